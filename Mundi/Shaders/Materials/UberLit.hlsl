@@ -26,6 +26,11 @@
 #define USE_CSM_DIRECTIONAL 0
 #endif
 
+/* Hardware instancing: 월드 행렬/UUID를 인스턴스 버퍼(t9)에서 읽음 */
+#ifndef USE_INSTANCING
+#define USE_INSTANCING 0
+#endif
+
 
 // 라이트 타입 구분용 상수 (HLSL은 enum class 미지원)
 static const uint ELightType_Ambient        = 0;
@@ -58,6 +63,9 @@ struct VS_INPUT
     float2 TexCoord : TEXCOORD0;
     float4 Tangent : TANGENT0;
     float4 Color : COLOR;
+#if USE_INSTANCING
+    uint InstanceID : SV_InstanceID;
+#endif
 };
 
 struct PS_INPUT
@@ -68,6 +76,9 @@ struct PS_INPUT
     row_major float3x3 TBN : TBN;
     float4 Color : COLOR;
     float2 TexCoord : TEXCOORD0;
+#if USE_INSTANCING
+    nointerpolation uint ObjectID : OBJECT_ID; // 인스턴스별 UUID (피킹)
+#endif
 };
 
 struct PS_OUTPUT
@@ -79,12 +90,30 @@ struct PS_OUTPUT
 // --- 상수 버퍼 (Constant Buffers) ---
 // 조명과 StaticMeshShader 기능을 모두 지원하도록 확장
 
+#if USE_INSTANCING
+// b0: InstanceBuffer (VS) - FInstanceBufferType과 일치. ModelBuffer 대신 인스턴스 버퍼 시작 위치를 받음
+cbuffer InstanceBuffer : register(b0)
+{
+    uint FirstInstance;
+};
+
+// t9: 인스턴스 버퍼 (VS) - FMeshInstanceData와 정확히 일치 (144 bytes)
+struct FInstanceData
+{
+    row_major float4x4 WorldMatrix;
+    row_major float4x4 WorldInverseTranspose;
+    uint ObjectID;
+    uint3 _padding;
+};
+StructuredBuffer<FInstanceData> g_InstanceData : register(t9);
+#else
 // b0: ModelBuffer (VS) - ModelBufferType과 정확히 일치 (128 bytes)
 cbuffer ModelBuffer : register(b0)
 {
     row_major float4x4 WorldMatrix; // 64 bytes
     row_major float4x4 WorldInverseTranspose; // 64 bytes - 올바른 노멀 변환을 위함
 };
+#endif
 
 // b1: ViewProjBuffer (VS) - ViewProjBufferType과 일치
 cbuffer ViewProjBuffer : register(b1)
@@ -656,6 +685,14 @@ PS_INPUT mainVS(VS_INPUT Input)
 {
     PS_INPUT Out;
 
+#if USE_INSTANCING
+    // SV_InstanceID는 StartInstanceLocation을 포함하지 않으므로 b0의 시작 위치를 더함
+    FInstanceData Instance = g_InstanceData[FirstInstance + Input.InstanceID];
+    float4x4 WorldMatrix = Instance.WorldMatrix;
+    float4x4 WorldInverseTranspose = Instance.WorldInverseTranspose;
+    Out.ObjectID = Instance.ObjectID;
+#endif
+
     // 위치를 월드 공간으로 먼저 변환
     float4 worldPos = mul(float4(Input.Position, 1.0f), WorldMatrix);
     Out.WorldPos = worldPos.xyz;
@@ -699,7 +736,11 @@ PS_INPUT mainVS(VS_INPUT Input)
 //================================================================================================
 PS_OUTPUT mainPS(PS_INPUT Input)
 {    PS_OUTPUT Output;
+#if USE_INSTANCING
+    Output.UUID = Input.ObjectID;
+#else
     Output.UUID = UUID;
+#endif
 
 #ifdef VIEWMODE_WORLD_NORMAL 
     // World Normal 시각화: Normal 벡터를 색상으로 변환
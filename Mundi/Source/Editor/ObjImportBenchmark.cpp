@@ -0,0 +1,352 @@
+﻿#include "pch.h"
+#include "ObjImportBenchmark.h"
+#include "CommandLineOptions.h"
+#include "ObjManager.h"
+#include "ObjParser.h"
+#include "PathUtils.h"
+#include "PlatformTime.h"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+	// FObjParser 도입 전 LoadObjModel의 지오메트리 파싱 루프 (로그/머티리얼 제외)
+	void LegacyParseObj(const FString& InFileName, bool bIsRightHanded, FObjInfo& OutObjInfo)
+	{
+		auto ParseVertexDef = [](const FString& InVertexDef, uint32 OutIndices[3])
+		{
+			std::stringstream ss(InVertexDef);
+			FString part;
+			uint32 temp_val;
+			for (int32 Component = 0; Component < 3; ++Component)
+			{
+				OutIndices[Component] = 0;
+				if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) OutIndices[Component] = temp_val - 1; } }
+			}
+		};
+
+		std::ifstream FileIn(UTF8ToWide(InFileName));
+		FString line;
+		while (std::getline(FileIn, line))
+		{
+			if (line.empty()) continue;
+
+			line.erase(0, line.find_first_not_of(" \t\n\r"));
+			if (line.empty() || line[0] == '#')
+				continue;
+
+			if (line.rfind("v ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(2));
+				float vx, vy, vz;
+				wss >> vx >> vy >> vz;
+				OutObjInfo.Positions.push_back(FVector(vx, bIsRightHanded ? -vy : vy, vz));
+			}
+			else if (line.rfind("vt ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(3));
+				float u, v;
+				wss >> u >> v;
+				OutObjInfo.TexCoords.push_back(FVector2D(u, 1.0f - v));
+			}
+			else if (line.rfind("vn ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(3));
+				float nx, ny, nz;
+				wss >> nx >> ny >> nz;
+				OutObjInfo.Normals.push_back(FVector(nx, bIsRightHanded ? -ny : ny, nz));
+			}
+			else if (line.rfind("f ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(2));
+				FString VertexDef;
+				TArray<std::array<uint32, 3>> LineFaceVertices;
+				while (wss >> VertexDef)
+				{
+					if (VertexDef[0] == '#')
+					{
+						break;
+					}
+					std::array<uint32, 3> FaceVertex;
+					ParseVertexDef(VertexDef, FaceVertex.data());
+					LineFaceVertices.push_back(FaceVertex);
+				}
+
+				for (size_t i = 1; i + 1 < LineFaceVertices.size(); ++i)
+				{
+					const size_t Order[3] = { 0, bIsRightHanded ? i + 1 : i, bIsRightHanded ? i : i + 1 };
+					for (size_t Corner : Order)
+					{
+						OutObjInfo.PositionIndices.push_back(LineFaceVertices[Corner][0]);
+						OutObjInfo.TexCoordIndices.push_back(LineFaceVertices[Corner][1]);
+						OutObjInfo.NormalIndices.push_back(LineFaceVertices[Corner][2]);
+					}
+				}
+			}
+			else if (line.rfind("usemtl ", 0) == 0)
+			{
+				OutObjInfo.MaterialNames.push_back(line.substr(7));
+				OutObjInfo.GroupIndexStartArray.push_back(static_cast<uint32>(OutObjInfo.PositionIndices.size()));
+			}
+		}
+	}
+
+	bool NearlyEqual(float A, float B)
+	{
+		return std::fabs(A - B) <= 1.0e-6f * std::max(1.0f, std::max(std::fabs(A), std::fabs(B)));
+	}
+
+	// 두 파서의 지오메트리 결과 비교 (실수는 변환 방식 차이로 마지막 비트가 다를 수 있어 상대 오차로 비교)
+	bool IsSameGeometry(const FObjInfo& A, const FObjInfo& B)
+	{
+		if (A.Positions.size() != B.Positions.size() || A.TexCoords.size() != B.TexCoords.size() || A.Normals.size() != B.Normals.size()
+			|| A.PositionIndices != B.PositionIndices || A.TexCoordIndices != B.TexCoordIndices || A.NormalIndices != B.NormalIndices
+			|| A.GroupIndexStartArray != B.GroupIndexStartArray || A.MaterialNames.size() != B.MaterialNames.size())
+		{
+			return false;
+		}
+		for (size_t i = 0; i < A.Positions.size(); ++i)
+		{
+			if (!NearlyEqual(A.Positions[i].X, B.Positions[i].X) || !NearlyEqual(A.Positions[i].Y, B.Positions[i].Y) || !NearlyEqual(A.Positions[i].Z, B.Positions[i].Z))
+			{
+				return false;
+			}
+		}
+		for (size_t i = 0; i < A.Normals.size(); ++i)
+		{
+			if (!NearlyEqual(A.Normals[i].X, B.Normals[i].X) || !NearlyEqual(A.Normals[i].Y, B.Normals[i].Y) || !NearlyEqual(A.Normals[i].Z, B.Normals[i].Z))
+			{
+				return false;
+			}
+		}
+		for (size_t i = 0; i < A.TexCoords.size(); ++i)
+		{
+			if (!NearlyEqual(A.TexCoords[i].X, B.TexCoords[i].X) || !NearlyEqual(A.TexCoords[i].Y, B.TexCoords[i].Y))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+FObjImportBenchmark::FObjImportBenchmark(const FObjImportBenchmarkConfig& InConfig)
+	: Config(InConfig)
+{
+}
+
+bool FObjImportBenchmark::ParseCommandLine(const FString& InCmdLine, FObjImportBenchmarkConfig& OutConfig)
+{
+	if (!FCommandLine::HasFlag(InCmdLine, "ObjImportBenchmark"))
+	{
+		return false;
+	}
+
+	FCommandLine::ParseIntOption(InCmdLine, "ObjSyntheticFaces", OutConfig.SyntheticFaceCount, 0);
+	FCommandLine::ParseIntOption(InCmdLine, "ObjImportRepeat", OutConfig.RepeatCount, 1);
+	OutConfig.bSkipLegacy = FCommandLine::HasFlag(InCmdLine, "ObjSkipLegacy");
+
+	FString Value;
+	if (FCommandLine::FindOption(InCmdLine, "ObjDataDir", Value))
+	{
+		OutConfig.DataDir = Value;
+	}
+	if (FCommandLine::FindOption(InCmdLine, "BenchmarkOutput", Value))
+	{
+		OutConfig.OutputDir = Value;
+	}
+	return true;
+}
+
+bool FObjImportBenchmark::Run()
+{
+	Results.Empty();
+
+	std::error_code ErrorCode;
+	std::filesystem::create_directories(Config.OutputDir, ErrorCode);
+
+	TArray<FString> ObjFiles;
+	for (std::filesystem::recursive_directory_iterator It(UTF8ToWide(Config.DataDir), ErrorCode), End; !ErrorCode && It != End; It.increment(ErrorCode))
+	{
+		if (It->is_regular_file() && It->path().extension() == ".obj")
+		{
+			ObjFiles.Add(NormalizePath(WideToUTF8(It->path().wstring())));
+		}
+	}
+	std::sort(ObjFiles.begin(), ObjFiles.end());
+
+	if (Config.SyntheticFaceCount > 0)
+	{
+		const FString SyntheticPath = WriteSyntheticObj(Config.SyntheticFaceCount);
+		if (!SyntheticPath.empty())
+		{
+			ObjFiles.Add(SyntheticPath);
+		}
+	}
+
+	for (const FString& ObjFile : ObjFiles)
+	{
+		RunFile(ObjFile);
+	}
+
+	const FString CSVPath = Config.OutputDir + "/ObjImportBenchmark.csv";
+	if (!WriteCSV(CSVPath))
+	{
+		UE_LOG("[ObjImportBenchmark] Failed to write results to %s", Config.OutputDir.c_str());
+		return false;
+	}
+	UE_LOG("[ObjImportBenchmark] %d results written to %s", static_cast<int32>(Results.Num()), Config.OutputDir.c_str());
+	return true;
+}
+
+void FObjImportBenchmark::RunFile(const FString& InFilePath)
+{
+	FObjImportBenchmarkResult Result;
+	Result.FileName = InFilePath;
+
+	// 파일 열기/매핑까지 포함한 시간 (OS 파일 캐시는 첫 반복에서 데워짐)
+	FObjInfo FastInfo;
+	double BestFastMS = (std::numeric_limits<double>::max)();
+	for (int32 Repeat = 0; Repeat < Config.RepeatCount; ++Repeat)
+	{
+		FastInfo = FObjInfo();
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		FMappedFile File;
+		if (!File.Open(InFilePath))
+		{
+			UE_LOG("[ObjImportBenchmark] Failed to open %s", InFilePath.c_str());
+			return;
+		}
+		FString MtlLibName;
+		FObjParser::ParseObj(File.GetData(), File.GetSize(), true, FastInfo, MtlLibName, InFilePath);
+		Result.FileBytes = static_cast<int64>(File.GetSize());
+		File.Close();
+		BestFastMS = std::min(BestFastMS, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	}
+	Result.FastMS = BestFastMS;
+	Result.TriangleCount = static_cast<int64>(FastInfo.PositionIndices.size() / 3);
+	Result.FastMBPerSecond = BestFastMS > 0.0 ? (static_cast<double>(Result.FileBytes) / (1024.0 * 1024.0)) / (BestFastMS / 1000.0) : 0.0;
+
+	if (!Config.bSkipLegacy)
+	{
+		FObjInfo LegacyInfo;
+		double BestLegacyMS = (std::numeric_limits<double>::max)();
+		for (int32 Repeat = 0; Repeat < Config.RepeatCount; ++Repeat)
+		{
+			LegacyInfo = FObjInfo();
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			LegacyParseObj(InFilePath, true, LegacyInfo);
+			BestLegacyMS = std::min(BestLegacyMS, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+		}
+		Result.LegacyMS = BestLegacyMS;
+		Result.bMatched = IsSameGeometry(LegacyInfo, FastInfo);
+	}
+
+	UE_LOG("[ObjImportBenchmark] %s (%.2f MB, %lld tris) Legacy=%.3fms Fast=%.3fms (%.1f MB/s)%s",
+		InFilePath.c_str(), static_cast<double>(Result.FileBytes) / (1024.0 * 1024.0), Result.TriangleCount,
+		Result.LegacyMS, Result.FastMS, Result.FastMBPerSecond, Result.bMatched ? "" : " MISMATCH");
+	Results.Add(Result);
+}
+
+FString FObjImportBenchmark::WriteSyntheticObj(int32 InFaceCount) const
+{
+	const FString FilePath = Config.OutputDir + "/Synthetic_" + std::to_string(InFaceCount) + ".obj";
+
+	// 이미 같은 크기로 만들어 둔 파일이 있으면 재사용
+	std::error_code ErrorCode;
+	if (std::filesystem::exists(UTF8ToWide(FilePath), ErrorCode))
+	{
+		return FilePath;
+	}
+
+	// 사각형 하나당 삼각형 2개인 (GridSize x GridSize) 격자. 마지막 행은 남은 삼각형 수만큼만 쓴다
+	const int32 QuadCount = (InFaceCount + 1) / 2;
+	const int32 GridSize = std::max(1, static_cast<int32>(std::ceil(std::sqrt(static_cast<double>(QuadCount)))));
+	const int32 VertexRow = GridSize + 1;
+
+	std::ofstream File(UTF8ToWide(FilePath), std::ios::binary);
+	if (!File.is_open())
+	{
+		UE_LOG("[ObjImportBenchmark] Failed to create %s", FilePath.c_str());
+		return FString();
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	FString Buffer;
+	Buffer.reserve(1 << 20);
+	char Line[160];
+	auto Flush = [&File, &Buffer](bool bForce)
+	{
+		if (bForce || Buffer.size() >= (1 << 20) - 160)
+		{
+			File.write(Buffer.data(), static_cast<std::streamsize>(Buffer.size()));
+			Buffer.clear();
+		}
+	};
+
+	Buffer += "# Synthetic OBJ for -ObjImportBenchmark\nmtllib Synthetic.mtl\nusemtl Default\n";
+	for (int32 Y = 0; Y < VertexRow; ++Y)
+	{
+		for (int32 X = 0; X < VertexRow; ++X)
+		{
+			const float U = static_cast<float>(X) / GridSize;
+			const float V = static_cast<float>(Y) / GridSize;
+			const float Height = 0.1f * std::sin(U * 31.0f) * std::cos(V * 17.0f);
+			Buffer.append(Line, std::snprintf(Line, sizeof(Line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn 0.000000 0.000000 1.000000\n",
+				U * 100.0f, V * 100.0f, Height, U, V));
+			Flush(false);
+		}
+	}
+
+	int32 Written = 0;
+	for (int32 Y = 0; Y < GridSize && Written < InFaceCount; ++Y)
+	{
+		for (int32 X = 0; X < GridSize && Written < InFaceCount; ++X)
+		{
+			const int32 I0 = Y * VertexRow + X + 1;
+			const int32 I1 = I0 + 1;
+			const int32 I2 = I0 + VertexRow;
+			const int32 I3 = I2 + 1;
+			Buffer.append(Line, std::snprintf(Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d\n", I0, I0, I0, I1, I1, I1, I3, I3, I3));
+			if (++Written < InFaceCount)
+			{
+				Buffer.append(Line, std::snprintf(Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d\n", I0, I0, I0, I3, I3, I3, I2, I2, I2));
+				++Written;
+			}
+			Flush(false);
+		}
+	}
+	Flush(true);
+
+	UE_LOG("[ObjImportBenchmark] Generated %s (%d tris) in %.1fms", FilePath.c_str(), Written,
+		FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	return FilePath;
+}
+
+bool FObjImportBenchmark::WriteCSV(const FString& InFilePath) const
+{
+	std::ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	File << "FileName,FileBytes,TriangleCount,LegacyMS,FastMS,FastMBPerSecond,Speedup,Matched\n";
+	File << std::fixed << std::setprecision(6);
+	for (const FObjImportBenchmarkResult& Result : Results)
+	{
+		File << Result.FileName << ','
+			<< Result.FileBytes << ','
+			<< Result.TriangleCount << ','
+			<< Result.LegacyMS << ','
+			<< Result.FastMS << ','
+			<< Result.FastMBPerSecond << ','
+			<< (Result.FastMS > 0.0 && Result.LegacyMS > 0.0 ? Result.LegacyMS / Result.FastMS : 0.0) << ','
+			<< (Result.bMatched ? 1 : 0) << '\n';
+	}
+	return true;
+}
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+/**
+ * @brief OBJ 임포트 벤치마크 설정. 커맨드라인(-ObjImportBenchmark ...)에서 채워집니다.
+ */
+struct FObjImportBenchmarkConfig
+{
+	FString DataDir = "Data";			// 하위 폴더까지 포함해 모든 .obj 측정
+	int32 SyntheticFaceCount = 10000000;	// 생성할 합성 OBJ의 삼각형 수 (0이면 생략)
+	int32 RepeatCount = 3;				// 파일별 반복 횟수 (가장 빠른 값을 기록)
+	bool bSkipLegacy = false;			// 기존 istringstream 파서 측정 생략 (큰 파일에서 오래 걸림)
+
+	FString OutputDir = "Saved/Benchmark";
+};
+
+/**
+ * @brief 측정 결과 한 줄 (CSV 한 행)
+ */
+struct FObjImportBenchmarkResult
+{
+	FString FileName;
+	int64 FileBytes = 0;
+	int64 TriangleCount = 0;
+	double LegacyMS = 0.0;		// getline + istringstream (기존 LoadObjModel), 생략 시 0
+	double FastMS = 0.0;		// 메모리 매핑 + 청크 병렬 파싱 (FObjParser)
+	double FastMBPerSecond = 0.0;
+	bool bMatched = true;		// 두 파서 결과가 같은지 (Legacy 생략 시 true)
+};
+
+/**
+ * @brief 기존 OBJ 지오메트리 파서와 FObjParser의 파일별 파싱 시간 비교
+ * Data 폴더의 .obj와 합성 대형 OBJ를 측정하고 결과를 CSV 로 저장합니다.
+ */
+class FObjImportBenchmark
+{
+public:
+	explicit FObjImportBenchmark(const FObjImportBenchmarkConfig& InConfig);
+
+	/**
+	 * @brief 커맨드라인에 -ObjImportBenchmark 가 있으면 설정을 채우고 true를 반환합니다.
+	 * 옵션: -ObjDataDir=Dir -ObjSyntheticFaces=N -ObjImportRepeat=N -ObjSkipLegacy -BenchmarkOutput=Dir
+	 */
+	static bool ParseCommandLine(const FString& InCmdLine, FObjImportBenchmarkConfig& OutConfig);
+
+	/** @return 측정을 마치고 CSV를 썼으면 true */
+	bool Run();
+
+	bool WriteCSV(const FString& InFilePath) const;
+
+	const TArray<FObjImportBenchmarkResult>& GetResults() const { return Results; }
+
+private:
+	void RunFile(const FString& InFilePath);
+
+	// 정점 격자로 InFaceCount개 삼각형을 가진 OBJ를 생성하고 경로를 반환. 실패 시 빈 문자열
+	FString WriteSyntheticObj(int32 InFaceCount) const;
+
+	FObjImportBenchmarkConfig Config;
+	TArray<FObjImportBenchmarkResult> Results;
+};
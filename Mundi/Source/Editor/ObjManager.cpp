@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "ObjManager.h"
+#include "ObjParser.h"
 #include "PathUtils.h"
 
 #include "ObjectIterator.h"
@@ -423,6 +424,9 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
 		MatWriter.Close();
 
+		// 메시 BVH 사이드카 캐시(.bvh.bin)가 이 경로를 기준으로 무효화 여부를 판단한다
+		NewFStaticMesh->CacheFilePath = BinPathFileName;
+
 		UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
 #endif // USE_OBJ_CACHE
 	}
@@ -548,26 +552,13 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FString& PathFileName)
 // obj File to FObjInfo, FMaterialParameters
 bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded)
 {
-	uint32 subsetCount = 0;
-	FString MtlFileName;
-
-	bool bHasTexcoord = false;
-	bool bHasNormal = false;
-	FString MaterialNameTemp;
-
-	FString Face;
-	uint32 VIndex = 0;
-	uint32 MeshTriangles = 0;
-
 	size_t pos = InFileName.find_last_of("/\\");
 	FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
 
 	// [안정성] .obj 파일이 존재하지 않으면 로드 실패를 반환합니다.
 	// 이는 필수 데이터이므로 더 이상 진행할 수 없습니다.
-	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
-	FWideString WPath = UTF8ToWide(InFileName);
-	std::ifstream FileIn(WPath);
-	if (!FileIn)
+	FMappedFile ObjFile;
+	if (!ObjFile.Open(InFileName))
 	{
 		UE_LOG("Error: The file '%s' does not exist!", InFileName.c_str());
 		return false;
@@ -575,139 +566,16 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 
 	OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
 
-	FString line;
-	while (std::getline(FileIn, line))
-	{
-		if (line.empty()) continue;
-
-		line.erase(0, line.find_first_not_of(" \t\n\r"));
-
-		if (line[0] == '#')
-			continue;
-
-		if (line.rfind("v ", 0) == 0) // 정점 좌표 (v x y z)
-		{
-			std::stringstream wss(line.substr(2));
-			float vx, vy, vz;
-			wss >> vx >> vy >> vz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, -vy, vz));
-			}
-			else
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, vy, vz));
-			}
-		}
-		else if (line.rfind("vt ", 0) == 0) // 텍스처 좌표 (vt u v)
-		{
-			std::stringstream wss(line.substr(3));
-			float u, v;
-			wss >> u >> v;
-			// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
-			v = 1.0f - v;
-			OutObjInfo->TexCoords.push_back(FVector2D(u, v));
-			bHasTexcoord = true;
-		}
-		else if (line.rfind("vn ", 0) == 0) // 법선 (vn x y z)
-		{
-			std::stringstream wss(line.substr(3));
-			float nx, ny, nz;
-			wss >> nx >> ny >> nz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, -ny, nz));
-			}
-			else
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, ny, nz));
-			}
-			bHasNormal = true;
-		}
-		else if (line.rfind("g ", 0) == 0) // 그룹 (g groupName)
-		{
-			// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
-		}
-		else if (line.rfind("s ", 0) == 0) // 스무딩 그룹 (s 1, s off)
-		{
-			// 스무딩 그룹은 현재 지원하지 않으므로 무시합니다.
-		}
-		else if (line.rfind("f ", 0) == 0) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
-		{
-			Face = line.substr(2);
-			if (Face.length() <= 0)
-			{
-				continue;
-			}
-
-			// Parse face line and trim at '#' or newline
-			std::stringstream wss(Face);
-			FString VertexDef;
-
-			TArray<FFaceVertex> LineFaceVertices;
-			while (wss >> VertexDef)
-			{
-				// '#'을 만나면 주석 처리 (이후 데이터 무시)
-				if (VertexDef[0] == '#')
-				{
-					break;
-				}
-
-				FFaceVertex FaceVertex = ParseVertexDef(VertexDef);
-				LineFaceVertices.push_back(FaceVertex);
-			}
-
-			// 4각형 이상의 폴리곤도 처리하기 위해서 for문으로 처리
-			for (uint32 i = 1; i < LineFaceVertices.size() - 1; ++i)
-			{
-				if (bIsRightHanded)
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-				}
-				else
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
+	// 지오메트리 파싱 (큰 파일은 청크 단위 병렬 파싱)
+	FString MtlLibName;
+	FObjParser::ParseObj(ObjFile.GetData(), ObjFile.GetSize(), bIsRightHanded, *OutObjInfo, MtlLibName, InFileName);
+	ObjFile.Close();
 
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-				}
-				VIndex += 3;
-				++MeshTriangles;
-			}
-		}
-		else if (line.rfind("mtllib ", 0) == 0)
-		{
-			MtlFileName = objDir + line.substr(7);
-		}
-		else if (line.rfind("usemtl ", 0) == 0)
-		{
-			MaterialNameTemp = line.substr(7);
-			OutObjInfo->MaterialNames.push_back(MaterialNameTemp);
-			OutObjInfo->GroupIndexStartArray.push_back(VIndex);
-			subsetCount++;
-		}
-		else
-		{
-			UE_LOG("While parsing the filename %s, the following unknown symbol was encountered: \'%s\'", InFileName.c_str(), line.c_str());
-		}
-	}
+	const bool bHasTexcoord = !OutObjInfo->TexCoords.empty();
+	const bool bHasNormal = !OutObjInfo->Normals.empty();
+	const uint32 VIndex = static_cast<uint32>(OutObjInfo->PositionIndices.size());
+	uint32 subsetCount = static_cast<uint32>(OutObjInfo->MaterialNames.size());
+	FString MtlFileName = MtlLibName.empty() ? FString() : objDir + MtlLibName;
 
 	if (subsetCount == 0)
 	{
@@ -731,8 +599,6 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 		OutObjInfo->TexCoords.push_back(FVector2D(0.0f, 0.0f));
 	}
 
-	FileIn.close();
-
 	// Material 파싱 시작
 	UE_LOG("[ObjImporter::LoadObjModel] MTL file path: %s", MtlFileName.c_str());
 
@@ -743,13 +609,10 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 		return true;
 	}
 
-	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
-	FWideString WMtlPath = UTF8ToWide(MtlFileName);
-	FileIn.open(WMtlPath);
-
 	// .mtl 파일이 존재하지 않더라도 로딩을 중단하지 않습니다.
 	// 경고를 로깅하고, 머티리얼이 없는 모델로 처리를 계속합니다.
-	if (!FileIn)
+	FMappedFile MtlFile;
+	if (!MtlFile.Open(MtlFileName))
 	{
 		UE_LOG("[ObjImporter::LoadObjModel] ERROR: Material file '%s' not found for obj '%s'. Loading model without materials.", MtlFileName.c_str(), InFileName.c_str());
 		OutObjInfo->bHasMtl = false;
@@ -758,81 +621,79 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 
 	UE_LOG("[ObjImporter::LoadObjModel] MTL file opened successfully, parsing materials...");
 
-	uint32 MatCount = 0;
-
 	TArray<FString> TempOptions;
 	FString TempTexturePath;
 
-	while (std::getline(FileIn, line))
+	auto ParseVector = [](const char* InArgs, const char* InEnd)
+	{
+		float X = 0.0f, Y = 0.0f, Z = 0.0f;
+		ObjText::ParseFloat(InArgs, InEnd, X);
+		ObjText::ParseFloat(InArgs, InEnd, Y);
+		ObjText::ParseFloat(InArgs, InEnd, Z);
+		return FVector(X, Y, Z);
+	};
+	auto ParseScalar = [](const char* InArgs, const char* InEnd)
 	{
-		if (line.empty()) continue;
+		float Value = 0.0f;
+		ObjText::ParseFloat(InArgs, InEnd, Value);
+		return Value;
+	};
+	// 텍스처 맵 라인은 키워드 뒤의 옵션/경로 토큰만 넘긴다
+	auto ParseTextureMap = [&TempOptions, &TempTexturePath](const char* InArgs, const char* InEnd)
+	{
+		ParseTextureMapLine(FString(InArgs, InEnd), 0, TempOptions, TempTexturePath);
+		return TempTexturePath;
+	};
+
+	const char* MtlEnd = MtlFile.GetData() + MtlFile.GetSize();
+	for (const char* Cursor = MtlFile.GetData(); Cursor && Cursor < MtlEnd;)
+	{
+		const char* LineEnd = ObjText::FindLineEnd(Cursor, MtlEnd);
+		const char* P = ObjText::SkipSpaces(Cursor, LineEnd);
+		const char* End = ObjText::TrimEnd(P, LineEnd);
+		Cursor = LineEnd < MtlEnd ? LineEnd + 1 : MtlEnd;
 
-		line.erase(0, line.find_first_not_of(" \t\n\r"));
-		if (line[0] == '#')
+		if (P == End || *P == '#')
 			continue;
 
-		if (line.rfind("newmtl ", 0) == 0)
+		if (const char* Args = ObjText::MatchKeyword(P, End, "newmtl"))
 		{
 			FMaterialInfo TempMatInfo;
-			TempMatInfo.MaterialName = line.substr(7);
+			TempMatInfo.MaterialName = FString(ObjText::SkipSpaces(Args, End), End);
 			OutMaterialInfos.push_back(TempMatInfo);
-			++MatCount;
 			UE_LOG("[ObjImporter::LoadObjModel] Found material: %s", TempMatInfo.MaterialName.c_str());
+			continue;
 		}
-		else if (MatCount > 0)
-		{
-			// (Kd, Ka 등 다른 속성 파싱은 변경 없음)
-			if (line.rfind("Kd ", 0) == 0) { std::stringstream wss(line.substr(3)); float vx, vy, vz; wss >> vx >> vy >> vz; OutMaterialInfos[MatCount - 1].DiffuseColor = FVector(vx, vy, vz); }
-			else if (line.rfind("Ka ", 0) == 0) { std::stringstream wss(line.substr(3)); float vx, vy, vz; wss >> vx >> vy >> vz; OutMaterialInfos[MatCount - 1].AmbientColor = FVector(vx, vy, vz); }
-			else if (line.rfind("Ke ", 0) == 0) { std::stringstream wss(line.substr(3)); float vx, vy, vz; wss >> vx >> vy >> vz; OutMaterialInfos[MatCount - 1].EmissiveColor = FVector(vx, vy, vz); }
-			else if (line.rfind("Ks ", 0) == 0) { std::stringstream wss(line.substr(3)); float vx, vy, vz; wss >> vx >> vy >> vz; OutMaterialInfos[MatCount - 1].SpecularColor = FVector(vx, vy, vz); }
-			else if (line.rfind("Tf ", 0) == 0) { std::stringstream wss(line.substr(3)); float vx, vy, vz; wss >> vx >> vy >> vz; OutMaterialInfos[MatCount - 1].TransmissionFilter = FVector(vx, vy, vz); }
-			else if (line.rfind("Tr ", 0) == 0) { std::stringstream wss(line.substr(3)); float value; wss >> value; OutMaterialInfos[MatCount - 1].Transparency = value; }
-			else if (line.rfind("d ", 0) == 0) { std::stringstream wss(line.substr(2)); float value; wss >> value; OutMaterialInfos[MatCount - 1].Transparency = 1.0f - value; }
-			else if (line.rfind("Ni ", 0) == 0) { std::stringstream wss(line.substr(3)); float value; wss >> value; OutMaterialInfos[MatCount - 1].OpticalDensity = value; }
-			else if (line.rfind("Ns ", 0) == 0) { std::stringstream wss(line.substr(3)); float value; wss >> value; OutMaterialInfos[MatCount - 1].SpecularExponent = value; }
-			else if (line.rfind("illum ", 0) == 0) { std::stringstream wss(line.substr(6)); float value; wss >> value; OutMaterialInfos[MatCount - 1].IlluminationModel = static_cast<int32>(value); }
-
-			// --- 텍스처 맵 파싱 로직 ---
-			else if (line.rfind("map_Kd ", 0) == 0)
-			{
-				ParseTextureMapLine(line, 7, TempOptions, TempTexturePath);
-				OutMaterialInfos[MatCount - 1].DiffuseTextureFileName = TempTexturePath;
-			}
-			else if (line.rfind("map_d ", 0) == 0)
-			{
-				ParseTextureMapLine(line, 7, TempOptions, TempTexturePath);
-				OutMaterialInfos[MatCount - 1].TransparencyTextureFileName = TempTexturePath;
-			}
-			else if (line.rfind("map_Ka ", 0) == 0)
-			{
-				ParseTextureMapLine(line, 7, TempOptions, TempTexturePath);
-				OutMaterialInfos[MatCount - 1].AmbientTextureFileName = TempTexturePath;
-			}
-			else if (line.rfind("map_Ks ", 0) == 0)
-			{
-				ParseTextureMapLine(line, 7, TempOptions, TempTexturePath);
-				OutMaterialInfos[MatCount - 1].SpecularTextureFileName = TempTexturePath;
-			}
-			else if (line.rfind("map_Ns ", 0) == 0)
-			{
-				ParseTextureMapLine(line, 7, TempOptions, TempTexturePath);
-				OutMaterialInfos[MatCount - 1].SpecularExponentTextureFileName = TempTexturePath;
-			}
-			else if (line.rfind("map_Ke ", 0) == 0)
-			{
-				ParseTextureMapLine(line, 7, TempOptions, TempTexturePath);
-				OutMaterialInfos[MatCount - 1].EmissiveTextureFileName = TempTexturePath;
-			}
-			else if (line.rfind("map_Bump ", 0) == 0)
-			{
-				ParseTextureMapLine(line, 9, TempOptions, TempTexturePath);
-				OutMaterialInfos[MatCount - 1].NormalTextureFileName = TempTexturePath;
-				OutMaterialInfos[MatCount - 1].BumpMultiplier = GetFloatOption(TempOptions, "-bm", 1.0f);
-			}
-		}
-	}
-	FileIn.close();
+		if (OutMaterialInfos.empty())
+			continue;
+
+		FMaterialInfo& MatInfo = OutMaterialInfos.back();
+		const char* Args = nullptr;
+		if ((Args = ObjText::MatchKeyword(P, End, "Kd"))) { MatInfo.DiffuseColor = ParseVector(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "Ka"))) { MatInfo.AmbientColor = ParseVector(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "Ke"))) { MatInfo.EmissiveColor = ParseVector(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "Ks"))) { MatInfo.SpecularColor = ParseVector(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "Tf"))) { MatInfo.TransmissionFilter = ParseVector(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "Tr"))) { MatInfo.Transparency = ParseScalar(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "d"))) { MatInfo.Transparency = 1.0f - ParseScalar(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "Ni"))) { MatInfo.OpticalDensity = ParseScalar(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "Ns"))) { MatInfo.SpecularExponent = ParseScalar(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "illum"))) { MatInfo.IlluminationModel = static_cast<int32>(ParseScalar(Args, End)); }
+
+		// --- 텍스처 맵 파싱 로직 ---
+		else if ((Args = ObjText::MatchKeyword(P, End, "map_Kd"))) { MatInfo.DiffuseTextureFileName = ParseTextureMap(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "map_d"))) { MatInfo.TransparencyTextureFileName = ParseTextureMap(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "map_Ka"))) { MatInfo.AmbientTextureFileName = ParseTextureMap(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "map_Ks"))) { MatInfo.SpecularTextureFileName = ParseTextureMap(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "map_Ns"))) { MatInfo.SpecularExponentTextureFileName = ParseTextureMap(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "map_Ke"))) { MatInfo.EmissiveTextureFileName = ParseTextureMap(Args, End); }
+		else if ((Args = ObjText::MatchKeyword(P, End, "map_Bump")))
+		{
+			MatInfo.NormalTextureFileName = ParseTextureMap(Args, End);
+			MatInfo.BumpMultiplier = GetFloatOption(TempOptions, "-bm", 1.0f);
+		}
+	}
+	MtlFile.Close();
 
 	for (uint32 i = 0; i < OutObjInfo->MaterialNames.size(); ++i)
 	{
@@ -966,17 +827,3 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		// else: InitialMaterialName은 비어있게 됨 (정상)
 	}
 }
-
-FObjImporter::FFaceVertex FObjImporter::ParseVertexDef(const FString& InVertexDef)
-{
-	FFaceVertex Result{ 0, 0, 0 };
-	std::stringstream ss(InVertexDef);
-	FString part;
-	uint32 temp_val;
-
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.PositionIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.TexCoordIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.NormalIndex = temp_val - 1; } }
-
-	return Result;
-}
@@ -48,11 +48,6 @@ public:
 	static bool LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded = true);
 
 	static void ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh);
-
-private:
-	struct FFaceVertex { uint32 PositionIndex, TexCoordIndex, NormalIndex; };
-
-	static FFaceVertex ParseVertexDef(const FString& InVertexDef);
 };
 
 class UStaticMesh;
@@ -0,0 +1,488 @@
+﻿#include "pch.h"
+#include "ObjParser.h"
+#include "ObjManager.h"
+#include "JobSystem.h"
+#include "PathUtils.h"
+
+#include <cstring>
+
+bool FMappedFile::Open(const FString& InPath)
+{
+	Close();
+
+	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
+	const FWideString WPath = UTF8ToWide(InPath);
+	FileHandle = CreateFileW(WPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (FileHandle == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER FileSize{};
+	if (!GetFileSizeEx(FileHandle, &FileSize))
+	{
+		Close();
+		return false;
+	}
+
+	Size = static_cast<size_t>(FileSize.QuadPart);
+	if (Size == 0)
+	{
+		// 빈 파일은 매핑할 수 없으므로 열린 상태로 데이터 없이 둔다
+		return true;
+	}
+
+	MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!MappingHandle)
+	{
+		Close();
+		return false;
+	}
+
+	Data = static_cast<const char*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+	if (!Data)
+	{
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void FMappedFile::Close()
+{
+	if (Data)
+	{
+		UnmapViewOfFile(Data);
+		Data = nullptr;
+	}
+	if (MappingHandle)
+	{
+		CloseHandle(MappingHandle);
+		MappingHandle = nullptr;
+	}
+	if (FileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(FileHandle);
+		FileHandle = INVALID_HANDLE_VALUE;
+	}
+	Size = 0;
+}
+
+namespace ObjText
+{
+	const char* FindLineEnd(const char* InCursor, const char* InEnd)
+	{
+		const void* NewLine = std::memchr(InCursor, '\n', static_cast<size_t>(InEnd - InCursor));
+		return NewLine ? static_cast<const char*>(NewLine) : InEnd;
+	}
+
+	bool ParseFloat(const char*& InOutCursor, const char* InEnd, float& OutValue)
+	{
+		// 10^22까지는 double로 정확히 표현되므로 유효 숫자가 2^53 이하면 곱/나눗셈 한 번으로 정확히 반올림된다 (Clinger fast path)
+		static constexpr double Pow10[] =
+		{
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		const char* Begin = SkipSpaces(InOutCursor, InEnd);
+		const char* P = Begin;
+
+		bool bNegative = false;
+		if (P < InEnd && (*P == '-' || *P == '+'))
+		{
+			bNegative = *P == '-';
+			++P;
+		}
+
+		uint64 Mantissa = 0;
+		int32 Exponent = 0;
+		int32 SignificantDigits = 0;
+		bool bAnyDigit = false;
+		bool bTruncated = false;
+
+		auto AccumulateDigit = [&](char C, bool bFraction)
+		{
+			bAnyDigit = true;
+			if (Mantissa == 0 && C == '0')
+			{
+				Exponent -= bFraction ? 1 : 0;
+				return;
+			}
+			if (SignificantDigits < 19)
+			{
+				Mantissa = Mantissa * 10 + static_cast<uint64>(C - '0');
+				++SignificantDigits;
+				Exponent -= bFraction ? 1 : 0;
+			}
+			else
+			{
+				bTruncated = true;
+				Exponent += bFraction ? 0 : 1;
+			}
+		};
+
+		while (P < InEnd && IsDigit(*P))
+		{
+			AccumulateDigit(*P++, false);
+		}
+		if (P < InEnd && *P == '.')
+		{
+			++P;
+			while (P < InEnd && IsDigit(*P))
+			{
+				AccumulateDigit(*P++, true);
+			}
+		}
+		if (!bAnyDigit)
+		{
+			return false;
+		}
+
+		if (P < InEnd && (*P == 'e' || *P == 'E'))
+		{
+			const char* ExponentCursor = P + 1;
+			bool bNegativeExponent = false;
+			if (ExponentCursor < InEnd && (*ExponentCursor == '-' || *ExponentCursor == '+'))
+			{
+				bNegativeExponent = *ExponentCursor == '-';
+				++ExponentCursor;
+			}
+			if (ExponentCursor < InEnd && IsDigit(*ExponentCursor))
+			{
+				int32 ExplicitExponent = 0;
+				while (ExponentCursor < InEnd && IsDigit(*ExponentCursor))
+				{
+					ExplicitExponent = std::min(ExplicitExponent * 10 + (*ExponentCursor - '0'), 100000);
+					++ExponentCursor;
+				}
+				Exponent += bNegativeExponent ? -ExplicitExponent : ExplicitExponent;
+				P = ExponentCursor;
+			}
+		}
+
+		double Value;
+		if (!bTruncated && Mantissa <= (1ull << 53) && Exponent >= -22 && Exponent <= 22)
+		{
+			Value = Exponent < 0 ? static_cast<double>(Mantissa) / Pow10[-Exponent] : static_cast<double>(Mantissa) * Pow10[Exponent];
+		}
+		else
+		{
+			// 드문 경우(유효 숫자가 많거나 지수가 큼)는 표준 변환에 맡긴다
+			char Buffer[128];
+			const size_t Length = std::min(static_cast<size_t>(P - Begin), sizeof(Buffer) - 1);
+			std::memcpy(Buffer, Begin, Length);
+			Buffer[Length] = '\0';
+			Value = std::fabs(std::strtod(Buffer, nullptr));
+		}
+
+		OutValue = static_cast<float>(bNegative ? -Value : Value);
+		InOutCursor = P;
+		return true;
+	}
+
+	bool ParseInt(const char*& InOutCursor, const char* InEnd, int32& OutValue)
+	{
+		const char* P = InOutCursor;
+		bool bNegative = false;
+		if (P < InEnd && (*P == '-' || *P == '+'))
+		{
+			bNegative = *P == '-';
+			++P;
+		}
+		if (P >= InEnd || !IsDigit(*P))
+		{
+			return false;
+		}
+
+		int64 Value = 0;
+		while (P < InEnd && IsDigit(*P))
+		{
+			Value = std::min<int64>(Value * 10 + (*P - '0'), INT32_MAX);
+			++P;
+		}
+
+		OutValue = static_cast<int32>(bNegative ? -Value : Value);
+		InOutCursor = P;
+		return true;
+	}
+}
+
+namespace
+{
+	struct FObjMaterialGroup
+	{
+		FString MaterialName;
+		uint32 LocalIndexStart = 0;
+	};
+
+	/** 청크 하나의 파싱 결과. 인덱스는 양수(절대)면 그대로, 음수(상대)면 청크 시작 기준 값으로 두고 Relative*Slots에 위치를 기록 */
+	struct FObjChunk
+	{
+		const char* Begin = nullptr;
+		const char* End = nullptr;
+
+		TArray<FVector> Positions;
+		TArray<FVector2D> TexCoords;
+		TArray<FVector> Normals;
+
+		TArray<uint32> PositionIndices;
+		TArray<uint32> TexCoordIndices;
+		TArray<uint32> NormalIndices;
+
+		TArray<uint32> RelativePositionSlots;
+		TArray<uint32> RelativeTexCoordSlots;
+		TArray<uint32> RelativeNormalSlots;
+
+		TArray<FObjMaterialGroup> MaterialGroups;
+		FString MtlLibName;
+	};
+
+	// 면 정점 하나 (v/vt/vn). 빠진 항목은 기존 로더처럼 0번을 가리킨다
+	struct FObjFaceVertex
+	{
+		uint32 Index[3] = { 0, 0, 0 };
+		bool bRelative[3] = { false, false, false };
+	};
+
+	// "v", "v/vt", "v//vn", "v/vt/vn" 하나를 읽는다. InLocalCounts는 지금까지 이 청크에서 읽은 v/vt/vn 개수
+	const char* ParseFaceVertex(const char* InCursor, const char* InEnd, const uint32 InLocalCounts[3], FObjFaceVertex& OutVertex)
+	{
+		for (int32 Component = 0; Component < 3; ++Component)
+		{
+			int32 Value = 0;
+			if (ObjText::ParseInt(InCursor, InEnd, Value) && Value != 0)
+			{
+				if (Value > 0)
+				{
+					OutVertex.Index[Component] = static_cast<uint32>(Value - 1);
+				}
+				else
+				{
+					OutVertex.Index[Component] = static_cast<uint32>(static_cast<int32>(InLocalCounts[Component]) + Value);
+					OutVertex.bRelative[Component] = true;
+				}
+			}
+
+			if (InCursor >= InEnd || *InCursor != '/')
+			{
+				break;
+			}
+			++InCursor;
+		}
+		return ObjText::SkipToken(InCursor, InEnd);
+	}
+
+	void PushFaceVertex(FObjChunk& InOutChunk, const FObjFaceVertex& InVertex)
+	{
+		TArray<uint32>* IndexArrays[3] = { &InOutChunk.PositionIndices, &InOutChunk.TexCoordIndices, &InOutChunk.NormalIndices };
+		TArray<uint32>* SlotArrays[3] = { &InOutChunk.RelativePositionSlots, &InOutChunk.RelativeTexCoordSlots, &InOutChunk.RelativeNormalSlots };
+		for (int32 Component = 0; Component < 3; ++Component)
+		{
+			if (InVertex.bRelative[Component])
+			{
+				SlotArrays[Component]->Add(static_cast<uint32>(IndexArrays[Component]->Num()));
+			}
+			IndexArrays[Component]->Add(InVertex.Index[Component]);
+		}
+	}
+
+	void ParseChunk(FObjChunk& InOutChunk, bool bIsRightHanded, const FString& InFileNameForLog)
+	{
+		const float YSign = bIsRightHanded ? -1.0f : 1.0f;
+		TArray<FObjFaceVertex> FaceVertices;
+
+		const char* Cursor = InOutChunk.Begin;
+		while (Cursor < InOutChunk.End)
+		{
+			const char* LineEnd = ObjText::FindLineEnd(Cursor, InOutChunk.End);
+			const char* P = ObjText::SkipSpaces(Cursor, LineEnd);
+			const char* End = ObjText::TrimEnd(P, LineEnd);
+			Cursor = LineEnd < InOutChunk.End ? LineEnd + 1 : InOutChunk.End;
+
+			if (P == End || *P == '#')
+			{
+				continue;
+			}
+
+			if (const char* Args = ObjText::MatchKeyword(P, End, "v")) // 정점 좌표 (v x y z)
+			{
+				float X = 0.0f, Y = 0.0f, Z = 0.0f;
+				ObjText::ParseFloat(Args, End, X);
+				ObjText::ParseFloat(Args, End, Y);
+				ObjText::ParseFloat(Args, End, Z);
+				InOutChunk.Positions.Add(FVector(X, Y * YSign, Z));
+			}
+			else if (const char* Args = ObjText::MatchKeyword(P, End, "vt")) // 텍스처 좌표 (vt u v)
+			{
+				float U = 0.0f, V = 0.0f;
+				ObjText::ParseFloat(Args, End, U);
+				ObjText::ParseFloat(Args, End, V);
+				// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
+				InOutChunk.TexCoords.Add(FVector2D(U, 1.0f - V));
+			}
+			else if (const char* Args = ObjText::MatchKeyword(P, End, "vn")) // 법선 (vn x y z)
+			{
+				float X = 0.0f, Y = 0.0f, Z = 0.0f;
+				ObjText::ParseFloat(Args, End, X);
+				ObjText::ParseFloat(Args, End, Y);
+				ObjText::ParseFloat(Args, End, Z);
+				InOutChunk.Normals.Add(FVector(X, Y * YSign, Z));
+			}
+			else if (const char* Args = ObjText::MatchKeyword(P, End, "f")) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
+			{
+				const uint32 LocalCounts[3] =
+				{
+					static_cast<uint32>(InOutChunk.Positions.Num()),
+					static_cast<uint32>(InOutChunk.TexCoords.Num()),
+					static_cast<uint32>(InOutChunk.Normals.Num())
+				};
+
+				FaceVertices.clear();
+				for (Args = ObjText::SkipSpaces(Args, End); Args < End && *Args != '#'; Args = ObjText::SkipSpaces(Args, End))
+				{
+					FObjFaceVertex FaceVertex;
+					Args = ParseFaceVertex(Args, End, LocalCounts, FaceVertex);
+					FaceVertices.Add(FaceVertex);
+				}
+
+				// 4각형 이상의 폴리곤은 팬으로 나눈다. 오른손 좌표계면 감김 순서를 뒤집는다
+				for (int32 i = 1; i + 1 < FaceVertices.Num(); ++i)
+				{
+					PushFaceVertex(InOutChunk, FaceVertices[0]);
+					PushFaceVertex(InOutChunk, FaceVertices[bIsRightHanded ? i + 1 : i]);
+					PushFaceVertex(InOutChunk, FaceVertices[bIsRightHanded ? i : i + 1]);
+				}
+			}
+			else if (ObjText::MatchKeyword(P, End, "g") || ObjText::MatchKeyword(P, End, "s"))
+			{
+				// 'usemtl' 기준으로 그룹을 나누므로 'g'는 무시, 스무딩 그룹은 지원하지 않음
+			}
+			else if (const char* Args = ObjText::MatchKeyword(P, End, "mtllib"))
+			{
+				Args = ObjText::SkipSpaces(Args, End);
+				InOutChunk.MtlLibName.assign(Args, End);
+			}
+			else if (const char* Args = ObjText::MatchKeyword(P, End, "usemtl"))
+			{
+				Args = ObjText::SkipSpaces(Args, End);
+				InOutChunk.MaterialGroups.Add({ FString(Args, End), static_cast<uint32>(InOutChunk.PositionIndices.Num()) });
+			}
+			else
+			{
+				UE_LOG("While parsing the filename %s, the following unknown symbol was encountered: \'%s\'",
+					InFileNameForLog.c_str(), FString(P, End).c_str());
+			}
+		}
+	}
+
+	// 청크 데이터를 전체 배열의 Offset 위치에 복사하고, 상대 인덱스에는 앞 청크들의 개수(Base)를 더한다
+	template<typename T>
+	void CopyChunkArray(const TArray<T>& InSource, TArray<T>& OutDest, size_t InOffset)
+	{
+		if (!InSource.empty())
+		{
+			std::copy(InSource.begin(), InSource.end(), OutDest.begin() + InOffset);
+		}
+	}
+
+	void CopyChunkIndices(const TArray<uint32>& InSource, const TArray<uint32>& InRelativeSlots, uint32 InBase, TArray<uint32>& OutDest, size_t InOffset)
+	{
+		CopyChunkArray(InSource, OutDest, InOffset);
+		for (uint32 Slot : InRelativeSlots)
+		{
+			OutDest[InOffset + Slot] = static_cast<uint32>(static_cast<int64>(static_cast<int32>(InSource[Slot])) + InBase);
+		}
+	}
+}
+
+void FObjParser::ParseObj(const char* InData, size_t InSize, bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlLibName, const FString& InFileNameForLog)
+{
+	OutMtlLibName.clear();
+	if (!InData || InSize == 0)
+	{
+		return;
+	}
+
+	const char* FileEnd = InData + InSize;
+	// UTF-8 BOM
+	if (InSize >= 3 && static_cast<uint8>(InData[0]) == 0xEF && static_cast<uint8>(InData[1]) == 0xBB && static_cast<uint8>(InData[2]) == 0xBF)
+	{
+		InData += 3;
+	}
+
+	// 줄 경계에 맞춰 청크 분할
+	TArray<FObjChunk> Chunks;
+	for (const char* ChunkBegin = InData; ChunkBegin < FileEnd;)
+	{
+		const char* ChunkEnd = FileEnd;
+		if (static_cast<size_t>(FileEnd - ChunkBegin) > ParallelChunkBytes)
+		{
+			ChunkEnd = ObjText::FindLineEnd(ChunkBegin + ParallelChunkBytes, FileEnd);
+			ChunkEnd = ChunkEnd < FileEnd ? ChunkEnd + 1 : FileEnd;
+		}
+
+		FObjChunk& Chunk = Chunks[Chunks.Emplace()];
+		Chunk.Begin = ChunkBegin;
+		Chunk.End = ChunkEnd;
+		ChunkBegin = ChunkEnd;
+	}
+
+	ParallelFor(Chunks.Num(), [&Chunks, bIsRightHanded, &InFileNameForLog](int32 ChunkIndex)
+	{
+		ParseChunk(Chunks[ChunkIndex], bIsRightHanded, InFileNameForLog);
+	}, 1);
+
+	// 청크별 시작 위치 (누적합)
+	struct FChunkBase
+	{
+		size_t Position = 0, TexCoord = 0, Normal = 0, Index = 0;
+	};
+	TArray<FChunkBase> Bases;
+	Bases.SetNum(Chunks.Num());
+
+	FChunkBase Total;
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+	{
+		const FObjChunk& Chunk = Chunks[ChunkIndex];
+		Bases[ChunkIndex] = Total;
+		Total.Position += Chunk.Positions.Num();
+		Total.TexCoord += Chunk.TexCoords.Num();
+		Total.Normal += Chunk.Normals.Num();
+		Total.Index += Chunk.PositionIndices.Num();
+
+		const size_t IndexBase = Bases[ChunkIndex].Index;
+		for (const FObjMaterialGroup& Group : Chunk.MaterialGroups)
+		{
+			OutObjInfo.MaterialNames.Add(Group.MaterialName);
+			OutObjInfo.GroupIndexStartArray.Add(static_cast<uint32>(IndexBase + Group.LocalIndexStart));
+		}
+		if (!Chunk.MtlLibName.empty())
+		{
+			OutMtlLibName = Chunk.MtlLibName;
+		}
+	}
+
+	OutObjInfo.Positions.resize(Total.Position);
+	OutObjInfo.TexCoords.resize(Total.TexCoord);
+	OutObjInfo.Normals.resize(Total.Normal);
+	OutObjInfo.PositionIndices.resize(Total.Index);
+	OutObjInfo.TexCoordIndices.resize(Total.Index);
+	OutObjInfo.NormalIndices.resize(Total.Index);
+
+	ParallelFor(Chunks.Num(), [&Chunks, &Bases, &OutObjInfo](int32 ChunkIndex)
+	{
+		FObjChunk& Chunk = Chunks[ChunkIndex];
+		const FChunkBase& Base = Bases[ChunkIndex];
+
+		CopyChunkArray(Chunk.Positions, OutObjInfo.Positions, Base.Position);
+		CopyChunkArray(Chunk.TexCoords, OutObjInfo.TexCoords, Base.TexCoord);
+		CopyChunkArray(Chunk.Normals, OutObjInfo.Normals, Base.Normal);
+		CopyChunkIndices(Chunk.PositionIndices, Chunk.RelativePositionSlots, static_cast<uint32>(Base.Position), OutObjInfo.PositionIndices, Base.Index);
+		CopyChunkIndices(Chunk.TexCoordIndices, Chunk.RelativeTexCoordSlots, static_cast<uint32>(Base.TexCoord), OutObjInfo.TexCoordIndices, Base.Index);
+		CopyChunkIndices(Chunk.NormalIndices, Chunk.RelativeNormalSlots, static_cast<uint32>(Base.Normal), OutObjInfo.NormalIndices, Base.Index);
+
+		// 청크 메모리는 바로 반납
+		Chunk = FObjChunk();
+	}, 1);
+}
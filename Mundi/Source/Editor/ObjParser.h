@@ -0,0 +1,101 @@
+﻿#pragma once
+
+#include <string_view>
+#include "UEContainer.h"
+
+struct FObjInfo;
+
+/**
+ * 읽기 전용 메모리 매핑 파일 (UTF-8 경로)
+ * 빈 파일도 열리며 이때 GetData()는 nullptr, GetSize()는 0이다.
+ */
+class FMappedFile
+{
+public:
+	FMappedFile() = default;
+	~FMappedFile() { Close(); }
+
+	FMappedFile(const FMappedFile&) = delete;
+	FMappedFile& operator=(const FMappedFile&) = delete;
+
+	bool Open(const FString& InPath);
+	void Close();
+
+	bool IsOpen() const { return FileHandle != INVALID_HANDLE_VALUE; }
+	const char* GetData() const { return Data; }
+	size_t GetSize() const { return Size; }
+
+private:
+	HANDLE FileHandle = INVALID_HANDLE_VALUE;
+	HANDLE MappingHandle = nullptr;
+	const char* Data = nullptr;
+	size_t Size = 0;
+};
+
+/**
+ * OBJ/MTL 텍스트용 스캐너. 모든 함수는 [Cursor, End) 범위만 읽으므로 널 종료가 없는 매핑 메모리에 바로 쓸 수 있다.
+ */
+namespace ObjText
+{
+	inline bool IsSpace(char C) { return C == ' ' || C == '\t' || C == '\r' || C == '\v' || C == '\f'; }
+	inline bool IsDigit(char C) { return C >= '0' && C <= '9'; }
+
+	inline const char* SkipSpaces(const char* InCursor, const char* InEnd)
+	{
+		while (InCursor < InEnd && IsSpace(*InCursor)) ++InCursor;
+		return InCursor;
+	}
+
+	inline const char* SkipToken(const char* InCursor, const char* InEnd)
+	{
+		while (InCursor < InEnd && !IsSpace(*InCursor)) ++InCursor;
+		return InCursor;
+	}
+
+	// 뒤쪽 공백(\r 포함)을 뺀 끝 위치
+	inline const char* TrimEnd(const char* InBegin, const char* InEnd)
+	{
+		while (InEnd > InBegin && IsSpace(InEnd[-1])) --InEnd;
+		return InEnd;
+	}
+
+	// 다음 '\n' 위치. 없으면 InEnd
+	const char* FindLineEnd(const char* InCursor, const char* InEnd);
+
+	// 줄 InCursor가 InKeyword로 시작하고 바로 뒤에 공백이 오면 공백 다음 위치를, 아니면 nullptr 반환
+	inline const char* MatchKeyword(const char* InCursor, const char* InEnd, std::string_view InKeyword)
+	{
+		if (static_cast<size_t>(InEnd - InCursor) <= InKeyword.size()
+			|| std::string_view(InCursor, InKeyword.size()) != InKeyword
+			|| !IsSpace(InCursor[InKeyword.size()]))
+		{
+			return nullptr;
+		}
+		return InCursor + InKeyword.size() + 1;
+	}
+
+	/** 앞 공백을 건너뛰고 실수 하나를 읽어 InOutCursor를 전진. 숫자가 없으면 false (커서 유지) */
+	bool ParseFloat(const char*& InOutCursor, const char* InEnd, float& OutValue);
+	/** 앞 공백 없이 부호 있는 정수 하나를 읽어 InOutCursor를 전진. 숫자가 없으면 false (커서 유지) */
+	bool ParseInt(const char*& InOutCursor, const char* InEnd, int32& OutValue);
+}
+
+/**
+ * OBJ 지오메트리 파서
+ * 파일을 ParallelChunkBytes 단위(줄 경계)로 나눠 청크마다 위치/UV/법선/면 인덱스를 따로 파싱한 뒤,
+ * 청크별 개수의 누적합으로 자리를 잡아 병렬로 합친다. 음수(상대) 인덱스는 청크 기준으로 기록했다가 합칠 때 보정한다.
+ * 결과는 기존 istringstream 파서와 같은 FObjInfo이므로 이후 ConvertToStaticMesh / .bin 캐시는 그대로 쓴다.
+ */
+struct FObjParser
+{
+	static constexpr size_t ParallelChunkBytes = 4 * 1024 * 1024;
+
+	/**
+	 * @param InData / InSize .obj 파일 내용
+	 * @param bIsRightHanded true면 Y를 뒤집어 왼손 좌표계로 변환 (기존 로더와 동일)
+	 * @param OutObjInfo Positions/TexCoords/Normals/*Indices/MaterialNames/GroupIndexStartArray를 채운다 (그룹 후처리는 호출자 몫)
+	 * @param OutMtlLibName 마지막 mtllib 줄의 파일 이름 (.obj 기준 상대 경로), 없으면 빈 문자열
+	 * @param InFileNameForLog 알 수 없는 줄을 로그로 남길 때 쓸 파일 이름
+	 */
+	static void ParseObj(const char* InData, size_t InSize, bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlLibName, const FString& InFileNameForLog);
+};
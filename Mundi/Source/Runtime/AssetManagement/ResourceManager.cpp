@@ -138,11 +138,71 @@ FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const FSta
         return nullptr;
 
     FMeshBVH* NewBVH = new FMeshBVH();
+    const uint32 TriangleCount = static_cast<uint32>(StaticMeshAsset->Indices.Num() / 3);
+
+#ifdef USE_OBJ_CACHE
+    // 메시 캐시(.bin) 옆의 사이드카(.bvh.bin)가 메시 캐시보다 새것이면 빌드 없이 그대로 읽는다
+    FString BVHCachePath;
+    if (!StaticMeshAsset->CacheFilePath.empty())
+    {
+        BVHCachePath = GetMeshBVHCachePath(StaticMeshAsset->CacheFilePath);
+        if (IsMeshBVHCacheValid(BVHCachePath, StaticMeshAsset->CacheFilePath)
+            && NewBVH->LoadCache(BVHCachePath, TriangleCount))
+        {
+            MeshBVHCache.Add(ObjPath, NewBVH);
+            UE_LOG("MeshBVH: %s loaded from cache (%d nodes)", ObjPath.c_str(), NewBVH->GetBuildStats().NodeCount);
+            return NewBVH;
+        }
+    }
+#endif // USE_OBJ_CACHE
+
     NewBVH->Build(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
     MeshBVHCache.Add(ObjPath, NewBVH);
+
+    const FMeshBVHBuildStats& Stats = NewBVH->GetBuildStats();
+    UE_LOG("MeshBVH: %s (%d tris) -> %d nodes, SAH %.2f, %.2fms", ObjPath.c_str(), TriangleCount, Stats.NodeCount, Stats.SAHCost, Stats.BuildMS);
+
+#ifdef USE_OBJ_CACHE
+    if (!BVHCachePath.empty())
+    {
+        NewBVH->SaveCache(BVHCachePath);
+    }
+#endif // USE_OBJ_CACHE
     return NewBVH;
 }
 
+FString UResourceManager::GetMeshBVHCachePath(const FString& MeshCachePath)
+{
+    // "Foo.obj.bin" -> "Foo.obj.bvh.bin"
+    const FString BinExtension = ".bin";
+    FString BasePath = MeshCachePath;
+    if (BasePath.size() > BinExtension.size()
+        && BasePath.compare(BasePath.size() - BinExtension.size(), BinExtension.size(), BinExtension) == 0)
+    {
+        BasePath.resize(BasePath.size() - BinExtension.size());
+    }
+    return BasePath + ".bvh.bin";
+}
+
+bool UResourceManager::IsMeshBVHCacheValid(const FString& BVHCachePath, const FString& MeshCachePath)
+{
+    namespace fs = std::filesystem;
+
+    // 메시 캐시가 재생성되면(.obj/.mtl 변경) 사이드카가 더 오래된 파일이 되어 자동으로 무효화된다
+    std::error_code Error;
+    if (!fs::exists(BVHCachePath, Error) || !fs::exists(MeshCachePath, Error))
+        return false;
+
+    const auto BVHTimestamp = fs::last_write_time(BVHCachePath, Error);
+    if (Error)
+        return false;
+    const auto MeshTimestamp = fs::last_write_time(MeshCachePath, Error);
+    if (Error)
+        return false;
+
+    return BVHTimestamp >= MeshTimestamp;
+}
+
 void UResourceManager::SetStaticMeshs()
 {
     StaticMeshs = GetAll<UStaticMesh>();
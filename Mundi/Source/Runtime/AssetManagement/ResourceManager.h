@@ -118,6 +118,10 @@ protected:
 	TMap<FWideString, FShader*> ShaderList;
 
 private:
+	// 메시 BVH 사이드카 캐시 경로 ("Foo.obj.bin" -> "Foo.obj.bvh.bin") / 메시 캐시 대비 최신 여부
+	static FString GetMeshBVHCachePath(const FString& MeshCachePath);
+	static bool IsMeshBVHCacheValid(const FString& BVHCachePath, const FString& MeshCachePath);
+
 	// --- 비공개 멤버 변수 ---
 	TMap<FString, UMaterial*> MaterialMap;
 
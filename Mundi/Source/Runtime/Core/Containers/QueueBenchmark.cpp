@@ -0,0 +1,278 @@
+﻿#include "pch.h"
+#include "QueueBenchmark.h"
+#include "CommandLineOptions.h"
+#include "HashUtils.h"
+#include "PlatformTime.h"
+
+#include <filesystem>
+#include <iomanip>
+
+namespace
+{
+	/**
+	 * @brief 비교 기준이 되는 mutex 보호 큐. TQueue 와 같은 Enqueue/Dequeue 시그니처를 가짐
+	 */
+	template<typename T>
+	class TMutexQueue
+	{
+	public:
+		explicit TMutexQueue(uint32 InCapacity)
+			: Capacity(InCapacity)
+		{
+		}
+
+		bool Enqueue(const T& Item)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			if (Queue.size() >= Capacity)
+			{
+				return false;
+			}
+			Queue.push(Item);
+			return true;
+		}
+
+		bool Dequeue(T& OutItem)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			if (Queue.empty())
+			{
+				return false;
+			}
+			OutItem = Queue.front();
+			Queue.pop();
+			return true;
+		}
+
+	private:
+		std::mutex Mutex;
+		std::queue<T> Queue;
+		size_t Capacity;
+	};
+
+	template<typename QueueType>
+	std::unique_ptr<QueueType> CreateQueue(uint32 InCapacity)
+	{
+		// Mpsc 는 크기 제한이 없어 용량 인자를 받지 않음
+		if constexpr (std::is_constructible_v<QueueType, uint32>)
+		{
+			return std::make_unique<QueueType>(InCapacity);
+		}
+		else
+		{
+			return std::make_unique<QueueType>();
+		}
+	}
+}
+
+FQueueBenchmark::FQueueBenchmark(const FQueueBenchmarkConfig& InConfig)
+	: Config(InConfig)
+{
+}
+
+bool FQueueBenchmark::ParseCommandLine(const FString& InCmdLine, FQueueBenchmarkConfig& OutConfig)
+{
+	if (!FCommandLine::HasFlag(InCmdLine, "QueueBenchmark"))
+	{
+		return false;
+	}
+
+	FCommandLine::ParseIntOption(InCmdLine, "QueueItems", OutConfig.ItemCount);
+	FCommandLine::ParseIntOption(InCmdLine, "QueueThreads", OutConfig.ThreadCount);
+	FCommandLine::ParseIntOption(InCmdLine, "QueueCapacity", OutConfig.Capacity);
+	FCommandLine::ParseIntOption(InCmdLine, "QueueRepeat", OutConfig.RepeatCount);
+
+	FString Value;
+	if (FCommandLine::FindOption(InCmdLine, "BenchmarkOutput", Value))
+	{
+		OutConfig.OutputDir = Value;
+	}
+	return true;
+}
+
+bool FQueueBenchmark::Run()
+{
+	Results.Empty();
+
+	const int32 Threads = Config.ThreadCount;
+
+	RunScenario<TQueue<uint64, EQueueMode::Spsc>>("Spsc", "LockFree", 1, 1);
+	RunScenario<TMutexQueue<uint64>>("Spsc", "Mutex", 1, 1);
+
+	RunScenario<TQueue<uint64, EQueueMode::Mpsc>>("Mpsc", "LockFree", Threads, 1);
+	RunScenario<TMutexQueue<uint64>>("Mpsc", "Mutex", Threads, 1);
+
+	RunScenario<TQueue<uint64, EQueueMode::Spmc>>("Spmc", "LockFree", 1, Threads);
+	RunScenario<TMutexQueue<uint64>>("Spmc", "Mutex", 1, Threads);
+
+	RunScenario<TQueue<uint64, EQueueMode::Mpmc>>("Mpmc", "LockFree", Threads, Threads);
+	RunScenario<TMutexQueue<uint64>>("Mpmc", "Mutex", Threads, Threads);
+
+	std::error_code ErrorCode;
+	std::filesystem::create_directories(Config.OutputDir, ErrorCode);
+
+	const FString CSVPath = Config.OutputDir + "/QueueBenchmark.csv";
+	if (!WriteCSV(CSVPath))
+	{
+		UE_LOG("[QueueBenchmark] Failed to write results to %s", Config.OutputDir.c_str());
+		return false;
+	}
+	UE_LOG("[QueueBenchmark] %d results written to %s", static_cast<int32>(Results.Num()), Config.OutputDir.c_str());
+
+	for (const FQueueBenchmarkResult& Result : Results)
+	{
+		if (!Result.bValid)
+		{
+			UE_LOG("[QueueBenchmark] FAILED: items were lost or duplicated");
+			return false;
+		}
+	}
+	return true;
+}
+
+template<typename QueueType>
+void FQueueBenchmark::RunScenario(const FString& InScenario, const FString& InQueue, int32 InProducerCount, int32 InConsumerCount)
+{
+	const uint64 ItemCount = static_cast<uint64>(Config.ItemCount);
+
+	FQueueBenchmarkResult Result;
+	Result.Scenario = InScenario;
+	Result.Queue = InQueue;
+	Result.ProducerCount = InProducerCount;
+	Result.ConsumerCount = InConsumerCount;
+	Result.ItemCount = Config.ItemCount;
+	Result.TotalMS = (std::numeric_limits<double>::max)();
+
+	// 유실/중복 검사 기준값 (1..ItemCount 를 정확히 한 번씩)
+	// 합만으로는 유실과 중복이 서로 상쇄될 수 있어 값마다 다른 해시의 합도 함께 검사
+	const uint64 ExpectedChecksum = ItemCount * (ItemCount + 1) / 2;
+	uint64 ExpectedHashSum = 0;
+	for (uint64 Value = 1; Value <= ItemCount; ++Value)
+	{
+		ExpectedHashSum += HashMix64(Value);
+	}
+
+	for (int32 Repeat = 0; Repeat < Config.RepeatCount; ++Repeat)
+	{
+		std::unique_ptr<QueueType> Queue = CreateQueue<QueueType>(static_cast<uint32>(Config.Capacity));
+
+		std::atomic<bool> bStart{ false };
+		std::atomic<int32> RemainingProducers{ InProducerCount };
+		std::atomic<uint64> Checksum{ 0 };
+		std::atomic<uint64> HashSum{ 0 };
+		std::atomic<uint64> ReceivedCount{ 0 };
+
+		TArray<std::thread> Threads;
+		Threads.Reserve(InProducerCount + InConsumerCount);
+
+		// 생산자 p 는 p+1, p+1+P, p+1+2P ... 를 넣어 전체적으로 1..ItemCount 를 한 번씩 전달
+		for (int32 p = 0; p < InProducerCount; ++p)
+		{
+			Threads.Emplace([&, p]()
+			{
+				while (!bStart.load(std::memory_order_acquire))
+				{
+					std::this_thread::yield();
+				}
+				for (uint64 Value = p + 1; Value <= ItemCount; Value += InProducerCount)
+				{
+					while (!Queue->Enqueue(Value))
+					{
+						std::this_thread::yield();
+					}
+				}
+				RemainingProducers.fetch_sub(1, std::memory_order_release);
+			});
+		}
+
+		for (int32 c = 0; c < InConsumerCount; ++c)
+		{
+			Threads.Emplace([&]()
+			{
+				while (!bStart.load(std::memory_order_acquire))
+				{
+					std::this_thread::yield();
+				}
+				uint64 LocalSum = 0;
+				uint64 LocalHashSum = 0;
+				uint64 LocalCount = 0;
+				uint64 Value = 0;
+				for (;;)
+				{
+					// 생산자 종료를 먼저 확인해야 Dequeue 실패가 "정말 비었음" 을 의미함
+					const bool bProducersDone = RemainingProducers.load(std::memory_order_acquire) == 0;
+					if (Queue->Dequeue(Value))
+					{
+						LocalSum += Value;
+						LocalHashSum += HashMix64(Value);
+						++LocalCount;
+					}
+					else if (bProducersDone)
+					{
+						break;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+				Checksum.fetch_add(LocalSum, std::memory_order_relaxed);
+				HashSum.fetch_add(LocalHashSum, std::memory_order_relaxed);
+				ReceivedCount.fetch_add(LocalCount, std::memory_order_relaxed);
+			});
+		}
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		bStart.store(true, std::memory_order_release);
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+		const double ElapsedMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+		Result.TotalMS = std::min(Result.TotalMS, ElapsedMS);
+		Result.Checksum = Checksum.load();
+
+		// 반복마다 검사 (마지막 반복만 보면 앞선 유실을 놓침)
+		const uint64 Received = ReceivedCount.load();
+		if (Received != ItemCount || Result.Checksum != ExpectedChecksum || HashSum.load() != ExpectedHashSum)
+		{
+			UE_LOG("[QueueBenchmark] %s/%s repeat %d lost or duplicated items: received %llu of %llu, checksum %llu (expected %llu)",
+				InScenario.c_str(), InQueue.c_str(), Repeat,
+				static_cast<unsigned long long>(Received), static_cast<unsigned long long>(ItemCount),
+				static_cast<unsigned long long>(Result.Checksum), static_cast<unsigned long long>(ExpectedChecksum));
+			Result.bValid = false;
+		}
+	}
+
+	Results.Add(Result);
+
+	UE_LOG("[QueueBenchmark] %-5s %-8s P=%-2d C=%-2d N=%-8d %.3fms %.2fM items/s",
+		Result.Scenario.c_str(), Result.Queue.c_str(), Result.ProducerCount, Result.ConsumerCount,
+		Result.ItemCount, Result.TotalMS, Result.GetItemsPerSecond() / 1000000.0);
+}
+
+bool FQueueBenchmark::WriteCSV(const FString& InFilePath) const
+{
+	std::ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	File << "Scenario,Queue,Producers,Consumers,ItemCount,TotalMS,ItemsPerSecond,Checksum,Valid\n";
+	File << std::fixed << std::setprecision(6);
+	for (const FQueueBenchmarkResult& Result : Results)
+	{
+		File << Result.Scenario << ','
+			<< Result.Queue << ','
+			<< Result.ProducerCount << ','
+			<< Result.ConsumerCount << ','
+			<< Result.ItemCount << ','
+			<< Result.TotalMS << ','
+			<< Result.GetItemsPerSecond() << ','
+			<< Result.Checksum << ','
+			<< (Result.bValid ? 1 : 0) << '\n';
+	}
+	return true;
+}
@@ -0,0 +1,64 @@
+﻿#pragma once
+
+/**
+ * @brief 큐 벤치마크 설정. 커맨드라인(-QueueBenchmark ...)에서 채워집니다.
+ */
+struct FQueueBenchmarkConfig
+{
+	int32 ItemCount = 1000000;		// 시나리오 하나에서 전달할 요소 수
+	int32 ThreadCount = 4;			// Mpsc/Mpmc/Spmc 시나리오의 다중 측 스레드 수
+	int32 Capacity = 1024;			// 고정 크기 큐(Spsc/Mpmc/Spmc)의 용량
+	int32 RepeatCount = 3;			// 시나리오별 반복 횟수 (가장 빠른 값을 기록)
+
+	FString OutputDir = "Saved/Benchmark";
+};
+
+/**
+ * @brief 측정 결과 한 줄 (CSV 한 행)
+ */
+struct FQueueBenchmarkResult
+{
+	FString Scenario;		// Spsc / Mpsc / Mpmc / Spmc
+	FString Queue;			// LockFree / Mutex
+	int32 ProducerCount = 0;
+	int32 ConsumerCount = 0;
+	int32 ItemCount = 0;
+	double TotalMS = 0.0;
+	// 전달된 값의 합. 1..ItemCount 의 합과 다르면 유실/중복이 있다는 뜻
+	uint64 Checksum = 0;
+	// 모든 반복에서 개수/합/해시 합이 기대값과 같았는지
+	bool bValid = true;
+
+	double GetItemsPerSecond() const { return TotalMS > 0.0 ? ItemCount / (TotalMS * 0.001) : 0.0; }
+};
+
+/**
+ * @brief TQueue 모드별 처리량 벤치마크
+ * 같은 생산자/소비자 구성에서 락프리 TQueue 특수화와 std::mutex 로 보호한 std::queue 를 비교하고
+ * 결과를 CSV 로 저장합니다.
+ */
+class FQueueBenchmark
+{
+public:
+	explicit FQueueBenchmark(const FQueueBenchmarkConfig& InConfig);
+
+	/**
+	 * @brief 커맨드라인에 -QueueBenchmark 가 있으면 설정을 채우고 true를 반환합니다.
+	 * 옵션: -QueueItems=N -QueueThreads=N -QueueCapacity=N -QueueRepeat=N -BenchmarkOutput=Dir
+	 */
+	static bool ParseCommandLine(const FString& InCmdLine, FQueueBenchmarkConfig& OutConfig);
+
+	/** @return 모든 시나리오에서 유실/중복이 없고 결과를 저장했으면 true */
+	bool Run();
+
+	bool WriteCSV(const FString& InFilePath) const;
+
+	const TArray<FQueueBenchmarkResult>& GetResults() const { return Results; }
+
+private:
+	template<typename QueueType>
+	void RunScenario(const FString& InScenario, const FString& InQueue, int32 InProducerCount, int32 InConsumerCount);
+
+	FQueueBenchmarkConfig Config;
+	TArray<FQueueBenchmarkResult> Results;
+};
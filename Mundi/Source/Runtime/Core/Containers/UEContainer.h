@@ -389,10 +389,11 @@ using TDoubleLinkedList = std::list<T>;
 /** 큐 모드 열거형 */
 enum class EQueueMode
 {
-    Spsc,           /** Single Producer Single Consumer (기본 FIFO) */
-    Mpmc,           /** Multiple Producer Multiple Consumer */
-    Mpsc,           /** Multiple Producer Single Consumer */
-    Spmc,           /** Single Producer Multiple Consumer */
+    Single,         /** 단일 스레드 FIFO (동기화 없음, 크기 제한 없음) */
+    Spsc,           /** Single Producer Single Consumer (고정 크기 링 버퍼) */
+    Mpmc,           /** Multiple Producer Multiple Consumer (고정 크기, 셀 단위 시퀀스) */
+    Mpsc,           /** Multiple Producer Single Consumer (Vyukov 노드 큐, 크기 제한 없음) */
+    Spmc,           /** Single Producer Multiple Consumer (Mpmc 구현 사용) */
     Priority        /** Priority Queue */
 };
 
@@ -406,8 +407,22 @@ struct TDefaultCompare
     }
 };
 
-/** 기본 TQueue - FIFO 큐 */
-template<typename T, EQueueMode Mode = EQueueMode::Spsc, typename Compare = TDefaultCompare<T>>
+/** 생산자/소비자 인덱스가 같은 캐시 라인을 공유하지 않도록 하는 정렬 단위 */
+constexpr size_t QueueCacheLineSize = 64;
+
+/** 요청 용량 이상의 2의 거듭제곱 (인덱스 마스킹용) */
+inline uint32 GetQueueCapacity(uint32 InCapacity)
+{
+    uint32 Capacity = 2;
+    while (Capacity < InCapacity)
+    {
+        Capacity <<= 1;
+    }
+    return Capacity;
+}
+
+/** 기본 TQueue - 단일 스레드 FIFO 큐 */
+template<typename T, EQueueMode Mode = EQueueMode::Single, typename Compare = TDefaultCompare<T>>
 class TQueue : public std::queue<T>
 {
 public:
@@ -461,6 +476,465 @@ public:
     }
 };
 
+/**
+ * SPSC 특수화 - 고정 크기 락프리 링 버퍼
+ * Enqueue는 생산자 스레드 하나, Dequeue/Peek/Empty는 소비자 스레드 하나에서만 호출해야 합니다.
+ * 가득 차면 Enqueue가 false를 반환합니다.
+ */
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Spsc, Compare>
+{
+public:
+    explicit TQueue(uint32 InCapacity = 1024)
+        : Buffer(GetQueueCapacity(InCapacity))
+        , Mask(static_cast<uint32>(Buffer.size()) - 1)
+    {
+    }
+
+    TQueue(const TQueue&) = delete;
+    TQueue& operator=(const TQueue&) = delete;
+
+    /** 요소 추가 (생산자 전용) */
+    bool Enqueue(const T& Item)
+    {
+        const uint32 Tail = TailIndex.load(std::memory_order_relaxed);
+        if (Tail - CachedHead > Mask)
+        {
+            // 캐시된 Head로 가득 찬 것처럼 보일 때만 소비자 쪽 캐시 라인을 읽음
+            CachedHead = HeadIndex.load(std::memory_order_acquire);
+            if (Tail - CachedHead > Mask)
+            {
+                return false;
+            }
+        }
+
+        Buffer[Tail & Mask] = Item;
+        TailIndex.store(Tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** 요소 제거 (소비자 전용) */
+    bool Dequeue(T& OutItem)
+    {
+        const uint32 Head = HeadIndex.load(std::memory_order_relaxed);
+        if (Head == CachedTail)
+        {
+            CachedTail = TailIndex.load(std::memory_order_acquire);
+            if (Head == CachedTail)
+            {
+                return false;
+            }
+        }
+
+        OutItem = std::move(Buffer[Head & Mask]);
+        HeadIndex.store(Head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** 맨 앞 요소 확인 (소비자 전용) */
+    bool Peek(T& OutItem) const
+    {
+        const uint32 Head = HeadIndex.load(std::memory_order_relaxed);
+        if (Head == CachedTail)
+        {
+            CachedTail = TailIndex.load(std::memory_order_acquire);
+            if (Head == CachedTail)
+            {
+                return false;
+            }
+        }
+
+        OutItem = Buffer[Head & Mask];
+        return true;
+    }
+
+    /** 다른 스레드가 동작 중이면 근사값 */
+    int32 Num() const
+    {
+        const uint32 Head = HeadIndex.load(std::memory_order_acquire);
+        const uint32 Tail = TailIndex.load(std::memory_order_acquire);
+        return static_cast<int32>(Tail - Head);
+    }
+
+    bool IsEmpty() const
+    {
+        return Num() == 0;
+    }
+
+    /** 남은 요소를 모두 버림 (소비자 전용) */
+    void Empty()
+    {
+        T Discard;
+        while (Dequeue(Discard))
+        {
+        }
+    }
+
+    int32 GetCapacity() const
+    {
+        return static_cast<int32>(Mask + 1);
+    }
+
+private:
+    std::vector<T> Buffer;
+    uint32 Mask;
+
+    // 소비자 영역
+    alignas(QueueCacheLineSize) std::atomic<uint32> HeadIndex{ 0 };
+    mutable uint32 CachedTail = 0;
+
+    // 생산자 영역
+    alignas(QueueCacheLineSize) std::atomic<uint32> TailIndex{ 0 };
+    uint32 CachedHead = 0;
+};
+
+/**
+ * MPMC 특수화 - 셀마다 시퀀스 번호를 둔 고정 크기 락프리 큐 (Vyukov bounded MPMC)
+ * 생산자/소비자 모두 CAS 한 번으로 슬롯을 확보하고, 가득 차면 Enqueue가 false를 반환합니다.
+ */
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Mpmc, Compare>
+{
+public:
+    explicit TQueue(uint32 InCapacity = 1024)
+        : Mask(GetQueueCapacity(InCapacity) - 1)
+        , Cells(new FCell[Mask + 1])
+    {
+        for (uint32 i = 0; i <= Mask; ++i)
+        {
+            Cells[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    TQueue(const TQueue&) = delete;
+    TQueue& operator=(const TQueue&) = delete;
+
+    bool Enqueue(const T& Item)
+    {
+        FCell* Cell = nullptr;
+        uint32 Pos = EnqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell = &Cells[Pos & Mask];
+            const uint32 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+            const int32 Diff = static_cast<int32>(Sequence - Pos);
+            if (Diff == 0)
+            {
+                if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (Diff < 0)
+            {
+                // 한 바퀴 전 값이 아직 소비되지 않음 = 가득 참
+                return false;
+            }
+            else
+            {
+                Pos = EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        Cell->Data = Item;
+        Cell->Sequence.store(Pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Dequeue(T& OutItem)
+    {
+        FCell* Cell = nullptr;
+        uint32 Pos = DequeuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell = &Cells[Pos & Mask];
+            const uint32 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+            const int32 Diff = static_cast<int32>(Sequence - (Pos + 1));
+            if (Diff == 0)
+            {
+                if (DequeuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (Diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                Pos = DequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        OutItem = std::move(Cell->Data);
+        Cell->Sequence.store(Pos + Mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** 맨 앞 요소 확인. 다른 소비자가 동시에 Dequeue 하지 않을 때만 값이 유효합니다. */
+    bool Peek(T& OutItem) const
+    {
+        const uint32 Pos = DequeuePos.load(std::memory_order_relaxed);
+        const FCell& Cell = Cells[Pos & Mask];
+        if (Cell.Sequence.load(std::memory_order_acquire) != Pos + 1)
+        {
+            return false;
+        }
+
+        OutItem = Cell.Data;
+        return true;
+    }
+
+    /** 다른 스레드가 동작 중이면 근사값 */
+    int32 Num() const
+    {
+        const uint32 Head = DequeuePos.load(std::memory_order_acquire);
+        const uint32 Tail = EnqueuePos.load(std::memory_order_acquire);
+        const int32 Count = static_cast<int32>(Tail - Head);
+        return Count > 0 ? Count : 0;
+    }
+
+    bool IsEmpty() const
+    {
+        return Num() == 0;
+    }
+
+    void Empty()
+    {
+        T Discard;
+        while (Dequeue(Discard))
+        {
+        }
+    }
+
+    int32 GetCapacity() const
+    {
+        return static_cast<int32>(Mask + 1);
+    }
+
+private:
+    struct FCell
+    {
+        std::atomic<uint32> Sequence{ 0 };
+        T Data{};
+    };
+
+    uint32 Mask;
+    std::unique_ptr<FCell[]> Cells;
+
+    alignas(QueueCacheLineSize) std::atomic<uint32> EnqueuePos{ 0 };
+    alignas(QueueCacheLineSize) std::atomic<uint32> DequeuePos{ 0 };
+};
+
+/**
+ * SPMC 특수화 - 생산자가 하나여도 소비자 간 경쟁은 MPMC와 같으므로 같은 구현을 사용
+ * (생산자 CAS는 경쟁이 없어 한 번에 성공)
+ */
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Spmc, Compare> : public TQueue<T, EQueueMode::Mpmc, Compare>
+{
+public:
+    using TQueue<T, EQueueMode::Mpmc, Compare>::TQueue;
+};
+
+/**
+ * MPSC 특수화 - Vyukov 노드 기반 큐
+ * Enqueue는 어느 스레드에서나 대기 없이 (exchange 한 번) 가능하고 크기 제한이 없습니다.
+ * Dequeue/Peek/Empty는 소비자 스레드 하나에서만 호출해야 합니다.
+ * 생산자가 Head를 교체한 뒤 Next를 잇기 전 짧은 구간에는 Dequeue가 false를 반환할 수 있습니다.
+ *
+ * 노드는 큐가 소유한 슬랩에서 꺼내 쓰고, 소비된 노드는 큐 내부 프리 리스트로 돌아갑니다.
+ * 프리 리스트가 빌 때(동시에 살아 있는 원소 수가 최대치를 넘을 때)만 슬랩을 새로 할당하므로
+ * 정상 상태의 Enqueue/Dequeue 경로에는 힙 할당이 없습니다.
+ * 프리 리스트는 여러 생산자가 꺼내므로 ABA를 막기 위해 포인터 상위 16비트에 태그를 붙입니다. (x64 48비트 주소 가정)
+ */
+template<typename T, typename Compare>
+class TQueue<T, EQueueMode::Mpsc, Compare>
+{
+public:
+    TQueue()
+    {
+        FNode* Stub = AllocateNode();
+        Head.store(Stub, std::memory_order_relaxed);
+        Tail = Stub;
+    }
+
+    ~TQueue()
+    {
+        Empty();
+        for (FNode* Slab : Slabs)
+        {
+            delete[] Slab;
+        }
+    }
+
+    TQueue(const TQueue&) = delete;
+    TQueue& operator=(const TQueue&) = delete;
+
+    bool Enqueue(const T& Item)
+    {
+        FNode* Node = AllocateNode();
+        Node->Data = Item;
+        Node->Next.store(nullptr, std::memory_order_relaxed);
+
+        FNode* Prev = Head.exchange(Node, std::memory_order_acq_rel);
+        Prev->Next.store(Node, std::memory_order_release);
+        Count.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /** 소비자 전용 */
+    bool Dequeue(T& OutItem)
+    {
+        FNode* Next = Tail->Next.load(std::memory_order_acquire);
+        if (!Next)
+        {
+            return false;
+        }
+
+        // Next가 새 더미 노드가 되고 기존 더미는 프리 리스트로 반환
+        // (Next가 이어졌으므로 기존 더미를 건드리는 생산자는 더 없음)
+        OutItem = std::move(Next->Data);
+        FNode* OldTail = Tail;
+        Tail = Next;
+        ReleaseNode(OldTail);
+        Count.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /** 소비자 전용 */
+    bool Peek(T& OutItem) const
+    {
+        FNode* Next = Tail->Next.load(std::memory_order_acquire);
+        if (!Next)
+        {
+            return false;
+        }
+
+        OutItem = Next->Data;
+        return true;
+    }
+
+    /** 다른 스레드가 동작 중이면 근사값 */
+    int32 Num() const
+    {
+        const int32 Value = Count.load(std::memory_order_relaxed);
+        return Value > 0 ? Value : 0;
+    }
+
+    bool IsEmpty() const
+    {
+        return Tail->Next.load(std::memory_order_acquire) == nullptr;
+    }
+
+    /** 소비자 전용 */
+    void Empty()
+    {
+        T Discard;
+        while (Dequeue(Discard))
+        {
+        }
+    }
+
+    /** @return 지금까지 할당한 노드 수 (슬랩 합계). 프리 리스트 재사용 확인용 */
+    int32 GetAllocatedNodeCount() const
+    {
+        std::lock_guard<std::mutex> Lock(SlabMutex);
+        return AllocatedNodeCount;
+    }
+
+private:
+    struct FNode
+    {
+        std::atomic<FNode*> Next{ nullptr };
+        std::atomic<FNode*> NextFree{ nullptr };
+        T Data{};
+    };
+
+    static_assert(sizeof(void*) == 8, "TQueue<Mpsc> 프리 리스트 태그는 64비트 포인터를 가정합니다.");
+    static constexpr uint64 FreePointerMask = (uint64(1) << 48) - 1;
+    static constexpr uint64 FreeTagIncrement = uint64(1) << 48;
+    static constexpr int32 MinSlabNodeCount = 64;
+    static constexpr int32 MaxSlabNodeCount = 4096;
+
+    static FNode* GetFreePointer(uint64 InTop)
+    {
+        return reinterpret_cast<FNode*>(InTop & FreePointerMask);
+    }
+
+    static uint64 MakeFreeTop(uint64 InPrevTop, FNode* InNode)
+    {
+        return ((InPrevTop & ~FreePointerMask) + FreeTagIncrement) | static_cast<uint64>(reinterpret_cast<uintptr_t>(InNode));
+    }
+
+    /** 생산자/생성자: 프리 리스트에서 노드 하나를 꺼내고, 비었으면 슬랩을 새로 할당 */
+    FNode* AllocateNode()
+    {
+        uint64 Top = FreeTop.load(std::memory_order_acquire);
+        while (FNode* Node = GetFreePointer(Top))
+        {
+            // Node가 다른 생산자에게 먼저 꺼내졌어도 슬랩은 큐 수명 동안 해제되지 않으므로 읽기는 안전하고,
+            // 태그가 바뀌어 아래 CAS가 실패함
+            FNode* NextFree = Node->NextFree.load(std::memory_order_relaxed);
+            if (FreeTop.compare_exchange_weak(Top, MakeFreeTop(Top, NextFree), std::memory_order_acquire, std::memory_order_acquire))
+            {
+                return Node;
+            }
+        }
+        return AllocateSlab();
+    }
+
+    /** [InFirst, InLast] 체인을 프리 리스트 맨 앞에 잇습니다. */
+    void PushFreeChain(FNode* InFirst, FNode* InLast)
+    {
+        uint64 Top = FreeTop.load(std::memory_order_relaxed);
+        do
+        {
+            InLast->NextFree.store(GetFreePointer(Top), std::memory_order_relaxed);
+        } while (!FreeTop.compare_exchange_weak(Top, MakeFreeTop(Top, InFirst), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void ReleaseNode(FNode* InNode)
+    {
+        PushFreeChain(InNode, InNode);
+    }
+
+    FNode* AllocateSlab()
+    {
+        std::lock_guard<std::mutex> Lock(SlabMutex);
+
+        const int32 SlabNodeCount = std::min(MaxSlabNodeCount, std::max(MinSlabNodeCount, AllocatedNodeCount));
+        FNode* Slab = new FNode[SlabNodeCount];
+        Slabs.push_back(Slab);
+        AllocatedNodeCount += SlabNodeCount;
+
+        // 첫 노드는 호출자에게, 나머지는 한 번의 CAS로 프리 리스트에 연결
+        for (int32 i = 1; i + 1 < SlabNodeCount; ++i)
+        {
+            Slab[i].NextFree.store(&Slab[i + 1], std::memory_order_relaxed);
+        }
+        if (SlabNodeCount > 1)
+        {
+            PushFreeChain(&Slab[1], &Slab[SlabNodeCount - 1]);
+        }
+        return &Slab[0];
+    }
+
+    // 생산자 영역
+    alignas(QueueCacheLineSize) std::atomic<FNode*> Head{ nullptr };
+    std::atomic<int32> Count{ 0 };
+
+    // 노드 풀 (생산자가 꺼내고 소비자가 반환)
+    alignas(QueueCacheLineSize) std::atomic<uint64> FreeTop{ 0 };
+    mutable std::mutex SlabMutex;
+    std::vector<FNode*> Slabs;
+    int32 AllocatedNodeCount = 0;
+
+    // 소비자 영역
+    alignas(QueueCacheLineSize) FNode* Tail = nullptr;
+};
+
 /** Priority Queue를 위한 특수화 - 기본 비교자 */
 template<typename T>
 class TQueue<T, EQueueMode::Priority, TDefaultCompare<T>> : public std::priority_queue<T>
@@ -574,6 +1048,11 @@ static inline FString ToUtf8(const FString& Ansi)
 {
     if (Ansi.empty()) return {};
 
+#ifndef _WIN32
+    // Windows 외 환경(독립 테스트 빌드)은 로캘이 UTF-8이므로 변환 없음
+    return Ansi;
+#else
+
     // ANSI -> Wide
     int WideLen = MultiByteToWideChar(CP_ACP, 0, Ansi.c_str(), -1, nullptr, 0);
     FWideString Wide(static_cast<size_t>(WideLen - 1), L'\0');
@@ -584,4 +1063,5 @@ static inline FString ToUtf8(const FString& Ansi)
     FString Utf8(static_cast<size_t>(Utf8Len - 1), '\0');
     WideCharToMultiByte(CP_UTF8, 0, Wide.c_str(), -1, Utf8.data(), Utf8Len, nullptr, nullptr);
     return Utf8;
+#endif
 }
\ No newline at end of file
@@ -1,44 +1,344 @@
 ﻿#include "pch.h"
 #include "MemoryManager.h"
 #include <cstddef>
+#include <cstring>
 
-uint32 CMemoryManager::TotalAllocationBytes = 0;
-uint32 CMemoryManager::TotalAllocationCount = 0;
-
-void* CMemoryManager::Allocate(size_t size)
+namespace
 {
-    size_t totalSize = size + sizeof(size_t);
+    constexpr size_t NumSizeClasses = CMemoryManager::MaxSlabBlockSize / CMemoryManager::SizeClassGranularity;
+
+    // 스레드 캐시가 이보다 많이 들고 있으면 ThreadCacheBatch개를 풀로 돌려보내고, 비면 그만큼 한 번에 가져온다
+    constexpr int32 ThreadCacheCapacity = 32;
+    constexpr int32 ThreadCacheBatch = 16;
+
+    constexpr uint8 GuardPattern = 0xFD;
+    constexpr uint8 FreedPattern = 0xDD;
+
+    struct FFreeBlock
+    {
+        FFreeBlock* Next;
+    };
+
+    std::atomic<uint64> GLiveBytes{ 0 };
+    std::atomic<uint64> GPeakBytes{ 0 };
+    std::atomic<uint32> GLiveCount{ 0 };
+    std::atomic<uint32> GPeakCount{ 0 };
+    std::atomic<uint32> GSlabCount{ 0 };
+    std::atomic<uint64> GSlabReservedBytes{ 0 };
+    std::atomic<uint64> GSlabUsedBytes{ 0 };
+    std::atomic<uint64> GLargeLiveBytes{ 0 };
+    std::atomic<bool> GThreadCacheEnabled{ true };
+
+    template<typename T>
+    void UpdatePeak(std::atomic<T>& Peak, T Value)
+    {
+        T Previous = Peak.load(std::memory_order_relaxed);
+        while (Previous < Value && !Peak.compare_exchange_weak(Previous, Value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void* AllocateRaw(size_t Size)
+    {
 #if defined(_MSC_VER) && defined(_DEBUG)
-    void* raw = _malloc_dbg(totalSize, _NORMAL_BLOCK, nullptr, 0);
+        return _malloc_dbg(Size, _NORMAL_BLOCK, nullptr, 0);
 #else
-    void* raw = std::malloc(totalSize);
+        return std::malloc(Size);
 #endif
-    if (!raw)
+    }
+
+    void FreeRaw(void* Ptr)
+    {
+#if defined(_MSC_VER) && defined(_DEBUG)
+        _free_dbg(Ptr, _NORMAL_BLOCK);
+#else
+        std::free(Ptr);
+#endif
+    }
+
+    /** 크기 클래스 하나의 블록 풀 */
+    struct FSlabPool
+    {
+        std::mutex Mutex;
+        FFreeBlock* FreeList = nullptr;
+        size_t BlockSize = 0;
+        TArray<void*> Slabs;
+
+        // 새 슬랩을 블록으로 잘라 프리 리스트 앞에 붙인다. Mutex를 잡은 상태에서 호출
+        bool Refill()
+        {
+            const size_t BlockCount = std::max<size_t>(CMemoryManager::SlabBytes / BlockSize, 16);
+            const size_t Bytes = BlockCount * BlockSize;
+            unsigned char* Slab = static_cast<unsigned char*>(AllocateRaw(Bytes));
+            if (!Slab)
+            {
+                return false;
+            }
+
+            Slabs.Add(Slab);
+            GSlabCount.fetch_add(1, std::memory_order_relaxed);
+            GSlabReservedBytes.fetch_add(Bytes, std::memory_order_relaxed);
+
+            // 앞쪽 블록이 먼저 나가도록 뒤에서부터 연결
+            for (size_t i = BlockCount; i-- > 0;)
+            {
+                FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Slab + i * BlockSize);
+                Block->Next = FreeList;
+                FreeList = Block;
+            }
+            return true;
+        }
+
+        // 최대 InCount개를 꺼내 OutHead 리스트로 넘긴다. 꺼낸 개수 반환
+        int32 PopBatch(FFreeBlock*& OutHead, int32 InCount)
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            if (!FreeList && !Refill())
+            {
+                return 0;
+            }
+
+            int32 Count = 0;
+            while (FreeList && Count < InCount)
+            {
+                FFreeBlock* Block = FreeList;
+                FreeList = Block->Next;
+                Block->Next = OutHead;
+                OutHead = Block;
+                ++Count;
+            }
+            return Count;
+        }
+
+        // InFirst..InLast로 이어진 블록들을 한 번에 돌려받는다
+        void PushBatch(FFreeBlock* InFirst, FFreeBlock* InLast)
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            InLast->Next = FreeList;
+            FreeList = InFirst;
+        }
+    };
+
+    FSlabPool* GetPools()
+    {
+        // 스레드 캐시의 반납이 정적 객체 소멸보다 늦을 수 있어 풀은 일부러 해제하지 않는다
+        static FSlabPool* Pools = []()
+        {
+            FSlabPool* NewPools = new FSlabPool[NumSizeClasses];
+            for (size_t i = 0; i < NumSizeClasses; ++i)
+            {
+                NewPools[i].BlockSize = (i + 1) * CMemoryManager::SizeClassGranularity;
+            }
+            return NewPools;
+        }();
+        return Pools;
+    }
+
+    /** 스레드별 크기 클래스 캐시. 스레드가 끝나면 남은 블록을 풀로 돌려준다 */
+    struct FThreadCache
+    {
+        FFreeBlock* Heads[NumSizeClasses] = {};
+        int32 Counts[NumSizeClasses] = {};
+
+        ~FThreadCache()
+        {
+            for (size_t i = 0; i < NumSizeClasses; ++i)
+            {
+                if (Heads[i])
+                {
+                    FFreeBlock* Last = Heads[i];
+                    while (Last->Next)
+                    {
+                        Last = Last->Next;
+                    }
+                    GetPools()[i].PushBatch(Heads[i], Last);
+                    Heads[i] = nullptr;
+                    Counts[i] = 0;
+                }
+            }
+        }
+    };
+
+    thread_local FThreadCache GThreadCache;
+
+    void* AllocateBlock(size_t InClassIndex)
+    {
+        FSlabPool& Pool = GetPools()[InClassIndex];
+        if (GThreadCacheEnabled.load(std::memory_order_relaxed))
+        {
+            FThreadCache& Cache = GThreadCache;
+            if (!Cache.Heads[InClassIndex])
+            {
+                Cache.Counts[InClassIndex] += Pool.PopBatch(Cache.Heads[InClassIndex], ThreadCacheBatch);
+                if (!Cache.Heads[InClassIndex])
+                {
+                    return nullptr;
+                }
+            }
+
+            FFreeBlock* Block = Cache.Heads[InClassIndex];
+            Cache.Heads[InClassIndex] = Block->Next;
+            --Cache.Counts[InClassIndex];
+            return Block;
+        }
+
+        FFreeBlock* Block = nullptr;
+        Pool.PopBatch(Block, 1);
+        return Block;
+    }
+
+    void FreeBlock(void* InBlock, size_t InClassIndex)
+    {
+        FFreeBlock* Block = static_cast<FFreeBlock*>(InBlock);
+        FSlabPool& Pool = GetPools()[InClassIndex];
+        if (GThreadCacheEnabled.load(std::memory_order_relaxed))
+        {
+            FThreadCache& Cache = GThreadCache;
+            Block->Next = Cache.Heads[InClassIndex];
+            Cache.Heads[InClassIndex] = Block;
+            if (++Cache.Counts[InClassIndex] <= ThreadCacheCapacity)
+            {
+                return;
+            }
+
+            // 앞쪽 ThreadCacheBatch개를 잘라 풀로 반납
+            FFreeBlock* First = Cache.Heads[InClassIndex];
+            FFreeBlock* Last = First;
+            for (int32 i = 1; i < ThreadCacheBatch; ++i)
+            {
+                Last = Last->Next;
+            }
+            Cache.Heads[InClassIndex] = Last->Next;
+            Cache.Counts[InClassIndex] -= ThreadCacheBatch;
+            Pool.PushBatch(First, Last);
+            return;
+        }
+
+        Pool.PushBatch(Block, Block);
+    }
+
+    size_t GetSizeClassIndex(size_t InBlockSize)
+    {
+        return (InBlockSize + CMemoryManager::SizeClassGranularity - 1) / CMemoryManager::SizeClassGranularity - 1;
+    }
+}
+
+void* CMemoryManager::Allocate(size_t Size, UClass* InClass)
+{
+    const size_t BlockSize = Size + GuardBytes * 2;
+    const bool bSlab = BlockSize <= MaxSlabBlockSize;
+
+    unsigned char* Raw = nullptr;
+    size_t RoundedSize = BlockSize;
+    if (bSlab)
+    {
+        const size_t ClassIndex = GetSizeClassIndex(BlockSize);
+        RoundedSize = (ClassIndex + 1) * SizeClassGranularity;
+        Raw = static_cast<unsigned char*>(AllocateBlock(ClassIndex));
+    }
+    else
+    {
+        Raw = static_cast<unsigned char*>(AllocateRaw(BlockSize));
+    }
+
+    if (!Raw)
         return nullptr;
 
-    *reinterpret_cast<size_t*>(raw) = size;
-    TotalAllocationBytes += static_cast<uint32>(size);
-    TotalAllocationCount++;
+#if MEMORY_GUARD_ENABLED
+    std::memset(Raw, GuardPattern, GuardBytes);
+    std::memset(Raw + GuardBytes + Size, GuardPattern, GuardBytes);
+#endif
+
+    if (bSlab)
+    {
+        GSlabUsedBytes.fetch_add(RoundedSize, std::memory_order_relaxed);
+    }
+    else
+    {
+        GLargeLiveBytes.fetch_add(BlockSize, std::memory_order_relaxed);
+    }
+    UpdatePeak(GPeakBytes, GLiveBytes.fetch_add(Size, std::memory_order_relaxed) + Size);
+    UpdatePeak(GPeakCount, GLiveCount.fetch_add(1, std::memory_order_relaxed) + 1);
+
+    if (InClass)
+    {
+        FClassMemoryStats& Stats = InClass->MemoryStats;
+        UpdatePeak(Stats.PeakCount, Stats.LiveCount.fetch_add(1, std::memory_order_relaxed) + 1);
+        Stats.LiveBytes.fetch_add(Size, std::memory_order_relaxed);
+        Stats.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
 
-    return static_cast<void*>(static_cast<unsigned char*>(raw) + sizeof(size_t));
+    return Raw + GuardBytes;
 }
 
-void CMemoryManager::Deallocate(void* ptr)
+void CMemoryManager::Deallocate(void* Ptr, size_t Size, UClass* InClass)
 {
-    if (!ptr)
+    if (!Ptr)
         return;
 
-    unsigned char* userPtr = static_cast<unsigned char*>(ptr);
-    unsigned char* raw = userPtr - sizeof(size_t);
-    size_t size = *reinterpret_cast<size_t*>(raw);
+    unsigned char* Raw = static_cast<unsigned char*>(Ptr) - GuardBytes;
+    const size_t BlockSize = Size + GuardBytes * 2;
 
-    TotalAllocationBytes -= static_cast<uint32>(size);
-    TotalAllocationCount--;
-#if defined(_MSC_VER) && defined(_DEBUG)
-    _free_dbg(raw, _NORMAL_BLOCK);
-#else
-    std::free(raw);
+#if MEMORY_GUARD_ENABLED
+    bool bGuardIntact = true;
+    for (size_t i = 0; i < GuardBytes; ++i)
+    {
+        bGuardIntact &= Raw[i] == GuardPattern;
+        bGuardIntact &= Raw[GuardBytes + Size + i] == GuardPattern;
+    }
+    if (!bGuardIntact)
+    {
+        UE_LOG("[Memory] Guard bytes overwritten: %s (%zu bytes) at %p",
+            InClass && InClass->Name ? InClass->Name : "Unknown", Size, Ptr);
+        assert(false && "UObject memory guard overwritten");
+    }
+    std::memset(Raw, FreedPattern, BlockSize);
 #endif
+
+    if (InClass)
+    {
+        FClassMemoryStats& Stats = InClass->MemoryStats;
+        Stats.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+        Stats.LiveBytes.fetch_sub(Size, std::memory_order_relaxed);
+    }
+    GLiveBytes.fetch_sub(Size, std::memory_order_relaxed);
+    GLiveCount.fetch_sub(1, std::memory_order_relaxed);
+
+    if (BlockSize <= MaxSlabBlockSize)
+    {
+        const size_t ClassIndex = GetSizeClassIndex(BlockSize);
+        GSlabUsedBytes.fetch_sub((ClassIndex + 1) * SizeClassGranularity, std::memory_order_relaxed);
+        FreeBlock(Raw, ClassIndex);
+    }
+    else
+    {
+        GLargeLiveBytes.fetch_sub(BlockSize, std::memory_order_relaxed);
+        FreeRaw(Raw);
+    }
+}
+
+void CMemoryManager::SetThreadCacheEnabled(bool bEnabled)
+{
+    GThreadCacheEnabled.store(bEnabled, std::memory_order_relaxed);
+}
+
+bool CMemoryManager::IsThreadCacheEnabled()
+{
+    return GThreadCacheEnabled.load(std::memory_order_relaxed);
+}
+
+FMemoryStats CMemoryManager::GetStats()
+{
+    FMemoryStats Stats;
+    Stats.LiveBytes = GLiveBytes.load(std::memory_order_relaxed);
+    Stats.PeakBytes = GPeakBytes.load(std::memory_order_relaxed);
+    Stats.LiveCount = GLiveCount.load(std::memory_order_relaxed);
+    Stats.PeakCount = GPeakCount.load(std::memory_order_relaxed);
+    Stats.SlabCount = GSlabCount.load(std::memory_order_relaxed);
+    Stats.SlabReservedBytes = GSlabReservedBytes.load(std::memory_order_relaxed);
+    Stats.SlabUsedBytes = GSlabUsedBytes.load(std::memory_order_relaxed);
+    Stats.LargeLiveBytes = GLargeLiveBytes.load(std::memory_order_relaxed);
+    return Stats;
 }
 
 // Global operators removed. Allocation is scoped to UObject via class-specific operators.
@@ -3,6 +3,7 @@
 #include <cstdlib>
 #include <cstdint>
 #include <cstddef>
+#include <atomic>
 #include "UEContainer.h"
 
 #if defined(_MSC_VER) && defined(_DEBUG)
@@ -10,12 +11,63 @@
 #   include <crtdbg.h>
 #endif
 
+// 1이면 블록 앞뒤에 가드 바이트를 두고 해제 시 덮어쓰기를 검사한다 (기본: 디버그 빌드에서만)
+#ifndef MEMORY_GUARD_ENABLED
+#   if defined(_DEBUG)
+#       define MEMORY_GUARD_ENABLED 1
+#   else
+#       define MEMORY_GUARD_ENABLED 0
+#   endif
+#endif
+
+struct UClass;
+
+/** 클래스별 할당 통계. UClass마다 하나씩 있고 CMemoryManager가 갱신 */
+struct FClassMemoryStats
+{
+    std::atomic<int32> LiveCount{ 0 };
+    std::atomic<int32> PeakCount{ 0 };
+    std::atomic<uint64> LiveBytes{ 0 };
+    std::atomic<uint64> TotalAllocations{ 0 };
+};
+
+/** 전체 할당 통계 스냅샷 */
+struct FMemoryStats
+{
+    uint64 LiveBytes = 0;           // 요청 크기 기준
+    uint64 PeakBytes = 0;
+    uint32 LiveCount = 0;
+    uint32 PeakCount = 0;
+    uint32 SlabCount = 0;
+    uint64 SlabReservedBytes = 0;   // 슬랩으로 확보한 전체 메모리
+    uint64 SlabUsedBytes = 0;       // 그중 객체에 나가 있는 블록 (크기 클래스 반올림, 가드 포함)
+    uint64 LargeLiveBytes = 0;      // MaxSlabBlockSize를 넘어 malloc으로 직접 할당된 양
+};
+
+/**
+ * UObject 전용 할당기
+ * 16바이트 간격의 크기 클래스마다 슬랩 풀을 두고, 64KB 슬랩을 같은 크기 블록으로 잘라 프리 리스트로 관리한다.
+ * 같은 클래스의 객체는 같은 풀의 연속된 슬랩에 모이며, 스레드별 캐시가 켜져 있으면 대부분의 할당/해제가 락 없이 끝난다.
+ * 슬랩은 프로그램이 끝날 때까지 반환하지 않는다.
+ */
 class CMemoryManager
 {
 public:
-    static uint32 TotalAllocationBytes;
-    static uint32 TotalAllocationCount;
+    static constexpr size_t SizeClassGranularity = 16;
+    static constexpr size_t MaxSlabBlockSize = 4096;
+    static constexpr size_t SlabBytes = 64 * 1024;
+    static constexpr size_t GuardBytes = MEMORY_GUARD_ENABLED ? 16 : 0;
+
+    /**
+     * 크기(= UClass::Size)에 맞는 풀에서 16바이트 정렬 블록을 꺼내고 InClass의 통계를 갱신한다
+     * 해제 시에도 같은 크기를 넘겨야 하므로 UObject는 클래스별 sized operator delete를 사용한다
+     */
+    static void* Allocate(size_t Size, UClass* InClass);
+    static void Deallocate(void* Ptr, size_t Size, UClass* InClass);
+
+    // 스레드별 블록 캐시 사용 여부 (기본 켜짐). 끄면 모든 할당이 풀의 락을 거친다
+    static void SetThreadCacheEnabled(bool bEnabled);
+    static bool IsThreadCacheEnabled();
 
-    static void* Allocate(size_t size);
-    static void Deallocate(void* ptr);
-};
\ No newline at end of file
+    static FMemoryStats GetStats();
+};
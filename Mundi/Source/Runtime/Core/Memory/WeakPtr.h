@@ -13,6 +13,7 @@ public:
 		if (InObject)
 		{
 			Index = InObject->InternalIndex;
+			SerialNumber = UObject::GetSerialNumberFromIndex(Index);
 		}
 	}
 
@@ -22,26 +23,27 @@ public:
 		if (InObject)
 		{
 			Index = InObject->InternalIndex;
+			SerialNumber = UObject::GetSerialNumberFromIndex(Index);
 		}
 		else
 		{
 			Index = -1;
+			SerialNumber = 0;
 		}
 		return *this;
 	}
 
-	// UObject가 소멸할때 GUObjectArray에서 InternalIndex element를 nullptr로 설정함
-	// 객체를 직접 참조하지 않고 InternalIndex로 참조하면 정말 객체가 유효할때만 IsValid true 리턴함.
-	// 근데 이건 InternalIndex가 중복되지 않는다는 가정이 필요함(현재 InternalIndex는 그냥 한없이 증가함, 중복 없음)
-	// nullptr 설정 후 다른 객체에 이 InternalIndex를 할당하는 경우 문제가 생김
-	// 이때는 SerialNumber를 따로 설정해줘야함.
-	bool IsValid() const { return UObject::GetObjectFromIndex(Index); }
+	// UObject가 소멸하면 GUObjectArray 슬롯이 nullptr가 되고 시리얼 번호가 0으로 지워짐
+	// 슬롯은 다른 객체에 재사용되지만 새 객체는 새 시리얼 번호를 받으므로,
+	// 인덱스와 함께 시리얼 번호까지 같을 때만 원래 객체로 본다 (둘 다 O(1) 조회)
+	bool IsValid() const { return UObject::GetObjectFromIndex(Index, SerialNumber); }
 
-	T* Get() const { return static_cast<T*>(UObject::GetObjectFromIndex(Index)); }
+	T* Get() const { return static_cast<T*>(UObject::GetObjectFromIndex(Index, SerialNumber)); }
 
 	T* operator->() { return Get(); }
 
 private:
-	// 인덱스 재활용 안 한다고 가정
 	uint32 Index = -1;
+	// 참조를 잡을 때의 슬롯 시리얼 번호 (0 = 참조 없음)
+	uint32 SerialNumber = 0;
 };
\ No newline at end of file
@@ -0,0 +1,88 @@
+﻿#pragma once
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "UEContainer.h"
+
+/**
+ * @brief "-Flag", "-Key=Value" 형태의 커맨드라인 옵션 파싱 유틸리티.
+ * 벤치마크 모드들이 같은 규칙(공백/탭으로 구분, 값이 없으면 무시)으로 옵션을 읽도록 모아 둡니다.
+ */
+struct FCommandLine
+{
+	/** @return InCmdLine에 "-InFlag"가 독립된 토큰(뒤가 공백/탭/'='/끝)으로 있으면 true */
+	static bool HasFlag(const FString& InCmdLine, const FString& InFlag)
+	{
+		const FString Token = "-" + InFlag;
+		size_t Pos = InCmdLine.find(Token);
+		while (Pos != FString::npos)
+		{
+			const size_t End = Pos + Token.size();
+			const bool bStartsToken = (Pos == 0) || InCmdLine[Pos - 1] == ' ' || InCmdLine[Pos - 1] == '\t';
+			const bool bEndsToken = (End == InCmdLine.size()) || InCmdLine[End] == ' ' || InCmdLine[End] == '\t' || InCmdLine[End] == '=';
+			if (bStartsToken && bEndsToken)
+			{
+				return true;
+			}
+			Pos = InCmdLine.find(Token, Pos + 1);
+		}
+		return false;
+	}
+
+	/**
+	 * @brief "-InKey=Value"의 값을 찾아 반환. 없거나 값이 비어 있으면 false
+	 * @details HasFlag와 같이 토큰 시작 위치만 인정하므로 "-MyKey="가 "-Key="로 잡히지 않습니다.
+	 */
+	static bool FindOption(const FString& InCmdLine, const FString& InKey, FString& OutValue)
+	{
+		const FString Token = "-" + InKey + "=";
+		size_t Pos = InCmdLine.find(Token);
+		while (Pos != FString::npos)
+		{
+			const bool bStartsToken = (Pos == 0) || InCmdLine[Pos - 1] == ' ' || InCmdLine[Pos - 1] == '\t';
+			if (bStartsToken)
+			{
+				const size_t Begin = Pos + Token.size();
+				const size_t End = InCmdLine.find_first_of(" \t", Begin);
+				OutValue = InCmdLine.substr(Begin, End == FString::npos ? FString::npos : End - Begin);
+				return !OutValue.empty();
+			}
+			Pos = InCmdLine.find(Token, Pos + 1);
+		}
+		return false;
+	}
+
+	/** @brief "-InKey=N"이 있으면 max(InMinValue, N)을 OutValue에 씁니다. 숫자가 아니면 OutValue는 그대로 */
+	static void ParseIntOption(const FString& InCmdLine, const FString& InKey, int32& OutValue, int32 InMinValue = 1)
+	{
+		FString Value;
+		if (FindOption(InCmdLine, InKey, Value))
+		{
+			try { OutValue = std::max(InMinValue, std::stoi(Value)); } catch (...) {}
+		}
+	}
+
+	/** @brief "-InKey=N"이 있으면 부호 없는 정수로 OutValue에 씁니다. (시드 등) */
+	static void ParseUIntOption(const FString& InCmdLine, const FString& InKey, uint32& OutValue)
+	{
+		FString Value;
+		if (FindOption(InCmdLine, InKey, Value))
+		{
+			try { OutValue = static_cast<uint32>(std::stoul(Value)); } catch (...) {}
+		}
+	}
+
+	/** @brief "1000,10000,..." 형태의 값을 정수 목록으로 변환. 숫자가 아닌 항목은 건너뜀 */
+	static TArray<int32> ParseIntList(const FString& InValue)
+	{
+		TArray<int32> Values;
+		std::stringstream Stream(InValue);
+		FString Token;
+		while (std::getline(Stream, Token, ','))
+		{
+			try { Values.Add(std::stoi(Token)); } catch (...) {}
+		}
+		return Values;
+	}
+};
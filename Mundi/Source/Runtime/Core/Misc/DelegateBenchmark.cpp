@@ -0,0 +1,265 @@
+﻿#include "pch.h"
+#include "DelegateBenchmark.h"
+#include "CommandLineOptions.h"
+#include "MultiCastDelegate.h"
+#include "DynamicBinding.h"
+#include "PlatformTime.h"
+
+#include <filesystem>
+#include <iomanip>
+#include <random>
+
+// 벤치마크용 리스너. 받은 값을 더해 두어 호출이 최적화로 사라지지 않게 한다
+class UDelegateBenchmarkListener : public UObject
+{
+public:
+	DECLARE_CLASS(UDelegateBenchmarkListener, UObject)
+
+	void OnEvent(int32 InValue) { Sum += InValue; }
+
+	int64 Sum = 0;
+};
+
+IMPLEMENT_CLASS(UDelegateBenchmarkListener)
+
+namespace
+{
+	// 인라인 저장 도입 전 TMultiCastDelegate. 바인딩마다 new, 제거는 선형 검색
+	template<typename... Args>
+	class TLegacyMultiCastDelegate
+	{
+	public:
+		~TLegacyMultiCastDelegate()
+		{
+			for (IDelegateBinding<Args...>* Binding : Bindings)
+			{
+				delete Binding;
+			}
+		}
+
+		template<typename T>
+		FBindingHandle AddDynamic(T* Instance, void(T::* InFunction)(Args...))
+		{
+			FBindingHandle Handle{ FBindingHandle(NextID++) };
+			Bindings.Add(new FDynamicBinding(Handle, Instance, InFunction));
+			return Handle;
+		}
+
+		void Remove(FBindingHandle Handle)
+		{
+			for (int32 Index = 0; Index < Bindings.Num(); Index++)
+			{
+				if (Bindings[Index] && Bindings[Index]->GetHandle() == Handle)
+				{
+					delete Bindings[Index];
+					Bindings.SwapAndPop(Index);
+					break;
+				}
+			}
+		}
+
+		void Broadcast(Args... InArgs)
+		{
+			for (IDelegateBinding<Args...>* Binding : Bindings)
+			{
+				if (Binding && Binding->IsValid())
+				{
+					Binding->Execute(InArgs...);
+				}
+			}
+		}
+
+	private:
+		uint32 NextID = 0;
+		TArray<IDelegateBinding<Args...>*> Bindings;
+	};
+
+	template<typename DelegateType>
+	double MeasureBroadcast(DelegateType& InDelegate, int32 InBroadcastCount, int32 InRepeatCount)
+	{
+		double BestMS = (std::numeric_limits<double>::max)();
+		for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < InBroadcastCount; ++i)
+			{
+				InDelegate.Broadcast(i);
+			}
+			BestMS = std::min(BestMS, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+		}
+		return BestMS;
+	}
+
+	// 라운드마다 모든 리스너를 등록한 뒤 섞인 순서로 핸들 제거. 제거 시간만 누적
+	template<typename DelegateType>
+	double MeasureRemove(const TArray<UDelegateBenchmarkListener*>& InListeners, int32 InRounds, int32 InRepeatCount)
+	{
+		std::mt19937 Random(1234);
+		TArray<FBindingHandle> Handles;
+		Handles.Reserve(InListeners.Num());
+
+		double BestMS = (std::numeric_limits<double>::max)();
+		for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			double TotalMS = 0.0;
+			DelegateType Delegate;
+			for (int32 Round = 0; Round < InRounds; ++Round)
+			{
+				Handles.Empty();
+				for (UDelegateBenchmarkListener* Listener : InListeners)
+				{
+					Handles.Add(Delegate.AddDynamic(Listener, &UDelegateBenchmarkListener::OnEvent));
+				}
+				std::shuffle(Handles.begin(), Handles.end(), Random);
+
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				for (const FBindingHandle& Handle : Handles)
+				{
+					Delegate.Remove(Handle);
+				}
+				TotalMS += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+			}
+			BestMS = std::min(BestMS, TotalMS);
+		}
+		return BestMS;
+	}
+}
+
+FDelegateBenchmark::FDelegateBenchmark(const FDelegateBenchmarkConfig& InConfig)
+	: Config(InConfig)
+{
+}
+
+bool FDelegateBenchmark::ParseCommandLine(const FString& InCmdLine, FDelegateBenchmarkConfig& OutConfig)
+{
+	if (!FCommandLine::HasFlag(InCmdLine, "DelegateBenchmark"))
+	{
+		return false;
+	}
+
+	FCommandLine::ParseIntOption(InCmdLine, "DelegateListeners", OutConfig.MaxListeners);
+	FCommandLine::ParseIntOption(InCmdLine, "DelegateBroadcasts", OutConfig.BroadcastCount);
+	FCommandLine::ParseIntOption(InCmdLine, "DelegateRemoveRounds", OutConfig.RemoveRounds);
+	FCommandLine::ParseIntOption(InCmdLine, "DelegateRepeat", OutConfig.RepeatCount);
+
+	FString Value;
+	if (FCommandLine::FindOption(InCmdLine, "BenchmarkOutput", Value))
+	{
+		OutConfig.OutputDir = Value;
+	}
+	return true;
+}
+
+bool FDelegateBenchmark::Run()
+{
+	Results.Empty();
+
+	for (int32 ListenerCount = 1; ListenerCount <= Config.MaxListeners; ListenerCount *= 2)
+	{
+		RunListenerCount(ListenerCount);
+	}
+
+	std::error_code ErrorCode;
+	std::filesystem::create_directories(Config.OutputDir, ErrorCode);
+
+	const FString CSVPath = Config.OutputDir + "/DelegateBenchmark.csv";
+	if (!WriteCSV(CSVPath))
+	{
+		UE_LOG("[DelegateBenchmark] Failed to write results to %s", Config.OutputDir.c_str());
+		return false;
+	}
+	UE_LOG("[DelegateBenchmark] %d results written to %s", static_cast<int32>(Results.Num()), Config.OutputDir.c_str());
+	return true;
+}
+
+void FDelegateBenchmark::RunListenerCount(int32 InListenerCount)
+{
+	TArray<UDelegateBenchmarkListener*> Listeners;
+	Listeners.Reserve(InListenerCount);
+	for (int32 i = 0; i < InListenerCount; ++i)
+	{
+		Listeners.Add(NewObject<UDelegateBenchmarkListener>());
+	}
+
+	auto AddResult = [this, InListenerCount](const char* InMethod, const char* InOperation, int64 InOperationCount, double InTotalMS)
+	{
+		FDelegateBenchmarkResult Result;
+		Result.Method = InMethod;
+		Result.Operation = InOperation;
+		Result.ListenerCount = InListenerCount;
+		Result.OperationCount = InOperationCount;
+		Result.TotalMS = InTotalMS;
+		Result.NsPerOperation = InOperationCount > 0 ? InTotalMS * 1.0e6 / static_cast<double>(InOperationCount) : 0.0;
+		Results.Add(Result);
+	};
+
+	// Broadcast
+	{
+		TLegacyMultiCastDelegate<int32> LegacyDelegate;
+		TMultiCastDelegate<int32> InlineDelegate;
+		for (UDelegateBenchmarkListener* Listener : Listeners)
+		{
+			LegacyDelegate.AddDynamic(Listener, &UDelegateBenchmarkListener::OnEvent);
+			InlineDelegate.AddDynamic(Listener, &UDelegateBenchmarkListener::OnEvent);
+		}
+
+		const double LegacyMS = MeasureBroadcast(LegacyDelegate, Config.BroadcastCount, Config.RepeatCount);
+		const double InlineMS = MeasureBroadcast(InlineDelegate, Config.BroadcastCount, Config.RepeatCount);
+		AddResult("Legacy", "Broadcast", Config.BroadcastCount, LegacyMS);
+		AddResult("Inline", "Broadcast", Config.BroadcastCount, InlineMS);
+
+		UE_LOG("[DelegateBenchmark] Broadcast Listeners=%-3d Legacy=%.3fms Inline=%.3fms",
+			InListenerCount, LegacyMS, InlineMS);
+	}
+
+	// 핸들 제거
+	{
+		const int64 RemoveCount = static_cast<int64>(Config.RemoveRounds) * InListenerCount;
+		const double LegacyMS = MeasureRemove<TLegacyMultiCastDelegate<int32>>(Listeners, Config.RemoveRounds, Config.RepeatCount);
+		const double InlineMS = MeasureRemove<TMultiCastDelegate<int32>>(Listeners, Config.RemoveRounds, Config.RepeatCount);
+		AddResult("Legacy", "Remove", RemoveCount, LegacyMS);
+		AddResult("Inline", "Remove", RemoveCount, InlineMS);
+
+		UE_LOG("[DelegateBenchmark] Remove    Listeners=%-3d Legacy=%.3fms Inline=%.3fms",
+			InListenerCount, LegacyMS, InlineMS);
+	}
+
+	// 두 방식이 같은 횟수만큼 호출했는지 확인 (리스너마다 Broadcast 값의 합이 두 번씩 더해짐)
+	const int64 ExpectedSum = 2 * static_cast<int64>(Config.RepeatCount)
+		* (static_cast<int64>(Config.BroadcastCount) * (Config.BroadcastCount - 1) / 2);
+	for (UDelegateBenchmarkListener* Listener : Listeners)
+	{
+		if (Listener->Sum != ExpectedSum)
+		{
+			UE_LOG("[DelegateBenchmark] Listener sum mismatch: %lld (expected %lld)", Listener->Sum, ExpectedSum);
+			break;
+		}
+	}
+
+	for (UDelegateBenchmarkListener* Listener : Listeners)
+	{
+		ObjectFactory::DeleteObject(Listener);
+	}
+}
+
+bool FDelegateBenchmark::WriteCSV(const FString& InFilePath) const
+{
+	std::ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	File << "Method,Operation,ListenerCount,OperationCount,TotalMS,NsPerOperation\n";
+	File << std::fixed << std::setprecision(6);
+	for (const FDelegateBenchmarkResult& Result : Results)
+	{
+		File << Result.Method << ','
+			<< Result.Operation << ','
+			<< Result.ListenerCount << ','
+			<< Result.OperationCount << ','
+			<< Result.TotalMS << ','
+			<< Result.NsPerOperation << '\n';
+	}
+	return true;
+}
@@ -0,0 +1,56 @@
+﻿#pragma once
+
+/**
+ * @brief 멀티캐스트 델리게이트 벤치마크 설정. 커맨드라인(-DelegateBenchmark ...)에서 채워집니다.
+ */
+struct FDelegateBenchmarkConfig
+{
+	int32 MaxListeners = 64;		// 1, 2, 4 ... MaxListeners 리스너로 측정
+	int32 BroadcastCount = 100000;	// 측정당 Broadcast 횟수
+	int32 RemoveRounds = 1000;		// 전체 등록 후 무작위 순서로 제거하는 라운드 수
+	int32 RepeatCount = 5;			// 측정별 반복 횟수 (가장 빠른 값을 기록)
+
+	FString OutputDir = "Saved/Benchmark";
+};
+
+/**
+ * @brief 측정 결과 한 줄 (CSV 한 행)
+ */
+struct FDelegateBenchmarkResult
+{
+	FString Method;			// Legacy (힙 바인딩 포인터 배열) / Inline (값 저장 연속 배열)
+	FString Operation;		// Broadcast / Remove
+	int32 ListenerCount = 0;
+	int64 OperationCount = 0;
+	double TotalMS = 0.0;
+	double NsPerOperation = 0.0;
+};
+
+/**
+ * @brief 기존 힙 할당 바인딩 방식과 인라인 저장 TMultiCastDelegate 의 Broadcast / 핸들 제거 비용 비교
+ * 리스너는 UObject 멤버 함수(AddDynamic)로 바인딩하며 결과를 CSV 로 저장합니다.
+ */
+class FDelegateBenchmark
+{
+public:
+	explicit FDelegateBenchmark(const FDelegateBenchmarkConfig& InConfig);
+
+	/**
+	 * @brief 커맨드라인에 -DelegateBenchmark 가 있으면 설정을 채우고 true를 반환합니다.
+	 * 옵션: -DelegateListeners=N -DelegateBroadcasts=N -DelegateRemoveRounds=N -DelegateRepeat=N -BenchmarkOutput=Dir
+	 */
+	static bool ParseCommandLine(const FString& InCmdLine, FDelegateBenchmarkConfig& OutConfig);
+
+	/** @return 측정을 마치고 CSV를 썼으면 true */
+	bool Run();
+
+	bool WriteCSV(const FString& InFilePath) const;
+
+	const TArray<FDelegateBenchmarkResult>& GetResults() const { return Results; }
+
+private:
+	void RunListenerCount(int32 InListenerCount);
+
+	FDelegateBenchmarkConfig Config;
+	TArray<FDelegateBenchmarkResult> Results;
+};
@@ -15,7 +15,7 @@ struct FBindingHandle
     FBindingHandle(const FBindingHandle& InOther)
         :ID(InOther.ID){
     }
-    bool operator==(const FBindingHandle& InOther)
+    bool operator==(const FBindingHandle& InOther) const
     {
         return ID == InOther.ID;
     }
@@ -0,0 +1,228 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <new>
+#include <type_traits>
+
+/**
+ * 정적 함수 / 람다 / 멤버 함수 바인딩 하나를 값으로 담는 델리게이트 인스턴스
+ * 호출 대상은 InlineBytes 크기의 내부 버퍼에 바로 생성하고, 그보다 큰 람다만 힙에 둔다.
+ * 종류별 동작은 타입마다 하나씩 있는 정적 함수 테이블(FOps)로 처리하므로 가상 함수나 std::function이 없다.
+ */
+template<typename... Args>
+class TDelegateInstance
+{
+public:
+	// TWeakPtr(8) + 멤버 함수 포인터(MSVC 최대 24)를 담을 수 있는 크기
+	static constexpr size_t InlineBytes = 48;
+	static constexpr size_t InlineAlign = 16;
+
+	TDelegateInstance() = default;
+
+	TDelegateInstance(const TDelegateInstance& InOther)
+	{
+		if (InOther.Ops)
+		{
+			InOther.Ops->Copy(Storage, InOther.Storage);
+			Ops = InOther.Ops;
+		}
+	}
+
+	TDelegateInstance(TDelegateInstance&& InOther) noexcept
+	{
+		if (InOther.Ops)
+		{
+			InOther.Ops->Move(Storage, InOther.Storage);
+			Ops = InOther.Ops;
+			InOther.Ops = nullptr;
+		}
+	}
+
+	TDelegateInstance& operator=(const TDelegateInstance& InOther)
+	{
+		if (this != &InOther)
+		{
+			Reset();
+			if (InOther.Ops)
+			{
+				InOther.Ops->Copy(Storage, InOther.Storage);
+				Ops = InOther.Ops;
+			}
+		}
+		return *this;
+	}
+
+	TDelegateInstance& operator=(TDelegateInstance&& InOther) noexcept
+	{
+		if (this != &InOther)
+		{
+			Reset();
+			if (InOther.Ops)
+			{
+				InOther.Ops->Move(Storage, InOther.Storage);
+				Ops = InOther.Ops;
+				InOther.Ops = nullptr;
+			}
+		}
+		return *this;
+	}
+
+	~TDelegateInstance()
+	{
+		Reset();
+	}
+
+	static TDelegateInstance CreateStatic(void (*InFunction)(Args...))
+	{
+		TDelegateInstance Instance;
+		Instance.template Emplace<FStaticPayload>(InFunction);
+		return Instance;
+	}
+
+	// 람다를 쓰는 경우 유효성 검사는 프로그래머가 직접 해줘야 함
+	template<typename FunctorType>
+	static TDelegateInstance CreateLambda(FunctorType&& InFunctor)
+	{
+		using DecayedType = std::decay_t<FunctorType>;
+
+		TDelegateInstance Instance;
+		if constexpr (sizeof(TLambdaPayload<DecayedType>) <= InlineBytes
+			&& alignof(DecayedType) <= InlineAlign
+			&& std::is_nothrow_move_constructible_v<DecayedType>)
+		{
+			Instance.template Emplace<TLambdaPayload<DecayedType>>(std::forward<FunctorType>(InFunctor));
+		}
+		else
+		{
+			Instance.template Emplace<THeapLambdaPayload<DecayedType>>(std::forward<FunctorType>(InFunctor));
+		}
+		return Instance;
+	}
+
+	// 객체는 TWeakPtr로 참조하므로 객체가 지워지면 IsValid가 false가 된다
+	template<typename T>
+	static TDelegateInstance CreateDynamic(T* InObject, void (T::* InFunction)(Args...))
+	{
+		TDelegateInstance Instance;
+		Instance.template Emplace<TDynamicPayload<T>>(InObject, InFunction);
+		return Instance;
+	}
+
+	bool IsBound() const { return Ops != nullptr; }
+	bool IsValid() const { return Ops && Ops->IsValid(Storage); }
+	bool IsBoundTo(const void* InObject) const { return Ops && InObject && Ops->GetObject(Storage) == InObject; }
+
+	void Execute(Args... InArgs) const
+	{
+		Ops->Execute(Storage, InArgs...);
+	}
+
+	void Reset()
+	{
+		if (Ops)
+		{
+			Ops->Destroy(Storage);
+			Ops = nullptr;
+		}
+	}
+
+private:
+	struct FOps
+	{
+		void (*Execute)(const void*, Args...);
+		bool (*IsValid)(const void*);
+		const void* (*GetObject)(const void*);
+		void (*Copy)(void*, const void*);
+		void (*Move)(void*, void*);
+		void (*Destroy)(void*);
+	};
+
+	struct FStaticPayload
+	{
+		void (*Function)(Args...);
+
+		explicit FStaticPayload(void (*InFunction)(Args...)) : Function(InFunction) {}
+		void Execute(Args... InArgs) const { (*Function)(InArgs...); }
+		bool IsValid() const { return Function != nullptr; }
+		const void* GetObject() const { return nullptr; }
+	};
+
+	template<typename FunctorType>
+	struct TLambdaPayload
+	{
+		mutable FunctorType Functor;
+
+		template<typename InFunctorType>
+		explicit TLambdaPayload(InFunctorType&& InFunctor) : Functor(std::forward<InFunctorType>(InFunctor)) {}
+		void Execute(Args... InArgs) const { Functor(InArgs...); }
+		bool IsValid() const { return true; }
+		const void* GetObject() const { return nullptr; }
+	};
+
+	// 내부 버퍼에 들어가지 않는 람다. 복사 시 람다도 새로 복사한다
+	template<typename FunctorType>
+	struct THeapLambdaPayload
+	{
+		FunctorType* Functor = nullptr;
+
+		template<typename InFunctorType>
+		explicit THeapLambdaPayload(InFunctorType&& InFunctor) : Functor(new FunctorType(std::forward<InFunctorType>(InFunctor))) {}
+		THeapLambdaPayload(const THeapLambdaPayload& InOther) : Functor(new FunctorType(*InOther.Functor)) {}
+		THeapLambdaPayload(THeapLambdaPayload&& InOther) noexcept : Functor(InOther.Functor) { InOther.Functor = nullptr; }
+		~THeapLambdaPayload() { delete Functor; }
+		void Execute(Args... InArgs) const { (*Functor)(InArgs...); }
+		bool IsValid() const { return Functor != nullptr; }
+		const void* GetObject() const { return nullptr; }
+	};
+
+	template<typename T>
+	struct TDynamicPayload
+	{
+		TWeakPtr<T> Object;
+		void (T::* Function)(Args...);
+
+		TDynamicPayload(T* InObject, void (T::* InFunction)(Args...)) : Object(InObject), Function(InFunction) {}
+		void Execute(Args... InArgs) const
+		{
+			if (T* Target = Object.Get())
+			{
+				(Target->*Function)(InArgs...);
+			}
+		}
+		bool IsValid() const { return Object.IsValid(); }
+		const void* GetObject() const { return Object.Get(); }
+	};
+
+	template<typename PayloadType>
+	static const FOps* GetOps()
+	{
+		static constexpr FOps PayloadOps =
+		{
+			[](const void* InStorage, Args... InArgs) { static_cast<const PayloadType*>(InStorage)->Execute(InArgs...); },
+			[](const void* InStorage) { return static_cast<const PayloadType*>(InStorage)->IsValid(); },
+			[](const void* InStorage) { return static_cast<const PayloadType*>(InStorage)->GetObject(); },
+			[](void* InDest, const void* InSource) { new (InDest) PayloadType(*static_cast<const PayloadType*>(InSource)); },
+			[](void* InDest, void* InSource)
+			{
+				PayloadType* Source = static_cast<PayloadType*>(InSource);
+				new (InDest) PayloadType(std::move(*Source));
+				Source->~PayloadType();
+			},
+			[](void* InStorage) { static_cast<PayloadType*>(InStorage)->~PayloadType(); }
+		};
+		return &PayloadOps;
+	}
+
+	template<typename PayloadType, typename... CtorArgs>
+	void Emplace(CtorArgs&&... InCtorArgs)
+	{
+		static_assert(sizeof(PayloadType) <= InlineBytes, "Delegate payload does not fit inline storage");
+		static_assert(alignof(PayloadType) <= InlineAlign, "Delegate payload alignment exceeds inline storage");
+
+		Reset();
+		new (Storage) PayloadType(std::forward<CtorArgs>(InCtorArgs)...);
+		Ops = GetOps<PayloadType>();
+	}
+
+	alignas(InlineAlign) unsigned char Storage[InlineBytes];
+	const FOps* Ops = nullptr;
+};
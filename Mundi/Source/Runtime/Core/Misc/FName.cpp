@@ -1,25 +1,227 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include <shared_mutex>
 
-TArray<FNameEntry> FNamePool::Entries;
-std::unordered_map<FString, uint32> FNamePool::NameMap;
+namespace
+{
+    // 엔트리는 BlockSize개씩 블록으로 잡고, Index 상위 비트가 블록 번호다. 블록 포인터 배열은 상수 초기화되어 정적 초기화 순서와 무관
+    constexpr uint32 BlockShift = 12;
+    constexpr uint32 BlockSize = 1u << BlockShift;
+    constexpr uint32 MaxBlocks = 1024;
+
+    constexpr uint32 ShardShift = 4;
+    constexpr uint32 ShardCount = 1u << ShardShift;
+    constexpr uint32 InitialSlotCount = 256;
+    constexpr size_t ArenaChunkBytes = 16 * 1024;
+    constexpr uint32 EmptySlot = UINT32_MAX;
+
+    std::atomic<FNameEntry*> GNameBlocks[MaxBlocks];
+    std::atomic<uint32> GNextNameIndex{ 0 };
+
+    inline char ToLowerAscii(char C)
+    {
+        return (C >= 'A' && C <= 'Z') ? static_cast<char>(C - 'A' + 'a') : C;
+    }
+
+    // 소문자로 바꾸면서 FNV-1a 해시를 한 번에 계산
+    uint32 HashNameNoCase(std::string_view InStr)
+    {
+        uint32 Hash = 2166136261u;
+        for (char C : InStr)
+        {
+            Hash ^= static_cast<uint8>(ToLowerAscii(C));
+            Hash *= 16777619u;
+        }
+        return Hash;
+    }
+
+    bool EqualsNoCase(const FNameEntry& InEntry, std::string_view InStr)
+    {
+        if (InEntry.Length != InStr.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < InStr.size(); ++i)
+        {
+            if (InEntry.Comparison[i] != ToLowerAscii(InStr[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    FNameEntry& GetEntrySlot(uint32 InIndex)
+    {
+        std::atomic<FNameEntry*>& BlockPtr = GNameBlocks[InIndex >> BlockShift];
+        FNameEntry* Block = BlockPtr.load(std::memory_order_acquire);
+        if (!Block)
+        {
+            FNameEntry* NewBlock = new FNameEntry[BlockSize];
+            if (BlockPtr.compare_exchange_strong(Block, NewBlock, std::memory_order_acq_rel))
+            {
+                Block = NewBlock;
+            }
+            else
+            {
+                delete[] NewBlock;
+            }
+        }
+        return Block[InIndex & (BlockSize - 1)];
+    }
+
+    struct FNameSlot
+    {
+        uint32 Hash = 0;
+        uint32 Index = EmptySlot;
+    };
+
+    /** 해시 상위 비트로 나뉜 풀 조각. 개방 주소(선형 탐사) 테이블과 문자열 아레나를 가진다 */
+    struct FNameShard
+    {
+        std::shared_mutex Mutex;
+        TArray<FNameSlot> Slots;
+        uint32 UsedSlots = 0;
+
+        TArray<std::unique_ptr<char[]>> ArenaChunks;
+        char* ArenaCursor = nullptr;
+        size_t ArenaRemaining = 0;
+
+        // 찾으면 엔트리 인덱스, 없으면 EmptySlot. 락은 호출자가 잡는다
+        uint32 Find(std::string_view InStr, uint32 InHash) const
+        {
+            if (Slots.IsEmpty())
+            {
+                return EmptySlot;
+            }
+
+            const uint32 Mask = static_cast<uint32>(Slots.Num()) - 1;
+            for (uint32 SlotIndex = InHash & Mask;; SlotIndex = (SlotIndex + 1) & Mask)
+            {
+                const FNameSlot& Slot = Slots[SlotIndex];
+                if (Slot.Index == EmptySlot)
+                {
+                    return EmptySlot;
+                }
+                if (Slot.Hash == InHash && EqualsNoCase(FNamePool::Get(Slot.Index), InStr))
+                {
+                    return Slot.Index;
+                }
+            }
+        }
+
+        char* AllocateString(size_t InBytes)
+        {
+            if (InBytes > ArenaRemaining)
+            {
+                const size_t ChunkBytes = std::max(ArenaChunkBytes, InBytes);
+                ArenaChunks.Emplace(new char[ChunkBytes]);
+                ArenaCursor = ArenaChunks[ArenaChunks.Num() - 1].get();
+                ArenaRemaining = ChunkBytes;
+            }
+
+            char* Result = ArenaCursor;
+            ArenaCursor += InBytes;
+            ArenaRemaining -= InBytes;
+            return Result;
+        }
+
+        void InsertSlot(uint32 InHash, uint32 InIndex)
+        {
+            const uint32 Mask = static_cast<uint32>(Slots.Num()) - 1;
+            uint32 SlotIndex = InHash & Mask;
+            while (Slots[SlotIndex].Index != EmptySlot)
+            {
+                SlotIndex = (SlotIndex + 1) & Mask;
+            }
+            Slots[SlotIndex] = { InHash, InIndex };
+        }
 
-uint32 FNamePool::Add(const FString& InStr)
+        // 부하율 50%를 넘기 전에 두 배로 늘려 재배치
+        void GrowIfNeeded()
+        {
+            if (!Slots.IsEmpty() && (UsedSlots + 1) * 2 <= static_cast<uint32>(Slots.Num()))
+            {
+                return;
+            }
+
+            TArray<FNameSlot> OldSlots = std::move(Slots);
+            Slots.clear();
+            Slots.resize(OldSlots.IsEmpty() ? InitialSlotCount : OldSlots.Num() * 2);
+            for (const FNameSlot& Slot : OldSlots)
+            {
+                if (Slot.Index != EmptySlot)
+                {
+                    InsertSlot(Slot.Hash, Slot.Index);
+                }
+            }
+        }
+
+        // 쓰기 락을 잡은 상태에서 새 엔트리를 만든다
+        uint32 AddLocked(std::string_view InStr, uint32 InHash)
+        {
+            GrowIfNeeded();
+
+            const uint32 Length = static_cast<uint32>(InStr.size());
+            char* Display = AllocateString((Length + 1) * 2);
+            char* Comparison = Display + Length + 1;
+            for (uint32 i = 0; i < Length; ++i)
+            {
+                Display[i] = InStr[i];
+                Comparison[i] = ToLowerAscii(InStr[i]);
+            }
+            Display[Length] = '\0';
+            Comparison[Length] = '\0';
+
+            const uint32 NewIndex = GNextNameIndex.fetch_add(1, std::memory_order_relaxed);
+            assert(NewIndex < MaxBlocks * BlockSize && "FNamePool exhausted");
+
+            FNameEntry& Entry = GetEntrySlot(NewIndex);
+            Entry.Display = Display;
+            Entry.Comparison = Comparison;
+            Entry.Length = Length;
+            Entry.Hash = InHash;
+
+            InsertSlot(InHash, NewIndex);
+            ++UsedSlots;
+            return NewIndex;
+        }
+    };
+
+    FNameShard* GetShards()
+    {
+        static FNameShard Shards[ShardCount];
+        return Shards;
+    }
+}
+
+uint32 FNamePool::Add(std::string_view InStr)
 {
-    FString Lower = InStr;
-    std::transform(Lower.begin(), Lower.end(), Lower.begin(), ::tolower);
+    const uint32 Hash = HashNameNoCase(InStr);
+    FNameShard& Shard = GetShards()[Hash >> (32 - ShardShift)];
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+    {
+        std::shared_lock<std::shared_mutex> ReadLock(Shard.Mutex);
+        const uint32 Found = Shard.Find(InStr, Hash);
+        if (Found != EmptySlot)
+            return Found;
+    }
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
-    return NewIndex;
+    // 읽기 락을 놓은 사이 다른 스레드가 같은 이름을 넣었을 수 있으므로 다시 확인
+    std::unique_lock<std::shared_mutex> WriteLock(Shard.Mutex);
+    const uint32 Found = Shard.Find(InStr, Hash);
+    if (Found != EmptySlot)
+        return Found;
+
+    return Shard.AddLocked(InStr, Hash);
 }
 
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    return Entries[Index];
-}
\ No newline at end of file
+    return GNameBlocks[Index >> BlockShift].load(std::memory_order_acquire)[Index & (BlockSize - 1)];
+}
+
+uint32 FNamePool::Num()
+{
+    return GNextNameIndex.load(std::memory_order_acquire);
+}
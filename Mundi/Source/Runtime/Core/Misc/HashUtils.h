@@ -0,0 +1,48 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstring>
+
+#include "UEContainer.h"
+
+// ============================================================================
+// 64비트 해시 유틸리티 (렌더러 캐시 키, 충돌 페어 키 등에서 공용으로 사용)
+// ============================================================================
+
+/**
+ * @brief 포인터 주소를 그대로 64비트 해시 값으로 사용합니다.
+ */
+inline uint64 PointerHash(const void* InPointer)
+{
+	return static_cast<uint64>(reinterpret_cast<uintptr_t>(InPointer));
+}
+
+/**
+ * @brief 기존 해시(Seed)에 새 값을 섞습니다 (boost::hash_combine 방식).
+ * @details 순서에 의존하므로 HashCombine(A, B) != HashCombine(B, A) 입니다.
+ */
+inline uint64 HashCombine(uint64 InSeed, uint64 InValue)
+{
+	return InSeed ^ (InValue + 0x9E3779B97F4A7C15ull + (InSeed << 6) + (InSeed >> 2));
+}
+
+/**
+ * @brief 입력의 모든 비트를 고르게 퍼뜨리는 64비트 믹서 (splitmix64 finalizer).
+ * @details 합산처럼 순서와 무관하게 합칠 값이나 연속된 정수 키를 해시할 때 사용합니다.
+ */
+inline uint64 HashMix64(uint64 InValue)
+{
+	InValue += 0x9E3779B97F4A7C15ull;
+	InValue = (InValue ^ (InValue >> 30)) * 0xBF58476D1CE4E5B9ull;
+	InValue = (InValue ^ (InValue >> 27)) * 0x94D049BB133111EBull;
+	return InValue ^ (InValue >> 31);
+}
+
+/**
+ * @brief float 의 비트 패턴을 해시에 섞습니다.
+ */
+inline uint64 HashCombineFloat(uint64 InSeed, float InValue)
+{
+	uint32 Bits = 0;
+	std::memcpy(&Bits, &InValue, sizeof(Bits));
+	return HashCombine(InSeed, Bits);
+}
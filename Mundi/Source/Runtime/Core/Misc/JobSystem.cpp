@@ -0,0 +1,237 @@
+﻿#include "pch.h"
+#include "JobSystem.h"
+
+namespace
+{
+	// 현재 스레드가 소유한 덱 번호. 워커가 아닌 스레드는 모두 0번(메인) 덱을 사용
+	thread_local int32 GJobQueueIndex = 0;
+
+	// 워커 수 상한. 그 이상은 덱 훔치기 탐색 비용이 이득보다 커짐
+	constexpr int32 MaxJobWorkers = 15;
+}
+
+FJobSystem::~FJobSystem()
+{
+	Shutdown();
+}
+
+void FJobSystem::Initialize(int32 InWorkerCount)
+{
+	if (bRunning.load())
+	{
+		return;
+	}
+
+	int32 WorkerCount = InWorkerCount;
+	if (WorkerCount < 0)
+	{
+		WorkerCount = static_cast<int32>(std::thread::hardware_concurrency()) - 1;
+	}
+	WorkerCount = std::clamp(WorkerCount, 0, MaxJobWorkers);
+
+	Queues.Empty();
+	for (int32 i = 0; i <= WorkerCount; ++i)
+	{
+		Queues.Emplace(std::make_unique<FJobDeque>());
+	}
+
+	bRunning.store(true);
+	for (int32 i = 1; i <= WorkerCount; ++i)
+	{
+		Workers.Emplace(&FJobSystem::WorkerMain, this, i);
+	}
+
+	UE_LOG("[JobSystem] %d worker threads started", WorkerCount);
+}
+
+void FJobSystem::Shutdown()
+{
+	if (!bRunning.exchange(false))
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(WakeMutex);
+	}
+	WakeCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		Worker.join();
+	}
+	Workers.Empty();
+
+	// 남은 작업은 대기 중인 쪽이 없도록 호출 스레드에서 마저 처리
+	while (TryExecuteOne(0))
+	{
+	}
+	Queues.Empty();
+	QueuedJobCount.store(0);
+}
+
+FJobRef FJobSystem::Launch(std::function<void()> InTask, const TArray<FJobRef>& InPrerequisites)
+{
+	FJobRef Job = std::make_shared<FJob>(std::move(InTask));
+
+	for (const FJobRef& Prerequisite : InPrerequisites)
+	{
+		if (!Prerequisite)
+		{
+			continue;
+		}
+
+		// 완료 표시와 후속 목록 등록이 같은 락 안에서 일어나므로 이미 끝난 선행 작업은 건너뜀
+		std::lock_guard<std::mutex> Lock(Prerequisite->SubsequentsMutex);
+		if (!Prerequisite->bComplete.load(std::memory_order_relaxed))
+		{
+			Job->PendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+			Prerequisite->Subsequents.Add(Job);
+		}
+	}
+
+	if (Job->PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		Schedule(Job);
+	}
+	return Job;
+}
+
+void FJobSystem::Wait(const FJobRef& InJob)
+{
+	if (!InJob)
+	{
+		return;
+	}
+
+	const int32 QueueIndex = GetCurrentQueueIndex();
+	while (!InJob->IsComplete())
+	{
+		if (!TryExecuteOne(QueueIndex))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FJobSystem::WaitAll(const TArray<FJobRef>& InJobs)
+{
+	for (const FJobRef& Job : InJobs)
+	{
+		Wait(Job);
+	}
+}
+
+void FJobSystem::WorkerMain(int32 InQueueIndex)
+{
+	GJobQueueIndex = InQueueIndex;
+
+	while (bRunning.load(std::memory_order_acquire))
+	{
+		if (TryExecuteOne(InQueueIndex))
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> Lock(WakeMutex);
+		WakeCondition.wait(Lock, [this]()
+		{
+			return !bRunning.load(std::memory_order_acquire) || QueuedJobCount.load(std::memory_order_acquire) > 0;
+		});
+	}
+}
+
+void FJobSystem::Schedule(const FJobRef& InJob)
+{
+	// 워커가 없으면 큐를 거치지 않고 바로 실행
+	if (Workers.IsEmpty())
+	{
+		Execute(InJob);
+		return;
+	}
+
+	FJobDeque& Deque = *Queues[GetCurrentQueueIndex()];
+	{
+		std::lock_guard<std::mutex> Lock(Deque.Mutex);
+		Deque.Jobs.push_back(InJob);
+	}
+	QueuedJobCount.fetch_add(1, std::memory_order_release);
+
+	// 워커가 조건 확인과 대기 사이에 있을 때 깨우기 신호를 놓치지 않도록 락을 한 번 거침
+	{
+		std::lock_guard<std::mutex> Lock(WakeMutex);
+	}
+	WakeCondition.notify_one();
+}
+
+void FJobSystem::Execute(const FJobRef& InJob)
+{
+	if (InJob->Task)
+	{
+		InJob->Task();
+		InJob->Task = nullptr;
+	}
+
+	TArray<FJobRef> ReadySubsequents;
+	{
+		std::lock_guard<std::mutex> Lock(InJob->SubsequentsMutex);
+		InJob->bComplete.store(true, std::memory_order_release);
+		ReadySubsequents.swap(InJob->Subsequents);
+	}
+
+	for (const FJobRef& Subsequent : ReadySubsequents)
+	{
+		if (Subsequent->PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Schedule(Subsequent);
+		}
+	}
+}
+
+bool FJobSystem::TryExecuteOne(int32 InQueueIndex)
+{
+	const int32 QueueCount = static_cast<int32>(Queues.Num());
+	if (QueueCount == 0)
+	{
+		return false;
+	}
+
+	FJobRef Job;
+
+	// 1. 자기 덱의 뒤쪽 (가장 최근에 넣은 작업이 캐시에 남아 있을 가능성이 높음)
+	{
+		FJobDeque& Own = *Queues[InQueueIndex];
+		std::lock_guard<std::mutex> Lock(Own.Mutex);
+		if (!Own.Jobs.empty())
+		{
+			Job = std::move(Own.Jobs.back());
+			Own.Jobs.pop_back();
+		}
+	}
+
+	// 2. 다른 덱의 앞쪽에서 훔침 (오래된, 보통 더 큰 단위의 작업)
+	for (int32 Offset = 1; !Job && Offset < QueueCount; ++Offset)
+	{
+		FJobDeque& Victim = *Queues[(InQueueIndex + Offset) % QueueCount];
+		std::lock_guard<std::mutex> Lock(Victim.Mutex);
+		if (!Victim.Jobs.empty())
+		{
+			Job = std::move(Victim.Jobs.front());
+			Victim.Jobs.pop_front();
+		}
+	}
+
+	if (!Job)
+	{
+		return false;
+	}
+
+	QueuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+	Execute(Job);
+	return true;
+}
+
+int32 FJobSystem::GetCurrentQueueIndex() const
+{
+	return GJobQueueIndex < static_cast<int32>(Queues.Num()) ? GJobQueueIndex : 0;
+}
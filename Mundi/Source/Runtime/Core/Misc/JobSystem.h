@@ -0,0 +1,147 @@
+﻿#pragma once
+
+class FJob;
+using FJobRef = std::shared_ptr<FJob>;
+
+/**
+ * @brief 잡 시스템에 제출된 작업 하나
+ * 선행 작업(Prerequisites)이 모두 끝난 뒤에 워커 큐로 들어가 실행됩니다.
+ */
+class FJob
+{
+public:
+	explicit FJob(std::function<void()> InTask) : Task(std::move(InTask)) {}
+
+	bool IsComplete() const { return bComplete.load(std::memory_order_acquire); }
+
+private:
+	friend class FJobSystem;
+
+	std::function<void()> Task;
+
+	// 제출이 끝나기 전에 실행되지 않도록 1에서 시작하고, Launch 마지막에 1을 뺌
+	std::atomic<int32> PendingPrerequisites{ 1 };
+	std::atomic<bool> bComplete{ false };
+
+	// 이 작업이 끝나야 실행될 수 있는 후속 작업들
+	std::mutex SubsequentsMutex;
+	TArray<FJobRef> Subsequents;
+};
+
+/**
+ * @brief 스레드별 작업 덱과 작업 훔치기(work stealing)를 사용하는 잡 시스템
+ * 각 스레드는 자기 덱의 뒤쪽에서 (LIFO) 꺼내 실행하고, 비어 있으면 다른 스레드 덱의 앞쪽에서 훔쳐옵니다.
+ * 덱 0번은 메인 스레드(와 워커가 아닌 스레드)용이며, 메인 스레드는 Wait 중에 작업을 함께 처리합니다.
+ */
+class FJobSystem
+{
+public:
+	static FJobSystem& GetInstance()
+	{
+		static FJobSystem Instance;
+		return Instance;
+	}
+
+	/**
+	 * @brief 워커 스레드를 생성합니다.
+	 * @param InWorkerCount 워커 수. 음수면 (하드웨어 스레드 수 - 1), 0이면 모든 작업을 호출 스레드에서 즉시 실행
+	 */
+	void Initialize(int32 InWorkerCount = -1);
+	void Shutdown();
+
+	/**
+	 * @brief 작업을 제출합니다. 선행 작업이 모두 끝나면 실행 큐에 들어갑니다.
+	 * @return Wait / 다른 작업의 선행 작업으로 쓸 수 있는 핸들
+	 */
+	FJobRef Launch(std::function<void()> InTask, const TArray<FJobRef>& InPrerequisites = TArray<FJobRef>());
+
+	/** @brief 작업이 끝날 때까지 대기합니다. 대기 중에는 호출 스레드도 큐의 작업을 실행합니다. */
+	void Wait(const FJobRef& InJob);
+	void WaitAll(const TArray<FJobRef>& InJobs);
+
+	int32 GetWorkerCount() const { return static_cast<int32>(Workers.Num()); }
+
+private:
+	FJobSystem() = default;
+	~FJobSystem();
+	FJobSystem(const FJobSystem&) = delete;
+	FJobSystem& operator=(const FJobSystem&) = delete;
+
+	struct FJobDeque
+	{
+		std::mutex Mutex;
+		std::deque<FJobRef> Jobs;
+	};
+
+	void WorkerMain(int32 InQueueIndex);
+	void Schedule(const FJobRef& InJob);
+	void Execute(const FJobRef& InJob);
+	bool TryExecuteOne(int32 InQueueIndex);
+	int32 GetCurrentQueueIndex() const;
+
+	TArray<std::unique_ptr<FJobDeque>> Queues;
+	TArray<std::thread> Workers;
+
+	std::atomic<bool> bRunning{ false };
+	std::atomic<int32> QueuedJobCount{ 0 };
+	std::mutex WakeMutex;
+	std::condition_variable WakeCondition;
+};
+
+/**
+ * @brief [0, InNum) 범위를 배치로 나눠 워커들과 호출 스레드가 함께 실행합니다.
+ * 모든 인덱스가 처리된 뒤에 반환하며, 워커가 없거나 InNum이 InMinBatchSize 이하면 호출 스레드에서 순차 실행합니다.
+ * InBody는 서로 다른 인덱스에 대해 동시에 호출되므로 공유 상태를 쓰지 않아야 합니다.
+ */
+template<typename FuncType>
+void ParallelFor(int32 InNum, const FuncType& InBody, int32 InMinBatchSize = 64)
+{
+	FJobSystem& JobSystem = FJobSystem::GetInstance();
+	const int32 WorkerCount = JobSystem.GetWorkerCount();
+	InMinBatchSize = std::max(1, InMinBatchSize);
+
+	if (WorkerCount == 0 || InNum <= InMinBatchSize)
+	{
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			InBody(Index);
+		}
+		return;
+	}
+
+	// 스레드당 4배치 정도로 나눠 먼저 끝난 스레드가 나머지를 가져가도록 함
+	const int32 ThreadCount = WorkerCount + 1;
+	const int32 BatchSize = std::max(InMinBatchSize, (InNum + ThreadCount * 4 - 1) / (ThreadCount * 4));
+	const int32 BatchCount = (InNum + BatchSize - 1) / BatchSize;
+
+	std::atomic<int32> NextBatch{ 0 };
+	auto RunBatches = [&]()
+	{
+		for (;;)
+		{
+			const int32 Batch = NextBatch.fetch_add(1, std::memory_order_relaxed);
+			if (Batch >= BatchCount)
+			{
+				return;
+			}
+
+			const int32 Begin = Batch * BatchSize;
+			const int32 End = std::min(InNum, Begin + BatchSize);
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				InBody(Index);
+			}
+		}
+	};
+
+	TArray<FJobRef> Helpers;
+	const int32 HelperCount = std::min(WorkerCount, BatchCount - 1);
+	Helpers.Reserve(HelperCount);
+	for (int32 i = 0; i < HelperCount; ++i)
+	{
+		Helpers.Add(JobSystem.Launch(RunBatches));
+	}
+
+	RunBatches();
+	JobSystem.WaitAll(Helpers);
+}
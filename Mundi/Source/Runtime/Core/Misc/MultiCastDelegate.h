@@ -1,105 +1,246 @@
 ﻿#pragma once
 
 #include "DelegateBinding.h"
-#include "StaticBinding.h"
-#include "DynamicBinding.h"
-#include "LambdaBinding.h"
+#include "DelegateInstance.h"
 #define DECLARE_MULTICAST_DELEGATE(Name, ...) TMultiCastDelegate<__VA_ARGS__> Name
 
+/**
+ * 멀티캐스트 델리게이트
+ * 바인딩은 TDelegateInstance 값으로 연속 배열에 들어 있어 Broadcast가 바인딩마다 포인터를 따라가지 않는다.
+ * 핸들은 (세대 | 핸들 슬롯)이고 핸들 슬롯이 바인딩 위치를 기억하므로 핸들 제거는 swap-and-pop으로 O(1)이다.
+ * Broadcast 도중의 Add/Remove는 표시만 해 두었다가 가장 바깥 Broadcast가 끝날 때 반영한다.
+ */
 template<typename... Args>
 class TMultiCastDelegate
 {
 public:
-	using LambdaType = std::function<void(Args...)>;
 	using StaticType = void(*)(Args...);
+	using DelegateInstanceType = TDelegateInstance<Args...>;
 
-	~TMultiCastDelegate()
-	{
-		ClearBindings();
-	}
-
-	// Add가 호출되는 시점에 리스트에 빈 공간이 없어야함
 	FBindingHandle AddStatic(StaticType InFunction)
 	{
-		FBindingHandle Handle{ FBindingHandle(NextID++) };
-
-		Bindings.Add(new FStaticBinding(Handle, InFunction));
-		return Handle;
+		return AddBinding(DelegateInstanceType::CreateStatic(InFunction));
 	}
 
 	// 람다를 쓰는 경우 유효성 검사는 프로그래머가 직접 해줘야 함.
-	FBindingHandle AddLambda(LambdaType InFunction)
+	template<typename FunctorType>
+	FBindingHandle AddLambda(FunctorType&& InFunction)
 	{
-		FBindingHandle Handle{ FBindingHandle(NextID++) };
-		Bindings.Add(new FLambdaBinding(Handle, InFunction));
-		return Handle;
+		return AddBinding(DelegateInstanceType::CreateLambda(std::forward<FunctorType>(InFunction)));
 	}
 
 	template<typename T>
 	FBindingHandle AddDynamic(T* Instance, void(T::* InFunction)(Args...) )
 	{
-		FBindingHandle Handle{ FBindingHandle(NextID++) };
-		Bindings.Add(new FDynamicBinding(Handle, Instance, InFunction));
-		return Handle;
+		return AddBinding(DelegateInstanceType::CreateDynamic(Instance, InFunction));
 	}
 
-	// 객체가 소멸될 때 명시적으로 Remove를 호출해줘야함.
-	// 안 해줘도 WeakPtr을 쓰기 때문에 문제가 생기진 않는데 쌓이면 쌓일 수록 성능 부담이 생길 수도 있음.
-	// 가비지컬렉터처럼 일정 주기마다 알아서 리스트 관리를 해주면 좋을듯.
+	// 객체가 소멸될 때 명시적으로 Remove를 호출해주는 것이 좋지만,
+	// 안 해줘도 WeakPtr을 쓰기 때문에 죽은 바인딩은 다음 Broadcast에서 정리된다.
 	void Remove(FBindingHandle Handle)
 	{
-		for (uint32 Index = 0; Index < Bindings.Num(); Index++)
+		const uint32 HandleSlot = Handle.ID & HandleSlotMask;
+		const uint32 Generation = Handle.ID >> HandleSlotBits;
+		if (HandleSlot >= static_cast<uint32>(HandleEntries.Num()) || HandleEntries[HandleSlot].Generation != Generation)
 		{
-			if (Bindings[Index] && Bindings[Index]->GetHandle() == Handle)
-			{
-				delete Bindings[Index];
-				
-				Bindings.SwapAndPop(Index);
-				break;
-			}
+			return;
 		}
+		RemoveByHandleSlot(HandleSlot);
 	}
+
 	template<typename T>
 	void Remove(T* Instance)
 	{
-		for (int32 Index = Bindings.Num()-1; Index >= 0; Index--)
+		for (int32 Index = Bindings.Num() - 1; Index >= 0; Index--)
+		{
+			if (!Bindings[Index].bPendingRemove && Bindings[Index].Delegate.IsBoundTo(Instance))
+			{
+				RemoveByHandleSlot(Bindings[Index].HandleSlot);
+			}
+		}
+		for (FBinding& Binding : PendingAdds)
 		{
-			if (Bindings[Index] && Bindings[Index]->IsBoundTo(Instance))
+			if (!Binding.bPendingRemove && Binding.Delegate.IsBoundTo(Instance))
 			{
-				delete Bindings[Index];
-				Bindings.SwapAndPop(Index);
+				RemoveByHandleSlot(Binding.HandleSlot);
 			}
 		}
 	}
+
 	void Broadcast(Args... InArgs)
 	{
-		for (IDelegateBinding<Args...>* Binding : Bindings)
+		// Broadcast 중에는 Bindings의 크기와 위치가 바뀌지 않는다 (추가는 PendingAdds로, 제거는 표시만)
+		++BroadcastDepth;
+		const int32 Count = Bindings.Num();
+		for (int32 Index = 0; Index < Count; ++Index)
 		{
-			if (Binding && Binding->IsValid())
+			FBinding& Binding = Bindings[Index];
+			if (Binding.bPendingRemove)
 			{
-				Binding->Execute(InArgs...);
+				continue;
 			}
+			if (!Binding.Delegate.IsValid())
+			{
+				RemoveByHandleSlot(Binding.HandleSlot);
+				continue;
+			}
+			Binding.Delegate.Execute(InArgs...);
+		}
+
+		if (--BroadcastDepth == 0)
+		{
+			FlushPending();
 		}
 	}
 
+	int32 Num() const { return Bindings.Num() + PendingAdds.Num(); }
+	bool IsBound() const { return Num() > 0; }
 
+	void Clear()
+	{
+		if (BroadcastDepth > 0)
+		{
+			for (TArray<FBinding>* List : { &Bindings, &PendingAdds })
+			{
+				for (FBinding& Binding : *List)
+				{
+					if (!Binding.bPendingRemove)
+					{
+						RemoveByHandleSlot(Binding.HandleSlot);
+					}
+				}
+			}
+			return;
+		}
+
+		Bindings.clear();
+		PendingAdds.clear();
+		HandleEntries.clear();
+		FreeHandleSlots.clear();
+		bHasPendingRemovals = false;
+	}
 
 private:
-	// 현재 Duplicate에서 얕은복사하면서 NextID가 그대로 유지되고있음.
-	// Duplicate포함 총 4,294,967,296개 이상의 객체를 바인딩 하는 경우 문제가 생김
-	// Duplicate하거나 PIE에서 돌아올 때 초기화 해줘야 함.
-	uint32 NextID = 0;
-	TArray<IDelegateBinding<Args...>*> Bindings;
+	// 핸들 ID 하위 20비트는 핸들 슬롯, 상위 12비트는 세대. 슬롯을 재사용해도 이전 핸들로는 지울 수 없다
+	static constexpr uint32 HandleSlotBits = 20;
+	static constexpr uint32 HandleSlotMask = (1u << HandleSlotBits) - 1;
+	static constexpr uint32 MaxGeneration = (1u << (32 - HandleSlotBits)) - 1;
+
+	struct FBinding
+	{
+		DelegateInstanceType Delegate;
+		uint32 HandleSlot = 0;
+		bool bPendingRemove = false;
+	};
+
+	struct FHandleEntry
+	{
+		uint32 Generation = 1;
+		int32 BindingIndex = -1;	// bPendingAdd면 PendingAdds, 아니면 Bindings 안의 위치
+		bool bPendingAdd = false;
+	};
+
+	TArray<FBinding> Bindings;
+	TArray<FBinding> PendingAdds;
+	TArray<FHandleEntry> HandleEntries;
+	TArray<uint32> FreeHandleSlots;
+	int32 BroadcastDepth = 0;
+	bool bHasPendingRemovals = false;
+
+	FBindingHandle AddBinding(DelegateInstanceType&& InDelegate)
+	{
+		uint32 HandleSlot;
+		if (!FreeHandleSlots.IsEmpty())
+		{
+			HandleSlot = FreeHandleSlots.back();
+			FreeHandleSlots.pop_back();
+		}
+		else
+		{
+			HandleSlot = static_cast<uint32>(HandleEntries.Emplace());
+		}
+
+		FHandleEntry& Entry = HandleEntries[HandleSlot];
+		FBinding NewBinding{ std::move(InDelegate), HandleSlot, false };
+		if (BroadcastDepth > 0)
+		{
+			Entry.bPendingAdd = true;
+			Entry.BindingIndex = PendingAdds.Emplace(std::move(NewBinding));
+		}
+		else
+		{
+			Entry.bPendingAdd = false;
+			Entry.BindingIndex = Bindings.Emplace(std::move(NewBinding));
+		}
+
+		return FBindingHandle((Entry.Generation << HandleSlotBits) | HandleSlot);
+	}
 
-	void ClearBindings()
+	void RemoveByHandleSlot(uint32 InHandleSlot)
 	{
-		for (IDelegateBinding<Args...>* Binding : Bindings)
+		FHandleEntry& Entry = HandleEntries[InHandleSlot];
+		const int32 BindingIndex = Entry.BindingIndex;
+
+		if (Entry.bPendingAdd)
+		{
+			PendingAdds[BindingIndex].bPendingRemove = true;
+		}
+		else if (BroadcastDepth > 0)
 		{
-			if (Binding)
+			Bindings[BindingIndex].bPendingRemove = true;
+			bHasPendingRemovals = true;
+		}
+		else
+		{
+			const int32 LastIndex = Bindings.Num() - 1;
+			if (BindingIndex != LastIndex)
 			{
-				delete Binding;
+				Bindings[BindingIndex] = std::move(Bindings[LastIndex]);
+				HandleEntries[Bindings[BindingIndex].HandleSlot].BindingIndex = BindingIndex;
 			}
+			Bindings.pop_back();
 		}
-		Bindings.clear();
+
+		// 세대를 올려 기존 핸들을 무효화하고 슬롯은 재사용
+		Entry.Generation = Entry.Generation == MaxGeneration ? 1 : Entry.Generation + 1;
+		Entry.BindingIndex = -1;
+		Entry.bPendingAdd = false;
+		FreeHandleSlots.Add(InHandleSlot);
+	}
+
+	// 가장 바깥 Broadcast가 끝난 뒤 지연된 제거/추가 반영
+	void FlushPending()
+	{
+		if (bHasPendingRemovals)
+		{
+			int32 WriteIndex = 0;
+			for (int32 ReadIndex = 0; ReadIndex < Bindings.Num(); ++ReadIndex)
+			{
+				if (Bindings[ReadIndex].bPendingRemove)
+				{
+					continue;
+				}
+				if (WriteIndex != ReadIndex)
+				{
+					Bindings[WriteIndex] = std::move(Bindings[ReadIndex]);
+				}
+				HandleEntries[Bindings[WriteIndex].HandleSlot].BindingIndex = WriteIndex;
+				++WriteIndex;
+			}
+			Bindings.resize(WriteIndex);
+			bHasPendingRemovals = false;
+		}
+
+		for (FBinding& Binding : PendingAdds)
+		{
+			if (Binding.bPendingRemove)
+			{
+				continue;
+			}
+			FHandleEntry& Entry = HandleEntries[Binding.HandleSlot];
+			Entry.bPendingAdd = false;
+			Entry.BindingIndex = Bindings.Emplace(std::move(Binding));
+		}
+		PendingAdds.clear();
 	}
-};
\ No newline at end of file
+};
@@ -2,6 +2,7 @@
 // Name.h
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
@@ -11,19 +12,27 @@
 // ──────────────────────────────
 struct FNameEntry
 {
-    FString Display;    // 원문
-    FString Comparison; // lower-case
+    const char* Display = nullptr;      // 원문 (처음 등록된 대소문자 그대로, 널 종료)
+    const char* Comparison = nullptr;   // lower-case (널 종료)
+    uint32 Length = 0;
+    uint32 Hash = 0;                    // Comparison의 FNV-1a
+
+    std::string_view GetDisplay() const { return std::string_view(Display, Length); }
+    std::string_view GetComparison() const { return std::string_view(Comparison, Length); }
 };
 
+/**
+ * 이름 인턴 풀 (정의는 FName.cpp)
+ * 해시 상위 비트로 고른 샤드마다 개방 주소 테이블과 문자열 아레나를 두고, 샤드별 읽기/쓰기 락으로 여러 로더 스레드가 동시에 인턴할 수 있다.
+ * 이미 있는 이름은 대소문자 무시 해시 한 번과 공유 락만으로 찾으며 힙 할당이 없다.
+ * 엔트리는 해제되지 않으므로 Get이 돌려준 참조와 문자열은 프로그램이 끝날 때까지 유효하다.
+ */
 class FNamePool
 {
 public:
-    static uint32 Add(const FString& InStr);
+    static uint32 Add(std::string_view InStr);
     static const FNameEntry& Get(uint32 Index);
-
-private:
-    static TArray<FNameEntry> Entries; // 정의는 Name.cpp
-    static std::unordered_map<FString, uint32> NameMap; // 빠른 검색용
+    static uint32 Num();
 };
 
 // ──────────────────────────────
@@ -35,10 +44,11 @@ struct FName
     uint32 ComparisonIndex = -1;
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
-    FName(const FString& InStr) { Init(InStr); }
+    FName(const char* InStr) { Init(std::string_view(InStr)); }
+    FName(const FString& InStr) { Init(std::string_view(InStr)); }
+    FName(std::string_view InStr) { Init(InStr); }
 
-    void Init(const FString& InStr)
+    void Init(std::string_view InStr)
     {
         int32_t Index = FNamePool::Add(InStr);
         DisplayIndex = Index;
@@ -46,20 +56,48 @@ struct FName
     }
 
     bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex; }
-    FString ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+    FString ToString() const { return FString(FNamePool::Get(DisplayIndex).GetDisplay()); }
+    std::string_view ToStringView() const { return FNamePool::Get(DisplayIndex).GetDisplay(); }
 
     friend FName operator+(const FName& A, const FName& B)
     {
-        return FName(A.ToString() + B.ToString());
+        return Concat(A.ToStringView(), B.ToStringView());
     }
 
     friend FName operator+(const FName& A, const FString& B)
     {
-        return FName(A.ToString() + B);
+        return Concat(A.ToStringView(), B);
     }
 
     friend FName operator+(const FString& A, const FName& B)
     {
-        return FName(A + B.ToString());
+        return Concat(A, B.ToStringView());
     }
-};
\ No newline at end of file
+
+private:
+    // 짧은 이름은 스택 버퍼에서 이어 붙여 임시 FString 할당 없이 인턴
+    static FName Concat(std::string_view A, std::string_view B)
+    {
+        char Buffer[256];
+        if (A.size() + B.size() <= sizeof(Buffer))
+        {
+            std::copy(A.begin(), A.end(), Buffer);
+            std::copy(B.begin(), B.end(), Buffer + A.size());
+            return FName(std::string_view(Buffer, A.size() + B.size()));
+        }
+        return FName(FString(A) + FString(B));
+    }
+};
+
+// 비교 인덱스가 이름마다 유일하므로 TMap<FName, ...>은 문자열을 다시 해시하지 않고 인덱스를 그대로 쓴다
+namespace std
+{
+    template<>
+    struct hash<FName>
+    {
+        size_t operator()(const FName& InName) const noexcept
+        {
+            return static_cast<size_t>(InName.ComparisonIndex);
+        }
+    };
+}
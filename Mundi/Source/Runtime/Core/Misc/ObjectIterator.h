@@ -2,28 +2,32 @@
 
 #include "ObjectFactory.h"
 
+// TObject와 그 하위 클래스들의 인스턴스 목록(UClass::Instances)만 순회한다.
+// 전체 GUObjectArray를 훑지 않으므로 비용은 일치하는 객체 수에 비례한다.
+// 루프 본문에서 객체를 삭제하면 목록이 swap-and-pop으로 바뀌어 일부 객체를 건너뛸 수 있다.
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator()
+		: Classes(&TObject::StaticClass()->GetDerivedClasses())
 	{
-		++(*this); // 첫 번째 유효 객체로 이동
+		AdvanceToNextValidObject(); // 첫 번째 유효 객체로 이동
 	}
 
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
+		++ObjectIndex;
 		AdvanceToNextValidObject();
 		return *this;
 	}
 
 	// 현재 객체에 접근
+	// 루프 본문에서 객체가 삭제되고 슬롯이 다른 객체에 재사용되었으면 시리얼 번호가 달라지므로 nullptr
 	TObject* operator*() const
 	{
-		// 이 시점의 CurrentIndex는 유효한 TObject를 가리키고 있어야 함
-		return static_cast<TObject*>(GUObjectArray[CurrentIndex]);
+		return static_cast<TObject*>(UObject::GetObjectFromIndex(CurrentInternalIndex, CurrentSerialNumber));
 	}
 
 	// 현재 객체에 접근 (포인터 연산자)
@@ -35,34 +39,42 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentIndex != Other.CurrentIndex;
+		return ClassIndex != Other.ClassIndex || ObjectIndex != Other.ObjectIndex;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
-		// CurrentIndex가 배열 범위 내에 있는지 확인
-		return CurrentIndex < GUObjectArray.Num();
+		// 아직 순회할 클래스가 남아 있는지 확인
+		return ClassIndex < Classes->Num();
 	}
 
 private:
-	// 현재 인덱스부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
+	// 현재 위치부터 시작하여 다음 객체를 찾는 헬퍼 함수. 현재 클래스 목록이 끝나면 다음 하위 클래스로 넘어간다
 	void AdvanceToNextValidObject()
 	{
-		while (CurrentIndex < GUObjectArray.Num())
+		while (ClassIndex < Classes->Num())
 		{
-			UObject* Object = GUObjectArray[CurrentIndex];
-			// 현재 객체가 유효하고, TObject 타입이면 검색 종료
-			if (Object && Object->IsA<TObject>())
+			const TArray<UObject*>& Instances = (*Classes)[ClassIndex]->Instances;
+			if (ObjectIndex < Instances.Num())
 			{
-				break;
+				const UObject* Object = Instances[ObjectIndex];
+				CurrentInternalIndex = Object->InternalIndex;
+				CurrentSerialNumber = GUObjectSerialNumbers[CurrentInternalIndex];
+				return;
 			}
 
-			// 다음 인덱스로 이동
-			++CurrentIndex;
+			++ClassIndex;
+			ObjectIndex = 0;
 		}
 	}
 
 private:
-	int32 CurrentIndex = -1;
+	const TArray<UClass*>* Classes = nullptr;
+	int32 ClassIndex = 0;
+	int32 ObjectIndex = 0;
+
+	// 찾은 객체의 GUObjectArray 슬롯과 시리얼 번호
+	uint32 CurrentInternalIndex = UINT32_MAX;
+	uint32 CurrentSerialNumber = 0;
 };
@@ -0,0 +1,218 @@
+﻿#include "pch.h"
+#include "ObjectIteratorBenchmark.h"
+#include "CommandLineOptions.h"
+#include "ObjectIterator.h"
+#include "PlatformTime.h"
+#include "Line.h"
+#include "Texture.h"
+#include "StaticMesh.h"
+
+#include <filesystem>
+#include <iomanip>
+#include <random>
+
+namespace
+{
+	int32 CountLiveObjects()
+	{
+		int32 Count = 0;
+		for (UObject* Object : GUObjectArray)
+		{
+			Count += Object ? 1 : 0;
+		}
+		return Count;
+	}
+}
+
+FObjectIteratorBenchmark::FObjectIteratorBenchmark(const FObjectIteratorBenchmarkConfig& InConfig)
+	: Config(InConfig)
+{
+}
+
+bool FObjectIteratorBenchmark::ParseCommandLine(const FString& InCmdLine, FObjectIteratorBenchmarkConfig& OutConfig)
+{
+	if (!FCommandLine::HasFlag(InCmdLine, "ObjectIteratorBenchmark"))
+	{
+		return false;
+	}
+
+	FCommandLine::ParseIntOption(InCmdLine, "IteratorObjects", OutConfig.ObjectCount);
+	FCommandLine::ParseIntOption(InCmdLine, "IteratorRepeat", OutConfig.RepeatCount);
+
+	FString Value;
+	FCommandLine::ParseUIntOption(InCmdLine, "IteratorSeed", OutConfig.Seed);
+	if (FCommandLine::FindOption(InCmdLine, "BenchmarkOutput", Value))
+	{
+		OutConfig.OutputDir = Value;
+	}
+	return true;
+}
+
+bool FObjectIteratorBenchmark::Run()
+{
+	Results.Empty();
+
+	const int32 LiveCountBefore = CountLiveObjects();
+
+	// 1% UStaticMesh, 10% UTexture, 나머지 ULine. 리소스는 로드하지 않으므로 GPU 자원 없이 생성/삭제된다
+	TArray<UObject*> Created;
+	Created.Reserve(Config.ObjectCount);
+	for (int32 i = 0; i < Config.ObjectCount; ++i)
+	{
+		if (i % 100 == 0)
+		{
+			Created.Add(NewObject<UStaticMesh>());
+		}
+		else if (i % 10 == 1)
+		{
+			Created.Add(NewObject<UTexture>());
+		}
+		else
+		{
+			Created.Add(NewObject<ULine>());
+		}
+	}
+
+	RunQuery<UStaticMesh>("UStaticMesh");
+	RunQuery<UResourceBase>("UResourceBase");
+	RunQuery<ULine>("ULine");
+	RunQuery<UObject>("UObject");
+
+	RunDelete(Created, LiveCountBefore);
+
+	std::error_code ErrorCode;
+	std::filesystem::create_directories(Config.OutputDir, ErrorCode);
+
+	const FString CSVPath = Config.OutputDir + "/ObjectIteratorBenchmark.csv";
+	if (!WriteCSV(CSVPath))
+	{
+		UE_LOG("[ObjectIteratorBenchmark] Failed to write results to %s", Config.OutputDir.c_str());
+		return false;
+	}
+	UE_LOG("[ObjectIteratorBenchmark] %d results written to %s", static_cast<int32>(Results.Num()), Config.OutputDir.c_str());
+
+	for (const FObjectIteratorBenchmarkResult& Result : Results)
+	{
+		if (!Result.bValid)
+		{
+			UE_LOG("[ObjectIteratorBenchmark] FAILED: %s %s result is inconsistent", Result.Query.c_str(), Result.Method.c_str());
+			return false;
+		}
+	}
+	return true;
+}
+
+template<typename TObject>
+void FObjectIteratorBenchmark::RunQuery(const FString& InQuery)
+{
+	FObjectIteratorBenchmarkResult FullScan;
+	FullScan.Query = InQuery;
+	FullScan.Method = "FullScan";
+	FullScan.ObjectCount = GUObjectArray.Num();
+	FullScan.TotalMS = (std::numeric_limits<double>::max)();
+
+	FObjectIteratorBenchmarkResult ClassList = FullScan;
+	ClassList.Method = "ClassList";
+
+	for (int32 Repeat = 0; Repeat < Config.RepeatCount; ++Repeat)
+	{
+		// 기존 TObjectIterator 방식: 모든 슬롯을 훑으며 IsA 검사
+		{
+			int32 MatchCount = 0;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (UObject* Object : GUObjectArray)
+			{
+				if (Object && Object->IsA<TObject>())
+				{
+					++MatchCount;
+				}
+			}
+			FullScan.TotalMS = std::min(FullScan.TotalMS, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+			FullScan.MatchCount = MatchCount;
+		}
+
+		{
+			int32 MatchCount = 0;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (TObjectIterator<TObject> It; It; ++It)
+			{
+				if (*It)
+				{
+					++MatchCount;
+				}
+			}
+			ClassList.TotalMS = std::min(ClassList.TotalMS, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+			ClassList.MatchCount = MatchCount;
+		}
+	}
+
+	if (FullScan.MatchCount != ClassList.MatchCount)
+	{
+		FullScan.bValid = false;
+		ClassList.bValid = false;
+		UE_LOG("[ObjectIteratorBenchmark] %s match count mismatch: FullScan=%d ClassList=%d",
+			InQuery.c_str(), FullScan.MatchCount, ClassList.MatchCount);
+	}
+
+	Results.Add(FullScan);
+	Results.Add(ClassList);
+
+	UE_LOG("[ObjectIteratorBenchmark] %-14s N=%-7d Matches=%-7d FullScan=%.3fms ClassList=%.3fms",
+		InQuery.c_str(), FullScan.ObjectCount, ClassList.MatchCount, FullScan.TotalMS, ClassList.TotalMS);
+}
+
+void FObjectIteratorBenchmark::RunDelete(TArray<UObject*>& InObjects, int32 InLiveCountBefore)
+{
+	// 실제 씬 정리처럼 생성 순서와 무관한 순서로 지워 슬롯 조회가 순서에 기대지 않는지 확인한다
+	std::mt19937 Random(Config.Seed);
+	std::shuffle(InObjects.begin(), InObjects.end(), Random);
+
+	FObjectIteratorBenchmarkResult Delete;
+	Delete.Query = "DeleteObject";
+	Delete.Method = "Shuffled";
+	Delete.ObjectCount = GUObjectArray.Num();
+	Delete.MatchCount = InObjects.Num();
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (UObject* Object : InObjects)
+	{
+		ObjectFactory::DeleteObject(Object);
+	}
+	Delete.TotalMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	InObjects.Empty();
+
+	const int32 LiveCountAfter = CountLiveObjects();
+	if (LiveCountAfter != InLiveCountBefore)
+	{
+		Delete.bValid = false;
+		UE_LOG("[ObjectIteratorBenchmark] live object count mismatch after delete: before=%d after=%d",
+			InLiveCountBefore, LiveCountAfter);
+	}
+
+	Results.Add(Delete);
+
+	UE_LOG("[ObjectIteratorBenchmark] %-14s N=%-7d Deleted=%-7d Shuffled=%.3fms",
+		Delete.Query.c_str(), Delete.ObjectCount, Delete.MatchCount, Delete.TotalMS);
+}
+
+bool FObjectIteratorBenchmark::WriteCSV(const FString& InFilePath) const
+{
+	std::ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	File << "Query,Method,ObjectCount,MatchCount,TotalMS,Valid\n";
+	File << std::fixed << std::setprecision(6);
+	for (const FObjectIteratorBenchmarkResult& Result : Results)
+	{
+		File << Result.Query << ','
+			<< Result.Method << ','
+			<< Result.ObjectCount << ','
+			<< Result.MatchCount << ','
+			<< Result.TotalMS << ','
+			<< (Result.bValid ? 1 : 0) << '\n';
+	}
+	return true;
+}
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+/**
+ * @brief TObjectIterator 벤치마크 설정. 커맨드라인(-ObjectIteratorBenchmark ...)에서 채워집니다.
+ */
+struct FObjectIteratorBenchmarkConfig
+{
+	int32 ObjectCount = 100000;		// 생성할 혼합 객체 수
+	int32 RepeatCount = 5;			// 질의별 반복 횟수 (가장 빠른 값을 기록)
+	uint32 Seed = 1337;				// 삭제 순서를 섞는 난수 시드
+
+	FString OutputDir = "Saved/Benchmark";
+};
+
+/**
+ * @brief 측정 결과 한 줄 (CSV 한 행)
+ */
+struct FObjectIteratorBenchmarkResult
+{
+	FString Query;			// 찾는 클래스 이름
+	FString Method;			// FullScan (GUObjectArray 전체 + IsA) / ClassList (TObjectIterator) / Shuffled (DeleteObject)
+	int32 ObjectCount = 0;	// 질의 시점의 GUObjectArray 크기
+	int32 MatchCount = 0;
+	double TotalMS = 0.0;
+	// FullScan과 ClassList의 결과 수가 같았는지 (삭제 행은 삭제 후 살아있는 객체 수가 생성 전과 같은지)
+	bool bValid = true;
+};
+
+/**
+ * @brief 클래스별 인스턴스 목록 기반 TObjectIterator 와 기존 전체 스캔 비교
+ * ULine / UTexture / UStaticMesh 를 섞어 만든 뒤 드문 클래스, 하위 클래스를 포함하는 기반 클래스,
+ * 흔한 클래스를 각각 찾고, 만든 객체를 무작위 순서로 삭제하는 시간까지 CSV 로 저장합니다.
+ */
+class FObjectIteratorBenchmark
+{
+public:
+	explicit FObjectIteratorBenchmark(const FObjectIteratorBenchmarkConfig& InConfig);
+
+	/**
+	 * @brief 커맨드라인에 -ObjectIteratorBenchmark 가 있으면 설정을 채우고 true를 반환합니다.
+	 * 옵션: -IteratorObjects=N -IteratorRepeat=N -IteratorSeed=N -BenchmarkOutput=Dir
+	 */
+	static bool ParseCommandLine(const FString& InCmdLine, FObjectIteratorBenchmarkConfig& OutConfig);
+
+	/** @return 모든 질의의 두 방식 결과 수가 같고 CSV를 썼으면 true */
+	bool Run();
+
+	bool WriteCSV(const FString& InFilePath) const;
+
+	const TArray<FObjectIteratorBenchmarkResult>& GetResults() const { return Results; }
+
+private:
+	template<typename TObject>
+	void RunQuery(const FString& InQuery);
+
+	void RunDelete(TArray<UObject*>& InObjects, int32 InLiveCountBefore);
+
+	FObjectIteratorBenchmarkConfig Config;
+	TArray<FObjectIteratorBenchmarkResult> Results;
+};
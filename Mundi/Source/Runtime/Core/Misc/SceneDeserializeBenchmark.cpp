@@ -0,0 +1,227 @@
+﻿#include "pch.h"
+#include "SceneDeserializeBenchmark.h"
+#include "CommandLineOptions.h"
+#include "PlatformTime.h"
+#include "Level.h"
+
+#include <filesystem>
+#include <iomanip>
+
+namespace
+{
+	// 역직렬화 순서대로 모은 "Type" 문자열과 해당 JSON 노드
+	struct FTypeEntry
+	{
+		FString TypeString;
+		const JSON* Json = nullptr;
+	};
+
+	void CollectTypeEntries(const JSON& InSceneJson, TArray<FTypeEntry>& OutEntries)
+	{
+		if (!InSceneJson.hasKey("Actors"))
+		{
+			return;
+		}
+
+		for (const auto& Pair : InSceneJson.at("Actors").ObjectRange())
+		{
+			const JSON& ActorJson = Pair.second;
+			if (ActorJson.hasKey("Type"))
+			{
+				OutEntries.Add({ ActorJson.at("Type").ToString(), &ActorJson });
+			}
+
+			if (!ActorJson.hasKey("OwnedComponents"))
+			{
+				continue;
+			}
+			for (const JSON& ComponentJson : ActorJson.at("OwnedComponents").ArrayRange())
+			{
+				if (ComponentJson.hasKey("Type"))
+				{
+					OutEntries.Add({ ComponentJson.at("Type").ToString(), &ComponentJson });
+				}
+			}
+		}
+	}
+}
+
+FSceneDeserializeBenchmark::FSceneDeserializeBenchmark(const FSceneDeserializeBenchmarkConfig& InConfig)
+	: Config(InConfig)
+{
+}
+
+bool FSceneDeserializeBenchmark::ParseCommandLine(const FString& InCmdLine, FSceneDeserializeBenchmarkConfig& OutConfig)
+{
+	if (!FCommandLine::HasFlag(InCmdLine, "SceneDeserializeBenchmark"))
+	{
+		return false;
+	}
+
+	FCommandLine::ParseIntOption(InCmdLine, "SceneRepeat", OutConfig.RepeatCount);
+	FCommandLine::ParseIntOption(InCmdLine, "SceneLevelRepeat", OutConfig.LevelRepeatCount);
+
+	FString Value;
+	if (FCommandLine::FindOption(InCmdLine, "BenchmarkScene", Value))
+	{
+		OutConfig.ScenePath = Value;
+	}
+	if (FCommandLine::FindOption(InCmdLine, "BenchmarkOutput", Value))
+	{
+		OutConfig.OutputDir = Value;
+	}
+	return true;
+}
+
+double FSceneDeserializeBenchmark::LoadLevelOnce(const JSON& InSceneJson, int32& OutActorCount) const
+{
+	// Serialize가 JSON을 비const로 받으므로 측정 밖에서 복사해 둔다
+	JSON LevelJson = InSceneJson;
+	std::unique_ptr<ULevel> Level = ULevelService::CreateDefaultLevel();
+	const int32 DefaultActorCount = Level->GetActors().Num();
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Level->Serialize(true, LevelJson);
+	const double ElapsedMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+	OutActorCount = Level->GetActors().Num() - DefaultActorCount;
+
+	// UWorld::SetLevel과 같은 방식으로 정리
+	for (AActor* Actor : Level->GetActors())
+	{
+		ObjectFactory::DeleteObject(Actor);
+	}
+	Level->Clear();
+	return ElapsedMS;
+}
+
+bool FSceneDeserializeBenchmark::Run()
+{
+	Results.Empty();
+
+	JSON SceneJson;
+	if (!FJsonSerializer::LoadJsonFromFile(SceneJson, Config.ScenePath))
+	{
+		UE_LOG("[SceneDeserializeBenchmark] Failed to load scene %s", Config.ScenePath.c_str());
+		return false;
+	}
+
+	TArray<FTypeEntry> Entries;
+	CollectTypeEntries(SceneJson, Entries);
+
+	// 레지스트리와 프로퍼티 테이블 색인은 첫 조회 때 한 번 일어나므로 측정 전에 끝내 둔다
+	UClass::GetClassRegistry();
+
+	// 메시 / 텍스처는 처음 로드할 때만 디스크에서 읽으므로 한 번 미리 로드해 두 방식이 같은 조건에서 측정되게 한다
+	int32 WarmupActorCount = 0;
+	LoadLevelOnce(SceneJson, WarmupActorCount);
+
+	auto Measure = [this, &Entries, &SceneJson](const char* InMethod, bool bInLinear)
+	{
+		UClass* (*FindClassFunc)(const FName&) = bInLinear ? &UClass::FindClassLinear : &UClass::FindClass;
+
+		FSceneDeserializeBenchmarkResult Result;
+		Result.Method = InMethod;
+		Result.LookupCount = Entries.Num();
+		Result.ClassLookupMS = (std::numeric_limits<double>::max)();
+		Result.PropertyMS = (std::numeric_limits<double>::max)();
+
+		TArray<UClass*> Classes;
+		Classes.SetNum(Entries.Num());
+
+		for (int32 Repeat = 0; Repeat < Config.RepeatCount; ++Repeat)
+		{
+			// Level/Actor::Serialize와 같이 FString → FName 변환 후 클래스 검색
+			int32 ResolvedCount = 0;
+			uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < Entries.Num(); ++i)
+			{
+				Classes[i] = FindClassFunc(Entries[i].TypeString);
+				ResolvedCount += Classes[i] ? 1 : 0;
+			}
+			Result.ClassLookupMS = std::min(Result.ClassLookupMS, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+			Result.ResolvedCount = ResolvedCount;
+
+			// UObject::Serialize가 훑는 평탄화된 프로퍼티 테이블과 JSON 키 조회
+			int32 PropertyCount = 0;
+			StartCycles = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < Entries.Num(); ++i)
+			{
+				if (!Classes[i])
+				{
+					continue;
+				}
+				for (const FProperty& Prop : Classes[i]->GetAllProperties())
+				{
+					PropertyCount += Entries[i].Json->hasKey(Prop.Name) ? 1 : 0;
+				}
+			}
+			Result.PropertyMS = std::min(Result.PropertyMS, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+			Result.PropertyCount = PropertyCount;
+		}
+
+		Result.TotalMS = Result.ClassLookupMS + Result.PropertyMS;
+
+		// 실제 로드 경로(Level / Actor::Serialize → UClass::FindClass)를 같은 검색 방식으로 실행
+		UClass::bUseLinearFindClass = bInLinear;
+		Result.LevelLoadMS = (std::numeric_limits<double>::max)();
+		for (int32 Repeat = 0; Repeat < Config.LevelRepeatCount; ++Repeat)
+		{
+			Result.LevelLoadMS = std::min(Result.LevelLoadMS, LoadLevelOnce(SceneJson, Result.ActorCount));
+		}
+		UClass::bUseLinearFindClass = false;
+
+		Results.Add(Result);
+
+		UE_LOG("[SceneDeserializeBenchmark] %-8s Types=%-5d Resolved=%-5d Lookup=%.3fms Properties=%.3fms Actors=%-5d LevelLoad=%.3fms",
+			InMethod, Result.LookupCount, Result.ResolvedCount, Result.ClassLookupMS, Result.PropertyMS, Result.ActorCount, Result.LevelLoadMS);
+	};
+
+	Measure("Linear", true);
+	Measure("Registry", false);
+
+	bool bSucceeded = true;
+	if (Results[0].ResolvedCount != Results[1].ResolvedCount || Results[0].ActorCount != Results[1].ActorCount)
+	{
+		UE_LOG("[SceneDeserializeBenchmark] FAILED: result mismatch: Linear=%d/%d Registry=%d/%d (resolved/actors)",
+			Results[0].ResolvedCount, Results[0].ActorCount, Results[1].ResolvedCount, Results[1].ActorCount);
+		bSucceeded = false;
+	}
+
+	std::error_code ErrorCode;
+	std::filesystem::create_directories(Config.OutputDir, ErrorCode);
+
+	const FString CSVPath = Config.OutputDir + "/SceneDeserializeBenchmark.csv";
+	if (!WriteCSV(CSVPath))
+	{
+		UE_LOG("[SceneDeserializeBenchmark] Failed to write results to %s", Config.OutputDir.c_str());
+		return false;
+	}
+	UE_LOG("[SceneDeserializeBenchmark] %d results written to %s", static_cast<int32>(Results.Num()), Config.OutputDir.c_str());
+	return bSucceeded;
+}
+
+bool FSceneDeserializeBenchmark::WriteCSV(const FString& InFilePath) const
+{
+	std::ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	File << "Method,LookupCount,ResolvedCount,PropertyCount,ClassLookupMS,PropertyMS,TotalMS,ActorCount,LevelLoadMS\n";
+	File << std::fixed << std::setprecision(6);
+	for (const FSceneDeserializeBenchmarkResult& Result : Results)
+	{
+		File << Result.Method << ','
+			<< Result.LookupCount << ','
+			<< Result.ResolvedCount << ','
+			<< Result.PropertyCount << ','
+			<< Result.ClassLookupMS << ','
+			<< Result.PropertyMS << ','
+			<< Result.TotalMS << ','
+			<< Result.ActorCount << ','
+			<< Result.LevelLoadMS << '\n';
+	}
+	return true;
+}
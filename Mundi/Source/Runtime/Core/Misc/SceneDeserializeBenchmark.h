@@ -0,0 +1,60 @@
+﻿#pragma once
+
+/**
+ * @brief 씬 역직렬화 벤치마크 설정. 커맨드라인(-SceneDeserializeBenchmark ...)에서 채워집니다.
+ */
+struct FSceneDeserializeBenchmarkConfig
+{
+	FString ScenePath = "Scene/Bus.Scene";	// 읽을 씬 파일
+	int32 RepeatCount = 20;					// 방식별 반복 횟수 (가장 빠른 값을 기록)
+	int32 LevelRepeatCount = 5;				// 방식별 실제 레벨 로드 반복 횟수 (가장 빠른 값을 기록)
+
+	FString OutputDir = "Saved/Benchmark";
+};
+
+/**
+ * @brief 측정 결과 한 줄 (CSV 한 행)
+ */
+struct FSceneDeserializeBenchmarkResult
+{
+	FString Method;				// Linear (기존 FindClass 선형 검색) / Registry (해시 레지스트리)
+	int32 LookupCount = 0;		// 액터 + 컴포넌트 "Type" 개수
+	int32 ResolvedCount = 0;	// 클래스를 찾은 개수
+	int32 PropertyCount = 0;	// 찾은 클래스들의 프로퍼티 중 JSON에 키가 있는 개수
+	double ClassLookupMS = 0.0;
+	double PropertyMS = 0.0;
+	double TotalMS = 0.0;
+	int32 ActorCount = 0;		// 레벨 로드로 만들어진 액터 수
+	double LevelLoadMS = 0.0;	// JSON → 액터/컴포넌트 생성 (ULevel::Serialize) 전체
+};
+
+/**
+ * @brief 씬 로드 시 "Type" → UClass 해석과 프로퍼티 테이블 조회 비용 측정
+ * 씬 JSON을 한 번 읽은 뒤 액터/컴포넌트마다 Level/Actor 역직렬화와 같은 순서로 FindClass 와 GetAllProperties 를 수행하고,
+ * 이어서 같은 JSON으로 ULevel::Serialize(레벨 로드의 JSON → 액터 경로)를 선형 검색 / 레지스트리 각각으로 실행해 시간을 잽니다.
+ */
+class FSceneDeserializeBenchmark
+{
+public:
+	explicit FSceneDeserializeBenchmark(const FSceneDeserializeBenchmarkConfig& InConfig);
+
+	/**
+	 * @brief 커맨드라인에 -SceneDeserializeBenchmark 가 있으면 설정을 채우고 true를 반환합니다.
+	 * 옵션: -BenchmarkScene=Path -SceneRepeat=N -SceneLevelRepeat=N -BenchmarkOutput=Dir
+	 */
+	static bool ParseCommandLine(const FString& InCmdLine, FSceneDeserializeBenchmarkConfig& OutConfig);
+
+	/** @return 두 방식의 클래스 해석 수와 로드된 액터 수가 같고 CSV를 썼으면 true */
+	bool Run();
+
+	bool WriteCSV(const FString& InFilePath) const;
+
+	const TArray<FSceneDeserializeBenchmarkResult>& GetResults() const { return Results; }
+
+private:
+	// 레벨 하나를 JSON에서 만들고 지운다. 반환값은 Serialize 시간(ms), OutActorCount는 만들어진 액터 수
+	double LoadLevelOnce(const JSON& InSceneJson, int32& OutActorCount) const;
+
+	FSceneDeserializeBenchmarkConfig Config;
+	TArray<FSceneDeserializeBenchmarkResult> Results;
+};
@@ -0,0 +1,206 @@
+﻿#include "pch.h"
+#include "JobSystem.h"
+
+#include <chrono>
+
+/**
+ * FJobSystem 독립 테스트 (Linux / ThreadSanitizer)
+ * 엔진 없이 JobSystem.cpp만 링크해 ParallelFor, 선행 작업 체인, 중첩 대기, 워커 0개 모드를 검사합니다.
+ * 실패한 검사가 하나라도 있으면 0이 아닌 값으로 종료합니다.
+ *
+ *   cmake -S Source/Runtime/Core/Misc/Tests -B Build/CoreTests -DCORE_TESTS_TSAN=ON
+ *   cmake --build Build/CoreTests && ctest --test-dir Build/CoreTests --output-on-failure
+ */
+
+namespace
+{
+	int32 GFailureCount = 0;
+
+#define JOB_TEST_CHECK(Condition) \
+	do { if (!(Condition)) { ++GFailureCount; std::printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #Condition); } } while (0)
+
+	// 모든 인덱스가 정확히 한 번씩 호출되는지
+	void TestParallelFor()
+	{
+		for (int32 Num : { 0, 1, 63, 64, 65, 1000, 100000 })
+		{
+			TArray<std::atomic<int32>> Visits(Num);
+			ParallelFor(Num, [&](int32 Index)
+			{
+				Visits[Index].fetch_add(1, std::memory_order_relaxed);
+			}, 16);
+
+			int32 Wrong = 0;
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				Wrong += Visits[Index].load() != 1 ? 1 : 0;
+			}
+			JOB_TEST_CHECK(Wrong == 0);
+		}
+	}
+
+	// 선형 체인은 순서대로, 다이아몬드(A → B,C → D)의 D는 B/C 이후에 실행
+	void TestDependencyChains()
+	{
+		FJobSystem& JobSystem = FJobSystem::GetInstance();
+
+		constexpr int32 ChainLength = 256;
+		TArray<int32> Order;
+		std::mutex OrderMutex;
+		FJobRef Previous;
+		TArray<FJobRef> Chain;
+		for (int32 i = 0; i < ChainLength; ++i)
+		{
+			TArray<FJobRef> Prerequisites;
+			if (Previous)
+			{
+				Prerequisites.Add(Previous);
+			}
+			Previous = JobSystem.Launch([&, i]()
+			{
+				std::lock_guard<std::mutex> Lock(OrderMutex);
+				Order.Add(i);
+			}, Prerequisites);
+			Chain.Add(Previous);
+		}
+		JobSystem.Wait(Previous);
+
+		JOB_TEST_CHECK(Order.Num() == ChainLength);
+		bool bInOrder = true;
+		for (int32 i = 0; i < Order.Num(); ++i)
+		{
+			bInOrder = bInOrder && Order[i] == i;
+		}
+		JOB_TEST_CHECK(bInOrder);
+		for (const FJobRef& Job : Chain)
+		{
+			JOB_TEST_CHECK(Job->IsComplete());
+		}
+
+		for (int32 Repeat = 0; Repeat < 200; ++Repeat)
+		{
+			std::atomic<int32> Step{ 0 };
+			std::atomic<bool> bDiamondOk{ true };
+			FJobRef A = JobSystem.Launch([&]() { Step.fetch_add(1); });
+			FJobRef B = JobSystem.Launch([&]() { if (!A->IsComplete()) bDiamondOk = false; Step.fetch_add(1); }, { A });
+			FJobRef C = JobSystem.Launch([&]() { if (!A->IsComplete()) bDiamondOk = false; Step.fetch_add(1); }, { A });
+			FJobRef D = JobSystem.Launch([&]()
+			{
+				if (!B->IsComplete() || !C->IsComplete() || Step.load() != 3) bDiamondOk = false;
+				Step.fetch_add(1);
+			}, { B, C, nullptr });
+			JobSystem.Wait(D);
+			JOB_TEST_CHECK(bDiamondOk.load());
+			JOB_TEST_CHECK(Step.load() == 4);
+		}
+
+		// 이미 끝난 선행 작업은 기다리지 않고 바로 실행 가능해야 함
+		FJobRef Done = JobSystem.Launch([]() {});
+		JobSystem.Wait(Done);
+		std::atomic<bool> bRan{ false };
+		FJobRef After = JobSystem.Launch([&]() { bRan = true; }, { Done });
+		JobSystem.Wait(After);
+		JOB_TEST_CHECK(bRan.load());
+	}
+
+	// 작업 안에서 다른 작업을 띄우고 기다리거나 ParallelFor를 중첩해도 교착 없이 끝나야 함
+	void TestNestedWaits()
+	{
+		FJobSystem& JobSystem = FJobSystem::GetInstance();
+
+		constexpr int32 OuterCount = 64;
+		constexpr int32 InnerCount = 16;
+		std::atomic<int32> InnerRuns{ 0 };
+		TArray<FJobRef> Outer;
+		for (int32 i = 0; i < OuterCount; ++i)
+		{
+			Outer.Add(JobSystem.Launch([&]()
+			{
+				TArray<FJobRef> Inner;
+				for (int32 j = 0; j < InnerCount; ++j)
+				{
+					Inner.Add(JobSystem.Launch([&]() { InnerRuns.fetch_add(1, std::memory_order_relaxed); }));
+				}
+				JobSystem.WaitAll(Inner);
+			}));
+		}
+		JobSystem.WaitAll(Outer);
+		JOB_TEST_CHECK(InnerRuns.load() == OuterCount * InnerCount);
+
+		constexpr int32 OuterRange = 32;
+		constexpr int32 InnerRange = 2000;
+		std::atomic<int64> Sum{ 0 };
+		ParallelFor(OuterRange, [&](int32 OuterIndex)
+		{
+			ParallelFor(InnerRange, [&](int32 InnerIndex)
+			{
+				Sum.fetch_add(static_cast<int64>(OuterIndex) * InnerRange + InnerIndex, std::memory_order_relaxed);
+			}, 64);
+		}, 1);
+		const int64 Total = static_cast<int64>(OuterRange) * InnerRange;
+		JOB_TEST_CHECK(Sum.load() == Total * (Total - 1) / 2);
+	}
+
+	// 워커 0개: Launch는 즉시 호출 스레드에서 실행되고, 선행 작업이 있으면 그 완료 시점에 실행
+	void TestZeroWorkers()
+	{
+		FJobSystem& JobSystem = FJobSystem::GetInstance();
+		JOB_TEST_CHECK(JobSystem.GetWorkerCount() == 0);
+
+		const std::thread::id CallerId = std::this_thread::get_id();
+		bool bSameThread = false;
+		FJobRef Job = JobSystem.Launch([&]() { bSameThread = std::this_thread::get_id() == CallerId; });
+		JOB_TEST_CHECK(Job->IsComplete());
+		JOB_TEST_CHECK(bSameThread);
+
+		TestParallelFor();
+		TestDependencyChains();
+		TestNestedWaits();
+	}
+
+	// Shutdown은 큐에 남은 작업을 호출 스레드에서 마저 실행해야 함
+	void TestShutdownDrainsQueue()
+	{
+		FJobSystem& JobSystem = FJobSystem::GetInstance();
+		std::atomic<int32> Runs{ 0 };
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			JobSystem.Launch([&]() { Runs.fetch_add(1, std::memory_order_relaxed); });
+		}
+		JobSystem.Shutdown();
+		JOB_TEST_CHECK(Runs.load() == 1000);
+	}
+
+	void RunTest(const char* InName, void (*InTest)())
+	{
+		const int32 FailuresBefore = GFailureCount;
+		const auto Start = std::chrono::steady_clock::now();
+		InTest();
+		const double ElapsedMS = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+		std::printf("[%s] %s (%.1f ms)\n", GFailureCount == FailuresBefore ? "PASS" : "FAIL", InName, ElapsedMS);
+	}
+}
+
+int main()
+{
+	FJobSystem& JobSystem = FJobSystem::GetInstance();
+
+	// 하드웨어 스레드 수와 무관하게 훔치기 경쟁이 생기도록 워커 수 고정
+	for (int32 WorkerCount : { 1, 4, 8 })
+	{
+		JobSystem.Initialize(WorkerCount);
+		std::printf("--- %d workers ---\n", JobSystem.GetWorkerCount());
+		RunTest("ParallelFor", TestParallelFor);
+		RunTest("DependencyChains", TestDependencyChains);
+		RunTest("NestedWaits", TestNestedWaits);
+		RunTest("ShutdownDrainsQueue", TestShutdownDrainsQueue);
+	}
+
+	JobSystem.Initialize(0);
+	std::printf("--- 0 workers ---\n");
+	RunTest("ZeroWorkers", TestZeroWorkers);
+	JobSystem.Shutdown();
+
+	std::printf("%s: %d failed checks\n", GFailureCount == 0 ? "SUCCESS" : "FAILURE", GFailureCount);
+	return GFailureCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,229 @@
+﻿#include "pch.h"
+#include "HashUtils.h"
+
+#include <chrono>
+
+/**
+ * TQueue 락프리 모드 독립 테스트 (Linux / ThreadSanitizer)
+ * 모드별 허용된 생산자/소비자 수로 동시에 넣고 빼면서 개수, 합, 해시 합, 생산자별 순서를 검사합니다.
+ * 실패한 검사가 하나라도 있으면 0이 아닌 값으로 종료합니다.
+ *
+ *   cmake -S Source/Runtime/Core/Misc/Tests -B Build/CoreTests -DCORE_TESTS_TSAN=ON
+ *   cmake --build Build/CoreTests && ctest --test-dir Build/CoreTests --output-on-failure
+ */
+
+namespace
+{
+	int32 GFailureCount = 0;
+
+#define QUEUE_TEST_CHECK(Condition) \
+	do { if (!(Condition)) { ++GFailureCount; std::printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #Condition); } } while (0)
+
+	// 경합 중 가득 참/빔 경로를 자주 타도록 작게 잡음
+	constexpr uint32 StressCapacity = 64;
+	constexpr uint64 ItemsPerProducer = 100000;
+
+	template<EQueueMode Mode>
+	std::unique_ptr<TQueue<uint64, Mode>> CreateQueue(uint32 InCapacity)
+	{
+		if constexpr (Mode == EQueueMode::Mpsc)
+		{
+			return std::make_unique<TQueue<uint64, Mode>>();
+		}
+		else
+		{
+			return std::make_unique<TQueue<uint64, Mode>>(InCapacity);
+		}
+	}
+
+	/**
+	 * 생산자마다 (Producer << 32) | 1..ItemsPerProducer 값을 넣고, 소비자가 모두 꺼낼 때까지 돌립니다.
+	 * 합만으로는 유실과 중복이 서로 상쇄될 수 있어 값마다 다른 해시의 합도 함께 비교합니다.
+	 * 한 소비자가 본 같은 생산자의 값은 넣은 순서대로여야 합니다 (FIFO).
+	 */
+	template<EQueueMode Mode>
+	void StressQueue(int32 InProducerCount, int32 InConsumerCount)
+	{
+		auto Queue = CreateQueue<Mode>(StressCapacity);
+
+		uint64 ExpectedSum = 0;
+		uint64 ExpectedHashSum = 0;
+		for (int32 Producer = 0; Producer < InProducerCount; ++Producer)
+		{
+			for (uint64 Index = 1; Index <= ItemsPerProducer; ++Index)
+			{
+				const uint64 Value = (static_cast<uint64>(Producer) << 32) | Index;
+				ExpectedSum += Value;
+				ExpectedHashSum += HashMix64(Value);
+			}
+		}
+		const uint64 TotalCount = ItemsPerProducer * InProducerCount;
+
+		std::atomic<uint64> ConsumedCount{ 0 };
+		std::atomic<uint64> Sum{ 0 };
+		std::atomic<uint64> HashSum{ 0 };
+		std::atomic<int32> OrderErrors{ 0 };
+
+		TArray<std::thread> Threads;
+		for (int32 Producer = 0; Producer < InProducerCount; ++Producer)
+		{
+			Threads.emplace_back([&, Producer]()
+			{
+				for (uint64 Index = 1; Index <= ItemsPerProducer; ++Index)
+				{
+					const uint64 Value = (static_cast<uint64>(Producer) << 32) | Index;
+					while (!Queue->Enqueue(Value))
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+		for (int32 Consumer = 0; Consumer < InConsumerCount; ++Consumer)
+		{
+			Threads.emplace_back([&]()
+			{
+				TArray<uint64> LastIndex(InProducerCount, 0);
+				uint64 LocalCount = 0;
+				uint64 LocalSum = 0;
+				uint64 LocalHashSum = 0;
+				int32 LocalOrderErrors = 0;
+				uint64 Value = 0;
+				while (ConsumedCount.load(std::memory_order_relaxed) < TotalCount)
+				{
+					if (!Queue->Dequeue(Value))
+					{
+						std::this_thread::yield();
+						continue;
+					}
+
+					ConsumedCount.fetch_add(1, std::memory_order_relaxed);
+					++LocalCount;
+					LocalSum += Value;
+					LocalHashSum += HashMix64(Value);
+
+					const uint64 Producer = Value >> 32;
+					const uint64 Index = Value & 0xFFFFFFFFull;
+					if (Producer >= static_cast<uint64>(InProducerCount) || Index <= LastIndex[Producer])
+					{
+						++LocalOrderErrors;
+					}
+					else
+					{
+						LastIndex[Producer] = Index;
+					}
+				}
+				Sum.fetch_add(LocalSum, std::memory_order_relaxed);
+				HashSum.fetch_add(LocalHashSum, std::memory_order_relaxed);
+				OrderErrors.fetch_add(LocalOrderErrors, std::memory_order_relaxed);
+			});
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+
+		QUEUE_TEST_CHECK(ConsumedCount.load() == TotalCount);
+		QUEUE_TEST_CHECK(Sum.load() == ExpectedSum);
+		QUEUE_TEST_CHECK(HashSum.load() == ExpectedHashSum);
+		QUEUE_TEST_CHECK(OrderErrors.load() == 0);
+
+		// 모두 꺼낸 뒤에는 비어 있어야 함
+		uint64 Leftover = 0;
+		QUEUE_TEST_CHECK(!Queue->Dequeue(Leftover));
+		QUEUE_TEST_CHECK(Queue->IsEmpty());
+		QUEUE_TEST_CHECK(Queue->Num() == 0);
+	}
+
+	// 단일 스레드: FIFO 순서, Peek, 용량 한계, Empty
+	template<EQueueMode Mode>
+	void BasicQueue()
+	{
+		auto Queue = CreateQueue<Mode>(8);
+
+		uint64 Value = 0;
+		QUEUE_TEST_CHECK(!Queue->Peek(Value));
+		QUEUE_TEST_CHECK(!Queue->Dequeue(Value));
+
+		for (uint64 Index = 1; Index <= 8; ++Index)
+		{
+			QUEUE_TEST_CHECK(Queue->Enqueue(Index));
+		}
+		if constexpr (Mode != EQueueMode::Mpsc)
+		{
+			// 고정 크기 큐는 가득 차면 거부
+			QUEUE_TEST_CHECK(!Queue->Enqueue(9));
+		}
+		QUEUE_TEST_CHECK(Queue->Num() == 8);
+
+		QUEUE_TEST_CHECK(Queue->Peek(Value) && Value == 1);
+		for (uint64 Index = 1; Index <= 4; ++Index)
+		{
+			QUEUE_TEST_CHECK(Queue->Dequeue(Value) && Value == Index);
+		}
+
+		// 링 버퍼가 한 바퀴 돌도록 다시 채움
+		for (uint64 Index = 9; Index <= 12; ++Index)
+		{
+			QUEUE_TEST_CHECK(Queue->Enqueue(Index));
+		}
+		for (uint64 Index = 5; Index <= 12; ++Index)
+		{
+			QUEUE_TEST_CHECK(Queue->Dequeue(Value) && Value == Index);
+		}
+		QUEUE_TEST_CHECK(Queue->IsEmpty());
+
+		Queue->Enqueue(13);
+		Queue->Enqueue(14);
+		Queue->Empty();
+		QUEUE_TEST_CHECK(Queue->IsEmpty());
+		QUEUE_TEST_CHECK(!Queue->Dequeue(Value));
+	}
+
+	// 동시에 살아 있는 원소 수가 일정하면 노드를 재사용해 슬랩이 더 늘지 않아야 함
+	void MpscRecyclesNodes()
+	{
+		TQueue<uint64, EQueueMode::Mpsc> Queue;
+		uint64 Value = 0;
+		for (uint64 Index = 0; Index < 1000; ++Index)
+		{
+			Queue.Enqueue(Index);
+			Queue.Dequeue(Value);
+		}
+		const int32 AllocatedNodes = Queue.GetAllocatedNodeCount();
+		for (uint64 Index = 0; Index < 100000; ++Index)
+		{
+			Queue.Enqueue(Index);
+			Queue.Dequeue(Value);
+		}
+		QUEUE_TEST_CHECK(Queue.GetAllocatedNodeCount() == AllocatedNodes);
+	}
+
+	void RunTest(const char* InName, void (*InTest)())
+	{
+		const int32 FailuresBefore = GFailureCount;
+		const auto Start = std::chrono::steady_clock::now();
+		InTest();
+		const double ElapsedMS = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+		std::printf("[%s] %s (%.1f ms)\n", GFailureCount == FailuresBefore ? "PASS" : "FAIL", InName, ElapsedMS);
+	}
+}
+
+int main()
+{
+	RunTest("Spsc Basic", BasicQueue<EQueueMode::Spsc>);
+	RunTest("Mpmc Basic", BasicQueue<EQueueMode::Mpmc>);
+	RunTest("Spmc Basic", BasicQueue<EQueueMode::Spmc>);
+	RunTest("Mpsc Basic", BasicQueue<EQueueMode::Mpsc>);
+	RunTest("Mpsc RecyclesNodes", MpscRecyclesNodes);
+
+	// 모드가 허용하는 만큼만 생산자/소비자를 둠
+	RunTest("Spsc 1x1", []() { StressQueue<EQueueMode::Spsc>(1, 1); });
+	RunTest("Mpsc 4x1", []() { StressQueue<EQueueMode::Mpsc>(4, 1); });
+	RunTest("Spmc 1x4", []() { StressQueue<EQueueMode::Spmc>(1, 4); });
+	RunTest("Mpmc 4x4", []() { StressQueue<EQueueMode::Mpmc>(4, 4); });
+	RunTest("Mpmc 8x2", []() { StressQueue<EQueueMode::Mpmc>(8, 2); });
+
+	std::printf("%s: %d failed checks\n", GFailureCount == 0 ? "SUCCESS" : "FAILURE", GFailureCount);
+	return GFailureCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,28 @@
+﻿#pragma once
+// 독립 테스트 빌드용 pch.h
+// 엔진 pch.h는 Windows / D3D11 헤더를 끌어오므로, 테스트 대상 코드가 실제로 쓰는 표준 라이브러리와 컨테이너만 포함합니다.
+// CMakeLists.txt가 이 디렉터리를 include 경로 맨 앞에 두어 JobSystem.cpp 등의 #include "pch.h"가 이 파일을 찾습니다.
+
+#include <vector>
+#include <map>
+#include <set>
+#include <unordered_set>
+#include <unordered_map>
+#include <queue>
+#include <stack>
+#include <list>
+#include <deque>
+#include <string>
+#include <array>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <cstdio>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "UEContainer.h"
+
+#define UE_LOG(fmt, ...) std::printf(fmt "\n", ##__VA_ARGS__)
@@ -95,6 +95,7 @@ void AActor::Destroy()
 	{ 
 		// 파티션 시스템에서 제거
 		GWorld->OnActorDestroyed(this);
+		GWorld->MarkLevelEdited();
 		// 컴포넌트 삭제, 언레지스터는 컴포넌트들이 알아서 해줄 거임
 		if (ULevel* Level = GWorld->GetLevel())
 		{
@@ -118,7 +119,7 @@ void AActor::Destroy()
 	ObjectFactory::DeleteObject(this);
 }
 
-void AActor::SetWorld(UWorld* InWorld)
+void AActor::SetWorld(UWorld* InWorld, TArray<UShapeComponent*>* OutDeferredCollision)
 {
 	World = InWorld;
 	this->RegisterAllComponents(InWorld);
@@ -133,7 +134,12 @@ void AActor::SetWorld(UWorld* InWorld)
 		bool bRegistered = false;
 		if (UShapeComponent* SHC = Cast<UShapeComponent>(Comp))
 		{
-			if (UWorldPhysics* WorldPhysics = World->GetWorldPhysics())
+			if (OutDeferredCollision)
+			{
+				OutDeferredCollision->Add(SHC);
+				bRegistered = true;
+			}
+			else if (UWorldPhysics* WorldPhysics = World->GetWorldPhysics())
 			{
 				WorldPhysics->RegisterCollision(SHC);
 				bRegistered = true;
@@ -191,6 +197,7 @@ void AActor::AddOwnedComponent(UActorComponent* Component)
 
 	OwnedComponents.insert(Component);
 	Component->SetOwner(this);
+	Component->MarkLevelEdited();
 	if (USceneComponent* SC = Cast<USceneComponent>(Component))
 	{
 		SceneComponents.AddUnique(SC);
@@ -227,6 +234,7 @@ void AActor::RemoveOwnedComponent(UActorComponent* Component)
 
 	// OwnedComponents에서 제거
 	OwnedComponents.erase(Component);
+	Component->MarkLevelEdited();
 
 	// SceneComponent라면 SceneComponents에서도 제거
 	if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
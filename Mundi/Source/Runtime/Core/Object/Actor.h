@@ -35,7 +35,8 @@ public:
     const FName& GetName() { return Name; }
 
     // 월드/표시
-    void SetWorld(UWorld* InWorld);
+    // OutDeferredCollision이 주어지면 대기 중인 충돌체를 바로 등록하지 않고 모아서 돌려준다 (UWorld::SetLevel 일괄 등록용)
+    void SetWorld(UWorld* InWorld, TArray<UShapeComponent*>* OutDeferredCollision = nullptr);
     UWorld* GetWorld() const { return World; }
 
     // 루트/컴포넌트
@@ -34,6 +34,19 @@ UWorld* UActorComponent::GetWorld() const
     return Owner ? Owner->GetWorld() : nullptr;
 }
 
+void UActorComponent::MarkLevelEdited() const
+{
+    // 에디터 전용 컴포넌트는 스냅샷에 들어가지 않고, 월드에 들어가기 전(생성/로드 중)에는 무효화할 스냅샷이 없다
+    if (!bIsEditable)
+    {
+        return;
+    }
+    if (UWorld* World = GetWorld())
+    {
+        World->MarkLevelEdited();
+    }
+}
+
 // ─────────────── Registration
 
 void UActorComponent::RegisterComponent(UWorld* InWorld)
@@ -82,6 +95,8 @@ void UActorComponent::Destroy()
 {
     MarkPendingDestroy();
 
+    MarkLevelEdited();
+
     // 등록 중이면 우선 해제(EndPlay 포함)
     if (bRegistered) UnregisterComponent();
 
@@ -64,6 +64,8 @@ public:
     void SetOwner(AActor* InOwner) { Owner = InOwner; }
     AActor* GetOwner() const { return Owner; }
     UWorld* GetWorld() const; // 구현은 .cpp에서 Owner->GetWorld()
+    // 레벨에 저장되는 상태(트랜스폼, 부착 관계, 소유 관계)가 바뀔 때 호출. 에디터 월드의 PIE 스냅샷을 무효화
+    void MarkLevelEdited() const;
 
     // ─────────────── 컴포넌트 보호
     void SetNative(const bool bValue) { bIsNative = bValue; }
@@ -13,6 +13,7 @@ using JSON = json::JSON;
 // 전방 선언/외부 심볼 (네 프로젝트 환경 유지)
 class UObject;
 class UWorld;
+class FArchive;
 // ── UClass: 간단한 타입 디스크립터 ─────────────────────────────
 struct UClass
 {
@@ -29,6 +30,20 @@ struct UClass
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
 
+    // SignUpClass 순서대로 매기는 조밀한 인덱스 (GetAllClasses()[ClassIndex] == this)
+    int32 ClassIndex = -1;
+    // Name을 한 번만 인턴한 FName. GetClassRegistry가 색인할 때 채운다
+    FName ClassFName;
+
+    // 정확히 이 클래스인 GUObjectArray 등록 객체들 (하위 클래스 제외). ObjectFactory가 등록/삭제 시 갱신
+    // 각 객체의 UObject::ClassInstanceIndex가 이 배열에서의 위치라 삭제는 swap-and-pop으로 O(1)
+    TArray<UObject*> Instances;
+    // GetDerivedClasses 캐시. 등록된 클래스 수가 바뀌면 다시 만든다
+    TArray<UClass*> CachedDerivedClasses;
+    int32 CachedDerivedClassesVersion = -1;
+    // 이 클래스로 할당된 객체의 live/peak 통계. CMemoryManager가 갱신
+    FClassMemoryStats MemoryStats;
+
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, std::size_t z)
         :Name(n), Super(s), Size(z) {
@@ -51,22 +66,75 @@ struct UClass
     {
         if (InClass)
         {
+            InClass->ClassIndex = GetAllClasses().Num();
             GetAllClasses().emplace_back(InClass);
         }
     }
+
+    static UClass* GetClassByIndex(int32 InClassIndex)
+    {
+        TArray<UClass*>& AllClasses = GetAllClasses();
+        return (InClassIndex >= 0 && InClassIndex < AllClasses.Num()) ? AllClasses[InClassIndex] : nullptr;
+    }
+
+    // 인턴된 클래스 이름 → UClass
+    // SignUpClass는 정적 초기화 중(프로퍼티 등록 전)에 불리므로 새로 등록된 클래스는 다음 조회 때 색인하고,
+    // 그 김에 평탄화된 프로퍼티 테이블도 만들어 둔다
+    // 색인은 뮤텍스 안에서만 하고, 모두 색인된 뒤의 조회는 원자적 개수 확인만으로 잠금 없이 읽는다
+    static const TMap<FName, UClass*>& GetClassRegistry()
+    {
+        static TMap<FName, UClass*> Registry;
+        static std::atomic<int32> IndexedClassCount{ 0 };
+        static std::mutex RegistryMutex;
+
+        TArray<UClass*>& AllClasses = GetAllClasses();
+        if (IndexedClassCount.load(std::memory_order_acquire) == AllClasses.Num())
+        {
+            return Registry;
+        }
+
+        std::lock_guard<std::mutex> Lock(RegistryMutex);
+        int32 ClassIndex = IndexedClassCount.load(std::memory_order_relaxed);
+        for (; ClassIndex < AllClasses.Num(); ++ClassIndex)
+        {
+            UClass* Class = AllClasses[ClassIndex];
+            Class->ClassFName = FName(Class->Name);
+            // 이름이 겹치면 먼저 등록된 클래스 유지 (기존 선형 검색과 같은 결과)
+            if (!Registry.Contains(Class->ClassFName))
+            {
+                Registry.Add(Class->ClassFName, Class);
+            }
+            Class->GetAllProperties();
+        }
+        IndexedClassCount.store(ClassIndex, std::memory_order_release);
+        return Registry;
+    }
+
     static UClass* FindClass(const FName& InClassName)
+    {
+        if (bUseLinearFindClass)
+        {
+            return FindClassLinear(InClassName);
+        }
+        return GetClassRegistry().FindRef(InClassName);
+    }
+
+    // 레지스트리 도입 전 FindClass. 클래스마다 Name으로 임시 FName을 만들어 비교한다
+    static UClass* FindClassLinear(const FName& InClassName)
     {
         for (UClass* Class : GetAllClasses())
         {
-            if (Class && Class->Name == InClassName)
+            if (Class && FName(Class->Name) == InClassName)
             {
                 return Class;
             }
         }
-
         return nullptr;
     }
 
+    // 벤치마크 전용: 실제 레벨 로드 경로의 FindClass를 선형 검색으로 되돌려 레지스트리와 비교
+    static inline bool bUseLinearFindClass = false;
+
     // 리플렉션 시스템 메서드
     // 주의: 프로퍼티는 static 초기화 시점에만 등록되며, 런타임 중 추가/삭제 불가
     void AddProperty(const FProperty& Property)
@@ -85,6 +153,7 @@ struct UClass
         if (!bAllPropertiesCached)
         {
             CachedAllProperties.clear();
+            CachedAllProperties.Reserve((Super ? Super->GetAllProperties().Num() : 0) + Properties.Num());
             if (Super)
             {
                 const TArray<FProperty>& ParentProps = Super->GetAllProperties();
@@ -102,6 +171,26 @@ struct UClass
         return CachedAllProperties;
     }
 
+    // 자기 자신과 모든 하위 클래스. TObjectIterator는 이 클래스들의 Instances만 순회한다
+    const TArray<UClass*>& GetDerivedClasses()
+    {
+        const int32 ClassCount = GetAllClasses().Num();
+        if (CachedDerivedClassesVersion != ClassCount)
+        {
+            CachedDerivedClasses.clear();
+            CachedDerivedClasses.Add(this);
+            for (UClass* Class : GetAllClasses())
+            {
+                if (Class && Class != this && Class->IsChildOf(this))
+                {
+                    CachedDerivedClasses.Add(Class);
+                }
+            }
+            CachedDerivedClassesVersion = ClassCount;
+        }
+        return CachedDerivedClasses;
+    }
+
     static TArray<UClass*> GetAllSpawnableActors()
     {
         TArray<UClass*> Result;
@@ -145,10 +234,10 @@ protected:
     friend void ObjectFactory::DeleteObject(UObject* Obj);
 
 public:
-    // UObject-scoped allocation only
-    static void* operator new(std::size_t size) { return CMemoryManager::Allocate(size); }
-    static void  operator delete(void* ptr) noexcept { CMemoryManager::Deallocate(ptr); }
-    static void  operator delete(void* ptr, std::size_t) noexcept { CMemoryManager::Deallocate(ptr); }
+    // UObject-scoped allocation only. 파생 클래스는 DECLARE_CLASS가 자기 UClass로 통계를 모으도록 다시 선언한다
+    // 슬랩 할당기가 크기로 풀을 찾으므로 sized delete만 둔다 (가상 소멸자 덕에 실제 객체 크기가 넘어옴)
+    static void* operator new(std::size_t size) { return CMemoryManager::Allocate(size, StaticClass()); }
+    static void  operator delete(void* ptr, std::size_t size) noexcept { CMemoryManager::Deallocate(ptr, size, StaticClass()); }
 
     FString GetName();    // 원문
     FString GetComparisonName(); // lower-case
@@ -157,12 +246,17 @@ public:
 
     // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+
+    // 쿠킹된 씬(FCookedScene) 직렬화. 리플렉션 프로퍼티는 FCookedScene이 처리하므로 Serialize(JSON)에서 직접 읽고 쓰는 값만 다룬다
+    virtual void SerializeCooked(FArchive& Ar) {}
 public:
     // GenerateUUID()에 의해 자동 발급
     uint32_t UUID;
 
     // 팩토리 함수에 의해 자동 발급
     uint32_t InternalIndex;
+    // GetClass()->Instances 안에서의 위치 (GUObjectArray 미등록이면 -1)
+    int32    ClassInstanceIndex = -1;
     FName    ObjectName;   // ← 객체 개별 이름 추가
 
     // 정적: 타입 메타 반환 (이름을 StaticClass로!)
@@ -190,6 +284,16 @@ public:
 
     static UObject* GetObjectFromIndex(uint32 InIndex) { if (InIndex >= GUObjectArray.Num() || InIndex<0) return nullptr; else return GUObjectArray[InIndex]; }
 
+    // 슬롯의 현재 시리얼 번호 (빈 슬롯 / 범위 밖이면 0)
+    static uint32 GetSerialNumberFromIndex(uint32 InIndex) { return InIndex < static_cast<uint32>(GUObjectSerialNumbers.Num()) ? GUObjectSerialNumbers[InIndex] : 0; }
+
+    // 슬롯이 재사용되었으면(시리얼 불일치) nullptr
+    static UObject* GetObjectFromIndex(uint32 InIndex, uint32 InSerialNumber)
+    {
+        if (InSerialNumber == 0 || GetSerialNumberFromIndex(InIndex) != InSerialNumber) return nullptr;
+        return GUObjectArray[InIndex];
+    }
+
     // ───── 복사 관련 ────────────────────────────
     virtual void DuplicateSubObjects(); // Super::DuplicateSubObjects() 호출 -> 얕은 복사한 멤버들에 대해 메뉴얼하게 깊은 복사 수행(특히, Uobject 계열 멤버들에 대해서는 Duplicate() 호출)
     virtual UObject* Duplicate() const; // 자기 자신 깊은 복사(+모든 멤버들 얕은 복사) -> DuplicateSubObjects 호출
@@ -272,6 +376,14 @@ public:                                                                       \
         return &Cls;                                                          \
     }                                                                         \
     virtual UClass* GetClass() const override { return ThisClass::StaticClass(); } \
+    static void* operator new(std::size_t Size)                              \
+    {                                                                         \
+        return CMemoryManager::Allocate(Size, ThisClass::StaticClass());      \
+    }                                                                         \
+    static void operator delete(void* Ptr, std::size_t Size) noexcept        \
+    {                                                                         \
+        CMemoryManager::Deallocate(Ptr, Size, ThisClass::StaticClass());      \
+    }                                                                         \
 
 // 각 파생 타입에 맞는 Duplicate() 자동 생성 매크로
 #define DECLARE_DUPLICATE(ThisClass)                                          \
@@ -2,6 +2,63 @@
 #include "ObjectFactory.h"
 // 전역 오브젝트 배열 정의 (한 번만!)
 TArray<UObject*> GUObjectArray;
+TArray<uint32> GUObjectSerialNumbers;
+
+namespace
+{
+    // 비워진 GUObjectArray 슬롯. 새 객체가 먼저 꺼내 쓰므로 배열은 동시에 살아있던 객체 수의 최댓값까지만 커진다
+    TArray<uint32> GUObjectFreeSlots;
+
+    // 포인터 -> 슬롯. DeleteObject가 이미 해제됐을 수도 있는 Obj를 역참조하지 않고 O(1)로 슬롯을 찾는 데 쓴다
+    TMap<UObject*, uint32> GUObjectSlotLookup;
+
+    // 슬롯 재사용 여부와 관계없이 전역으로 증가 (0은 빈 슬롯 표시용이라 건너뜀)
+    uint32 GNextObjectSerialNumber = 1;
+
+    uint32 AllocateObjectSlot(UObject* Obj)
+    {
+        uint32 Index;
+        if (!GUObjectFreeSlots.IsEmpty())
+        {
+            Index = GUObjectFreeSlots.Pop();
+            GUObjectArray[Index] = Obj;
+        }
+        else
+        {
+            Index = static_cast<uint32>(GUObjectArray.Add(Obj));
+            GUObjectSerialNumbers.Add(0);
+        }
+
+        GUObjectSerialNumbers[Index] = GNextObjectSerialNumber++;
+        if (GNextObjectSerialNumber == 0)
+        {
+            GNextObjectSerialNumber = 1;
+        }
+
+        Obj->InternalIndex = Index;
+        GUObjectSlotLookup.Add(Obj, Index);
+
+        TArray<UObject*>& Instances = Obj->GetClass()->Instances;
+        Obj->ClassInstanceIndex = Instances.Add(Obj);
+        return Index;
+    }
+
+    void RemoveFromClassInstances(UObject* Obj)
+    {
+        TArray<UObject*>& Instances = Obj->GetClass()->Instances;
+        const int32 InstanceIndex = Obj->ClassInstanceIndex;
+        if (InstanceIndex < 0 || InstanceIndex >= Instances.Num() || Instances[InstanceIndex] != Obj)
+        {
+            return;
+        }
+
+        UObject* Last = Instances.back();
+        Instances[InstanceIndex] = Last;
+        Last->ClassInstanceIndex = InstanceIndex;
+        Instances.pop_back();
+        Obj->ClassInstanceIndex = -1;
+    }
+}
 
 namespace ObjectFactory
 {
@@ -29,11 +86,7 @@ namespace ObjectFactory
         UObject* Obj = ConstructObject(Class);
         if (!Obj) return nullptr;
 
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        AllocateObjectSlot(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -55,11 +108,7 @@ namespace ObjectFactory
         if (!Obj) return nullptr;
 
         // 배열에 등록: 빈 슬롯 재사용
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-        //}
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        AllocateObjectSlot(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -81,22 +130,20 @@ namespace ObjectFactory
         if (!Obj) return;
 
         // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
-        {
-            if (GUObjectArray[i] == Obj)
-            {
-                foundIndex = i;
-                break;
-            }
-        }
-        if (foundIndex < 0)
+        // 포인터 자체로 슬롯을 찾으므로 이미 지워진 객체(댕글링 포인터)가 들어와도 안전하다
+        const uint32* FoundSlot = GUObjectSlotLookup.Find(Obj);
+        if (!FoundSlot)
         {
             // Not managed or already deleted.
             return;
         }
+        const uint32 foundIndex = *FoundSlot;
+        GUObjectSlotLookup.Remove(Obj);
 
+        RemoveFromClassInstances(Obj);
         GUObjectArray[foundIndex] = nullptr;
+        GUObjectSerialNumbers[foundIndex] = 0;
+        GUObjectFreeSlots.Add(foundIndex);
         // Safe to delete now; Obj still valid since we found it in GUObjectArray
         Obj->DestroyInternal();
     }
@@ -113,26 +160,9 @@ namespace ObjectFactory
         }
         GUObjectArray.Empty();
         GUObjectArray.Shrink();
-    }
-
-    // (선택) null 슬롯 압축
-    void CompactNullSlots()
-    {
-        int32 write = 0;
-        for (int32 read = 0; read < GUObjectArray.Num(); ++read)
-        {
-            if (UObject* Obj = GUObjectArray[read])
-            {
-                if (write != read)
-                {
-                    GUObjectArray[write] = Obj;
-                    Obj->InternalIndex = static_cast<uint32>(write);
-                    GUObjectArray[read] = nullptr;
-                }
-                ++write;
-            }
-        }
-        // 크기(Num) 축소 + 불필요한 capacity도 반환
-        GUObjectArray.SetNum(write);
+        GUObjectSerialNumbers.Empty();
+        GUObjectSerialNumbers.Shrink();
+        GUObjectFreeSlots.Empty();
+        GUObjectSlotLookup.Empty();
     }
 }
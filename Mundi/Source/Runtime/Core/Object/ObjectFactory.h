@@ -6,6 +6,9 @@
 class UObject;
 struct UClass;
 extern TArray<UObject*> GUObjectArray;
+// GUObjectArray와 같은 인덱스의 슬롯별 시리얼 번호 (0 = 빈 슬롯)
+// 슬롯이 재사용되어도 새 객체는 새 번호를 받으므로, 인덱스 + 시리얼로 이전 객체와 구분한다
+extern TArray<uint32> GUObjectSerialNumbers;
 
 // ── ObjectFactory 네임스페이스 ─────────────────────────────
 namespace ObjectFactory
@@ -42,12 +45,10 @@ namespace ObjectFactory
         return static_cast<T*>(AddToGUObjectArray(T::StaticClass(), Dest));
     }
 
-    // 개별 삭제(단일 소유자: Factory)
+    // 개별 삭제(단일 소유자: Factory). 비워진 슬롯은 프리 리스트로 돌아가 다음 생성 시 재사용
     void DeleteObject(UObject* Obj);
     // 종료시 일괄 정리
     void DeleteAll(bool bCallBeginDestroy = true);
-    // Null 슬롯 압축하여 배열 크기 축소
-    void CompactNullSlots();
 }
 
 // ── 등록 매크로 ─────────────────────────────────────────────
@@ -32,6 +32,30 @@ struct FWavDataChunkHeader
 	DWORD SubchunkSize;
 };
 
+namespace
+{
+	// 이보다 긴 트랙은 메모리에 올리지 않고 스트리밍
+	constexpr float StreamingThresholdSeconds = 10.0f;
+	// 스트림 버퍼 하나에 담을 재생 시간 (두 버퍼가 번갈아 재생/로드)
+	constexpr float StreamChunkSeconds = 1.0f;
+	constexpr uint32 NumStreamBuffers = 2;
+}
+
+// 디스크 스트리밍 상태
+// 버퍼는 Voice가 파괴될 때까지 XAudio2가 참조하므로 스트림 수명은 Voice 수명 이상이어야 합니다.
+struct FAudioStream
+{
+	uint32 Id = 0;
+	IXAudio2SourceVoice* Voice = nullptr;
+	FWavData* Sound = nullptr;
+	std::ifstream File;
+	TArray<BYTE> Buffers[NumStreamBuffers];
+	uint32 NextBuffer = 0;			// 다음에 채울 버퍼 (제출 순서대로 소비되므로 라운드 로빈)
+	DWORD ReadOffset = 0;			// data 청크 내 다음 읽기 위치
+	bool bLoop = false;
+	bool bFinished = false;			// 마지막 청크까지 제출 완료
+};
+
 UAudioManager::UAudioManager()
 {
 }
@@ -93,7 +117,11 @@ void UAudioManager::Initialize()
 
 void UAudioManager::Update(float DeltaTime)
 {
-	// XAudio2는 별도 업데이트가 필요 없음 (자동으로 처리됨)
+	// 스트림 버퍼 보충 (XAudio2 콜백 스레드에서 디스크 I/O를 하지 않도록 메인 스레드에서 폴링)
+	for (std::unique_ptr<FAudioStream>& Stream : ActiveStreams)
+	{
+		PumpStream(*Stream);
+	}
 }
 
 void UAudioManager::Shutdown()
@@ -101,7 +129,10 @@ void UAudioManager::Shutdown()
 	if (!bIsInitialized)
 		return;
 
-	// 모든 WAV 데이터 해제
+	// 모든 스트림 및 WAV 데이터 해제
+	ActiveStreams.Empty();
+	ResidentSounds.Empty();
+	ResidentSoundBytes = 0;
 	WavDataMap.clear();
 	SoundFilePaths.Empty();
 
@@ -135,8 +166,7 @@ void UAudioManager::LoadAllSounds()
 	}
 
 
-	// 기존 데이터 클리어
-	WavDataMap.clear();
+	// 경로 목록만 다시 만듦 (재생 중인 보이스가 참조할 수 있으므로 기존 FWavData는 유지)
 	SoundFilePaths.Empty();
 
 	// Data/Sound 폴더 경로
@@ -166,21 +196,26 @@ void UAudioManager::LoadAllSounds()
 		// 경로 정규화 (백슬래시를 슬래시로 변환)
 		std::replace(FilePathUTF8.begin(), FilePathUTF8.end(), '\\', '/');
 
-		// WAV 데이터 로드
+		if (WavDataMap.Contains(FilePathUTF8))
+		{
+			SoundFilePaths.push_back(FilePathUTF8);
+			continue;
+		}
+
+		// 헤더만 읽음 (PCM 데이터는 첫 재생 시 로드)
 		auto WavData = std::make_unique<FWavData>();
-		if (LoadWavFile(FilePath, WavData.get()))
+		if (ReadWavHeader(FilePath, WavData.get()))
 		{
 			WavDataMap[FilePathUTF8] = std::move(WavData);
 			SoundFilePaths.push_back(FilePathUTF8);
-			UE_LOG("Loaded sound: %s", FilePathUTF8.c_str());
 		}
 		else
 		{
-			UE_LOG("Failed to load sound: %s", FilePathUTF8.c_str());
+			UE_LOG("Failed to read sound header: %s", FilePathUTF8.c_str());
 		}
 	}
 
-	UE_LOG("Loaded %d sound files from Data/Sound folder.", SoundFilePaths.size());
+	UE_LOG("Scanned %d sound files from Data/Sound folder.", SoundFilePaths.size());
 }
 
 void UAudioManager::ScanFolderRecursive(const FWideString& FolderPath, TArray<FWideString>& OutWavFiles)
@@ -229,23 +264,25 @@ void UAudioManager::ScanFolderRecursive(const FWideString& FolderPath, TArray<FW
 	FindClose(FindHandle);
 }
 
-bool UAudioManager::LoadWavFile(const FWideString& FilePath, FWavData* OutWavData)
+bool UAudioManager::ReadWavHeader(const FWideString& FilePath, FWavData* OutWavData)
 {
 	if (!OutWavData)
 		return false;
 
 	// 파일 열기
-	std::ifstream File(FilePath, std::ios::binary);
+	std::ifstream File(FilePath, std::ios::binary | std::ios::ate);
 	if (!File.is_open())
 	{
 		UE_LOG("Failed to open WAV file: %ws", FilePath.c_str());
 		return false;
 	}
+	const std::streamoff FileSize = File.tellg();
+	File.seekg(0, std::ios::beg);
 
 	// RIFF 헤더 읽기
 	FWavHeader Header;
-	File.read(reinterpret_cast<char*>(&Header), sizeof(FWavHeader));
-	if (strncmp(Header.ChunkID, "RIFF", 4) != 0 || strncmp(Header.Format, "WAVE", 4) != 0)
+	if (!File.read(reinterpret_cast<char*>(&Header), sizeof(FWavHeader))
+		|| strncmp(Header.ChunkID, "RIFF", 4) != 0 || strncmp(Header.Format, "WAVE", 4) != 0)
 	{
 		UE_LOG("Invalid WAV file format: %ws", FilePath.c_str());
 		return false;
@@ -253,8 +290,8 @@ bool UAudioManager::LoadWavFile(const FWideString& FilePath, FWavData* OutWavDat
 
 	// fmt 청크 읽기
 	FWavFormatChunk FormatChunk;
-	File.read(reinterpret_cast<char*>(&FormatChunk), sizeof(FWavFormatChunk));
-	if (strncmp(FormatChunk.SubchunkID, "fmt ", 4) != 0)
+	if (!File.read(reinterpret_cast<char*>(&FormatChunk), sizeof(FWavFormatChunk))
+		|| strncmp(FormatChunk.SubchunkID, "fmt ", 4) != 0 || FormatChunk.BlockAlign == 0)
 	{
 		UE_LOG("Invalid fmt chunk in WAV file: %ws", FilePath.c_str());
 		return false;
@@ -276,7 +313,7 @@ bool UAudioManager::LoadWavFile(const FWideString& FilePath, FWavData* OutWavDat
 	}
 
 	// data 청크 찾기
-	FWavDataChunkHeader DataChunkHeader;
+	FWavDataChunkHeader DataChunkHeader = {};
 	while (File.read(reinterpret_cast<char*>(&DataChunkHeader), sizeof(FWavDataChunkHeader)))
 	{
 		if (strncmp(DataChunkHeader.SubchunkID, "data", 4) == 0)
@@ -293,15 +330,237 @@ bool UAudioManager::LoadWavFile(const FWideString& FilePath, FWavData* OutWavDat
 		return false;
 	}
 
-	// 오디오 데이터 읽기
-	OutWavData->AudioDataSize = DataChunkHeader.SubchunkSize;
-	OutWavData->AudioData = new BYTE[OutWavData->AudioDataSize];
-	File.read(reinterpret_cast<char*>(OutWavData->AudioData), OutWavData->AudioDataSize);
+	// 위치와 크기만 기록 (크기가 잘못 기록된 파일은 실제 파일 끝까지로 제한, 블록 단위 정렬)
+	const std::streamoff DataOffset = File.tellg();
+	const std::streamoff Available = FileSize - DataOffset;
+	DWORD DataSize = DataChunkHeader.SubchunkSize;
+	if ((std::streamoff)DataSize > Available)
+	{
+		DataSize = (DWORD)Available;
+	}
+	DataSize -= DataSize % FormatChunk.BlockAlign;
+
+	OutWavData->SourcePath = FilePath;
+	OutWavData->DataOffset = (DWORD)DataOffset;
+	OutWavData->AudioDataSize = DataSize;
+	OutWavData->bStreaming = OutWavData->GetDuration() > StreamingThresholdSeconds
+		|| (uint64)DataSize > SoundCacheBudget;
 
 	File.close();
+	return DataSize > 0;
+}
+
+bool UAudioManager::LoadSoundData(FWavData* Sound)
+{
+	std::ifstream File(Sound->SourcePath, std::ios::binary);
+	if (!File.is_open())
+	{
+		UE_LOG("Failed to open WAV file: %ws", Sound->SourcePath.c_str());
+		return false;
+	}
+
+	BYTE* Data = new BYTE[Sound->AudioDataSize];
+	File.seekg(Sound->DataOffset, std::ios::beg);
+	if (!File.read(reinterpret_cast<char*>(Data), Sound->AudioDataSize))
+	{
+		UE_LOG("Failed to read WAV data: %ws", Sound->SourcePath.c_str());
+		delete[] Data;
+		return false;
+	}
+
+	Sound->AudioData = Data;
+	ResidentSounds.Add(Sound);
+	ResidentSoundBytes += Sound->AudioDataSize;
 	return true;
 }
 
+void UAudioManager::EvictSoundCache()
+{
+	while (ResidentSoundBytes > SoundCacheBudget)
+	{
+		// 고정되지 않은 사운드 중 가장 오래 사용되지 않은 것
+		int32 VictimIndex = -1;
+		for (int32 i = 0; i < ResidentSounds.Num(); ++i)
+		{
+			const FWavData* Candidate = ResidentSounds[i];
+			if (Candidate->PinCount > 0)
+				continue;
+			if (VictimIndex < 0 || Candidate->LastUsedSerial < ResidentSounds[VictimIndex]->LastUsedSerial)
+			{
+				VictimIndex = i;
+			}
+		}
+
+		// 모두 재생 중이면 예산을 잠시 초과하도록 둠
+		if (VictimIndex < 0)
+			return;
+
+		FWavData* Victim = ResidentSounds[VictimIndex];
+		ResidentSoundBytes -= Victim->AudioDataSize;
+		delete[] Victim->AudioData;
+		Victim->AudioData = nullptr;
+
+		ResidentSounds.SwapAndPop(VictimIndex);
+	}
+}
+
+const BYTE* UAudioManager::PinSoundData(FWavData* Sound)
+{
+	if (!Sound || Sound->bStreaming)
+		return nullptr;
+
+	if (!Sound->AudioData && !LoadSoundData(Sound))
+		return nullptr;
+
+	++Sound->PinCount;
+	Sound->LastUsedSerial = ++SoundUseSerial;
+	EvictSoundCache();
+	return Sound->AudioData;
+}
+
+void UAudioManager::UnpinSoundData(FWavData* Sound)
+{
+	if (!Sound || Sound->PinCount <= 0)
+		return;
+
+	--Sound->PinCount;
+	EvictSoundCache();
+}
+
+void UAudioManager::PrefetchSound(FWavData* Sound)
+{
+	if (!Sound || Sound->bStreaming || Sound->AudioData)
+		return;
+
+	if (LoadSoundData(Sound))
+	{
+		Sound->LastUsedSerial = ++SoundUseSerial;
+		EvictSoundCache();
+	}
+}
+
+void UAudioManager::SetSoundCacheBudget(uint64 InBudgetBytes)
+{
+	SoundCacheBudget = InBudgetBytes;
+	EvictSoundCache();
+}
+
+uint32 UAudioManager::StartStream(IXAudio2SourceVoice* Voice, FWavData* Sound, DWORD ByteOffset, bool bLoop)
+{
+	if (!Voice || !Sound)
+		return 0;
+
+	auto Stream = std::make_unique<FAudioStream>();
+	Stream->File.open(Sound->SourcePath, std::ios::binary);
+	if (!Stream->File.is_open())
+	{
+		UE_LOG("Failed to open WAV stream: %ws", Sound->SourcePath.c_str());
+		return 0;
+	}
+
+	// 청크 크기는 블록 단위로 정렬
+	const DWORD BlockAlign = Sound->WaveFormat.nBlockAlign;
+	DWORD ChunkBytes = (DWORD)(Sound->WaveFormat.nAvgBytesPerSec * StreamChunkSeconds);
+	ChunkBytes = std::max<DWORD>(BlockAlign, ChunkBytes - ChunkBytes % BlockAlign);
+	for (TArray<BYTE>& Buffer : Stream->Buffers)
+	{
+		Buffer.SetNum(ChunkBytes);
+	}
+
+	Stream->Id = NextStreamId++;
+	Stream->Voice = Voice;
+	Stream->Sound = Sound;
+	Stream->ReadOffset = std::min(ByteOffset - ByteOffset % BlockAlign, Sound->AudioDataSize);
+	Stream->bLoop = bLoop;
+
+	// 첫 두 청크는 즉시 제출 (Start 직후 재생 가능하도록)
+	PumpStream(*Stream);
+
+	const uint32 StreamId = Stream->Id;
+	ActiveStreams.Emplace(std::move(Stream));
+	return StreamId;
+}
+
+void UAudioManager::StopStream(uint32 StreamId)
+{
+	for (int32 i = 0; i < ActiveStreams.Num(); ++i)
+	{
+		if (ActiveStreams[i]->Id == StreamId)
+		{
+			ActiveStreams.SwapAndPop(i);
+			return;
+		}
+	}
+}
+
+void UAudioManager::PumpStream(FAudioStream& Stream)
+{
+	if (Stream.bFinished)
+		return;
+
+	XAUDIO2_VOICE_STATE State;
+	Stream.Voice->GetState(&State, XAUDIO2_VOICE_NOSAMPLESPLAYED);
+
+	// 대기 중인 버퍼 수가 NumStreamBuffers 미만이면 가장 먼저 제출한 버퍼는 소비가 끝난 것
+	for (uint32 Queued = State.BuffersQueued; Queued < NumStreamBuffers && !Stream.bFinished; ++Queued)
+	{
+		TArray<BYTE>& Buffer = Stream.Buffers[Stream.NextBuffer];
+		const FWavData* Sound = Stream.Sound;
+
+		// 청크 채우기 (루프면 끝에서 처음으로 이어서 읽음)
+		DWORD Filled = 0;
+		while (Filled < (DWORD)Buffer.Num())
+		{
+			if (Stream.ReadOffset >= Sound->AudioDataSize)
+			{
+				if (!Stream.bLoop)
+				{
+					Stream.bFinished = true;
+					break;
+				}
+				Stream.ReadOffset = 0;
+			}
+
+			const DWORD ReadBytes = std::min((DWORD)Buffer.Num() - Filled, Sound->AudioDataSize - Stream.ReadOffset);
+			Stream.File.seekg((std::streamoff)Sound->DataOffset + Stream.ReadOffset, std::ios::beg);
+			if (!Stream.File.read(reinterpret_cast<char*>(Buffer.data() + Filled), ReadBytes))
+			{
+				UE_LOG("Failed to read WAV stream: %ws", Sound->SourcePath.c_str());
+				Stream.File.clear();
+				Stream.bFinished = true;
+				break;
+			}
+
+			Filled += ReadBytes;
+			Stream.ReadOffset += ReadBytes;
+		}
+
+		// 파일 끝에 정확히 닿았으면 이 청크가 마지막
+		if (!Stream.bLoop && Stream.ReadOffset >= Sound->AudioDataSize)
+		{
+			Stream.bFinished = true;
+		}
+
+		if (Filled == 0)
+			break;
+
+		XAUDIO2_BUFFER XBuffer = {};
+		XBuffer.AudioBytes = Filled;
+		XBuffer.pAudioData = Buffer.data();
+		XBuffer.Flags = Stream.bFinished ? XAUDIO2_END_OF_STREAM : 0;
+
+		HRESULT hr = Stream.Voice->SubmitSourceBuffer(&XBuffer);
+		if (FAILED(hr))
+		{
+			UE_LOG("Failed to submit stream buffer: 0x%08X", hr);
+			Stream.bFinished = true;
+			break;
+		}
+
+		Stream.NextBuffer = (Stream.NextBuffer + 1) % NumStreamBuffers;
+	}
+}
+
 FWavData* UAudioManager::GetSound(const FString& FilePath)
 {
 	// 경로 정규화
@@ -314,7 +573,17 @@ FWavData* UAudioManager::GetSound(const FString& FilePath)
 		return It->second.get();
 	}
 
-	return nullptr;
+	// 스캔 이후 추가되었거나 Data/Sound 밖에 있는 파일은 첫 요청 시 헤더를 읽어 등록
+	const FWideString WidePath = UTF8ToWide(NormalizedPath);
+	auto WavData = std::make_unique<FWavData>();
+	if (!std::filesystem::exists(WidePath) || !ReadWavHeader(WidePath, WavData.get()))
+	{
+		return nullptr;
+	}
+
+	FWavData* Result = WavData.get();
+	WavDataMap[NormalizedPath] = std::move(WavData);
+	return Result;
 }
 
 void UAudioManager::SetMasterVolume(float Volume)
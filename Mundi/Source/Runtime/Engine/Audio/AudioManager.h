@@ -5,11 +5,25 @@
 #include <xaudio2.h>
 
 // WAV 파일 데이터를 담는 구조체
+// 헤더 정보(포맷, data 청크 위치/크기)는 시작 시 스캔되고, PCM 데이터는 첫 재생 요청 시 로드됩니다.
 struct FWavData
 {
 	WAVEFORMATEX WaveFormat;
-	BYTE* AudioData = nullptr;
-	DWORD AudioDataSize = 0;
+	BYTE* AudioData = nullptr;		// 상주 중일 때만 유효 (스트리밍 사운드는 항상 nullptr)
+	DWORD AudioDataSize = 0;		// data 청크 크기 (상주 여부와 무관하게 유효)
+
+	FWideString SourcePath;			// 원본 .wav 파일 경로
+	DWORD DataOffset = 0;			// 파일 내 data 청크 시작 위치
+	bool bStreaming = false;		// 긴 트랙: 메모리에 올리지 않고 디스크에서 스트리밍
+	int32 PinCount = 0;				// 재생 중인 보이스 수 (0보다 크면 캐시에서 제거 불가)
+	uint64 LastUsedSerial = 0;		// LRU 캐시용 최근 사용 시각
+
+	float GetDuration() const
+	{
+		if (WaveFormat.nBlockAlign == 0 || WaveFormat.nSamplesPerSec == 0)
+			return 0.0f;
+		return (float)(AudioDataSize / WaveFormat.nBlockAlign) / (float)WaveFormat.nSamplesPerSec;
+	}
 
 	~FWavData()
 	{
@@ -21,12 +35,15 @@ struct FWavData
 	}
 };
 
+struct FAudioStream;
+
 /**
  * UAudioManager
  *
  * 게임 엔진의 오디오 시스템을 관리하는 싱글톤 클래스
  * - XAudio2 기반 오디오 엔진
- * - Data/Sound 폴더의 모든 .wav 파일을 미리 로드
+ * - 시작 시 Data/Sound 폴더의 .wav 헤더만 스캔하고, PCM 데이터는 필요할 때 로드
+ * - 짧은 사운드는 메모리 예산이 있는 LRU 캐시에 상주, 긴 트랙은 이중 버퍼로 디스크 스트리밍
  * - AudioComponent에서 사운드 파일 선택 및 재생을 위한 인터페이스 제공
  */
 class UAudioManager
@@ -42,17 +59,49 @@ public:
 
 	// --- 사운드 리소스 관리 ---
 	/**
-	 * Data/Sound 폴더를 재귀적으로 스캔하여 모든 .wav 파일을 로드합니다.
+	 * Data/Sound 폴더를 재귀적으로 스캔하여 모든 .wav 파일의 헤더를 읽습니다.
+	 * PCM 데이터는 읽지 않으며, 이미 등록된 사운드는 그대로 유지됩니다.
 	 */
 	void LoadAllSounds();
 
 	/**
 	 * 파일 경로로 WAV 데이터를 가져옵니다.
+	 * 스캔되지 않은 경로는 이 시점에 헤더를 읽어 등록합니다.
+	 * 반환된 FWavData의 AudioData는 PinSoundData() 전까지 비어 있을 수 있습니다.
 	 * @param FilePath 사운드 파일 경로 (Data/Sound/xxx.wav)
 	 * @return FWavData 포인터 (nullptr if not found)
 	 */
 	FWavData* GetSound(const FString& FilePath);
 
+	/**
+	 * 짧은 사운드의 PCM 데이터를 캐시에 올리고 고정합니다.
+	 * 고정된 사운드는 UnpinSoundData() 전까지 캐시에서 제거되지 않습니다.
+	 * @return PCM 데이터 (스트리밍 사운드이거나 로드 실패 시 nullptr)
+	 */
+	const BYTE* PinSoundData(FWavData* Sound);
+	void UnpinSoundData(FWavData* Sound);
+
+	/**
+	 * 짧은 사운드를 고정하지 않고 캐시에 미리 올립니다. (첫 재생 시 디스크 읽기 방지)
+	 */
+	void PrefetchSound(FWavData* Sound);
+
+	/**
+	 * 스트리밍 사운드를 Voice에 연결하고 첫 두 청크를 제출합니다.
+	 * 이후 청크는 Update()에서 Voice가 버퍼를 소비할 때마다 디스크에서 채워집니다.
+	 * Voice를 파괴한 뒤에는 반드시 StopStream()으로 스트림을 해제해야 합니다.
+	 * @return 스트림 핸들 (실패 시 0)
+	 */
+	uint32 StartStream(IXAudio2SourceVoice* Voice, FWavData* Sound, DWORD ByteOffset, bool bLoop);
+	void StopStream(uint32 StreamId);
+
+	/**
+	 * 짧은 사운드 캐시의 메모리 예산을 설정합니다. (바이트)
+	 */
+	void SetSoundCacheBudget(uint64 InBudgetBytes);
+	uint64 GetSoundCacheBudget() const { return SoundCacheBudget; }
+	uint64 GetResidentSoundBytes() const { return ResidentSoundBytes; }
+
 	/**
 	 * 모든 로드된 사운드 파일 경로 목록을 반환합니다.
 	 * PropertyRenderer에서 ImGui 드롭다운을 만들 때 사용합니다.
@@ -86,16 +135,37 @@ private:
 	void ScanFolderRecursive(const FWideString& FolderPath, TArray<FWideString>& OutWavFiles);
 
 	/**
-	 * .wav 파일을 로드하여 FWavData로 변환합니다.
+	 * .wav 파일의 헤더를 읽어 포맷과 data 청크 위치를 FWavData에 채웁니다.
+	 */
+	bool ReadWavHeader(const FWideString& FilePath, FWavData* OutWavData);
+
+	/**
+	 * data 청크 전체를 읽어 사운드를 메모리에 상주시킵니다.
+	 */
+	bool LoadSoundData(FWavData* Sound);
+
+	/**
+	 * 캐시가 예산을 넘으면 고정되지 않은 사운드를 오래된 순서대로 해제합니다.
+	 */
+	void EvictSoundCache();
+
+	/**
+	 * Voice가 소비한 스트림 버퍼를 디스크에서 다시 채워 제출합니다.
 	 */
-	bool LoadWavFile(const FWideString& FilePath, FWavData* OutWavData);
+	void PumpStream(FAudioStream& Stream);
 
 private:
 	// --- 멤버 변수 ---
 	IXAudio2* XAudio2 = nullptr;								// XAudio2 인스턴스
 	IXAudio2MasteringVoice* MasteringVoice = nullptr;			// 마스터링 보이스
-	TMap<FString, std::unique_ptr<FWavData>> WavDataMap;		// 로드된 WAV 데이터 맵
+	TMap<FString, std::unique_ptr<FWavData>> WavDataMap;		// 스캔된 WAV 데이터 맵
 	TArray<FString> SoundFilePaths;								// PropertyRenderer용 경로 목록
+	TArray<FWavData*> ResidentSounds;							// PCM 데이터가 상주 중인 사운드
+	uint64 ResidentSoundBytes = 0;								// 상주 중인 PCM 데이터 크기
+	uint64 SoundCacheBudget = 64ull * 1024 * 1024;				// 짧은 사운드 캐시 예산
+	uint64 SoundUseSerial = 0;									// LRU 순서용 카운터
+	TArray<std::unique_ptr<FAudioStream>> ActiveStreams;		// 재생 중인 스트림
+	uint32 NextStreamId = 1;
 	float MasterVolume = 100.0f;								// 마스터 볼륨 (0 ~ 100)
 	bool bIsInitialized = false;								// 초기화 여부
 };
@@ -17,6 +17,13 @@ FVector FAABB::GetHalfExtent() const
 	return (Max - Min) * 0.5f;
 }
 
+// 표면적 (SAH 비용 계산용)
+float FAABB::GetSurfaceArea() const
+{
+	const FVector Size = Max - Min;
+	return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+}
+
 TArray<FVector> FAABB::GetPoints() const
 {
 	TArray<FVector> Points;
@@ -27,6 +27,9 @@ struct FAABB
 	// 반쪽 크기 (Extent)
 	FVector GetHalfExtent() const;
 
+	// 표면적 (SAH 비용 계산용)
+	float GetSurfaceArea() const;
+
 	// AABB의 8개 꼭짓점 
 	TArray<FVector> GetPoints() const;
 
@@ -163,7 +163,7 @@ FFrustum CreateFrustum(const FVector& Location, const FQuat& Rotation, float ZNe
     const FVector4 Up = FVector4::FromDirection(Rotation.RotateVector(FVector(0, 0, 1)));
 
     // Far 평면에서의 절반 높이/너비
-    const float HalfVSide = ZNear * tanf(FovRad * 0.5f); // 세로(Vertical) 반폭
+    const float HalfVSide = ZFar * tanf(FovRad * 0.5f); // 세로(Vertical) 반폭 (측면 평면을 Far 기준 벡터로 만들므로 Far에서 계산)
     const float HalfHSide = HalfVSide * Aspect;            // 가로(Horizontal) 반폭
     const FVector4 FrontMultFar = FVector4(Forward.X * ZFar, Forward.Y * ZFar, Forward.Z * ZFar, 0.0f);        // Far까지의 전방 벡터
 
@@ -144,7 +144,7 @@ bool FOBB::Intersects(const FOBB& Other) const
         for (int32 j = 0; j < 3; ++j)
         {
             R[i][j] = FVector::Dot(UA[i], UB[j]);
-            AbsR[i][j] = std::fabsf(R[i][j]) + KINDA_SMALL_NUMBER;
+            AbsR[i][j] = std::fabs(R[i][j]) + KINDA_SMALL_NUMBER;
         }
     }
 
@@ -154,7 +154,7 @@ bool FOBB::Intersects(const FOBB& Other) const
         const float RA = (&ExtA.X)[i];
         const float RB = ExtB.X * AbsR[i][0] + ExtB.Y * AbsR[i][1] + ExtB.Z * AbsR[i][2];
         const float ProjT = FVector::Dot(T, UA[i]);
-        if (std::fabsf(ProjT) > RA + RB)
+        if (std::fabs(ProjT) > RA + RB)
             return false;
     }
 
@@ -164,7 +164,7 @@ bool FOBB::Intersects(const FOBB& Other) const
         const float RA = ExtA.X * AbsR[0][j] + ExtA.Y * AbsR[1][j] + ExtA.Z * AbsR[2][j];
         const float RB = (&ExtB.X)[j];
         const float ProjT = FVector::Dot(T, UB[j]);
-        if (std::fabsf(ProjT) > RA + RB)
+        if (std::fabs(ProjT) > RA + RB)
             return false;
     }
 
@@ -183,7 +183,7 @@ bool FOBB::Intersects(const FOBB& Other) const
             const float RA = (&ExtA.X)[i1]*AbsR[i2][j0] + (&ExtA.X)[i2]*AbsR[i1][j0];
             const float RB = (&ExtB.X)[j1]*AbsR[i0][j2] + (&ExtB.X)[j2]*AbsR[i0][j1];
             
-            const float TL = std::fabsf(FVector::Dot(T, UA[i2])*R[i1][j0] - FVector::Dot(T, UA[i1])*R[i2][j0]);
+            const float TL = std::fabs(FVector::Dot(T, UA[i2])*R[i1][j0] - FVector::Dot(T, UA[i1])*R[i2][j0]);
             if (TL > RA + RB)
                 return false;
         }
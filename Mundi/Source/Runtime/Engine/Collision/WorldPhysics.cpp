@@ -10,6 +10,8 @@
 #include "OBB.h"
 #include "BoundingSphere.h"
 #include "BoundingCapsule.h"
+#include "JobSystem.h"
+#include "HashUtils.h"
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
@@ -31,9 +33,7 @@ namespace
 			std::swap(AddressA, AddressB);
 		}
 
-		const uint64 MixedLow = static_cast<uint64>(AddressA);
-		const uint64 MixedHigh = static_cast<uint64>(AddressB);
-		return MixedLow ^ (MixedHigh + 0x9e3779b97f4a7c15ULL + (MixedLow << 6) + (MixedLow >> 2));
+		return HashCombine(static_cast<uint64>(AddressA), static_cast<uint64>(AddressB));
 	}
 }
 
@@ -62,6 +62,8 @@ void UWorldPhysics::Clear()
 
 	CollisionDirtyQueue.Empty();
 	CollisionDirtySet.Empty();
+	PendingPairShapes.Empty();
+	CollisionMap.Empty();
 }
 
 void UWorldPhysics::RegisterCollision(UShapeComponent* InShape)
@@ -88,6 +90,8 @@ void UWorldPhysics::BulkRegisterCollision(const TArray<UShapeComponent*>& InShap
 			continue;
 		}
 		CollisionDirtySet.erase(Shape);
+		// BVH는 아래에서 한 번에 빌드하고, 쌍 검사만 다음 Update로 미룸
+		PendingPairShapes.Add(Shape);
 	}
 
 	if (BVH)
@@ -152,14 +156,9 @@ void UWorldPhysics::UnregisterCollision(UShapeComponent* InShape)
 	// Collision Map에서 제거
 	CollisionMap.Remove(InShape);
 
-	PreviousCollisionMap.Remove(InShape);
-	for (auto& Pair : PreviousCollisionMap)
-	{
-		Pair.second.Remove(InShape);
-	}
-
 	// Update 대기중이었을 수 있으므로 DirtySet에서도 제거
 	CollisionDirtySet.erase(InShape);
+	PendingPairShapes.erase(std::remove(PendingPairShapes.begin(), PendingPairShapes.end(), InShape), PendingPairShapes.end());
 }
 
 void UWorldPhysics::MarkCollisionDirty(UShapeComponent* PhysicsObject)
@@ -169,16 +168,8 @@ void UWorldPhysics::MarkCollisionDirty(UShapeComponent* PhysicsObject)
 		return;
 	}
 
-	// 캐시된 CollisionMap이 있다면 즉시 무효화
-	if (!CollisionMap.IsEmpty())
-	{
-		CollisionMap.Remove(PhysicsObject);
-		for (auto& Pair : CollisionMap)
-		{
-			Pair.second.Remove(PhysicsObject);
-		}
-	}
-
+	// CollisionMap은 다음 Update에서 이 shape가 포함된 쌍만 다시 검사해 갱신
+	// (그 전까지 CollisionQuery는 더티 여부를 보고 캐시 대신 BVH를 직접 조회)
 	if (CollisionDirtySet.insert(PhysicsObject).second)
 	{
 		CollisionDirtyQueue.push(PhysicsObject);
@@ -190,6 +181,7 @@ void UWorldPhysics::Update(float DeltaTime)
 	(void)DeltaTime;
 
 	// 1. DirtyQueue 처리
+	TArray<UShapeComponent*> DirtyShapes;
 	while (true)
 	{
 		UShapeComponent* Shape = nullptr;
@@ -212,37 +204,88 @@ void UWorldPhysics::Update(float DeltaTime)
 		{
 			BVH->Update(Shape);
 		}
+		DirtyShapes.Add(Shape);
 	}
-	
-	if (BVH)
+
+	if (!BVH)
 	{
-		// 2. BVH 갱신
-		BVH->FlushRebuild();
+		CollisionMap.Empty();
+		PendingPairShapes.Empty();
+		return;
+	}
+
+	// 2. BVH 갱신
+	BVH->FlushRebuild();
 
-		// 3. CollisionMap 갱신
-		CollisionMap.clear();
-		TArray<UShapeComponent*> Shapes = BVH->GetShapeArray();
-		for (UShapeComponent* Shape : Shapes)
+	// 3. 더티 shape가 포함된 쌍만 다시 검사. 나머지 쌍은 이전 프레임 상태를 그대로 유지
+	DirtyShapes.Append(PendingPairShapes);
+	PendingPairShapes.Empty();
+
+	TArray<UShapeComponent*> UniqueShapes;
+	TSet<UShapeComponent*> Processed;
+	for (UShapeComponent* Shape : DirtyShapes)
+	{
+		// 대기 중 등록 해제된 shape는 BVH에 없으므로 건너뜀
+		if (Processed.insert(Shape).second && BVH->Contains(Shape))
 		{
-			if (!Shape)
-			{
-				continue;
-			}
+			UniqueShapes.Add(Shape);
+		}
+	}
+
+	// BVH 쿼리는 읽기 전용이라 워커에서 병렬로 수행하고, CollisionMap 갱신은 아래에서 순서대로 적용
+	// (더티 shape의 월드 변환 캐시는 위 BVH->Update / BulkUpdate에서 이미 계산됨)
+	const int32 ShapeCount = static_cast<int32>(UniqueShapes.Num());
+	TArray<TArray<UShapeComponent*>> CollidedLists(ShapeCount);
+	ParallelFor(ShapeCount, [&](int32 Index)
+	{
+		CollidedLists[Index] = BVH->Query(UniqueShapes[Index]);
+	}, 16);
+
+	TArray<std::pair<UShapeComponent*, UShapeComponent*>> BeginPairs;
+	TArray<std::pair<UShapeComponent*, UShapeComponent*>> EndPairs;
+	for (int32 Index = 0; Index < ShapeCount; ++Index)
+	{
+		UpdateCollisionPairs(UniqueShapes[Index], CollidedLists[Index], BeginPairs, EndPairs);
+	}
+
+	// 4. 상태가 바뀐 쌍에 대해서만 Begin/End 이벤트 발송
+	BroadcastCollisionEvents(BeginPairs, EndPairs);
+}
+
+void UWorldPhysics::UpdateCollisionPairs(UShapeComponent* InShape, const TArray<UShapeComponent*>& InCollided,
+	TArray<std::pair<UShapeComponent*, UShapeComponent*>>& OutBeginPairs, TArray<std::pair<UShapeComponent*, UShapeComponent*>>& OutEndPairs)
+{
+	TSet<UShapeComponent*>& Current = CollisionMap[InShape];
 
-			TArray<UShapeComponent*> Collided = BVH->Query(Shape);
-			TSet<UShapeComponent*> CollidedSet(Collided.begin(), Collided.end());
-			CollisionMap.Add(Shape, CollidedSet);
+	// 더 이상 겹치지 않는 쌍: 양쪽 캐시에서 제거
+	for (auto It = Current.begin(); It != Current.end();)
+	{
+		UShapeComponent* Other = *It;
+		if (std::find(InCollided.begin(), InCollided.end(), Other) != InCollided.end())
+		{
+			++It;
+			continue;
 		}
+
+		if (TSet<UShapeComponent*>* OtherSet = CollisionMap.Find(Other))
+		{
+			OtherSet->Remove(InShape);
+		}
+		OutEndPairs.Add({ InShape, Other });
+		It = Current.erase(It);
 	}
-	else
+
+	// 새로 겹치기 시작한 쌍: 양쪽 캐시에 추가. 상대도 더티라면 상대 차례에는 이미 기록되어 있어 중복 이벤트가 나가지 않음
+	for (UShapeComponent* Other : InCollided)
 	{
-		CollisionMap.clear();
+		if (!Other || !Current.insert(Other).second)
+		{
+			continue;
+		}
+
+		CollisionMap[Other].Add(InShape);
+		OutBeginPairs.Add({ InShape, Other });
 	}
-	
-	// 갱신된 충돌 집합을 기반으로 Begin/End 이벤트 발송
-	BroadcastCollisionEvents();
-	// 이후 프레임 비교를 위해 현재 프레임 결과를 스냅샷으로 보관
-	PreviousCollisionMap = CollisionMap;
 }
 
 /**
@@ -258,7 +301,9 @@ TArray<UShapeComponent*> UWorldPhysics::CollisionQuery(const UShapeComponent* Ph
 		return Collisions;
 	}
 
-	if (const TSet<UShapeComponent*>* CachedSet = CollisionMap.Find(PhysicsObject))
+	// 더티 shape의 캐시는 다음 Update 전까지 최신이 아니므로 BVH로 직접 조회
+	const TSet<UShapeComponent*>* CachedSet = CollisionDirtySet.Contains(const_cast<UShapeComponent*>(PhysicsObject)) ? nullptr : CollisionMap.Find(PhysicsObject);
+	if (CachedSet)
 	{
 		Collisions = CachedSet->Array();
 		return Collisions;
@@ -438,7 +483,7 @@ void UWorldPhysics::DebugDrawCollision(URenderer* Renderer, USelectionManager* S
 		return;
 	}
 
-	const TArray<UShapeComponent*> Shapes = BVH->GetShapeArray();
+	const TArray<UShapeComponent*>& Shapes = BVH->GetShapeArray();
 	if (Shapes.IsEmpty())
 	{
 		return;
@@ -485,59 +530,33 @@ void UWorldPhysics::DebugDrawCollision(URenderer* Renderer, USelectionManager* S
 	}
 }
 
-void UWorldPhysics::BroadcastCollisionEvents()
+void UWorldPhysics::BroadcastCollisionEvents(const TArray<std::pair<UShapeComponent*, UShapeComponent*>>& InBeginPairs,
+	const TArray<std::pair<UShapeComponent*, UShapeComponent*>>& InEndPairs)
 {
-	TSet<uint64> ProcessedPairs;
-
-	// 이벤트 브로드캐스트 중 콜백에서 CollisionMap이 수정될 수 있으므로 복사본 순회
-	TMap<const UShapeComponent*, TSet<UShapeComponent*>> CollisionMapSnapshot = CollisionMap;
-
-	for (const auto& Pair : CollisionMapSnapshot)
+	// 콜백 안에서 등록 해제/이동이 일어날 수 있으므로 발송 직전에 쌍 상태를 다시 확인
+	for (const auto& Pair : InEndPairs)
 	{
-		const UShapeComponent* OwnerConst = Pair.first;
-		UShapeComponent* Owner = const_cast<UShapeComponent*>(OwnerConst);
-		const TSet<UShapeComponent*>& Current = Pair.second;
-		const TSet<UShapeComponent*>* Previous = PreviousCollisionMap.Find(OwnerConst);
+		if (!BVH->Contains(Pair.first) || !BVH->Contains(Pair.second))
+		{
+			// 등록 해제되었다면 UnregisterCollision에서 이미 처리됨
+			continue;
+		}
 
-		for (UShapeComponent* Other : Current)
+		const TSet<UShapeComponent*>* Current = CollisionMap.Find(Pair.first);
+		if (!Current || !Current->Contains(Pair.second))
 		{
-			if (!Previous || !Previous->Contains(Other))
-			{
-				if (!Other)
-				{
-					continue;
-				}
-
-				const uint64 Key = MakeCollisionPairKey(OwnerConst, Other);
-				if (Key != 0 && !ProcessedPairs.Contains(Key))
-				{
-					ProcessedPairs.Add(Key);
-					// 처음으로 겹치기 시작한 경우에만 BeginOverlap을 브로드캐스트
-					BeginOverlapEvent.Broadcast(Owner, Other);
-				}
-			}
+			// 앞선 프레임까지 겹쳤다가 이번 프레임에 분리된 경우 EndOverlap
+			EndOverlapEvent.Broadcast(Pair.first, Pair.second);
 		}
+	}
 
-		if (Previous)
+	for (const auto& Pair : InBeginPairs)
+	{
+		const TSet<UShapeComponent*>* Current = CollisionMap.Find(Pair.first);
+		if (Current && Current->Contains(Pair.second))
 		{
-			for (UShapeComponent* PrevOther : *Previous)
-			{
-				if (!Current.Contains(PrevOther))
-				{
-					if (!PrevOther)
-					{
-						continue;
-					}
-
-					const uint64 Key = MakeCollisionPairKey(OwnerConst, PrevOther);
-					if (Key != 0 && !ProcessedPairs.Contains(Key))
-					{
-						ProcessedPairs.Add(Key);
-						// 앞선 프레임까지 겹쳤다가 이번 프레임에 분리된 경우 EndOverlap
-						EndOverlapEvent.Broadcast(Owner, PrevOther);
-					}
-				}
-			}
+			// 처음으로 겹치기 시작한 경우에만 BeginOverlap을 브로드캐스트
+			BeginOverlapEvent.Broadcast(Pair.first, Pair.second);
 		}
 	}
 }
@@ -39,13 +39,18 @@ private:
 	UWorldPhysics(const UWorldPhysics&) = delete;
 	UWorldPhysics& operator=(const UWorldPhysics&) = delete;
 
-	void BroadcastCollisionEvents();
+	// 더티 shape의 새 겹침 목록(InCollided)으로 CollisionMap을 갱신하고, 상태가 바뀐 쌍을 OutBegin/OutEnd에 수집
+	void UpdateCollisionPairs(UShapeComponent* InShape, const TArray<UShapeComponent*>& InCollided, TArray<std::pair<UShapeComponent*, UShapeComponent*>>& OutBeginPairs,
+		TArray<std::pair<UShapeComponent*, UShapeComponent*>>& OutEndPairs);
+	void BroadcastCollisionEvents(const TArray<std::pair<UShapeComponent*, UShapeComponent*>>& InBeginPairs,
+		const TArray<std::pair<UShapeComponent*, UShapeComponent*>>& InEndPairs);
 	
 	TQueue<UShapeComponent*> CollisionDirtyQueue; // 추가 혹은 갱신이 필요한 요소의 대기 큐
 	TSet<UShapeComponent*> CollisionDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
+	TArray<UShapeComponent*> PendingPairShapes;   // BulkRegister로 BVH에는 들어갔지만 쌍 검사가 아직인 shape
 
+	// 프레임 간 유지되는 겹침 쌍 캐시 (양방향으로 기록). 더티 shape가 포함된 쌍만 갱신됨
 	TMap<const UShapeComponent*, TSet<UShapeComponent*>> CollisionMap;
-	TMap<const UShapeComponent*, TSet<UShapeComponent*>> PreviousCollisionMap;
 
 	FCollisionBVH* BVH = nullptr;
 
@@ -101,34 +101,24 @@ void UAudioComponent::Play(bool bLoopOverride)
 	// 루프 설정
 	bool bShouldLoop = bLoopOverride ? true : bLoop;
 
-	// 버퍼 설정
-	XAUDIO2_BUFFER Buffer = {};
-	Buffer.AudioBytes = WavData->AudioDataSize;
-	Buffer.pAudioData = WavData->AudioData;
-	Buffer.Flags = XAUDIO2_END_OF_STREAM;
-
-	if (bShouldLoop)
-	{
-		Buffer.LoopCount = XAUDIO2_LOOP_INFINITE;
-	}
-	else
+	// 스트림은 버퍼가 XAudio2에 남아 있을 수 있으므로 Voice를 새로 만든 뒤 처음부터 다시 스트리밍
+	if (StreamId != 0 && !ResetSourceVoice(WavData))
 	{
-		Buffer.LoopCount = 0;
+		return;
 	}
 
 	// 기존 버퍼 클리어
 	SourceVoice->FlushSourceBuffers();
 
-	// 버퍼 제출
-	HRESULT hr = SourceVoice->SubmitSourceBuffer(&Buffer);
-	if (FAILED(hr))
+	// 버퍼 제출 (첫 재생 시 사운드 데이터 로드)
+	if (!SubmitAudio(WavData, 0, bShouldLoop))
 	{
-		UE_LOG("AudioComponent::Play - Failed to submit source buffer: 0x%08X", hr);
+		UE_LOG("AudioComponent::Play - Failed to submit audio for '%s'.", AudioFilePath.c_str());
 		return;
 	}
 
 	// 재생 시작
-	hr = SourceVoice->Start(0);
+	HRESULT hr = SourceVoice->Start(0);
 	if (FAILED(hr))
 	{
 		UE_LOG("AudioComponent::Play - Failed to start playback: 0x%08X", hr);
@@ -251,31 +241,9 @@ void UAudioComponent::Resume()
 	try
 	{
 		// SourceVoice를 재생성 (SamplesPlayed 누적 문제 해결)
-		if (SourceVoice)
-		{
-			SourceVoice->Stop(0);
-			SourceVoice->FlushSourceBuffers();
-			SourceVoice->DestroyVoice();
-			SourceVoice = nullptr;
-		}
-
-		// 새 SourceVoice 생성
-		IXAudio2* XAudio2 = AudioMgr.GetXAudio2();
-		if (!XAudio2)
+		if (!ResetSourceVoice(WavData))
 			return;
 
-		HRESULT hr = XAudio2->CreateSourceVoice(&SourceVoice, &WavData->WaveFormat);
-		if (FAILED(hr))
-		{
-			UE_LOG("AudioComponent::Resume - Failed to create SourceVoice: 0x%08X", hr);
-			return;
-		}
-
-		// 볼륨/재생속도 설정
-		float NormalizedVolume = Volume / 100.0f;
-		SourceVoice->SetVolume(NormalizedVolume);
-		SourceVoice->SetFrequencyRatio(PlaybackSpeed);
-
 		// 현재 PlaybackStartOffset 위치에서 버퍼 제출
 		UINT64 SamplePosition = (UINT64)(PlaybackStartOffset * WavData->WaveFormat.nSamplesPerSec);
 		UINT64 TotalSamples = WavData->AudioDataSize / WavData->WaveFormat.nBlockAlign;
@@ -285,22 +253,8 @@ void UAudioComponent::Resume()
 
 		DWORD ByteOffset = (DWORD)(SamplePosition * WavData->WaveFormat.nBlockAlign);
 
-		// 버퍼 제출
-		XAUDIO2_BUFFER Buffer = {};
-		Buffer.AudioBytes = WavData->AudioDataSize - ByteOffset;
-		Buffer.pAudioData = WavData->AudioData + ByteOffset;
-		Buffer.Flags = XAUDIO2_END_OF_STREAM;
-
-		if (bLoop)
-		{
-			Buffer.LoopCount = XAUDIO2_LOOP_INFINITE;
-		}
-		else
-		{
-			Buffer.LoopCount = 0;
-		}
-
-		SourceVoice->SubmitSourceBuffer(&Buffer);
+		if (!SubmitAudio(WavData, ByteOffset, bLoop))
+			return;
 
 		// 재생 시작
 		SourceVoice->Start(0);
@@ -436,31 +390,9 @@ void UAudioComponent::SetPlaybackPosition(float Seconds)
 		bool bWasPlaying = IsPlaying();
 
 		// SourceVoice를 재생성 (SamplesPlayed 누적 문제 해결)
-		if (SourceVoice)
-		{
-			SourceVoice->Stop(0);
-			SourceVoice->FlushSourceBuffers();
-			SourceVoice->DestroyVoice();
-			SourceVoice = nullptr;
-		}
-
-		// 새 SourceVoice 생성
-		IXAudio2* XAudio2 = AudioMgr.GetXAudio2();
-		if (!XAudio2)
+		if (!ResetSourceVoice(WavData))
 			return;
 
-		HRESULT hr = XAudio2->CreateSourceVoice(&SourceVoice, &WavData->WaveFormat);
-		if (FAILED(hr))
-		{
-			UE_LOG("AudioComponent::SetPlaybackPosition - Failed to create SourceVoice: 0x%08X", hr);
-			return;
-		}
-
-		// 볼륨/재생속도 설정
-		float NormalizedVolume = Volume / 100.0f;
-		SourceVoice->SetVolume(NormalizedVolume);
-		SourceVoice->SetFrequencyRatio(PlaybackSpeed);
-
 		// 초를 샘플 수로 변환
 		UINT64 SamplePosition = (UINT64)(Seconds * WavData->WaveFormat.nSamplesPerSec);
 		UINT64 TotalSamples = WavData->AudioDataSize / WavData->WaveFormat.nBlockAlign;
@@ -473,22 +405,12 @@ void UAudioComponent::SetPlaybackPosition(float Seconds)
 		DWORD ByteOffset = (DWORD)(SamplePosition * WavData->WaveFormat.nBlockAlign);
 
 		// 새 위치에서 버퍼 제출
-		XAUDIO2_BUFFER Buffer = {};
-		Buffer.AudioBytes = WavData->AudioDataSize - ByteOffset;
-		Buffer.pAudioData = WavData->AudioData + ByteOffset;
-		Buffer.Flags = XAUDIO2_END_OF_STREAM;
-
-		if (bLoop)
+		if (!SubmitAudio(WavData, ByteOffset, bLoop))
 		{
-			Buffer.LoopCount = XAUDIO2_LOOP_INFINITE;
-		}
-		else
-		{
-			Buffer.LoopCount = 0;
+			bIsCurrentlyPlaying = false;
+			return;
 		}
 
-		SourceVoice->SubmitSourceBuffer(&Buffer);
-
 		// 시작 오프셋 업데이트 (새로운 버퍼는 이 위치부터 시작)
 		PlaybackStartOffset = Seconds;
 
@@ -524,9 +446,8 @@ float UAudioComponent::GetDuration() const
 	if (!WavData)
 		return 0.0f;
 
-	// 전체 샘플 수 / 샘플레이트 = 초
-	UINT64 TotalSamples = WavData->AudioDataSize / WavData->WaveFormat.nBlockAlign;
-	return (float)TotalSamples / (float)WavData->WaveFormat.nSamplesPerSec;
+	// 헤더 정보만으로 계산 (PCM 데이터 상주 여부와 무관)
+	return WavData->GetDuration();
 }
 
 void UAudioComponent::SeekRelative(float Seconds)
@@ -585,6 +506,9 @@ void UAudioComponent::LoadAudio()
 	// SourceVoice 생성
 	CreateSourceVoice();
 
+	// 짧은 사운드는 첫 Play에서 디스크를 읽지 않도록 미리 캐시에 올림
+	AudioMgr.PrefetchSound(WavData);
+
 	if (SourceVoice)
 	{
 		bIsLoaded = true;
@@ -634,14 +558,18 @@ void UAudioComponent::CreateSourceVoice()
 void UAudioComponent::ReleaseSourceVoice()
 {
 	if (!SourceVoice)
+	{
+		ReleasePlaybackData();
 		return;
+	}
 
-	// 먼저 재생 중지
+	// 먼저 재생 중지 (곧 파괴할 Voice를 Stop이 처음 위치로 재생성하지 않도록 로드 상태부터 해제)
+	bIsLoaded = false;
 	Stop(true);
 
 	// AudioManager가 shutdown된 경우 DestroyVoice 호출 불필요
 	UAudioManager& AudioMgr = UAudioManager::GetInstance();
-	if (AudioMgr.IsInitialized())
+	if (SourceVoice && AudioMgr.IsInitialized())
 	{
 		try
 		{
@@ -655,7 +583,101 @@ void UAudioComponent::ReleaseSourceVoice()
 	}
 
 	SourceVoice = nullptr;
-	bIsLoaded = false;
+	ReleasePlaybackData();
+}
+
+bool UAudioComponent::ResetSourceVoice(FWavData* WavData)
+{
+	UAudioManager& AudioMgr = UAudioManager::GetInstance();
+
+	if (SourceVoice)
+	{
+		SourceVoice->Stop(0);
+		SourceVoice->FlushSourceBuffers();
+		SourceVoice->DestroyVoice();
+		SourceVoice = nullptr;
+	}
+
+	// Voice가 파괴되었으므로 이전 스트림 버퍼를 안전하게 해제 가능
+	// (고정한 사운드는 같은 데이터를 다시 제출하므로 그대로 유지)
+	if (StreamId != 0)
+	{
+		AudioMgr.StopStream(StreamId);
+		StreamId = 0;
+	}
+
+	// 새 SourceVoice 생성
+	IXAudio2* XAudio2 = AudioMgr.GetXAudio2();
+	if (!XAudio2)
+		return false;
+
+	HRESULT hr = XAudio2->CreateSourceVoice(&SourceVoice, &WavData->WaveFormat);
+	if (FAILED(hr))
+	{
+		UE_LOG("AudioComponent::ResetSourceVoice - Failed to create SourceVoice: 0x%08X", hr);
+		SourceVoice = nullptr;
+		return false;
+	}
+
+	// 볼륨/재생속도 설정
+	float NormalizedVolume = Volume / 100.0f;
+	SourceVoice->SetVolume(NormalizedVolume);
+	SourceVoice->SetFrequencyRatio(PlaybackSpeed);
+	return true;
+}
+
+bool UAudioComponent::SubmitAudio(FWavData* WavData, DWORD ByteOffset, bool bShouldLoop)
+{
+	UAudioManager& AudioMgr = UAudioManager::GetInstance();
+
+	// 긴 트랙: 디스크에서 이중 버퍼로 스트리밍 (루프는 스트림이 처리)
+	if (WavData->bStreaming)
+	{
+		StreamId = AudioMgr.StartStream(SourceVoice, WavData, ByteOffset, bShouldLoop);
+		return StreamId != 0;
+	}
+
+	// 짧은 사운드: 재생하는 동안 캐시에서 제거되지 않도록 고정
+	if (!PinnedSound)
+	{
+		if (!AudioMgr.PinSoundData(WavData))
+			return false;
+		PinnedSound = WavData;
+	}
+
+	XAUDIO2_BUFFER Buffer = {};
+	Buffer.AudioBytes = WavData->AudioDataSize - ByteOffset;
+	Buffer.pAudioData = WavData->AudioData + ByteOffset;
+	Buffer.Flags = XAUDIO2_END_OF_STREAM;
+	Buffer.LoopCount = bShouldLoop ? XAUDIO2_LOOP_INFINITE : 0;
+
+	HRESULT hr = SourceVoice->SubmitSourceBuffer(&Buffer);
+	if (FAILED(hr))
+	{
+		UE_LOG("AudioComponent::SubmitAudio - Failed to submit source buffer: 0x%08X", hr);
+		return false;
+	}
+	return true;
+}
+
+void UAudioComponent::ReleasePlaybackData()
+{
+	// AudioManager가 shutdown되면 스트림과 캐시도 함께 해제되었음
+	UAudioManager& AudioMgr = UAudioManager::GetInstance();
+	if (AudioMgr.IsInitialized())
+	{
+		if (StreamId != 0)
+		{
+			AudioMgr.StopStream(StreamId);
+		}
+		if (PinnedSound)
+		{
+			AudioMgr.UnpinSoundData(PinnedSound);
+		}
+	}
+
+	StreamId = 0;
+	PinnedSound = nullptr;
 }
 
 void UAudioComponent::OnSerialized()
@@ -676,6 +698,8 @@ void UAudioComponent::DuplicateSubObjects()
 	// ReleaseSourceVoice()를 호출하면 원본의 SourceVoice를 파괴하게 됩니다.
 	// 따라서 단순히 nullptr로 설정만 하고, BeginPlay에서 새로 생성합니다.
 	SourceVoice = nullptr;
+	PinnedSound = nullptr;
+	StreamId = 0;
 	bIsLoaded = false;
 	bIsCurrentlyPlaying = false;
 	PlaybackStartOffset = 0.0f;
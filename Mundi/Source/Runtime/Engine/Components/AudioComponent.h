@@ -5,6 +5,8 @@
 #include <xaudio2.h>
 #include <x3daudio.h>
 
+struct FWavData;
+
 /**
  * UAudioComponent
  *
@@ -129,6 +131,22 @@ private:
 	 */
 	void ReleaseSourceVoice();
 
+	/**
+	 * 기존 SourceVoice를 파괴하고 같은 포맷으로 새로 만듭니다. (SamplesPlayed 초기화)
+	 */
+	bool ResetSourceVoice(FWavData* WavData);
+
+	/**
+	 * ByteOffset 위치부터 오디오를 SourceVoice에 제출합니다.
+	 * 짧은 사운드는 캐시에 고정한 PCM 데이터를, 긴 트랙은 스트림을 사용합니다.
+	 */
+	bool SubmitAudio(FWavData* WavData, DWORD ByteOffset, bool bShouldLoop);
+
+	/**
+	 * 고정한 사운드 데이터와 스트림을 해제합니다. SourceVoice 파괴 후에만 호출해야 합니다.
+	 */
+	void ReleasePlaybackData();
+
 private:
 	FString ComponentName;			// 컴포넌트 이름 (구분용, 예: "Engine", "Booster", "Collision")
 	FString AudioFilePath;			// 오디오 파일 경로
@@ -142,4 +160,6 @@ private:
 	bool bIsLoaded = false;							// 오디오 파일 로드 여부
 	bool bIsCurrentlyPlaying = false;				// 현재 재생 중인지 여부
 	float PlaybackStartOffset = 0.0f;				// 재생 시작 오프셋 (초)
+	FWavData* PinnedSound = nullptr;				// 재생을 위해 캐시에 고정한 사운드
+	uint32 StreamId = 0;							// 스트리밍 재생 핸들 (0이면 없음)
 };
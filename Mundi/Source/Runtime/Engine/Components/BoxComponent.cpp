@@ -5,6 +5,7 @@
 #include "Collision.h"
 #include "WorldPhysics.h"
 #include "JsonSerializer.h"
+#include "Archive.h"
 
 IMPLEMENT_CLASS(UBoxComponent)
 
@@ -127,6 +128,13 @@ void UBoxComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void UBoxComponent::SerializeCooked(FArchive& Ar)
+{
+	Super::SerializeCooked(Ar);
+
+	Ar << BoxExtent;
+}
+
 void UBoxComponent::DuplicateSubObjects()
 {
 	// BoxExtent와 cached OBB는 POD 타입이므로 자동 복사됨
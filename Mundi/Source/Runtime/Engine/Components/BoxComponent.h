@@ -25,6 +25,7 @@ public:
 	void OnTransformUpdated() override;
 	void UpdateBound() override;
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void SerializeCooked(FArchive& Ar) override;
 
 	// ───── 복사 관련 ─────────────────────────────────────
 	void DuplicateSubObjects() override;
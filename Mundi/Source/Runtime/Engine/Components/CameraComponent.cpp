@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "CameraComponent.h"
 #include "FViewport.h"
+#include "Archive.h"
 
 extern float CLIENTWIDTH;
 extern float CLIENTHEIGHT;
@@ -140,6 +141,15 @@ void UCameraComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
     }
 }
 
+void UCameraComponent::SerializeCooked(FArchive& Ar)
+{
+    Super::SerializeCooked(Ar);
+
+    int32 ModeInt = static_cast<int32>(ProjectionMode);
+    Ar << ModeInt;
+    ProjectionMode = static_cast<ECameraProjectionMode>(ModeInt);
+}
+
 void UCameraComponent::OnSerialized()
 {
     Super::OnSerialized();
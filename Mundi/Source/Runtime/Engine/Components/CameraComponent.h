@@ -49,6 +49,7 @@ public:
     // Serialization
     virtual void OnSerialized() override;
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    virtual void SerializeCooked(FArchive& Ar) override;
 
 
 private:
@@ -5,6 +5,7 @@
 #include "Collision.h"
 #include "WorldPhysics.h"
 #include "JsonSerializer.h"
+#include "Archive.h"
 
 IMPLEMENT_CLASS(UCapsuleComponent)
 
@@ -130,6 +131,13 @@ void UCapsuleComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void UCapsuleComponent::SerializeCooked(FArchive& Ar)
+{
+	Super::SerializeCooked(Ar);
+
+	Ar << CapsuleHalfHeight << CapsuleRadius;
+}
+
 void UCapsuleComponent::DuplicateSubObjects()
 {
 	Super::DuplicateSubObjects();
@@ -25,6 +25,7 @@ public:
 	// ───── Transform 업데이트 ────────────────────────────
 	void OnTransformUpdated() override;
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void SerializeCooked(FArchive& Ar) override;
 	void UpdateBound() override;
 
 	// ───── 복사 관련 ─────────────────────────────────────
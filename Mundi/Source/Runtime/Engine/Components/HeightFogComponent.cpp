@@ -4,6 +4,7 @@
 #include "Color.h"
 #include "ResourceManager.h"
 #include "BillboardComponent.h"
+#include "Archive.h"
 
 IMPLEMENT_CLASS(UHeightFogComponent)
 
@@ -103,6 +104,27 @@ void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 	}
 }
+
+void UHeightFogComponent::SerializeCooked(FArchive& Ar)
+{
+	Super::SerializeCooked(Ar);
+
+	Ar << FogInscatteringColor << FogDensity << FogHeightFalloff << StartDistance << FogCutoffDistance << FogMaxOpacity;
+
+	if (Ar.IsLoading())
+	{
+		FString ShaderPath;
+		Serialization::ReadString(Ar, ShaderPath);
+		if (!ShaderPath.empty())
+		{
+			HeightFogShader = UResourceManager::GetInstance().Load<UShader>(ShaderPath.c_str());
+		}
+	}
+	else
+	{
+		Serialization::WriteString(Ar, HeightFogShader ? HeightFogShader->GetFilePath() : FString());
+	}
+}
 void UHeightFogComponent::OnSerialized()
 {
 	Super::OnSerialized();
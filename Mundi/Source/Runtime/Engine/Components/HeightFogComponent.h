@@ -43,6 +43,7 @@ public:
 	// Serialize
 	void OnSerialized() override;
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void SerializeCooked(FArchive& Ar) override;
 
 
 	// ───── 복사 관련 ────────────────────────────
@@ -2,6 +2,7 @@
 #include "OBB.h"
 #include "PerspectiveDecalComponent.h"
 #include "JsonSerializer.h"
+#include "Archive.h"
 
 IMPLEMENT_CLASS(UPerspectiveDecalComponent)
 
@@ -178,6 +179,18 @@ void UPerspectiveDecalComponent::Serialize(const bool bInIsLoading, JSON& InOutH
 	}
 }
 
+void UPerspectiveDecalComponent::SerializeCooked(FArchive& Ar)
+{
+	Super::SerializeCooked(Ar);
+
+	float FovYTemp = FovY;
+	Ar << FovYTemp;
+	if (Ar.IsLoading())
+	{
+		SetFovY(FovYTemp);
+	}
+}
+
 void UPerspectiveDecalComponent::OnSerialized()
 {
 	Super::OnSerialized();
@@ -5,6 +5,7 @@
 #include "PrimitiveComponent.h"
 #include "WorldPartitionManager.h"
 #include "BillboardComponent.h"
+#include "Archive.h"
 
 IMPLEMENT_CLASS(USceneComponent)
 
@@ -154,13 +155,24 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
 // ──────────────────────────────
 FTransform USceneComponent::GetWorldTransform() const
 {
+    if (!bWorldTransformDirty)
+    {
+        return CachedWorldTransform;
+    }
+
     // Dangling pointer 방지를 위한 체크
     if (AttachParent && !AttachParent->IsPendingDestroy())
     {
-        return AttachParent->GetSocketWorldTransform().GetWorldTransform(RelativeTransform);
+        CachedWorldTransform = AttachParent->GetSocketWorldTransform().GetWorldTransform(RelativeTransform);
+    }
+    else
+    {
+        CachedWorldTransform = RelativeTransform;
     }
 
-    return RelativeTransform;
+    bWorldTransformDirty = false;
+    bWorldMatrixDirty = true;
+    return CachedWorldTransform;
 }
 
 void USceneComponent::SetWorldTransform(const FTransform& W)
@@ -262,13 +274,38 @@ void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat&
     RelativeRotation = R.GetNormalized();
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-     
+    MarkWorldTransformDirty();
+    MarkLevelEdited();
 }
 
 
 FMatrix USceneComponent::GetWorldMatrix() const
 {
-    return GetWorldTransform().ToMatrix();
+    // GetWorldTransform이 재계산되면 bWorldMatrixDirty도 함께 세워짐
+    const FTransform& WorldTransform = GetWorldTransform();
+    if (bWorldMatrixDirty)
+    {
+        CachedWorldMatrix = WorldTransform.ToMatrix();
+        bWorldMatrixDirty = false;
+    }
+    return CachedWorldMatrix;
+}
+
+void USceneComponent::UpdateWorldTransformRecursive()
+{
+    // 부모가 먼저 갱신되므로 자식은 부모 캐시를 그대로 사용 (컴포넌트당 한 번만 계산)
+    if (bWorldTransformDirty || bWorldMatrixDirty)
+    {
+        GetWorldMatrix();
+    }
+
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->UpdateWorldTransformRecursive();
+        }
+    }
 }
 
 FTransform USceneComponent::GetSocketWorldTransform() const
@@ -330,6 +367,8 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, EAttachmentRule
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+    MarkWorldTransformDirty();
+    MarkLevelEdited();
 }
 
 void USceneComponent::DetachFromParent(bool bKeepWorld)
@@ -341,6 +380,8 @@ void USceneComponent::DetachFromParent(bool bKeepWorld)
         auto& Siblings = AttachParent->AttachChildren;
         Siblings.erase(std::remove(Siblings.begin(), Siblings.end(), this), Siblings.end());
         AttachParent = nullptr;
+        MarkWorldTransformDirty();
+        MarkLevelEdited();
     }
 
     //if (bKeepWorld)
@@ -359,6 +400,7 @@ void USceneComponent::DuplicateSubObjects()
     SpriteComponent = nullptr;
 
     AttachChildren.clear();
+    MarkWorldTransformDirty();
 }
 
 // ──────────────────────────────
@@ -369,6 +411,20 @@ void USceneComponent::UpdateRelativeTransform()
     RelativeTransform = FTransform(RelativeLocation, RelativeRotation, RelativeScale);
 }
 
+void USceneComponent::MarkWorldTransformDirty()
+{
+    // 스프링 암처럼 소켓이 자체 캐시를 가진 경우 부모가 깨끗해도 자식만 더티일 수 있으므로 조기 종료 없이 전부 순회
+    bWorldTransformDirty = true;
+    bWorldMatrixDirty = true;
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->MarkWorldTransformDirty();
+        }
+    }
+}
+
 void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
@@ -386,6 +442,7 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
         // 해당 객체의 Transform을 위에서 읽은 값을 기반으로 변경 후, 자식에게 전파
         UpdateRelativeTransform();
+        MarkWorldTransformDirty();
          
 	}
 	else
@@ -403,6 +460,28 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void USceneComponent::SerializeCooked(FArchive& Ar)
+{
+	Super::SerializeCooked(Ar);
+
+	if (Ar.IsSaving())
+	{
+		// JSON 저장과 같이 저장 시점의 UUID 기준 (에디터에서 추가된 컴포넌트는 SceneId가 비어 있음)
+		uint32 CookedId = UUID;
+		uint32 CookedParentId = AttachParent ? AttachParent->UUID : 0;
+		Ar << CookedId << CookedParentId;
+	}
+	else
+	{
+		Ar << SceneId << ParentId;
+		SceneIdMap.Add(SceneId, this);
+
+		RelativeRotation = FQuat::MakeFromEulerZYX(RelativeRotationEuler).GetNormalized();
+		UpdateRelativeTransform();
+		MarkWorldTransformDirty();
+	}
+}
+
 void USceneComponent::OnRegister(UWorld* InWorld)
 {
     if (!std::strcmp(this->GetClass()->Name , USceneComponent::StaticClass()->Name) && !SpriteComponent)
@@ -420,6 +499,13 @@ void USceneComponent::OnSerialized()
 
 void USceneComponent::OnTransformUpdated()
 {
+    // 자식은 아래 순회에서 각자의 OnTransformUpdated를 통해 무효화됨
+    bWorldTransformDirty = true;
+    bWorldMatrixDirty = true;
+
+    // 모든 트랜스폼 세터가 여기를 지나므로 기즈모 / 디테일 패널 / 스크립트 어느 경로의 편집이든 PIE 스냅샷이 무효화된다
+    MarkLevelEdited();
+
     for (USceneComponent* Child : GetAttachChildren())
     {
         Child->OnTransformUpdated();
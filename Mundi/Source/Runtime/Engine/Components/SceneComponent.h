@@ -68,6 +68,9 @@ public:
 
     FMatrix GetWorldMatrix() const; // ToMatrixWithScale
 
+    /** @brief 더티 상태인 월드 트랜스폼을 부모부터 자식 순으로 일괄 재계산 (틱 끝, 렌더링 전에 호출) */
+    void UpdateWorldTransformRecursive();
+
     // ──────────────────────────────
     // Socket World Transform API
     // ──────────────────────────────
@@ -101,6 +104,7 @@ public:
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void SerializeCooked(FArchive& Ar) override;
     void OnRegister(UWorld* InWorld) override;
     void Destroy() override;
     void OnSerialized() override;
@@ -162,6 +166,18 @@ protected:
     FTransform RelativeTransform;
 
     void UpdateRelativeTransform();
+
+    /**
+     * @brief 자신과 모든 자손의 월드 트랜스폼 캐시를 무효화.
+     * @note OnTransformUpdated를 거치지 않고 부모 관계나 소켓이 바뀌는 경로(Attach/Detach, 역직렬화, 스프링 암 소켓 이동 등)에서 사용
+     */
+    void MarkWorldTransformDirty();
+
+    // 월드 트랜스폼 캐시. GetWorldTransform/GetWorldMatrix에서 지연 계산
+    mutable FTransform CachedWorldTransform;
+    mutable FMatrix CachedWorldMatrix;
+    mutable bool bWorldTransformDirty = true;
+    mutable bool bWorldMatrixDirty = true;
     
     uint32 SceneId; // Scene파일에서 불러온 Id. 컴포넌트끼리 자식부모관계 연결하기 위해 저장. Scene에 저장할 때는 UUID를 저장
     uint32 ParentId;
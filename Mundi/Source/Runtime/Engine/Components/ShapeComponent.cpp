@@ -3,6 +3,7 @@
 #include "World.h"
 #include "WorldPhysics.h"
 #include "JsonSerializer.h"
+#include "Archive.h"
 
 IMPLEMENT_CLASS(UShapeComponent)
 
@@ -70,6 +71,13 @@ void UShapeComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void UShapeComponent::SerializeCooked(FArchive& Ar)
+{
+	Super::SerializeCooked(Ar);
+
+	Ar << ShapeColor << bDrawOnlyIfSelected;
+}
+
 void UShapeComponent::OnSerialized()
 {
     Super::OnSerialized();
@@ -33,6 +33,7 @@ public:
     virtual FAABB GetWorldAABB() { return FAABB(); } // World Partition System에서 사용하기 위한 AABB
 	virtual EShapeType GetShapeType() const { return EShapeType::None; }
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void SerializeCooked(FArchive& Ar) override;
 
 	virtual void UpdateBound() {};
 	
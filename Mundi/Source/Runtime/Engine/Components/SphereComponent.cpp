@@ -5,6 +5,7 @@
 #include "Collision.h"
 #include "WorldPhysics.h"
 #include "JsonSerializer.h"
+#include "Archive.h"
 
 IMPLEMENT_CLASS(USphereComponent)
 
@@ -101,6 +102,13 @@ void USphereComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void USphereComponent::SerializeCooked(FArchive& Ar)
+{
+	Super::SerializeCooked(Ar);
+
+	Ar << Radius;
+}
+
 void USphereComponent::DuplicateSubObjects()
 {
     // Radius와 cached sphere는 POD 타입이므로 자동 복사됨
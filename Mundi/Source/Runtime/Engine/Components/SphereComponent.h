@@ -24,6 +24,7 @@ public:
 	// ───── Update ───────────────────────────────────────
 	void OnTransformUpdated() override;
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void SerializeCooked(FArchive& Ar) override;
 	void UpdateBound() override;
 
 	// ───── 복사 관련 ─────────────────────────────────────
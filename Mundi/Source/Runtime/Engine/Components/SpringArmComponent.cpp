@@ -165,8 +165,20 @@ void USpringArmComponent::EvaluateArm(float DeltaTime)
 		FinalSocketPos = SmoothedSocketPosWS;
 	}
 
-	CachedSocketWorld = FTransform(FinalSocketPos, WorldRotation, WorldTransform.Scale3D);
+	const FTransform NewSocketWorld(FinalSocketPos, WorldRotation, WorldTransform.Scale3D);
+	const bool bSocketMoved = !bSocketValid
+		|| NewSocketWorld.Translation != CachedSocketWorld.Translation
+		|| NewSocketWorld.Rotation != CachedSocketWorld.Rotation
+		|| NewSocketWorld.Scale3D != CachedSocketWorld.Scale3D;
+
+	CachedSocketWorld = NewSocketWorld;
 	bSocketValid = true;
+
+	// 소켓은 OnTransformUpdated 없이 움직이므로 자식의 월드 트랜스폼 캐시를 직접 무효화
+	if (bSocketMoved)
+	{
+		MarkWorldTransformDirty();
+	}
 }
 
 void USpringArmComponent::DuplicateSubObjects()
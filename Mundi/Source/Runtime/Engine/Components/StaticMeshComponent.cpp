@@ -12,6 +12,7 @@
 #include "CameraComponent.h"
 #include "MeshBatchElement.h"
 #include "Material.h"
+#include "Archive.h"
 
 IMPLEMENT_CLASS(UStaticMeshComponent)
 
@@ -505,6 +506,85 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void UStaticMeshComponent::SerializeCooked(FArchive& Ar)
+{
+	Super::SerializeCooked(Ar);
+
+	// 슬롯마다 종류(ECookedMaterialSlot)와 문자열 하나: UMaterial은 에셋 경로, UMID는 Serialize(JSON) 결과
+	enum ECookedMaterialSlot : uint8 { None, Asset, Dynamic };
+
+	if (Ar.IsLoading())
+	{
+		ClearDynamicMaterials();
+
+		uint32 SlotCount = 0;
+		Ar << SlotCount;
+		if (SlotCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Cooked scene corrupt: Material slot count is unreasonable.");
+		}
+
+		MaterialSlots.resize(SlotCount);
+		for (uint32 i = 0; i < SlotCount; ++i)
+		{
+			uint8 SlotType = None;
+			Ar << SlotType;
+
+			FString Payload;
+			if (SlotType != None)
+			{
+				Serialization::ReadString(Ar, Payload);
+			}
+
+			UMaterialInterface* LoadedMaterial = nullptr;
+			if (SlotType == Dynamic)
+			{
+				UMaterialInstanceDynamic* NewMID = new UMaterialInstanceDynamic();
+				JSON SlotJson = JSON::Load(Payload);
+				NewMID->Serialize(true, SlotJson);
+				DynamicMaterialInstances.Add(NewMID);
+				LoadedMaterial = NewMID;
+			}
+			else if (SlotType == Asset && !Payload.empty())
+			{
+				LoadedMaterial = UResourceManager::GetInstance().Load<UMaterial>(Payload);
+			}
+			MaterialSlots[i] = LoadedMaterial;
+		}
+	}
+	else
+	{
+		uint32 SlotCount = static_cast<uint32>(MaterialSlots.size());
+		Ar << SlotCount;
+		for (UMaterialInterface* Mtl : MaterialSlots)
+		{
+			uint8 SlotType = None;
+			FString Payload;
+			if (Mtl)
+			{
+				JSON SlotJson = JSON::Make(JSON::Class::Object);
+				Mtl->Serialize(false, SlotJson);
+				if (Mtl->GetClass() == UMaterialInstanceDynamic::StaticClass())
+				{
+					SlotType = Dynamic;
+					Payload = SlotJson.dump();
+				}
+				else
+				{
+					SlotType = Asset;
+					FJsonSerializer::ReadString(SlotJson, "AssetPath", Payload, "", false);
+				}
+			}
+
+			Ar << SlotType;
+			if (SlotType != None)
+			{
+				Serialization::WriteString(Ar, Payload);
+			}
+		}
+	}
+}
+
 // 직렬화 완료 직후 호출됨
 void UStaticMeshComponent::OnSerialized()
 {
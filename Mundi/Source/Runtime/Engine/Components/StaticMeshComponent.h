@@ -28,6 +28,7 @@ public:
 	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void SerializeCooked(FArchive& Ar) override;
 	void OnSerialized() override;
 
 	void SetStaticMesh(const FString& PathFileName);
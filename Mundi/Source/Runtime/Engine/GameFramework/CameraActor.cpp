@@ -6,6 +6,7 @@
 #include "InputManager.h"
 #include "Vector.h"
 #include "USlateManager.h"
+#include "Archive.h"
 
 // 예전 World에서 사용하던 전역 변수들 (임시)
 static float MouseSensitivity = 0.05f;  // 적당한 값으로 조정
@@ -205,6 +206,25 @@ void ACameraActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
     }
 }
 
+void ACameraActor::SerializeCooked(FArchive& Ar)
+{
+    Super::SerializeCooked(Ar);
+
+    Ar << MouseSensitivity << CameraMoveSpeed << CameraYawDeg << CameraPitchDeg << PerspectiveCameraInput;
+
+    if (Ar.IsLoading())
+    {
+        for (UActorComponent* Component : OwnedComponents)
+        {
+            if (UCameraComponent* CameraComp = Cast<UCameraComponent>(Component))
+            {
+                CameraComponent = CameraComp;
+                break;
+            }
+        }
+    }
+}
+
 void ACameraActor::OnSerialized()
 {
     Super::OnSerialized();
@@ -60,6 +60,7 @@ public:
     // ───── 직렬화 관련 ────────────────────────────
     void OnSerialized() override;
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void SerializeCooked(FArchive& Ar) override;
 
     // ───── 복사 관련 ────────────────────────────
     void DuplicateSubObjects() override;
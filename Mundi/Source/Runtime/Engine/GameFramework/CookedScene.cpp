@@ -0,0 +1,1042 @@
+﻿#include "pch.h"
+#include "CookedScene.h"
+#include "Level.h"
+#include "Actor.h"
+#include "ActorComponent.h"
+#include "SceneComponent.h"
+#include "StaticMesh.h"
+#include "Archive.h"
+#include "WindowsBinWriter.h"
+
+#include <cstring>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	// 본문을 메모리에 먼저 만든 뒤 파일에 한 번에 쓰기 위한 아카이브
+	class FCookedBufferWriter : public FArchive
+	{
+	public:
+		FCookedBufferWriter() : FArchive(false, true) {}
+
+		void Serialize(void* Data, int64 Length) override
+		{
+			const uint8* Bytes = static_cast<const uint8*>(Data);
+			Buffer.insert(Buffer.end(), Bytes, Bytes + Length);
+		}
+		bool Close() override { return true; }
+
+		TArray<uint8> Buffer;
+	};
+
+	// 파일 전체를 읽어 둔 버퍼에서 읽는 아카이브. 범위를 벗어나면 Serialization 헬퍼처럼 예외를 던진다
+	class FCookedBufferReader : public FArchive
+	{
+	public:
+		FCookedBufferReader(const uint8* InData, size_t InSize)
+			: FArchive(true, false), Data(InData), Size(InSize)
+		{
+		}
+
+		void Serialize(void* OutData, int64 Length) override
+		{
+			if (Length < 0 || static_cast<size_t>(Length) > Size - Offset)
+			{
+				throw std::runtime_error("Cooked scene corrupt: Unexpected end of file.");
+			}
+			std::memcpy(OutData, Data + Offset, static_cast<size_t>(Length));
+			Offset += static_cast<size_t>(Length);
+		}
+		bool Close() override { return true; }
+
+		size_t GetRemaining() const { return Size - Offset; }
+
+	private:
+		const uint8* Data = nullptr;
+		size_t Size = 0;
+		size_t Offset = 0;
+	};
+
+	class FCookedStringTable
+	{
+	public:
+		uint32 Add(const FString& InString)
+		{
+			if (const uint32* Found = Indices.Find(InString))
+			{
+				return *Found;
+			}
+			const uint32 Index = static_cast<uint32>(Strings.Num());
+			Strings.Add(InString);
+			Indices.Add(InString, Index);
+			return Index;
+		}
+
+		void Write(FArchive& Ar) const
+		{
+			uint32 Count = static_cast<uint32>(Strings.Num());
+			Ar << Count;
+			for (const FString& String : Strings)
+			{
+				Serialization::WriteString(Ar, String);
+			}
+		}
+
+	private:
+		TArray<FString> Strings;
+		TMap<FString, uint32> Indices;
+	};
+
+	struct FCookedAttachment
+	{
+		uint32 Child;
+		uint32 Parent;
+	};
+
+	// 로드 중 공유 상태: 문자열 테이블과 같은 경로의 리소스 조회 결과 캐시
+	struct FCookedLoadContext
+	{
+		TArray<FString> Strings;
+		TMap<uint64, UObject*> ResourceCache;
+
+		const FString& GetString(uint32 InIndex) const
+		{
+			if (InIndex >= static_cast<uint32>(Strings.Num()))
+			{
+				throw std::runtime_error("Cooked scene corrupt: String index out of range.");
+			}
+			return Strings[InIndex];
+		}
+
+		template<typename T>
+		T* LoadResource(uint32 InIndex)
+		{
+			const FString& Path = GetString(InIndex);
+			if (Path.empty())
+			{
+				return nullptr;
+			}
+
+			const uint64 Key = (static_cast<uint64>(T::StaticClass()->ClassIndex) << 32) | InIndex;
+			if (UObject** Found = ResourceCache.Find(Key))
+			{
+				return static_cast<T*>(*Found);
+			}
+			T* Resource = UResourceManager::GetInstance().Load<T>(Path);
+			ResourceCache.Add(Key, Resource);
+			return Resource;
+		}
+	};
+
+	void WriteSchema(FArchive& Ar, const TArray<FProperty>& InProperties, FCookedStringTable& InOutStrings)
+	{
+		uint32 Count = static_cast<uint32>(InProperties.Num());
+		Ar << Count;
+		for (const FProperty& Prop : InProperties)
+		{
+			uint32 NameIndex = InOutStrings.Add(Prop.Name);
+			uint8 Type = static_cast<uint8>(Prop.Type);
+			uint8 InnerType = static_cast<uint8>(Prop.InnerType);
+			Ar << NameIndex << Type << InnerType;
+		}
+	}
+
+	// 쿠킹 시점의 스키마가 현재 클래스의 프로퍼티 테이블과 같은지 (다르면 레코드를 해석할 수 없음)
+	bool ReadAndMatchSchema(FArchive& Ar, const TArray<FProperty>& InProperties, const FCookedLoadContext& InContext)
+	{
+		uint32 Count = 0;
+		Ar << Count;
+
+		bool bMatched = Count == static_cast<uint32>(InProperties.Num());
+		for (uint32 i = 0; i < Count; ++i)
+		{
+			uint32 NameIndex = 0;
+			uint8 Type = 0;
+			uint8 InnerType = 0;
+			Ar << NameIndex << Type << InnerType;
+
+			bMatched = bMatched
+				&& static_cast<EPropertyType>(Type) == InProperties[i].Type
+				&& static_cast<EPropertyType>(InnerType) == InProperties[i].InnerType
+				&& InContext.GetString(NameIndex) == InProperties[i].Name;
+		}
+		return bMatched;
+	}
+
+	template<typename T>
+	void WriteArrayProperty(FArchive& Ar, const TArray<T>& InArray)
+	{
+		uint32 Count = static_cast<uint32>(InArray.Num());
+		Ar << Count;
+		for (T Value : InArray)
+		{
+			Ar << Value;
+		}
+	}
+
+	template<typename T>
+	void ReadArrayProperty(FArchive& Ar, TArray<T>& OutArray)
+	{
+		uint32 Count = 0;
+		Ar << Count;
+		if (Count > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Cooked scene corrupt: Array property size is unreasonable.");
+		}
+		OutArray.SetNum(static_cast<int32>(Count));
+		for (uint32 i = 0; i < Count; ++i)
+		{
+			T Value{};
+			Ar << Value;
+			OutArray[i] = Value;
+		}
+	}
+
+	// UObject::Serialize(JSON)가 다루는 리플렉션 프로퍼티를 키 없이 스키마 순서로 기록
+	void WriteProperties(FArchive& Ar, UObject* InObject, const TArray<FProperty>& InProperties, FCookedStringTable& InOutStrings)
+	{
+		for (const FProperty& Prop : InProperties)
+		{
+			switch (Prop.Type)
+			{
+			case EPropertyType::Bool:
+			{
+				uint8 Value = *Prop.GetValuePtr<bool>(InObject) ? 1 : 0;
+				Ar << Value;
+				break;
+			}
+			case EPropertyType::Int32:
+				Ar << *Prop.GetValuePtr<int32>(InObject);
+				break;
+			case EPropertyType::Float:
+				Ar << *Prop.GetValuePtr<float>(InObject);
+				break;
+			case EPropertyType::FVector:
+			{
+				FVector* Value = Prop.GetValuePtr<FVector>(InObject);
+				Ar << Value->X << Value->Y << Value->Z;
+				break;
+			}
+			case EPropertyType::FLinearColor:
+			{
+				FLinearColor* Value = Prop.GetValuePtr<FLinearColor>(InObject);
+				Ar << Value->R << Value->G << Value->B << Value->A;
+				break;
+			}
+			case EPropertyType::FString:
+			case EPropertyType::Audio:
+			{
+				uint32 Index = InOutStrings.Add(*Prop.GetValuePtr<FString>(InObject));
+				Ar << Index;
+				break;
+			}
+			case EPropertyType::FName:
+			{
+				uint32 Index = InOutStrings.Add(Prop.GetValuePtr<FName>(InObject)->ToString());
+				Ar << Index;
+				break;
+			}
+			case EPropertyType::Texture:
+			{
+				UTexture* Value = *Prop.GetValuePtr<UTexture*>(InObject);
+				uint32 Index = InOutStrings.Add(Value ? Value->GetFilePath() : FString());
+				Ar << Index;
+				break;
+			}
+			case EPropertyType::StaticMesh:
+			{
+				UStaticMesh* Value = *Prop.GetValuePtr<UStaticMesh*>(InObject);
+				uint32 Index = InOutStrings.Add(Value ? Value->GetAssetPathFileName() : FString());
+				Ar << Index;
+				break;
+			}
+			case EPropertyType::Material:
+			{
+				UMaterial* Value = *Prop.GetValuePtr<UMaterial*>(InObject);
+				uint32 Index = InOutStrings.Add(Value ? Value->GetFilePath() : FString());
+				Ar << Index;
+				break;
+			}
+			case EPropertyType::Array:
+			{
+				switch (Prop.InnerType)
+				{
+				case EPropertyType::Int32:
+					WriteArrayProperty(Ar, *Prop.GetValuePtr<TArray<int32>>(InObject));
+					break;
+				case EPropertyType::Float:
+					WriteArrayProperty(Ar, *Prop.GetValuePtr<TArray<float>>(InObject));
+					break;
+				case EPropertyType::Bool:
+				{
+					const TArray<bool>& Values = *Prop.GetValuePtr<TArray<bool>>(InObject);
+					TArray<uint8> Bytes;
+					Bytes.Reserve(Values.Num());
+					for (bool bValue : Values)
+					{
+						Bytes.Add(bValue ? 1 : 0);
+					}
+					WriteArrayProperty(Ar, Bytes);
+					break;
+				}
+				case EPropertyType::FString:
+				{
+					TArray<uint32> Indices;
+					for (const FString& Value : *Prop.GetValuePtr<TArray<FString>>(InObject))
+					{
+						Indices.Add(InOutStrings.Add(Value));
+					}
+					WriteArrayProperty(Ar, Indices);
+					break;
+				}
+				default:
+					// JSON 경로도 지원하지 않는 InnerType (SerializeCooked에서 필요하면 직접 처리)
+					break;
+				}
+				break;
+			}
+			default:
+				// ObjectPtr, Struct 등은 JSON 경로와 마찬가지로 기록하지 않음
+				break;
+			}
+		}
+	}
+
+	void ReadProperties(FArchive& Ar, UObject* InObject, const TArray<FProperty>& InProperties, FCookedLoadContext& InContext)
+	{
+		for (const FProperty& Prop : InProperties)
+		{
+			switch (Prop.Type)
+			{
+			case EPropertyType::Bool:
+			{
+				uint8 Value = 0;
+				Ar << Value;
+				*Prop.GetValuePtr<bool>(InObject) = Value != 0;
+				break;
+			}
+			case EPropertyType::Int32:
+				Ar << *Prop.GetValuePtr<int32>(InObject);
+				break;
+			case EPropertyType::Float:
+				Ar << *Prop.GetValuePtr<float>(InObject);
+				break;
+			case EPropertyType::FVector:
+			{
+				FVector* Value = Prop.GetValuePtr<FVector>(InObject);
+				Ar << Value->X << Value->Y << Value->Z;
+				break;
+			}
+			case EPropertyType::FLinearColor:
+			{
+				FLinearColor* Value = Prop.GetValuePtr<FLinearColor>(InObject);
+				Ar << Value->R << Value->G << Value->B << Value->A;
+				break;
+			}
+			case EPropertyType::FString:
+			case EPropertyType::Audio:
+			{
+				uint32 Index = 0;
+				Ar << Index;
+				*Prop.GetValuePtr<FString>(InObject) = InContext.GetString(Index);
+				break;
+			}
+			case EPropertyType::FName:
+			{
+				uint32 Index = 0;
+				Ar << Index;
+				*Prop.GetValuePtr<FName>(InObject) = FName(InContext.GetString(Index));
+				break;
+			}
+			case EPropertyType::Texture:
+			{
+				uint32 Index = 0;
+				Ar << Index;
+				*Prop.GetValuePtr<UTexture*>(InObject) = InContext.LoadResource<UTexture>(Index);
+				break;
+			}
+			case EPropertyType::StaticMesh:
+			{
+				uint32 Index = 0;
+				Ar << Index;
+				*Prop.GetValuePtr<UStaticMesh*>(InObject) = InContext.LoadResource<UStaticMesh>(Index);
+				break;
+			}
+			case EPropertyType::Material:
+			{
+				uint32 Index = 0;
+				Ar << Index;
+				*Prop.GetValuePtr<UMaterial*>(InObject) = InContext.LoadResource<UMaterial>(Index);
+				break;
+			}
+			case EPropertyType::Array:
+			{
+				switch (Prop.InnerType)
+				{
+				case EPropertyType::Int32:
+					ReadArrayProperty(Ar, *Prop.GetValuePtr<TArray<int32>>(InObject));
+					break;
+				case EPropertyType::Float:
+					ReadArrayProperty(Ar, *Prop.GetValuePtr<TArray<float>>(InObject));
+					break;
+				case EPropertyType::Bool:
+				{
+					TArray<uint8> Bytes;
+					ReadArrayProperty(Ar, Bytes);
+					TArray<bool>& Values = *Prop.GetValuePtr<TArray<bool>>(InObject);
+					Values.SetNum(Bytes.Num());
+					for (int32 i = 0; i < Bytes.Num(); ++i)
+					{
+						Values[i] = Bytes[i] != 0;
+					}
+					break;
+				}
+				case EPropertyType::FString:
+				{
+					TArray<uint32> Indices;
+					ReadArrayProperty(Ar, Indices);
+					TArray<FString>& Values = *Prop.GetValuePtr<TArray<FString>>(InObject);
+					Values.SetNum(Indices.Num());
+					for (int32 i = 0; i < Indices.Num(); ++i)
+					{
+						Values[i] = InContext.GetString(Indices[i]);
+					}
+					break;
+				}
+				default:
+					break;
+				}
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+
+	// 인스턴스 목록을 등장 순서대로 클래스별로 묶는다
+	template<typename T>
+	void GroupByClass(const TArray<T*>& InObjects, TArray<UClass*>& OutClasses, TArray<TArray<uint32>>& OutIndicesPerClass)
+	{
+		TMap<UClass*, int32> ClassSlots;
+		for (int32 Index = 0; Index < InObjects.Num(); ++Index)
+		{
+			UClass* Class = InObjects[Index]->GetClass();
+			int32 Slot;
+			if (const int32* Found = ClassSlots.Find(Class))
+			{
+				Slot = *Found;
+			}
+			else
+			{
+				Slot = OutClasses.Add(Class);
+				OutIndicesPerClass.Emplace();
+				ClassSlots.Add(Class, Slot);
+			}
+			OutIndicesPerClass[Slot].Add(static_cast<uint32>(Index));
+		}
+	}
+
+	// 클래스 테이블 항목 (로드 측)
+	struct FCookedClassEntry
+	{
+		UClass* Class = nullptr;
+		TArray<uint32> Indices;
+	};
+
+	FCookedClassEntry ReadClassEntry(FArchive& Ar, const FCookedLoadContext& InContext, const UClass* InRequiredBase, uint32 InObjectCount, TArray<uint8>& InOutSeen)
+	{
+		uint32 ClassNameIndex = 0;
+		Ar << ClassNameIndex;
+
+		FCookedClassEntry Entry;
+		const FString& ClassName = InContext.GetString(ClassNameIndex);
+		Entry.Class = UClass::FindClass(FName(ClassName));
+		if (!Entry.Class || !Entry.Class->IsChildOf(InRequiredBase))
+		{
+			throw std::runtime_error("Cooked scene references unknown class: " + ClassName);
+		}
+
+		Serialization::ReadArray(Ar, Entry.Indices);
+		for (uint32 Index : Entry.Indices)
+		{
+			if (Index >= InObjectCount || InOutSeen[Index])
+			{
+				throw std::runtime_error("Cooked scene corrupt: Invalid class table.");
+			}
+			InOutSeen[Index] = 1;
+		}
+		return Entry;
+	}
+
+	// 레벨 → 페이로드(문자열 테이블 + 본문). 파일 쿠킹과 PIE 스냅샷이 함께 쓴다
+	void WriteLevelPayload(const ULevel& InLevel, bool bIncludeCamera, TArray<uint8>& OutPayload)
+	{
+		FCookedStringTable Strings;
+		FCookedBufferWriter Body;
+
+		// 에디터 카메라
+		uint8 bHasCamera = (bIncludeCamera && InLevel.HasPerspectiveCamera()) ? 1 : 0;
+		Body << bHasCamera;
+		if (bHasCamera)
+		{
+			FPerspectiveCameraData Camera = InLevel.GetPerspectiveCamera();
+			Body << Camera.Location.X << Camera.Location.Y << Camera.Location.Z
+				<< Camera.Rotation.X << Camera.Rotation.Y << Camera.Rotation.Z
+				<< Camera.FOV << Camera.NearClip << Camera.FarClip;
+		}
+
+		// 액터와 컴포넌트에 전역 인덱스 부여 (액터 순서 → OwnedComponents 순서)
+		TArray<AActor*> Actors;
+		TArray<UActorComponent*> Components;
+		TArray<uint32> ComponentOwners;
+		TMap<UActorComponent*, uint32> ComponentIndices;
+		Actors.Reserve(InLevel.GetActors().Num());
+		for (AActor* Actor : InLevel.GetActors())
+		{
+			if (!Actor)
+			{
+				continue;
+			}
+			const uint32 ActorIndex = static_cast<uint32>(Actors.Add(Actor));
+			for (UActorComponent* Component : Actor->GetOwnedComponents())
+			{
+				// JSON 저장과 마찬가지로 에디터 전용 컴포넌트는 제외
+				if (!Component || !Component->IsEditable())
+				{
+					continue;
+				}
+				ComponentIndices.Add(Component, static_cast<uint32>(Components.Num()));
+				Components.Add(Component);
+				ComponentOwners.Add(ActorIndex);
+			}
+		}
+
+		// 부착 순서: 부모 없는 컴포넌트부터 AttachChildren 순서대로 내려가며 (자식, 부모) 기록
+		TArray<FCookedAttachment> Attachments;
+		TArray<USceneComponent*> Stack;
+		for (UActorComponent* Component : Components)
+		{
+			USceneComponent* SceneComponent = Cast<USceneComponent>(Component);
+			if (!SceneComponent || SceneComponent->GetAttachParent())
+			{
+				continue;
+			}
+			Stack.Add(SceneComponent);
+			while (!Stack.IsEmpty())
+			{
+				USceneComponent* Parent = Stack.back();
+				Stack.pop_back();
+				const uint32* ParentIndex = ComponentIndices.Find(Parent);
+				const TArray<USceneComponent*>& Children = Parent->GetAttachChildren();
+				for (USceneComponent* Child : Children)
+				{
+					const uint32* ChildIndex = ComponentIndices.Find(Child);
+					if (ParentIndex && ChildIndex)
+					{
+						Attachments.Add({ *ChildIndex, *ParentIndex });
+					}
+				}
+				// 자식의 자식은 부모-자식 연결이 끝난 뒤 (순서는 AttachChildren 역순으로 쌓아 원래 순서대로 처리)
+				for (int32 i = Children.Num() - 1; i >= 0; --i)
+				{
+					Stack.Add(Children[i]);
+				}
+			}
+		}
+
+		// 액터 클래스 테이블: 이름과 루트 컴포넌트도 함께
+		TArray<UClass*> ActorClasses;
+		TArray<TArray<uint32>> ActorsPerClass;
+		GroupByClass(Actors, ActorClasses, ActorsPerClass);
+
+		uint32 ActorCount = static_cast<uint32>(Actors.Num());
+		uint32 ActorClassCount = static_cast<uint32>(ActorClasses.Num());
+		Body << ActorCount << ActorClassCount;
+		for (int32 ClassSlot = 0; ClassSlot < ActorClasses.Num(); ++ClassSlot)
+		{
+			uint32 ClassNameIndex = Strings.Add(ActorClasses[ClassSlot]->Name);
+			Body << ClassNameIndex;
+			Serialization::WriteArray(Body, ActorsPerClass[ClassSlot]);
+			for (uint32 ActorIndex : ActorsPerClass[ClassSlot])
+			{
+				AActor* Actor = Actors[ActorIndex];
+				uint32 NameIndex = Strings.Add(Actor->GetName().ToString());
+				const uint32* RootIndex = Actor->GetRootComponent() ? ComponentIndices.Find(Actor->GetRootComponent()) : nullptr;
+				int32 RootComponent = RootIndex ? static_cast<int32>(*RootIndex) : -1;
+				Body << NameIndex << RootComponent;
+			}
+		}
+
+		// 컴포넌트 클래스 테이블: 소유 액터와 Native 여부
+		TArray<UClass*> ComponentClasses;
+		TArray<TArray<uint32>> ComponentsPerClass;
+		GroupByClass(Components, ComponentClasses, ComponentsPerClass);
+
+		uint32 ComponentCount = static_cast<uint32>(Components.Num());
+		uint32 ComponentClassCount = static_cast<uint32>(ComponentClasses.Num());
+		Body << ComponentCount << ComponentClassCount;
+		for (int32 ClassSlot = 0; ClassSlot < ComponentClasses.Num(); ++ClassSlot)
+		{
+			uint32 ClassNameIndex = Strings.Add(ComponentClasses[ClassSlot]->Name);
+			Body << ClassNameIndex;
+			Serialization::WriteArray(Body, ComponentsPerClass[ClassSlot]);
+
+			TArray<uint32> Owners;
+			TArray<uint8> NativeFlags;
+			for (uint32 ComponentIndex : ComponentsPerClass[ClassSlot])
+			{
+				Owners.Add(ComponentOwners[ComponentIndex]);
+				NativeFlags.Add(Components[ComponentIndex]->IsNative() ? 1 : 0);
+			}
+			Serialization::WriteArray(Body, Owners);
+			Serialization::WriteArray(Body, NativeFlags);
+		}
+
+		// 액터 프로퍼티 (JSON 경로처럼 컴포넌트보다 먼저 적용)
+		for (int32 ClassSlot = 0; ClassSlot < ActorClasses.Num(); ++ClassSlot)
+		{
+			const TArray<FProperty>& Properties = ActorClasses[ClassSlot]->GetAllProperties();
+			WriteSchema(Body, Properties, Strings);
+			for (uint32 ActorIndex : ActorsPerClass[ClassSlot])
+			{
+				WriteProperties(Body, Actors[ActorIndex], Properties, Strings);
+			}
+		}
+
+		// 컴포넌트 레코드
+		for (int32 ClassSlot = 0; ClassSlot < ComponentClasses.Num(); ++ClassSlot)
+		{
+			const TArray<FProperty>& Properties = ComponentClasses[ClassSlot]->GetAllProperties();
+			WriteSchema(Body, Properties, Strings);
+			for (uint32 ComponentIndex : ComponentsPerClass[ClassSlot])
+			{
+				WriteProperties(Body, Components[ComponentIndex], Properties, Strings);
+				Components[ComponentIndex]->SerializeCooked(Body);
+			}
+		}
+
+		Serialization::WriteArray(Body, Attachments);
+
+		// 액터 고유 값 (컴포넌트가 모두 붙은 뒤 적용)
+		for (int32 ClassSlot = 0; ClassSlot < ActorClasses.Num(); ++ClassSlot)
+		{
+			for (uint32 ActorIndex : ActorsPerClass[ClassSlot])
+			{
+				Actors[ActorIndex]->SerializeCooked(Body);
+			}
+		}
+
+		FCookedBufferWriter StringTable;
+		Strings.Write(StringTable);
+
+		OutPayload = std::move(StringTable.Buffer);
+		OutPayload.insert(OutPayload.end(), Body.Buffer.begin(), Body.Buffer.end());
+	}
+
+	// 페이로드 → OutLevel. 실패하면 만든 객체를 모두 지우고 false
+	bool ReadLevelPayload(const uint8* InData, size_t InSize, const FString& InSourceName, ULevel& OutLevel)
+	{
+		TArray<AActor*> Actors;
+		TArray<UActorComponent*> UnownedComponents;
+
+		try
+		{
+			FCookedBufferReader Ar(InData, InSize);
+
+			FCookedLoadContext Context;
+			uint32 StringCount = 0;
+			Ar << StringCount;
+			if (StringCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+			{
+				throw std::runtime_error("Cooked scene corrupt: String table size is unreasonable.");
+			}
+			Context.Strings.SetNum(static_cast<int32>(StringCount));
+			for (FString& String : Context.Strings)
+			{
+				Serialization::ReadString(Ar, String);
+			}
+
+			uint8 bHasCamera = 0;
+			FPerspectiveCameraData Camera;
+			Ar << bHasCamera;
+			if (bHasCamera)
+			{
+				Ar << Camera.Location.X << Camera.Location.Y << Camera.Location.Z
+					<< Camera.Rotation.X << Camera.Rotation.Y << Camera.Rotation.Z
+					<< Camera.FOV << Camera.NearClip << Camera.FarClip;
+			}
+
+			// 액터 클래스 테이블 → 클래스마다 한 번에 생성
+			uint32 ActorCount = 0;
+			uint32 ActorClassCount = 0;
+			Ar << ActorCount << ActorClassCount;
+			if (ActorCount > Serialization::MAX_REASONABLE_ARRAY_SIZE || ActorClassCount > ActorCount)
+			{
+				throw std::runtime_error("Cooked scene corrupt: Actor count is unreasonable.");
+			}
+
+			TArray<uint8> SeenActors;
+			SeenActors.SetNum(static_cast<int32>(ActorCount));
+			TArray<FCookedClassEntry> ActorClasses;
+			TArray<int32> RootComponents;
+			Actors.SetNum(static_cast<int32>(ActorCount));
+			RootComponents.SetNum(static_cast<int32>(ActorCount));
+			for (uint32 ClassSlot = 0; ClassSlot < ActorClassCount; ++ClassSlot)
+			{
+				FCookedClassEntry& Entry = ActorClasses[ActorClasses.Add(ReadClassEntry(Ar, Context, AActor::StaticClass(), ActorCount, SeenActors))];
+				for (uint32 ActorIndex : Entry.Indices)
+				{
+					uint32 NameIndex = 0;
+					Ar << NameIndex << RootComponents[ActorIndex];
+
+					AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(Entry.Class));
+					if (!NewActor)
+					{
+						throw std::runtime_error("ObjectFactory could not create an actor instance.");
+					}
+					NewActor->SetName(Context.GetString(NameIndex));
+					Actors[ActorIndex] = NewActor;
+				}
+			}
+			for (uint8 bSeen : SeenActors)
+			{
+				if (!bSeen)
+				{
+					throw std::runtime_error("Cooked scene corrupt: Actor missing from class table.");
+				}
+			}
+
+			// 컴포넌트 클래스 테이블 → Native는 생성자에서 만든 것을 찾고 나머지는 클래스마다 한 번에 생성
+			uint32 ComponentCount = 0;
+			uint32 ComponentClassCount = 0;
+			Ar << ComponentCount << ComponentClassCount;
+			if (ComponentCount > Serialization::MAX_REASONABLE_ARRAY_SIZE || ComponentClassCount > ComponentCount)
+			{
+				throw std::runtime_error("Cooked scene corrupt: Component count is unreasonable.");
+			}
+
+			TArray<uint8> SeenComponents;
+			SeenComponents.SetNum(static_cast<int32>(ComponentCount));
+			TArray<FCookedClassEntry> ComponentClasses;
+			TArray<UActorComponent*> Components;
+			TArray<uint32> ComponentOwners;
+			TArray<uint8> ComponentNative;
+			Components.SetNum(static_cast<int32>(ComponentCount));
+			ComponentOwners.SetNum(static_cast<int32>(ComponentCount));
+			ComponentNative.SetNum(static_cast<int32>(ComponentCount));
+			for (uint32 ClassSlot = 0; ClassSlot < ComponentClassCount; ++ClassSlot)
+			{
+				FCookedClassEntry& Entry = ComponentClasses[ComponentClasses.Add(ReadClassEntry(Ar, Context, UActorComponent::StaticClass(), ComponentCount, SeenComponents))];
+
+				TArray<uint32> Owners;
+				TArray<uint8> NativeFlags;
+				Serialization::ReadArray(Ar, Owners);
+				Serialization::ReadArray(Ar, NativeFlags);
+				if (Owners.Num() != Entry.Indices.Num() || NativeFlags.Num() != Entry.Indices.Num())
+				{
+					throw std::runtime_error("Cooked scene corrupt: Component table size mismatch.");
+				}
+
+				for (int32 i = 0; i < Entry.Indices.Num(); ++i)
+				{
+					const uint32 ComponentIndex = Entry.Indices[i];
+					if (Owners[i] >= ActorCount)
+					{
+						throw std::runtime_error("Cooked scene corrupt: Component owner out of range.");
+					}
+					ComponentOwners[ComponentIndex] = Owners[i];
+					ComponentNative[ComponentIndex] = NativeFlags[i];
+
+					UActorComponent* Component = nullptr;
+					if (NativeFlags[i])
+					{
+						for (UActorComponent* ExistingComp : Actors[Owners[i]]->GetOwnedComponents())
+						{
+							if (ExistingComp && ExistingComp->IsNative() && ExistingComp->IsA(Entry.Class))
+							{
+								Component = ExistingComp;
+								break;
+							}
+						}
+						if (!Component)
+						{
+							// 레코드는 읽어서 버려야 하므로 임시 인스턴스를 만든다
+							UE_LOG("[CookedScene] Warning: Native component '%s' not found in constructor. Skipping.", Entry.Class->Name);
+							Component = Cast<UActorComponent>(ObjectFactory::NewObject(Entry.Class));
+							UnownedComponents.Add(Component);
+							ComponentNative[ComponentIndex] = 0xFF;
+						}
+					}
+					else
+					{
+						// 바로 소유 액터에 붙여 두면 실패 시 액터 삭제로 함께 정리된다
+						Component = Cast<UActorComponent>(ObjectFactory::NewObject(Entry.Class));
+						if (Component)
+						{
+							Actors[Owners[i]]->AddOwnedComponent(Component);
+						}
+					}
+					if (!Component)
+					{
+						throw std::runtime_error("ObjectFactory could not create a component instance.");
+					}
+					Components[ComponentIndex] = Component;
+				}
+			}
+			for (uint8 bSeen : SeenComponents)
+			{
+				if (!bSeen)
+				{
+					throw std::runtime_error("Cooked scene corrupt: Component missing from class table.");
+				}
+			}
+
+			// 액터 프로퍼티
+			for (const FCookedClassEntry& Entry : ActorClasses)
+			{
+				const TArray<FProperty>& Properties = Entry.Class->GetAllProperties();
+				if (!ReadAndMatchSchema(Ar, Properties, Context))
+				{
+					throw std::runtime_error(FString("Property schema changed for ") + Entry.Class->Name);
+				}
+				for (uint32 ActorIndex : Entry.Indices)
+				{
+					ReadProperties(Ar, Actors[ActorIndex], Properties, Context);
+					Actors[ActorIndex]->OnSerialized();
+				}
+			}
+
+			// 컴포넌트 레코드
+			for (const FCookedClassEntry& Entry : ComponentClasses)
+			{
+				const TArray<FProperty>& Properties = Entry.Class->GetAllProperties();
+				if (!ReadAndMatchSchema(Ar, Properties, Context))
+				{
+					throw std::runtime_error(FString("Property schema changed for ") + Entry.Class->Name);
+				}
+				for (uint32 ComponentIndex : Entry.Indices)
+				{
+					UActorComponent* Component = Components[ComponentIndex];
+					ReadProperties(Ar, Component, Properties, Context);
+					Component->OnSerialized();
+					Component->SerializeCooked(Ar);
+				}
+			}
+
+			// 건너뛴 Native 레코드용 임시 인스턴스 정리
+			for (UActorComponent* Component : UnownedComponents)
+			{
+				ObjectFactory::DeleteObject(Component);
+			}
+			UnownedComponents.Empty();
+
+			for (uint32 ActorIndex = 0; ActorIndex < ActorCount; ++ActorIndex)
+			{
+				const int32 RootIndex = RootComponents[ActorIndex];
+				if (RootIndex >= 0 && static_cast<uint32>(RootIndex) < ComponentCount && ComponentNative[RootIndex] != 0xFF)
+				{
+					if (USceneComponent* Root = Cast<USceneComponent>(Components[RootIndex]))
+					{
+						Actors[ActorIndex]->SetRootComponent(Root);
+					}
+				}
+			}
+
+			TArray<FCookedAttachment> Attachments;
+			Serialization::ReadArray(Ar, Attachments);
+			for (const FCookedAttachment& Attachment : Attachments)
+			{
+				if (Attachment.Child >= ComponentCount || Attachment.Parent >= ComponentCount
+					|| ComponentNative[Attachment.Child] == 0xFF || ComponentNative[Attachment.Parent] == 0xFF)
+				{
+					continue;
+				}
+				USceneComponent* Child = Cast<USceneComponent>(Components[Attachment.Child]);
+				USceneComponent* Parent = Cast<USceneComponent>(Components[Attachment.Parent]);
+				if (Child && Parent)
+				{
+					Child->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
+				}
+			}
+
+			for (const FCookedClassEntry& Entry : ActorClasses)
+			{
+				for (uint32 ActorIndex : Entry.Indices)
+				{
+					Actors[ActorIndex]->SerializeCooked(Ar);
+				}
+			}
+
+			if (Ar.GetRemaining() != 0)
+			{
+				throw std::runtime_error("Cooked scene corrupt: Trailing data.");
+			}
+
+			OutLevel.ReserveActors(static_cast<int32>(ActorCount));
+			for (AActor* Actor : Actors)
+			{
+				OutLevel.AddActor(Actor);
+			}
+			if (bHasCamera)
+			{
+				OutLevel.SetPerspectiveCamera(Camera);
+			}
+			return true;
+		}
+		catch (const std::exception& e)
+		{
+			UE_LOG("[CookedScene] Failed to load %s: %s", InSourceName.c_str(), e.what());
+
+			for (UActorComponent* Component : UnownedComponents)
+			{
+				ObjectFactory::DeleteObject(Component);
+			}
+			for (AActor* Actor : Actors)
+			{
+				if (Actor)
+				{
+					ObjectFactory::DeleteObject(Actor);
+				}
+			}
+			OutLevel.Clear();
+			return false;
+		}
+	}
+}
+
+FString FCookedScene::GetCookedPath(const FString& InScenePath)
+{
+	return ConvertDataPathToCachePath(NormalizePath(InScenePath)) + ".cooked";
+}
+
+bool FCookedScene::IsCookedStale(const FString& InScenePath, const FString& InCookedPath)
+{
+	try
+	{
+		const fs::path CookedPath(UTF8ToWide(InCookedPath));
+		if (!fs::exists(CookedPath))
+		{
+			return true;
+		}
+		return fs::last_write_time(fs::path(UTF8ToWide(InScenePath))) > fs::last_write_time(CookedPath);
+	}
+	catch (const fs::filesystem_error& e)
+	{
+		UE_LOG("[CookedScene] Filesystem error during cooked scene validation: %s", e.what());
+		return true;
+	}
+}
+
+bool FCookedScene::Cook(const ULevel& InLevel, const FString& InScenePath, const FString& InCookedPath)
+{
+	TArray<uint8> Payload;
+	WriteLevelPayload(InLevel, true, Payload);
+
+	try
+	{
+		const fs::path CookedPath(UTF8ToWide(InCookedPath));
+		if (CookedPath.has_parent_path())
+		{
+			fs::create_directories(CookedPath.parent_path());
+		}
+
+		uint32 FileMagic = Magic;
+		uint32 FileVersion = Version;
+		uint64 PayloadSize = Payload.size();
+		{
+			FWindowsBinWriter Writer(InCookedPath);
+			Writer << FileMagic << FileVersion;
+			Serialization::WriteString(Writer, NormalizePath(InScenePath));
+			Writer << PayloadSize;
+			Writer.Serialize(Payload.data(), static_cast<int64>(Payload.size()));
+		}
+
+		// 쓰기 도중 실패하면 잘린 파일이 남으므로 크기로 확인 후 지운다
+		const uint64 ExpectedSize = sizeof(FileMagic) + sizeof(FileVersion) + sizeof(uint32) + NormalizePath(InScenePath).size() + sizeof(PayloadSize) + PayloadSize;
+		if (!fs::exists(CookedPath) || fs::file_size(CookedPath) != ExpectedSize)
+		{
+			std::error_code ErrorCode;
+			fs::remove(CookedPath, ErrorCode);
+			return false;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG("[CookedScene] Failed to write %s: %s", InCookedPath.c_str(), e.what());
+		return false;
+	}
+
+	UE_LOG("[CookedScene] Cooked %s (%d actors, %.1f KB)", InCookedPath.c_str(),
+		static_cast<int32>(InLevel.GetActors().Num()), static_cast<double>(Payload.size()) / 1024.0);
+	return true;
+}
+
+bool FCookedScene::Load(const FString& InScenePath, const FString& InCookedPath, ULevel& OutLevel)
+{
+	TArray<uint8> FileData;
+	{
+		std::ifstream File(UTF8ToWide(InCookedPath), std::ios::binary | std::ios::ate);
+		if (!File.is_open())
+		{
+			return false;
+		}
+		const std::streamoff FileSize = File.tellg();
+		if (FileSize <= 0)
+		{
+			return false;
+		}
+		FileData.SetNum(static_cast<int32>(FileSize));
+		File.seekg(0);
+		File.read(reinterpret_cast<char*>(FileData.data()), FileSize);
+		if (!File)
+		{
+			return false;
+		}
+	}
+
+	FCookedBufferReader Ar(FileData.data(), FileData.size());
+	try
+	{
+		uint32 FileMagic = 0;
+		uint32 FileVersion = 0;
+		FString SourcePath;
+		uint64 PayloadSize = 0;
+		Ar << FileMagic << FileVersion;
+		if (FileMagic != Magic || FileVersion != Version)
+		{
+			UE_LOG("[CookedScene] %s has an unsupported version", InCookedPath.c_str());
+			return false;
+		}
+		Serialization::ReadString(Ar, SourcePath);
+		Ar << PayloadSize;
+		if (SourcePath != NormalizePath(InScenePath) || PayloadSize != Ar.GetRemaining())
+		{
+			UE_LOG("[CookedScene] %s was cooked from a different scene or is truncated", InCookedPath.c_str());
+			return false;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG("[CookedScene] Failed to load %s: %s", InCookedPath.c_str(), e.what());
+		return false;
+	}
+
+	const size_t HeaderSize = FileData.size() - Ar.GetRemaining();
+	return ReadLevelPayload(FileData.data() + HeaderSize, Ar.GetRemaining(), InCookedPath, OutLevel);
+}
+
+void FCookedScene::CaptureSnapshot(const ULevel& InLevel, TArray<uint8>& OutSnapshot)
+{
+	WriteLevelPayload(InLevel, false, OutSnapshot);
+}
+
+bool FCookedScene::LoadSnapshot(const TArray<uint8>& InSnapshot, ULevel& OutLevel)
+{
+	if (InSnapshot.IsEmpty())
+	{
+		return false;
+	}
+	return ReadLevelPayload(InSnapshot.data(), InSnapshot.size(), "PIE snapshot", OutLevel);
+}
@@ -0,0 +1,50 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class ULevel;
+
+/**
+ * 쿠킹된 바이너리 씬. JSON(.Scene)을 한 번 로드한 레벨을 FWindowsBinWriter로 기록해 두고 다음 로드부터 대신 읽는다.
+ *
+ * 파일 구성 (모든 문자열은 문자열 테이블 인덱스로 참조)
+ *  - 헤더: Magic, Version, 원본 씬 경로, 이후 바이트 수
+ *  - 문자열 테이블: 클래스/액터 이름, 에셋 경로 등을 한 번씩만 저장
+ *  - 에디터 카메라
+ *  - 액터/컴포넌트 클래스 테이블: 클래스별 인스턴스 목록. 로더는 클래스 단위로 한 번에 생성한다
+ *  - 클래스별 레코드: 프로퍼티 스키마(이름, 타입) 한 번 + 인스턴스마다 키 없이 스키마 순서로 채운 값과 SerializeCooked 값
+ *  - 부착 순서: 쿠킹 시점의 AttachChildren 순서대로 미리 계산한 (자식, 부모) 목록
+ *
+ * 스키마가 현재 클래스의 프로퍼티와 다르면(코드 변경) 로드를 거부하고, 호출자는 JSON으로 되돌아가 다시 쿠킹한다.
+ *
+ * 같은 본문(헤더와 에디터 카메라 제외)을 메모리에 담은 것이 PIE 스냅샷이다 (UWorld::DuplicateWorldForPIE).
+ */
+class FCookedScene
+{
+public:
+	static constexpr uint32 Magic = 0x4E43534D;	// "MSCN"
+	static constexpr uint32 Version = 1;		// SerializeCooked 구성이 바뀌면 올린다
+
+	// Scene/Bus.Scene → <GCacheDir>/Bus.Scene.cooked
+	static FString GetCookedPath(const FString& InScenePath);
+
+	// 쿠킹 파일이 없거나 원본 씬보다 오래되었으면 true
+	static bool IsCookedStale(const FString& InScenePath, const FString& InCookedPath);
+
+	/**
+	 * JSON에서 막 로드한 레벨(월드 등록 전)을 쿠킹 파일로 저장합니다.
+	 * @param InScenePath 원본 씬 경로 (같은 이름의 다른 씬과 구분하기 위해 헤더에 기록)
+	 */
+	static bool Cook(const ULevel& InLevel, const FString& InScenePath, const FString& InCookedPath);
+
+	/**
+	 * 쿠킹 파일에서 액터/컴포넌트를 클래스 단위로 생성해 OutLevel을 채웁니다. 월드 등록은 UWorld::SetLevel에서 일괄로 한다.
+	 * @return 파일이 손상되었거나 원본/스키마가 다르면 만든 객체를 모두 지우고 false
+	 */
+	static bool Load(const FString& InScenePath, const FString& InCookedPath, ULevel& OutLevel);
+
+	// 월드에 등록된 에디터 레벨을 메모리 스냅샷으로 저장합니다. 에디터 전용 컴포넌트는 제외
+	static void CaptureSnapshot(const ULevel& InLevel, TArray<uint8>& OutSnapshot);
+
+	// 스냅샷에서 레벨을 채웁니다. 실패 시 Load와 같이 만든 객체를 모두 지우고 false
+	static bool LoadSnapshot(const TArray<uint8>& InSnapshot, ULevel& OutLevel);
+};
@@ -10,6 +10,8 @@
 #include "FViewportClient.h"
 #include "CameraActor.h"
 #include "SplashScreen.h"
+#include "JobSystem.h"
+#include "PlatformTime.h"
 
 
 float UEditorEngine::ClientWidth = 1024.0f;
@@ -168,7 +170,12 @@ bool UEditorEngine::CreateMainWindow(HINSTANCE hInstance)
     if (clientHeight < 600) clientHeight = 1024;
 
     // Convert client area size to window size (including title bar and borders)
-    DWORD windowStyle = WS_POPUP | WS_VISIBLE | WS_OVERLAPPEDWINDOW;
+    // Null RHI는 화면에 출력하지 않으므로 창을 띄우지 않는다 (입력/ImGui용 HWND만 필요)
+    DWORD windowStyle = WS_POPUP | WS_OVERLAPPEDWINDOW;
+    if (!bNullRHI)
+    {
+        windowStyle |= WS_VISIBLE;
+    }
     RECT windowRect = { 0, 0, clientWidth, clientHeight };
     AdjustWindowRect(&windowRect, windowStyle, FALSE);
 
@@ -202,7 +209,18 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
         return false;
 
     //디바이스 리소스 및 렌더러 생성
-    RHIDevice.Initialize(HWnd);
+    if (bNullRHI)
+    {
+        if (!RHIDevice.InitializeNull(static_cast<UINT>(ClientWidth), static_cast<UINT>(ClientHeight), bD3DNullDriver))
+        {
+            UE_LOG("EditorEngine: Failed to create a null RHI device");
+            return false;
+        }
+    }
+    else
+    {
+        RHIDevice.Initialize(HWnd);
+    }
     Renderer = std::make_unique<URenderer>(&RHIDevice);
 
 #ifdef _RELEASE_STANDALONE
@@ -222,6 +240,7 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 #endif
 
     //매니저 초기화
+    FJobSystem::GetInstance().Initialize();
     UI.Initialize(HWnd, RHIDevice.GetDevice(), RHIDevice.GetDeviceContext());
     INPUT.Initialize(HWnd);
 
@@ -313,6 +332,12 @@ void UEditorEngine::Tick(float DeltaSeconds)
 #ifndef _RELEASE_STANDALONE
     // 에디터 전용 SLATE 업데이트
     SLATE.Update(DeltaSeconds);
+
+    // 편집이 멈추면 PIE 스냅샷을 미리 캡처해 Play 시작 지연을 줄임
+    if (!bPIEActive && !WorldContexts.empty() && WorldContexts[0].World)
+    {
+        WorldContexts[0].World->TickPIESnapshot(DeltaSeconds);
+    }
 #endif
 
     INPUT.Update();
@@ -457,6 +482,9 @@ void UEditorEngine::MainLoop()
 
 void UEditorEngine::Shutdown()
 {
+    // 워커가 UObject를 참조하는 작업을 들고 있지 않도록 가장 먼저 종료
+    FJobSystem::GetInstance().Shutdown();
+
 #ifndef _RELEASE_STANDALONE
     // Release ImGui first (it may hold D3D11 resources)
     UUIManager::GetInstance().Release();
@@ -534,6 +562,7 @@ void UEditorEngine::StartPIE()
         }
     }
 
+    const uint64 PIEStartCycles = FPlatformTime::Cycles64();
     UWorld* PIEWorld = UWorld::DuplicateWorldForPIE(EditorWorld);
 
     if (!PIEWorld)
@@ -583,7 +612,7 @@ void UEditorEngine::StartPIE()
         }
     }
 
-    UE_LOG("START PIE CLICKED");
+    UE_LOG("START PIE CLICKED (PIE startup %.2fms)", FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PIEStartCycles));
 }
 
 void UEditorEngine::EndPIE()
@@ -632,13 +661,8 @@ void UEditorEngine::LoadSceneAndStartPIE(const FString& ScenePath)
         CurrentWorld->SetSceneName(SceneName);
 
         // 새 레벨 생성 및 로드
-        std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-        JSON LevelJsonData;
-        if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, ScenePath))
-        {
-            NewLevel->Serialize(true, LevelJsonData);
-        }
-        else
+        std::unique_ptr<ULevel> NewLevel = ULevelService::LoadLevel(ScenePath);
+        if (!NewLevel)
         {
             UE_LOG("EditorEngine: Failed to load scene from: %s", ScenePath.c_str());
             return;
@@ -28,6 +28,15 @@ public:
     ~UEditorEngine();
 
     bool Startup(HINSTANCE hInstance);
+
+    // Startup 이전에 설정: 창을 숨기고 화면 출력 없는 Null RHI로 초기화 (헤드리스 벤치마크용)
+    // bInD3DNullDriver면 카운터 전용 디바이스 대신 D3D NULL 드라이버를 사용 (D3D11RHI::InitializeNull 참고)
+    void SetNullRHI(bool bInNullRHI, bool bInD3DNullDriver = false)
+    {
+        bNullRHI = bInNullRHI;
+        bD3DNullDriver = bInD3DNullDriver;
+    }
+    bool IsNullRHI() const { return bNullRHI; }
     void MainLoop();
     void Shutdown();
 
@@ -83,6 +92,8 @@ private:
     bool bRunning = false;
     bool bUVScrollPaused = true;
     bool bPIEActive = false;
+    bool bNullRHI = false;
+    bool bD3DNullDriver = false;
     float UVScrollTime = 0.0f;
     FVector2D UVScrollSpeed = FVector2D(0.5f, 0.5f);
 
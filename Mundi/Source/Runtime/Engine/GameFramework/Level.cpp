@@ -11,6 +11,8 @@
 #include "AmbientLightComponent.h"
 #include "World.h"
 #include "JsonSerializer.h"
+#include "CookedScene.h"
+#include "PlatformTime.h"
 
 static inline FString RemoveObjExtension(const FString& FileName)
 {
@@ -37,6 +39,40 @@ std::unique_ptr<ULevel> ULevelService::CreateDefaultLevel()
     return NewLevel;
 }
 
+std::unique_ptr<ULevel> ULevelService::LoadLevel(const FString& InScenePath)
+{
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    const FString CookedPath = FCookedScene::GetCookedPath(InScenePath);
+
+    std::unique_ptr<ULevel> NewLevel = CreateDefaultLevel();
+    if (!FCookedScene::IsCookedStale(InScenePath, CookedPath))
+    {
+        if (FCookedScene::Load(InScenePath, CookedPath, *NewLevel))
+        {
+            UE_LOG("LevelService: Loaded '%s' from cooked scene (%d actors, %.2fms)", InScenePath.c_str(),
+                static_cast<int32>(NewLevel->GetActors().Num()), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+            return NewLevel;
+        }
+        UE_LOG("LevelService: Cooked scene '%s' is invalid, falling back to JSON", CookedPath.c_str());
+    }
+
+    JSON LevelJsonData;
+    if (!FJsonSerializer::LoadJsonFromFile(LevelJsonData, InScenePath))
+    {
+        return nullptr;
+    }
+    NewLevel->Serialize(true, LevelJsonData);
+    UE_LOG("LevelService: Loaded '%s' from JSON (%d actors, %.2fms)", InScenePath.c_str(),
+        static_cast<int32>(NewLevel->GetActors().Num()), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+
+    // 월드에 등록하기 전(에디터 전용 컴포넌트가 붙기 전) 상태를 그대로 쿠킹
+    if (!FCookedScene::Cook(*NewLevel, InScenePath, CookedPath))
+    {
+        UE_LOG("LevelService: Failed to cook '%s'", CookedPath.c_str());
+    }
+    return NewLevel;
+}
+
 //어느 레벨이든 기본적으로 존재하는 엑터(디렉셔널 라이트) 생성
 void ULevel::SpawnDefaultActors()
 {
@@ -73,18 +109,29 @@ void ULevel::UpdateSceneAABB()
     }
 }
 
-void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+void ULevel::SetPerspectiveCamera(const FPerspectiveCameraData& InCameraData)
 {
-    Super::Serialize(bInIsLoading, InOutHandle);
+    PerspectiveCamera = InCameraData;
+    bHasPerspectiveCamera = true;
+
+    ACameraActor* CamActor = GWorld ? GWorld->GetCameraActor() : nullptr;
+    if (!CamActor)
+    {
+        return;
+    }
 
-    struct FPerspectiveCameraData
+    CamActor->SetActorLocation(InCameraData.Location);
+    CamActor->SetRotationFromEulerAngles(InCameraData.Rotation);
+    if (auto* CamComp = CamActor->GetCameraComponent())
     {
-        FVector Location;
-        FVector Rotation;
-        float FOV;
-        float NearClip;
-        float FarClip;
-    };
+        CamComp->SetFOV(InCameraData.FOV);
+        CamComp->SetClipPlanes(InCameraData.NearClip, InCameraData.FarClip);
+    }
+}
+
+void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+{
+    Super::Serialize(bInIsLoading, InOutHandle);
 
     if (bInIsLoading)
     {
@@ -92,28 +139,15 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         JSON PerspectiveCameraData;
         if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
         {
-            // 카메라 정보
-            ACameraActor* CamActor = GWorld->GetCameraActor();
+            // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
+            // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
             FPerspectiveCameraData CamData;
-            if (CamActor)
-            {
-                // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
-                // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
-                // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
-
-                CamActor->SetActorLocation(CamData.Location);
-                CamActor->SetRotationFromEulerAngles(CamData.Rotation);
-                if (auto* CamComp = CamActor->GetCameraComponent())
-                {
-                    CamComp->SetFOV(CamData.FOV);
-                    CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
-                }
-            }
+            FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
+            FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
+            FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
+            FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
+            FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
+            SetPerspectiveCamera(CamData);
         }
 
         // Actors 정보
@@ -4,6 +4,16 @@
 #include "Actor.h"
 #include <algorithm>
 
+// 씬 파일의 "PerspectiveCamera" 블록
+struct FPerspectiveCameraData
+{
+    FVector Location;
+    FVector Rotation;
+    float FOV = 0.0f;
+    float NearClip = 0.0f;
+    float FarClip = 0.0f;
+};
+
 class ULevel : public UObject
 {
 public:
@@ -13,6 +23,7 @@ public:
 
     const TArray<AActor*>& GetActors() const { return Actors; }
     void AddActor(AActor* Actor) { if (Actor) Actors.Add(Actor); }
+    void ReserveActors(int32 InCount) { Actors.Reserve(InCount); }
     void SpawnDefaultActors();
     bool RemoveActor(AActor* Actor)
     {
@@ -24,10 +35,18 @@ public:
     void UpdateSceneAABB();
     const FAABB& GetSceneAABB() const { return SceneAABB; }
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+
+    // 로드한 씬의 에디터 카메라 정보. 로드 시 GWorld의 카메라 액터에 적용된다
+    bool HasPerspectiveCamera() const { return bHasPerspectiveCamera; }
+    const FPerspectiveCameraData& GetPerspectiveCamera() const { return PerspectiveCamera; }
+    void SetPerspectiveCamera(const FPerspectiveCameraData& InCameraData);
 private:
     TArray<AActor*> Actors;
     //씬 전체를 감싸는 AABB
     FAABB SceneAABB;
+
+    bool bHasPerspectiveCamera = false;
+    FPerspectiveCameraData PerspectiveCamera;
 };
 
 class ULevelService
@@ -36,4 +55,6 @@ public:
     // Create a new empty level
     static std::unique_ptr<ULevel> CreateNewLevel();
     static std::unique_ptr<ULevel> CreateDefaultLevel();
+    // 씬 파일 로드. 최신 쿠킹 파일(FCookedScene)이 있으면 그것을 읽고, 없으면 JSON을 읽은 뒤 쿠킹해 둔다. 실패 시 nullptr
+    static std::unique_ptr<ULevel> LoadLevel(const FString& InScenePath);
 };
@@ -40,6 +40,8 @@
 #include "BoxComponent.h"
 #include "SphereComponent.h"
 #include "CapsuleComponent.h"
+#include "CookedScene.h"
+#include "PlatformTime.h"
 
 IMPLEMENT_CLASS(UWorld)
 
@@ -683,6 +685,25 @@ void UWorld::Tick(float DeltaSeconds)
 	{
 		if (EditorActor && !bPie) EditorActor->ExecuteTick(DeltaSeconds);
 	}
+
+	// 틱에서 바뀐 트랜스폼을 렌더링 전에 한 번에 갱신. 계층당 루트부터 내려가며 더티인 컴포넌트만 재계산
+	if (Level)
+	{
+		for (AActor* Actor : Level->GetActors())
+		{
+			if (Actor && Actor->GetRootComponent())
+			{
+				Actor->GetRootComponent()->UpdateWorldTransformRecursive();
+			}
+		}
+	}
+	for (AActor* EditorActor : EditorActors)
+	{
+		if (EditorActor && EditorActor->GetRootComponent())
+		{
+			EditorActor->GetRootComponent()->UpdateWorldTransformRecursive();
+		}
+	}
 }
 
 UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
@@ -706,26 +727,40 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	FWorldContext PIEWorldContext = FWorldContext(PIEWorld, EWorldType::Game);
 	GEngine.AddWorldContext(PIEWorldContext);
 	
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 
-	const TArray<AActor*>& SourceActors = InEditorWorld->GetLevel()->GetActors();
-	for (AActor* SourceActor : SourceActors)
+	// 에디터 레벨 스냅샷에서 클래스 단위로 한 번에 생성하고, SetLevel에서 파티션/충돌체를 일괄 등록
+	std::unique_ptr<ULevel> PIELevel = ULevelService::CreateDefaultLevel();
+	if (InEditorWorld->UpdatePIESnapshot() && FCookedScene::LoadSnapshot(InEditorWorld->PIESnapshot, *PIELevel))
+	{
+		PIEWorld->SetLevel(std::move(PIELevel));
+		UE_LOG("DuplicateWorldForPIE: Instantiated %d actors from snapshot (%.2fms)",
+			static_cast<int32>(PIEWorld->GetLevel()->GetActors().Num()), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	}
+	else
 	{
-		if (!SourceActor)
+		// 스냅샷을 쓸 수 없으면 액터마다 복제
+		const TArray<AActor*>& SourceActors = InEditorWorld->GetLevel()->GetActors();
+		for (AActor* SourceActor : SourceActors)
 		{
-			UE_LOG("Duplicate failed: SourceActor is nullptr");
-			continue;
-		}
+			if (!SourceActor)
+			{
+				UE_LOG("Duplicate failed: SourceActor is nullptr");
+				continue;
+			}
 
-		AActor* NewActor = SourceActor->Duplicate();
+			AActor* NewActor = SourceActor->Duplicate();
 
-		if (!NewActor)
-		{
-			UE_LOG("Duplicate failed: NewActor is nullptr");
-			continue;
+			if (!NewActor)
+			{
+				UE_LOG("Duplicate failed: NewActor is nullptr");
+				continue;
+			}
+			PIEWorld->AddActorToLevel(NewActor);
+			NewActor->SetWorld(PIEWorld);
 		}
-		PIEWorld->AddActorToLevel(NewActor);
-		NewActor->SetWorld(PIEWorld);
-
+		UE_LOG("DuplicateWorldForPIE: Duplicated %d actors (%.2fms)",
+			static_cast<int32>(PIEWorld->GetLevel()->GetActors().Num()), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
 	}
 
 	// PIE World에 카메라 액터 설정 (복제된 액터 중 첫 번째 카메라를 메인 카메라로 설정)
@@ -753,6 +788,50 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	return PIEWorld;
 }
 
+bool UWorld::UpdatePIESnapshot()
+{
+	if (bPie || !Level)
+	{
+		return false;
+	}
+
+	if (PIESnapshotVersion != LevelEditVersion)
+	{
+		PIESnapshot.Empty();
+		FCookedScene::CaptureSnapshot(*Level, PIESnapshot);
+		PIESnapshotVersion = LevelEditVersion;
+	}
+#ifdef _DEBUG
+	else
+	{
+		// MarkLevelEdited를 거치지 않는 편집 경로가 생기면 오래된 스냅샷으로 PIE가 시작되므로 디버그 빌드에서 새로 캡처해 비교
+		TArray<uint8> FreshSnapshot;
+		FCookedScene::CaptureSnapshot(*Level, FreshSnapshot);
+		if (FreshSnapshot != PIESnapshot)
+		{
+			UE_LOG("UpdatePIESnapshot: Snapshot was stale (an edit skipped MarkLevelEdited), recaptured");
+			PIESnapshot = std::move(FreshSnapshot);
+		}
+	}
+#endif
+	return !PIESnapshot.IsEmpty();
+}
+
+void UWorld::TickPIESnapshot(float DeltaSeconds)
+{
+	if (bPie || PIESnapshotVersion == LevelEditVersion)
+	{
+		return;
+	}
+
+	// 기즈모 드래그처럼 매 프레임 편집되는 동안에는 캡처하지 않고, 멈춘 뒤 한 번만
+	SecondsSinceLevelEdit += DeltaSeconds;
+	if (SecondsSinceLevelEdit >= 0.5f)
+	{
+		UpdatePIESnapshot();
+	}
+}
+
 FString UWorld::GenerateUniqueActorName(const FString& ActorType)
 {
 	// GetInstance current count for this type
@@ -912,12 +991,17 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     if (Level)
     {
 		Partition->BulkRegister(Level->GetActors());
+
+		// 충돌체도 액터마다 등록하지 않고 모아서 BVH를 한 번에 빌드
+		TArray<UShapeComponent*> Shapes;
         for (AActor* A : Level->GetActors())
         {
             if (!A) continue;
-            A->SetWorld(this);
+            A->SetWorld(this, &Shapes);
         }
+		Physics->BulkRegisterCollision(Shapes);
     }
+	MarkLevelEdited();
 
     // Clean any dangling selection references just in case
     if (SelectionMgr) SelectionMgr->CleanupInvalidActors();
@@ -929,6 +1013,7 @@ void UWorld::AddActorToLevel(AActor* Actor)
 	{
 		Level->AddActor(Actor);
 		Partition->Register(Actor);
+		MarkLevelEdited();
 	}
 }
 
@@ -124,6 +124,19 @@ public:
     // PIE용 World 생성
     static UWorld* DuplicateWorldForPIE(UWorld* InEditorWorld);
 
+    /** === PIE 스냅샷 === */
+    // 에디터에서 레벨 내용(액터 추가/삭제, 컴포넌트, 프로퍼티, 트랜스폼)이 바뀔 때 호출. PIE 스냅샷을 무효화한다
+    void MarkLevelEdited()
+    {
+        if (bPie) return;
+        ++LevelEditVersion;
+        SecondsSinceLevelEdit = 0.0f;
+    }
+    // 스냅샷이 마지막 편집보다 오래되었으면 다시 캡처. 사용할 수 있는 스냅샷이 있으면 true
+    bool UpdatePIESnapshot();
+    // 편집이 잠시 멈추면 PIE 시작 전에 스냅샷을 미리 만들어 둔다 (에디터 Tick)
+    void TickPIESnapshot(float DeltaSeconds);
+
 private:
     /** === World Runtime === */
     float GlobalTimeDeliation = 1.0f; // 전역 시간 흐름 배율
@@ -175,6 +188,12 @@ private:
     TArray<AActor*> ActorsToDestroy;
     TArray<UActorComponent*> ComponentsToDestroy;
 
+    // PIE 스냅샷 (FCookedScene 페이로드). LevelEditVersion이 PIESnapshotVersion과 같을 때만 유효
+    TArray<uint8> PIESnapshot;
+    uint64 LevelEditVersion = 1;
+    uint64 PIESnapshotVersion = 0;
+    float SecondsSinceLevelEdit = 0.0f;
+
 };
 
 template<class T>
@@ -13,6 +13,7 @@
 #include "Picking.h" // FRay
 
 #include "StaticMeshComponent.h"
+#include "JobSystem.h"
 #include "ResourceManager.h"
 #include "StaticMesh.h"
 
@@ -68,6 +69,12 @@ void FBVHierarchy::Clear()
     StaticMeshComponentBounds = TMap<UStaticMeshComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UStaticMeshComponent*>();
     Nodes = TArray<FLBVHNode>();
+    ComponentSlots = TMap<UStaticMeshComponent*, int32>();
+    SlotLeaves = TArray<int32>();
+    PendingRefitLeaves = TSet<int32>();
+    SAHAreaSum = 0.0f;
+    BuiltSAHCost = 0.0f;
+    RemovedSlotCount = 0;
     Bounds = FAABB();
     bPendingRebuild = false;
 }
@@ -96,6 +103,19 @@ void FBVHierarchy::Update(UStaticMeshComponent* InComponent)
     }
 
     StaticMeshComponentBounds.Add(InComponent, InComponent->GetWorldAABB());
+    if (bPendingRebuild)
+    {
+        return;
+    }
+
+    // 이미 트리에 있는 컴포넌트는 위상 변화 없이 소속 리프만 리핏
+    if (const int32* Slot = ComponentSlots.Find(InComponent))
+    {
+        PendingRefitLeaves.Add(SlotLeaves[*Slot]);
+        return;
+    }
+
+    // 신규 컴포넌트는 들어갈 리프가 없으므로 리빌드
     bPendingRebuild = true;
 }
 
@@ -109,6 +129,25 @@ void FBVHierarchy::Remove(UStaticMeshComponent* InComponent)
     if (StaticMeshComponentBounds.Find(InComponent))
     {
         StaticMeshComponentBounds.Remove(InComponent);
+        if (bPendingRebuild)
+        {
+            return;
+        }
+
+        // 슬롯만 비우고 리프를 리핏. 빈 슬롯이 많아지면 리빌드로 압축
+        if (const int32* Slot = ComponentSlots.Find(InComponent))
+        {
+            StaticMeshComponentArray[*Slot] = nullptr;
+            PendingRefitLeaves.Add(SlotLeaves[*Slot]);
+            ComponentSlots.Remove(InComponent);
+            ++RemovedSlotCount;
+            if (RemovedSlotCount > StaticMeshComponentArray.Num() * RebuildRemovedRatio)
+            {
+                bPendingRebuild = true;
+            }
+            return;
+        }
+
         bPendingRebuild = true;
     }
 }
@@ -168,6 +207,52 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
     }
 }
 
+void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum, OUT TArray<UStaticMeshComponent*>& OutComponents) const
+{
+    if (Nodes.empty()) return;
+
+    // second: 노드가 프러스텀 안에 완전히 포함되어 하위 테스트를 생략해도 되는지 여부
+    TArray<std::pair<int32, bool>> IdxStack;
+    IdxStack.push_back({ 0, false });
+
+    while (!IdxStack.empty())
+    {
+        const std::pair<int32, bool> Entry = IdxStack.back();
+        IdxStack.pop_back();
+
+        const FLBVHNode& Node = Nodes[Entry.first];
+        bool bFullyInside = Entry.second;
+        if (!bFullyInside)
+        {
+            if (!IsAABBVisible(InFrustum, Node.Bounds))
+                continue;
+            // 가시 판정을 통과했는데 교차가 아니면 완전 내부
+            bFullyInside = !IsAABBIntersects(InFrustum, Node.Bounds);
+        }
+
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                UStaticMeshComponent* Component = StaticMeshComponentArray[Node.First + i];
+                if (!Component) continue;
+
+                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                if (!Cached) continue;
+
+                if (bFullyInside || IsAABBVisible(InFrustum, *Cached))
+                {
+                    OutComponents.Add(Component);
+                }
+            }
+            continue;
+        }
+
+        if (Node.Left >= 0) IdxStack.push_back({ Node.Left, bFullyInside });
+        if (Node.Right >= 0) IdxStack.push_back({ Node.Right, bFullyInside });
+    }
+}
+
 void FBVHierarchy::DebugDraw(URenderer* Renderer) const
 {
     if (!Renderer) return;
@@ -219,7 +304,7 @@ int FBVHierarchy::TotalNodeCount() const
 
 int FBVHierarchy::TotalActorCount() const
 {
-    return static_cast<int>(StaticMeshComponentArray.size());
+    return static_cast<int>(StaticMeshComponentArray.size()) - RemovedSlotCount;
 }
 
 int FBVHierarchy::MaxOccupiedDepth() const
@@ -267,6 +352,12 @@ void FBVHierarchy::BuildLBVH()
     StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
     const int N = StaticMeshComponentArray.Num();
     Nodes = TArray<FLBVHNode>();
+    ComponentSlots = TMap<UStaticMeshComponent*, int32>();
+    SlotLeaves = TArray<int32>();
+    PendingRefitLeaves.Empty();
+    SAHAreaSum = 0.0f;
+    BuiltSAHCost = 0.0f;
+    RemovedSlotCount = 0;
 
     if (N == 0)
     {
@@ -300,7 +391,8 @@ void FBVHierarchy::BuildLBVH()
     const FVector Min = Bounds.Min;
     const FVector Extent = Bounds.GetHalfExtent();
 
-    for (int i = 0; i < N; ++i)
+    // 컴포넌트마다 독립적인 계산이라 워커에 나눠 처리 (바운드 맵은 읽기만 함)
+    ParallelFor(N, [&](int32 i)
     {
         UStaticMeshComponent* Component = StaticMeshComponentArray[i];
         const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
@@ -324,7 +416,7 @@ void FBVHierarchy::BuildLBVH()
         const uint32 Iz = static_cast<uint32>(Nz * 1023.0f);
 
         Codes[i] = Morton3D(Ix, Iy, Iz);
-    }
+    }, 1024);
 
     TArray<std::pair<UStaticMeshComponent*, uint32>> ComponentCodePairs;
     ComponentCodePairs.resize(N);
@@ -346,7 +438,20 @@ void FBVHierarchy::BuildLBVH()
 
     Nodes.reserve(std::max(1, 2 * N));
     Nodes.clear();
+    SlotLeaves.resize(N, -1);
     BuildRange(0, N);
+
+    ComponentSlots.reserve(N);
+    for (int i = 0; i < N; ++i)
+    {
+        ComponentSlots.Add(StaticMeshComponentArray[i], i);
+    }
+
+    for (const FLBVHNode& Node : Nodes)
+    {
+        SAHAreaSum += Node.Bounds.GetSurfaceArea() * (Node.IsLeaf() ? Node.Count : 1);
+    }
+    BuiltSAHCost = GetSAHCost();
 }
 
 int FBVHierarchy::BuildRange(int s, int e)
@@ -360,6 +465,10 @@ int FBVHierarchy::BuildRange(int s, int e)
     {
         node.First = s;
         node.Count = count;
+        for (int i = s; i < e; ++i)
+        {
+            SlotLeaves[i] = nodeIdx;
+        }
         bool bInitialized = false;
         FAABB Accumulated;
         for (int i = s; i < e; ++i)
@@ -391,9 +500,86 @@ int FBVHierarchy::BuildRange(int s, int e)
     int R = BuildRange(mid, e);
     node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
     node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
+    Nodes[L].Parent = nodeIdx;
+    Nodes[R].Parent = nodeIdx;
     return nodeIdx;
 }
 
+void FBVHierarchy::RefitDirtyLeaves()
+{
+    for (int32 LeafIndex : PendingRefitLeaves)
+    {
+        const FLBVHNode& Leaf = Nodes[LeafIndex];
+
+        bool bInitialized = false;
+        FAABB Accumulated;
+        for (int32 i = Leaf.First; i < Leaf.First + Leaf.Count; ++i)
+        {
+            UStaticMeshComponent* Component = StaticMeshComponentArray[i];
+            if (!Component)
+            {
+                continue;
+            }
+
+            const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
+            const FAABB LocalBound = Bound ? *Bound : Component->GetWorldAABB();
+            Accumulated = bInitialized ? FAABB::Union(Accumulated, LocalBound) : LocalBound;
+            bInitialized = true;
+        }
+
+        // 슬롯이 모두 비었으면 이전 바운드를 유지 (쿼리는 nullptr 슬롯을 건너뜀, 다음 리빌드에서 정리)
+        if (!bInitialized)
+        {
+            continue;
+        }
+        SetNodeBounds(LeafIndex, Accumulated);
+
+        // 부모 방향으로 전파. 바운드가 그대로인 노드를 만나면 그 위도 변하지 않으므로 중단
+        int32 NodeIndex = Leaf.Parent;
+        while (NodeIndex >= 0)
+        {
+            const FLBVHNode& Node = Nodes[NodeIndex];
+            const FAABB NewBounds = FAABB::Union(Nodes[Node.Left].Bounds, Nodes[Node.Right].Bounds);
+            if (NewBounds.Min == Node.Bounds.Min && NewBounds.Max == Node.Bounds.Max)
+            {
+                break;
+            }
+            SetNodeBounds(NodeIndex, NewBounds);
+            NodeIndex = Node.Parent;
+        }
+    }
+    PendingRefitLeaves.Empty();
+
+    if (!Nodes.empty())
+    {
+        Bounds = Nodes[0].Bounds;
+    }
+}
+
+void FBVHierarchy::SetNodeBounds(int32 NodeIndex, const FAABB& InBounds)
+{
+    FLBVHNode& Node = Nodes[NodeIndex];
+    const float Weight = Node.IsLeaf() ? static_cast<float>(Node.Count) : 1.0f;
+    SAHAreaSum += (InBounds.GetSurfaceArea() - Node.Bounds.GetSurfaceArea()) * Weight;
+    Node.Bounds = InBounds;
+}
+
+float FBVHierarchy::GetSAHCost() const
+{
+    if (Nodes.empty())
+    {
+        return 0.0f;
+    }
+
+    const float RootArea = Nodes[0].Bounds.GetSurfaceArea();
+    return RootArea > KINDA_SMALL_NUMBER ? SAHAreaSum / RootArea : 0.0f;
+}
+
+float FBVHierarchy::GetQualityRatio() const
+{
+    return BuiltSAHCost > KINDA_SMALL_NUMBER ? GetSAHCost() / BuiltSAHCost : 1.0f;
+}
+
 void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
 {
     OutActor = nullptr;
@@ -653,6 +839,19 @@ void FBVHierarchy::FlushRebuild()
     {
         BuildLBVH();
         bPendingRebuild = false;
+        return;
+    }
+
+    if (PendingRefitLeaves.IsEmpty())
+    {
+        return;
+    }
+
+    // 이동한 컴포넌트 수에 비례하는 비용으로 갱신하고, 트리 품질이 임계값 아래로 떨어졌을 때만 리빌드
+    RefitDirtyLeaves();
+    if (GetQualityRatio() > RebuildCostRatio)
+    {
+        BuildLBVH();
     }
 }
 
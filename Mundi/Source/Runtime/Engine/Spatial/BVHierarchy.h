@@ -35,6 +35,11 @@ public:
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
     void QueryRayClosestStrict(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT, TArray<AActor*> ExcludeList = {}) const;
     void QueryFrustum(const FFrustum& InFrustum);
+    // 프러스텀과 겹치는 컴포넌트를 수집 (액터 상태를 건드리지 않는 렌더러용 쿼리)
+    void QueryFrustum(const FFrustum& InFrustum, OUT TArray<UStaticMeshComponent*>& OutComponents) const;
+    bool Contains(UStaticMeshComponent* InComponent) const { return StaticMeshComponentBounds.Contains(InComponent); }
+    // BVH에 반영된 마지막 바운드 (미등록이면 nullptr)
+    const FAABB* FindBounds(UStaticMeshComponent* InComponent) const { return StaticMeshComponentBounds.Find(InComponent); }
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
@@ -47,6 +52,8 @@ public:
     int MaxOccupiedDepth() const;
     void DebugDump() const;
     const FAABB& GetBounds() const { return Bounds; }
+    // 현재 트리의 SAH 비용 / 마지막 전체 빌드 직후의 SAH 비용 (1.0 = 빌드 직후 품질)
+    float GetQualityRatio() const;
 
     // 프러스텀 기준으로 오클루더(내부노드 AABB) / 오클루디(리프의 액터들) 수집
     // VP는 행벡터 기준(네 컨벤션): p' = p * VP
@@ -58,12 +65,18 @@ private:
         FAABB Bounds;
         int32 Left = -1;
         int32 Right = -1;
+        int32 Parent = -1;
         int32 First = -1;
         int32 Count = 0;
         bool IsLeaf() const { return Count > 0; }
     };
     void BuildLBVH();
 
+    // 더티 리프의 바운드를 제자리에서 다시 계산하고 부모 방향으로 전파
+    void RefitDirtyLeaves();
+    void SetNodeBounds(int32 NodeIndex, const FAABB& InBounds);
+    float GetSAHCost() const;
+
 private:
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
     TArray<UStaticMeshComponent*> QueryIntersectedComponentsGeneric(const BoundType& InBound
@@ -83,5 +96,21 @@ private:
     // LBVH nodes
     TArray<FLBVHNode> Nodes;
 
+    // === Refit data ===
+    // 컴포넌트 -> StaticMeshComponentArray 슬롯, 슬롯 -> 소속 리프 노드
+    TMap<UStaticMeshComponent*, int32> ComponentSlots;
+    TArray<int32> SlotLeaves;
+    TSet<int32> PendingRefitLeaves;
+
+    // SAH 비용 = SAHAreaSum / 루트 표면적. 내부 노드는 표면적, 리프는 표면적 * 원소 수로 누적
+    float SAHAreaSum = 0.0f;
+    float BuiltSAHCost = 0.0f;
+    int32 RemovedSlotCount = 0;
+
+    // 리핏 누적으로 SAH 비용이 빌드 직후보다 이 비율 이상 나빠지면 전체 리빌드
+    static constexpr float RebuildCostRatio = 1.5f;
+    // 제거로 비어 있는 슬롯이 전체의 이 비율을 넘으면 전체 리빌드
+    static constexpr float RebuildRemovedRatio = 0.25f;
+
     bool bPendingRebuild = false;
 };
@@ -0,0 +1,332 @@
+﻿#include "pch.h"
+#include "StaticMesh.h"
+#include "StaticMeshComponent.h"
+#include "StaticMeshActor.h"
+#include "BoxComponent.h"
+#include "SphereComponent.h"
+#include "CapsuleComponent.h"
+#include "ResourceManager.h"
+#include "Collision.h"
+#include "MeshBVH.h"
+#include "Picking.h"
+
+/**
+ * 독립 공간 벤치마크용 대체 클래스 구현
+ * 바운드 / 교차 / 피킹 계산은 엔진의 해당 .cpp와 같은 식을 그대로 옮겨, 측정 대상 자료구조가 엔진과 같은 입력을 받도록 합니다.
+ */
+
+namespace
+{
+	/** 엔진 기본 메시(Data/cube-tex.obj)와 같은 한 변 1의 큐브. 삼각형 12개 */
+	FStaticMesh* CreateUnitCubeAsset()
+	{
+		FStaticMesh* Asset = new FStaticMesh();
+		Asset->PathFileName = "Data/cube-tex.obj";
+
+		const FVector Corners[8] =
+		{
+			FVector(-0.5f, -0.5f, -0.5f), FVector(0.5f, -0.5f, -0.5f), FVector(0.5f, -0.5f, 0.5f), FVector(-0.5f, -0.5f, 0.5f),
+			FVector(-0.5f, 0.5f, -0.5f), FVector(0.5f, 0.5f, -0.5f), FVector(0.5f, 0.5f, 0.5f), FVector(-0.5f, 0.5f, 0.5f),
+		};
+		for (const FVector& Corner : Corners)
+		{
+			FNormalVertex Vertex;
+			Vertex.pos = Corner;
+			Asset->Vertices.Add(Vertex);
+		}
+
+		const uint32 Faces[12][3] =
+		{
+			{ 0, 1, 2 }, { 0, 2, 3 },	// -Y
+			{ 4, 6, 5 }, { 4, 7, 6 },	// +Y
+			{ 0, 4, 5 }, { 0, 5, 1 },	// -Z
+			{ 3, 2, 6 }, { 3, 6, 7 },	// +Z
+			{ 0, 3, 7 }, { 0, 7, 4 },	// -X
+			{ 1, 5, 6 }, { 1, 6, 2 },	// +X
+		};
+		for (const auto& Face : Faces)
+		{
+			Asset->Indices.Add(Face[0]);
+			Asset->Indices.Add(Face[1]);
+			Asset->Indices.Add(Face[2]);
+		}
+		return Asset;
+	}
+
+	UStaticMesh* GetDefaultStaticMesh()
+	{
+		static UStaticMesh* DefaultMesh = []()
+		{
+			UStaticMesh* Mesh = NewObject<UStaticMesh>();
+			Mesh->SetStaticMeshAsset(CreateUnitCubeAsset());
+			return Mesh;
+		}();
+		return DefaultMesh;
+	}
+}
+
+// ───── UStaticMesh ────────────────────────────
+
+void UStaticMesh::SetStaticMeshAsset(FStaticMesh* InStaticMeshAsset)
+{
+	StaticMeshAsset = InStaticMeshAsset;
+	LocalBound = FAABB();
+	if (!StaticMeshAsset || StaticMeshAsset->Vertices.IsEmpty())
+	{
+		return;
+	}
+
+	FVector Min = StaticMeshAsset->Vertices[0].pos;
+	FVector Max = Min;
+	for (const FNormalVertex& Vertex : StaticMeshAsset->Vertices)
+	{
+		Min = Min.ComponentMin(Vertex.pos);
+		Max = Max.ComponentMax(Vertex.pos);
+	}
+	LocalBound = FAABB(Min, Max);
+}
+
+// ───── UStaticMeshComponent ────────────────────────────
+
+UStaticMeshComponent::UStaticMeshComponent()
+{
+	SetStaticMesh(GetDefaultStaticMesh());
+}
+
+FAABB UStaticMeshComponent::GetWorldAABB() const
+{
+	const FMatrix WorldMatrix = GetWorldMatrix();
+	if (!StaticMesh)
+	{
+		const FVector Origin = GetWorldLocation();
+		return FAABB(Origin, Origin);
+	}
+
+	const FAABB LocalBound = StaticMesh->GetLocalBound();
+	const FVector LocalMin = LocalBound.Min;
+	const FVector LocalMax = LocalBound.Max;
+
+	const FVector LocalCorners[8] = {
+		FVector(LocalMin.X, LocalMin.Y, LocalMin.Z),
+		FVector(LocalMax.X, LocalMin.Y, LocalMin.Z),
+		FVector(LocalMin.X, LocalMax.Y, LocalMin.Z),
+		FVector(LocalMax.X, LocalMax.Y, LocalMin.Z),
+		FVector(LocalMin.X, LocalMin.Y, LocalMax.Z),
+		FVector(LocalMax.X, LocalMin.Y, LocalMax.Z),
+		FVector(LocalMin.X, LocalMax.Y, LocalMax.Z),
+		FVector(LocalMax.X, LocalMax.Y, LocalMax.Z)
+	};
+
+	FVector4 WorldMin4 = FVector4(LocalCorners[0].X, LocalCorners[0].Y, LocalCorners[0].Z, 1.0f) * WorldMatrix;
+	FVector4 WorldMax4 = WorldMin4;
+	for (int32 CornerIndex = 1; CornerIndex < 8; ++CornerIndex)
+	{
+		const FVector4 WorldPos = FVector4(LocalCorners[CornerIndex].X, LocalCorners[CornerIndex].Y, LocalCorners[CornerIndex].Z, 1.0f) * WorldMatrix;
+		WorldMin4 = WorldMin4.ComponentMin(WorldPos);
+		WorldMax4 = WorldMax4.ComponentMax(WorldPos);
+	}
+
+	return FAABB(FVector(WorldMin4.X, WorldMin4.Y, WorldMin4.Z), FVector(WorldMax4.X, WorldMax4.Y, WorldMax4.Z));
+}
+
+// ───── UBoxComponent ────────────────────────────
+
+void UBoxComponent::SetExtent(const FVector& InExtent)
+{
+	BoxExtent = InExtent;
+	UpdateBound();
+}
+
+FAABB UBoxComponent::GetWorldAABB()
+{
+	const TArray<FVector> Corners = CachedBound.GetCorners();
+	if (Corners.empty())
+	{
+		const FVector WorldPos = GetWorldLocation();
+		return FAABB(WorldPos, WorldPos);
+	}
+
+	FVector Min = Corners[0];
+	FVector Max = Corners[0];
+	for (const FVector& Corner : Corners)
+	{
+		Min.X = FMath::Min(Min.X, Corner.X);
+		Min.Y = FMath::Min(Min.Y, Corner.Y);
+		Min.Z = FMath::Min(Min.Z, Corner.Z);
+
+		Max.X = FMath::Max(Max.X, Corner.X);
+		Max.Y = FMath::Max(Max.Y, Corner.Y);
+		Max.Z = FMath::Max(Max.Z, Corner.Z);
+	}
+	return FAABB(Min, Max);
+}
+
+bool UBoxComponent::Intersects(const UShapeComponent* Other) const
+{
+	switch (Other->GetShapeType())
+	{
+	case EShapeType::Box:
+		return CachedBound.Intersects(Cast<UBoxComponent>(Other)->CachedBound);
+	case EShapeType::Sphere:
+		return Collision::Intersects(CachedBound, Cast<USphereComponent>(Other)->GetBoundingSphere());
+	case EShapeType::Capsule:
+		return Collision::Intersects(CachedBound, Cast<UCapsuleComponent>(Other)->GetBoundingCapsule());
+	default:
+		return false;
+	}
+}
+
+void UBoxComponent::UpdateBound()
+{
+	const FAABB LocalAABB(-BoxExtent, BoxExtent);
+	CachedBound = FOBB(LocalAABB, GetWorldMatrix());
+}
+
+// ───── USphereComponent ────────────────────────────
+
+void USphereComponent::SetRadius(const float InRadius)
+{
+	Radius = InRadius;
+	UpdateBound();
+}
+
+FAABB USphereComponent::GetWorldAABB()
+{
+	const FVector Center = CachedBound.GetCenter();
+	const float R = CachedBound.GetRadius();
+	return FAABB(Center - FVector(R, R, R), Center + FVector(R, R, R));
+}
+
+bool USphereComponent::Intersects(const UShapeComponent* Other) const
+{
+	switch (Other->GetShapeType())
+	{
+	case EShapeType::Box:
+		return Collision::Intersects(Cast<UBoxComponent>(Other)->GetOBB(), CachedBound);
+	case EShapeType::Sphere:
+		return CachedBound.Intersects(Cast<USphereComponent>(Other)->GetBoundingSphere());
+	case EShapeType::Capsule:
+		return Collision::Intersects(CachedBound, Cast<UCapsuleComponent>(Other)->GetBoundingCapsule());
+	default:
+		return false;
+	}
+}
+
+void USphereComponent::UpdateBound()
+{
+	CachedBound = FBoundingSphere(GetWorldLocation(), Radius);
+}
+
+// ───── UCapsuleComponent ────────────────────────────
+
+FAABB UCapsuleComponent::GetWorldAABB()
+{
+	const FVector Axis = CachedBound.GetAxis();
+	const FVector Center = CachedBound.GetCenter();
+	const float HalfHeight = CachedBound.GetHalfHeight();
+	const float Radius = CachedBound.GetRadius();
+
+	const FVector CapStart = Center - Axis * HalfHeight;
+	const FVector CapEnd = Center + Axis * HalfHeight;
+	return FAABB(CapStart.ComponentMin(CapEnd) - FVector(Radius, Radius, Radius), CapStart.ComponentMax(CapEnd) + FVector(Radius, Radius, Radius));
+}
+
+bool UCapsuleComponent::Intersects(const UShapeComponent* Other) const
+{
+	switch (Other->GetShapeType())
+	{
+	case EShapeType::Box:
+		return Collision::Intersects(Cast<UBoxComponent>(Other)->GetOBB(), CachedBound);
+	case EShapeType::Sphere:
+		return Collision::Intersects(Cast<USphereComponent>(Other)->GetBoundingSphere(), CachedBound);
+	case EShapeType::Capsule:
+		return CachedBound.Intersects(Cast<UCapsuleComponent>(Other)->GetBoundingCapsule());
+	default:
+		return false;
+	}
+}
+
+void UCapsuleComponent::UpdateBound()
+{
+	FVector Axis = GetWorldRotation().GetUpVector();
+	Axis.Normalize();
+	if (Axis.SizeSquared() < KINDA_SMALL_NUMBER)
+	{
+		Axis = FVector(0.0f, 0.0f, 1.0f);
+	}
+	CachedBound = FBoundingCapsule(GetWorldLocation(), Axis, CapsuleHalfHeight, CapsuleRadius);
+}
+
+// ───── UResourceManager ────────────────────────────
+
+UResourceManager& UResourceManager::GetInstance()
+{
+	static UResourceManager Instance;
+	return Instance;
+}
+
+FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const FStaticMesh* StaticMeshAsset)
+{
+	if (FMeshBVH** Found = MeshBVHCache.Find(ObjPath))
+	{
+		return *Found;
+	}
+	if (!StaticMeshAsset)
+	{
+		return nullptr;
+	}
+
+	FMeshBVH* BVH = new FMeshBVH();
+	BVH->Build(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
+	MeshBVHCache.Add(ObjPath, BVH);
+	return BVH;
+}
+
+void UResourceManager::Clear()
+{
+	for (auto& Pair : MeshBVHCache)
+	{
+		delete Pair.second;
+	}
+	MeshBVHCache.Empty();
+}
+
+// ───── CPickingSystem ────────────────────────────
+
+bool CPickingSystem::CheckActorPicking(const AActor* Actor, const FRay& Ray, float& OutDistance)
+{
+	if (!Actor) return false;
+
+	for (USceneComponent* SceneComponent : Actor->GetSceneComponents())
+	{
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(SceneComponent);
+		if (!StaticMeshComponent) continue;
+
+		UStaticMesh* MeshRes = StaticMeshComponent->GetStaticMesh();
+		if (!MeshRes) continue;
+
+		FStaticMesh* StaticMesh = MeshRes->GetStaticMeshAsset();
+		if (!StaticMesh) continue;
+
+		// 로컬 공간에서의 레이로 변환
+		const FMatrix WorldMatrix = StaticMeshComponent->GetWorldMatrix();
+		const FMatrix InvWorld = WorldMatrix.InverseAffine();
+		const FVector4 RayOrigin4(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z, 1.0f);
+		const FVector4 RayDir4(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z, 0.0f);
+		const FVector4 LocalOrigin4 = RayOrigin4 * InvWorld;
+		const FVector4 LocalDir4 = RayDir4 * InvWorld;
+		const FRay LocalRay{ FVector(LocalOrigin4.X, LocalOrigin4.Y, LocalOrigin4.Z), FVector(LocalDir4.X, LocalDir4.Y, LocalDir4.Z) };
+
+		FMeshBVH* BVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshRes->GetAssetPathFileName(), StaticMesh);
+		float THitLocal;
+		if (BVH && BVH->IntersectRay(LocalRay, StaticMesh->Vertices, StaticMesh->Indices, THitLocal))
+		{
+			const FVector4 HitLocal4(LocalOrigin4.X + LocalDir4.X * THitLocal, LocalOrigin4.Y + LocalDir4.Y * THitLocal, LocalOrigin4.Z + LocalDir4.Z * THitLocal, 1.0f);
+			const FVector4 HitWorld4 = HitLocal4 * WorldMatrix;
+			OutDistance = (FVector(HitWorld4.X, HitWorld4.Y, HitWorld4.Z) - Ray.Origin).Size();
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,52 @@
+﻿#pragma once
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdint>
+
+/**
+ * 독립 공간 벤치마크 빌드용 Windows API 대체
+ * PlatformTime.h가 쓰는 QueryPerformanceCounter / QueryPerformanceFrequency를 steady_clock으로,
+ * <windows.h>의 IN / OUT 주석 매크로를 빈 매크로로 제공합니다.
+ */
+
+#ifndef IN
+#define IN
+#endif
+#ifndef OUT
+#define OUT
+#endif
+
+union LARGE_INTEGER
+{
+	struct
+	{
+		uint32_t LowPart;
+		int32_t HighPart;
+	};
+	long long QuadPart;
+};
+
+inline bool QueryPerformanceFrequency(LARGE_INTEGER* OutFrequency)
+{
+	OutFrequency->QuadPart = static_cast<long long>(std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num);
+	return true;
+}
+
+inline bool QueryPerformanceCounter(LARGE_INTEGER* OutCounter)
+{
+	OutCounter->QuadPart = static_cast<long long>(std::chrono::steady_clock::now().time_since_epoch().count());
+	return true;
+}
+
+struct FBenchmarkLog
+{
+	static void Log(const char* InFormat, ...)
+	{
+		va_list Args;
+		va_start(Args, InFormat);
+		std::vprintf(InFormat, Args);
+		va_end(Args);
+		std::putchar('\n');
+	}
+};
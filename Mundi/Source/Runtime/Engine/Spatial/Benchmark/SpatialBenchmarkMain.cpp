@@ -0,0 +1,39 @@
+﻿#include "pch.h"
+#include "SpatialBenchmark.h"
+#include "ResourceManager.h"
+#include "JobSystem.h"
+
+/**
+ * 독립 공간 벤치마크 진입점 (Linux, D3D11 / 에디터 없음)
+ * 에디터의 -SpatialBenchmark 모드와 같은 FSpatialBenchmark를 돌리고 같은 CSV / JSON을 씁니다.
+ * 인자는 에디터와 같은 옵션을 받습니다. (-SpatialBenchmark 플래그는 생략 가능)
+ *
+ *   cmake -S Source/Runtime/Engine/Spatial/Benchmark -B Build/SpatialBenchmark -DCMAKE_BUILD_TYPE=Release
+ *   cmake --build Build/SpatialBenchmark
+ *   Build/SpatialBenchmark/SpatialBenchmark -BenchmarkCounts=1000,10000 -BenchmarkOutput=Saved/Benchmark
+ */
+int main(int argc, char** argv)
+{
+	FString CmdLine = "-SpatialBenchmark";
+	for (int i = 1; i < argc; ++i)
+	{
+		CmdLine += " ";
+		CmdLine += argv[i];
+	}
+
+	FSpatialBenchmarkConfig Config;
+	FSpatialBenchmark::ParseCommandLine(CmdLine, Config);
+
+	FJobSystem::GetInstance().Initialize();
+
+	bool bSucceeded = false;
+	{
+		FSpatialBenchmark Benchmark(Config);
+		bSucceeded = Benchmark.Run();
+	}
+
+	FJobSystem::GetInstance().Shutdown();
+	UResourceManager::GetInstance().Clear();
+	ObjectFactory::DeleteAll();
+	return bSucceeded ? 0 : 1;
+}
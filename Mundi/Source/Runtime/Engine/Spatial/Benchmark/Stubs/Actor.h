@@ -0,0 +1,56 @@
+﻿#pragma once
+#include "Object.h"
+#include "Vector.h"
+#include "SceneComponent.h"
+#include "AABB.h"
+
+/**
+ * 독립 공간 벤치마크용 AActor 대체
+ * 루트 컴포넌트 변환과 BVH / Octree / 피킹이 읽는 표시 상태만 둡니다.
+ */
+class AActor : public UObject
+{
+public:
+	DECLARE_CLASS(AActor, UObject)
+
+	USceneComponent* GetRootComponent() const { return RootComponent; }
+	const TArray<USceneComponent*>& GetSceneComponents() const { return SceneComponents; }
+
+	void SetActorLocation(const FVector& NewLocation)
+	{
+		if (RootComponent)
+		{
+			RootComponent->SetWorldLocation(NewLocation);
+		}
+	}
+	FVector GetActorLocation() const { return RootComponent ? RootComponent->GetWorldLocation() : FVector(); }
+
+	void SetActorScale(const FVector& NewScale)
+	{
+		if (RootComponent)
+		{
+			RootComponent->SetWorldScale(NewScale);
+		}
+	}
+
+	virtual FAABB GetBounds() const { return FAABB(); }
+
+	void SetCulled(bool InCulled) { bIsCulled = InCulled; }
+	bool GetCulled() const { return bIsCulled; }
+	bool GetActorHiddenInEditor() const { return bHiddenInEditor; }
+
+	template<typename T>
+	T* CreateDefaultSubobject(const char* InSubobjectName)
+	{
+		T* Comp = ObjectFactory::NewObject<T>();
+		Comp->SetOwner(this);
+		SceneComponents.Add(Comp);
+		return Comp;
+	}
+
+protected:
+	USceneComponent* RootComponent = nullptr;
+	TArray<USceneComponent*> SceneComponents;
+	bool bIsCulled = false;
+	bool bHiddenInEditor = false;
+};
@@ -0,0 +1,17 @@
+﻿#pragma once
+#include "Object.h"
+
+class AActor;
+
+/** 독립 공간 벤치마크용 UActorComponent 대체 (소유 액터만 보관) */
+class UActorComponent : public UObject
+{
+public:
+	DECLARE_CLASS(UActorComponent, UObject)
+
+	void SetOwner(AActor* InOwner) { Owner = InOwner; }
+	AActor* GetOwner() const { return Owner; }
+
+private:
+	AActor* Owner = nullptr;
+};
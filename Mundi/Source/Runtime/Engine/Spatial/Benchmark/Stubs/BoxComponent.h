@@ -0,0 +1,25 @@
+﻿#pragma once
+#include "ShapeComponent.h"
+#include "OBB.h"
+
+/** 독립 공간 벤치마크용 UBoxComponent 대체 (바운드 / 교차 계산은 엔진 BoxComponent.cpp와 동일) */
+class UBoxComponent : public UShapeComponent
+{
+public:
+	DECLARE_CLASS(UBoxComponent, UShapeComponent)
+
+	UBoxComponent() { UpdateBound(); }
+
+	EShapeType GetShapeType() const override { return EShapeType::Box; }
+	FAABB GetWorldAABB() override;
+	bool Intersects(const UShapeComponent* Other) const override;
+	void UpdateBound() override;
+
+	void SetExtent(const FVector& InExtent);
+	FVector GetExtent() const { return BoxExtent; }
+	const FOBB& GetOBB() const { return CachedBound; }
+
+private:
+	FVector BoxExtent = FVector(1.0f, 1.0f, 1.0f); // Half Extent
+	FOBB CachedBound;
+};
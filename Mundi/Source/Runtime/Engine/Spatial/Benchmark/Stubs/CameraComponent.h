@@ -0,0 +1,21 @@
+﻿#pragma once
+#include "Vector.h"
+
+/**
+ * 독립 공간 벤치마크용 UCameraComponent 대체
+ * Frustum.cpp의 카메라 기반 프러스텀 생성이 컴파일되도록 게터만 둡니다. 벤치마크는 호출하지 않습니다.
+ */
+class UCameraComponent
+{
+public:
+	float GetNearClip() const { return 0.1f; }
+	float GetFarClip() const { return 1000.0f; }
+	float GetAspectRatio() const { return 1.0f; }
+	float GetFOV() const { return 90.0f; }
+	FVector GetWorldLocation() const { return FVector(); }
+	FVector GetForward() const { return FVector(1, 0, 0); }
+	FVector GetRight() const { return FVector(0, 1, 0); }
+	FVector GetUp() const { return FVector(0, 0, 1); }
+	FMatrix GetViewMatrix() const { return FMatrix::Identity(); }
+	FMatrix GetProjectionMatrix() const { return FMatrix::Identity(); }
+};
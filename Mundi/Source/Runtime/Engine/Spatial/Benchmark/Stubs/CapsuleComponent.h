@@ -0,0 +1,24 @@
+﻿#pragma once
+#include "ShapeComponent.h"
+#include "BoundingCapsule.h"
+
+/** 독립 공간 벤치마크용 UCapsuleComponent 대체 (바운드 / 교차 계산은 엔진 CapsuleComponent.cpp와 동일) */
+class UCapsuleComponent : public UShapeComponent
+{
+public:
+	DECLARE_CLASS(UCapsuleComponent, UShapeComponent)
+
+	UCapsuleComponent() { UpdateBound(); }
+
+	EShapeType GetShapeType() const override { return EShapeType::Capsule; }
+	FAABB GetWorldAABB() override;
+	bool Intersects(const UShapeComponent* Other) const override;
+	void UpdateBound() override;
+
+	const FBoundingCapsule& GetBoundingCapsule() const { return CachedBound; }
+
+private:
+	float CapsuleHalfHeight = 1.0f;
+	float CapsuleRadius = 1.0f;
+	FBoundingCapsule CachedBound;
+};
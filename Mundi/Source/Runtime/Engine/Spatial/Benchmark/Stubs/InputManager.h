@@ -0,0 +1,2 @@
+﻿#pragma once
+// 독립 공간 벤치마크용: Picking.h가 포함하지만 레이 / 교차 선언만 쓰므로 비워 둠
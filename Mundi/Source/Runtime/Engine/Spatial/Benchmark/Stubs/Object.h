@@ -0,0 +1,112 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * 독립 공간 벤치마크용 UObject 최소 구현
+ * 엔진 Object.h는 리플렉션 / 직렬화 / GUObjectArray / 슬랩 할당기를 함께 끌어오므로,
+ * 공간 분할 코드가 쓰는 타입 정보(StaticClass / IsA / Cast)와 생성 / 일괄 삭제만 남깁니다.
+ */
+
+struct UClass
+{
+	const char* Name = nullptr;
+	const UClass* Super = nullptr;
+
+	bool IsChildOf(const UClass* InBase) const
+	{
+		for (const UClass* Class = this; Class; Class = Class->Super)
+		{
+			if (Class == InBase)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+class UObject
+{
+public:
+	using ThisClass_t = UObject;
+
+	UObject() = default;
+	virtual ~UObject() = default;
+
+	static UClass* StaticClass()
+	{
+		static UClass Cls{ "UObject", nullptr };
+		return &Cls;
+	}
+	virtual UClass* GetClass() const { return UObject::StaticClass(); }
+
+	template<class T>
+	bool IsA() const { return GetClass()->IsChildOf(T::StaticClass()); }
+
+	// TWeakPtr(WeakPtr.h)용. 벤치마크에서는 객체를 중간에 지우지 않으므로 세대 번호는 항상 1
+	uint32 InternalIndex = 0;
+	static uint32 GetSerialNumberFromIndex(uint32 Index) { return 1; }
+	static UObject* GetObjectFromIndex(uint32 Index, uint32 SerialNumber);
+};
+
+#define DECLARE_CLASS(ThisClass, SuperClass)                                  \
+public:                                                                       \
+    using Super_t = SuperClass;                                               \
+    using Super   = SuperClass;                                               \
+    using ThisClass_t = ThisClass;                                            \
+    static UClass* StaticClass()                                              \
+    {                                                                         \
+        static UClass Cls{ #ThisClass, SuperClass::StaticClass() };           \
+        return &Cls;                                                          \
+    }                                                                         \
+    virtual UClass* GetClass() const override { return ThisClass::StaticClass(); }
+
+// 팩토리 등록은 이름 기반 생성에만 쓰이므로 벤치마크에서는 필요 없음
+#define IMPLEMENT_CLASS(ThisClass)
+
+template<class T>
+T* Cast(UObject* Obj) noexcept
+{
+	return (Obj && Obj->IsA<T>()) ? static_cast<T*>(Obj) : nullptr;
+}
+template<class T>
+const T* Cast(const UObject* Obj) noexcept
+{
+	return (Obj && Obj->IsA<T>()) ? static_cast<const T*>(Obj) : nullptr;
+}
+
+namespace ObjectFactory
+{
+	/** NewObject로 만든 객체 목록. DeleteAll이 생성 역순으로 지움 */
+	inline TArray<UObject*>& GetCreatedObjects()
+	{
+		static TArray<UObject*> CreatedObjects;
+		return CreatedObjects;
+	}
+
+	template<class T>
+	T* NewObject()
+	{
+		T* Object = new T();
+		Object->InternalIndex = static_cast<uint32>(GetCreatedObjects().Num());
+		GetCreatedObjects().Add(Object);
+		return Object;
+	}
+
+	inline void DeleteAll()
+	{
+		TArray<UObject*>& CreatedObjects = GetCreatedObjects();
+		for (auto It = CreatedObjects.rbegin(); It != CreatedObjects.rend(); ++It)
+		{
+			delete *It;
+		}
+		CreatedObjects.Empty();
+	}
+}
+using namespace ObjectFactory;
+
+inline UObject* UObject::GetObjectFromIndex(uint32 Index, uint32 SerialNumber)
+{
+	const TArray<UObject*>& CreatedObjects = ObjectFactory::GetCreatedObjects();
+	return Index < static_cast<uint32>(CreatedObjects.Num()) ? CreatedObjects[Index] : nullptr;
+}
@@ -0,0 +1,9 @@
+﻿#pragma once
+#include "SceneComponent.h"
+
+/** 독립 공간 벤치마크용 UPrimitiveComponent 대체 */
+class UPrimitiveComponent : public USceneComponent
+{
+public:
+	DECLARE_CLASS(UPrimitiveComponent, USceneComponent)
+};
@@ -0,0 +1,13 @@
+﻿#pragma once
+#include "Vector.h"
+
+/**
+ * 독립 공간 벤치마크용 URenderer 대체
+ * BVH / Octree / WorldPhysics의 디버그 드로우가 컴파일되도록 라인 추가 함수만 둡니다. (아무것도 그리지 않음)
+ */
+class URenderer
+{
+public:
+	void AddLine(const FVector& Start, const FVector& End, const FVector4& Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f)) {}
+	void AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors) {}
+};
@@ -0,0 +1,23 @@
+﻿#pragma once
+#include "Object.h"
+
+class FMeshBVH;
+struct FStaticMesh;
+
+/**
+ * 독립 공간 벤치마크용 UResourceManager 대체
+ * 정밀 피킹이 쓰는 메시 BVH 캐시(경로별 1회 빌드)만 둡니다. 디스크 DDC 캐시는 쓰지 않습니다.
+ */
+class UResourceManager
+{
+public:
+	static UResourceManager& GetInstance();
+
+	FMeshBVH* GetOrBuildMeshBVH(const FString& ObjPath, const FStaticMesh* StaticMeshAsset);
+
+	// 벤치마크 메시 데이터와 BVH 해제
+	void Clear();
+
+private:
+	TMap<FString, FMeshBVH*> MeshBVHCache;
+};
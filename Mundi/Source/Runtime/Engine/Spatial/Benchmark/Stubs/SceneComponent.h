@@ -0,0 +1,56 @@
+﻿#pragma once
+#include "ActorComponent.h"
+#include "Vector.h"
+
+/**
+ * 독립 공간 벤치마크용 USceneComponent 대체
+ * 부착 계층이 없으므로 월드 변환 = 상대 변환이고, 엔진과 같이 월드 행렬을 캐시해 두었다가 변환이 바뀔 때만 다시 만듭니다.
+ */
+class USceneComponent : public UActorComponent
+{
+public:
+	DECLARE_CLASS(USceneComponent, UActorComponent)
+
+	const FTransform& GetWorldTransform() const { return WorldTransform; }
+	void SetWorldTransform(const FTransform& InTransform)
+	{
+		WorldTransform = InTransform;
+		bWorldMatrixDirty = true;
+		OnTransformUpdated();
+	}
+
+	FMatrix GetWorldMatrix() const
+	{
+		if (bWorldMatrixDirty)
+		{
+			CachedWorldMatrix = WorldTransform.ToMatrix();
+			bWorldMatrixDirty = false;
+		}
+		return CachedWorldMatrix;
+	}
+
+	void SetWorldLocation(const FVector& InLocation)
+	{
+		FTransform Transform = WorldTransform;
+		Transform.Translation = InLocation;
+		SetWorldTransform(Transform);
+	}
+	FVector GetWorldLocation() const { return WorldTransform.Translation; }
+	FQuat GetWorldRotation() const { return WorldTransform.Rotation; }
+
+	void SetWorldScale(const FVector& InScale)
+	{
+		FTransform Transform = WorldTransform;
+		Transform.Scale3D = InScale;
+		SetWorldTransform(Transform);
+	}
+	FVector GetWorldScale() const { return WorldTransform.Scale3D; }
+
+protected:
+	virtual void OnTransformUpdated() {}
+
+private:
+	FTransform WorldTransform;
+	mutable FMatrix CachedWorldMatrix = FMatrix::Identity();
+	mutable bool bWorldMatrixDirty = false;
+};
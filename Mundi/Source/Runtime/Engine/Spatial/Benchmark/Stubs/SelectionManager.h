@@ -0,0 +1,12 @@
+﻿#pragma once
+
+class AActor;
+class UActorComponent;
+
+/** 독립 공간 벤치마크용 USelectionManager 대체 (선택된 항목 없음) */
+class USelectionManager
+{
+public:
+	bool IsActorSelected(AActor* Actor) const { return false; }
+	UActorComponent* GetSelectedActorComponent() const { return nullptr; }
+};
@@ -0,0 +1,37 @@
+﻿#pragma once
+#include "PrimitiveComponent.h"
+#include "Color.h"
+#include "AABB.h"
+
+enum class EShapeType : uint8
+{
+	None,
+	Box,
+	Sphere,
+	Capsule
+};
+
+/**
+ * 독립 공간 벤치마크용 UShapeComponent 대체
+ * 충돌 BVH / WorldPhysics가 쓰는 형상 인터페이스만 두고, Lua / 직렬화 / 월드 등록은 뺐습니다.
+ */
+class UShapeComponent : public UPrimitiveComponent
+{
+public:
+	DECLARE_CLASS(UShapeComponent, UPrimitiveComponent)
+
+	FLinearColor GetShapeColor() const { return ShapeColor; }
+	bool IsDrawOnlyWhenSelected() const { return bDrawOnlyIfSelected; }
+
+	virtual FAABB GetWorldAABB() { return FAABB(); }
+	virtual EShapeType GetShapeType() const { return EShapeType::None; }
+	virtual void UpdateBound() {}
+
+	virtual bool Intersects(const UShapeComponent* Other) const { return false; }
+
+protected:
+	void OnTransformUpdated() override { UpdateBound(); }
+
+	FLinearColor ShapeColor = FLinearColor(1.0f, 0.34f, 0.28f);
+	bool bDrawOnlyIfSelected = false;
+};
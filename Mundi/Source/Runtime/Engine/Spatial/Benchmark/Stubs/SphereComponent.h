@@ -0,0 +1,25 @@
+﻿#pragma once
+#include "ShapeComponent.h"
+#include "BoundingSphere.h"
+
+/** 독립 공간 벤치마크용 USphereComponent 대체 (바운드 / 교차 계산은 엔진 SphereComponent.cpp와 동일) */
+class USphereComponent : public UShapeComponent
+{
+public:
+	DECLARE_CLASS(USphereComponent, UShapeComponent)
+
+	USphereComponent() { UpdateBound(); }
+
+	EShapeType GetShapeType() const override { return EShapeType::Sphere; }
+	FAABB GetWorldAABB() override;
+	bool Intersects(const UShapeComponent* Other) const override;
+	void UpdateBound() override;
+
+	void SetRadius(const float InRadius);
+	float GetRadius() const { return Radius; }
+	const FBoundingSphere& GetBoundingSphere() const { return CachedBound; }
+
+private:
+	float Radius = 1.0f;
+	FBoundingSphere CachedBound;
+};
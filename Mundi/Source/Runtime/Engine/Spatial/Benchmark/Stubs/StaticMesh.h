@@ -0,0 +1,26 @@
+﻿#pragma once
+#include "Object.h"
+#include "AABB.h"
+#include "Enums.h"
+#include "MeshBVH.h"
+
+/**
+ * 독립 공간 벤치마크용 UStaticMesh 대체
+ * 엔진은 OBJ를 로드하지만, 벤치마크는 메시 에셋(정점 / 인덱스)과 로컬 바운드만 넘겨받아 보관합니다.
+ */
+class UStaticMesh : public UObject
+{
+public:
+	DECLARE_CLASS(UStaticMesh, UObject)
+
+	void SetStaticMeshAsset(FStaticMesh* InStaticMeshAsset);
+
+	const FString& GetAssetPathFileName() const { return StaticMeshAsset ? StaticMeshAsset->PathFileName : FilePath; }
+	FStaticMesh* GetStaticMeshAsset() const { return StaticMeshAsset; }
+	FAABB GetLocalBound() const { return LocalBound; }
+
+private:
+	FString FilePath;
+	FStaticMesh* StaticMeshAsset = nullptr;
+	FAABB LocalBound;
+};
@@ -0,0 +1,26 @@
+﻿#pragma once
+#include "Actor.h"
+#include "StaticMeshComponent.h"
+
+/** 독립 공간 벤치마크용 AStaticMeshActor 대체 */
+class AStaticMeshActor : public AActor
+{
+public:
+	DECLARE_CLASS(AStaticMeshActor, AActor)
+
+	AStaticMeshActor()
+	{
+		StaticMeshComponent = CreateDefaultSubobject<UStaticMeshComponent>("StaticMeshComponent");
+		RootComponent = StaticMeshComponent;
+	}
+
+	UStaticMeshComponent* GetStaticMeshComponent() const { return StaticMeshComponent; }
+
+	FAABB GetBounds() const override
+	{
+		return StaticMeshComponent ? StaticMeshComponent->GetWorldAABB() : FAABB();
+	}
+
+private:
+	UStaticMeshComponent* StaticMeshComponent = nullptr;
+};
@@ -0,0 +1,25 @@
+﻿#pragma once
+#include "PrimitiveComponent.h"
+#include "AABB.h"
+
+class UStaticMesh;
+
+/**
+ * 독립 공간 벤치마크용 UStaticMeshComponent 대체
+ * 엔진 기본값(cube-tex.obj)과 같은 단위 큐브 메시를 쓰고, 월드 AABB는 엔진과 같은 방식(로컬 바운드 8꼭짓점 변환)으로 계산합니다.
+ */
+class UStaticMeshComponent : public UPrimitiveComponent
+{
+public:
+	DECLARE_CLASS(UStaticMeshComponent, UPrimitiveComponent)
+
+	UStaticMeshComponent();
+
+	void SetStaticMesh(UStaticMesh* InStaticMesh) { StaticMesh = InStaticMesh; }
+	UStaticMesh* GetStaticMesh() const { return StaticMesh; }
+
+	FAABB GetWorldAABB() const;
+
+private:
+	UStaticMesh* StaticMesh = nullptr;
+};
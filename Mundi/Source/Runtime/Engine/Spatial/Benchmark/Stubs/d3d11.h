@@ -0,0 +1,24 @@
+﻿#pragma once
+
+/**
+ * 독립 공간 벤치마크용 <d3d11.h> 대체
+ * Enums.h가 리소스 구조체 멤버로만 쓰는 D3D 타입을 불완전 타입으로 선언합니다. (정점 / 메시 구조체만 사용)
+ */
+
+struct ID3D11Buffer;
+struct ID3D11InputLayout;
+struct ID3D11VertexShader;
+struct ID3D11PixelShader;
+struct ID3D11Resource;
+struct ID3D11ShaderResourceView;
+struct ID3D11BlendState;
+
+enum D3D11_PRIMITIVE_TOPOLOGY
+{
+	D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+	D3D11_PRIMITIVE_TOPOLOGY_POINTLIST = 1,
+	D3D11_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+	D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP = 3,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5,
+};
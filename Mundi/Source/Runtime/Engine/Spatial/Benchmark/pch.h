@@ -0,0 +1,55 @@
+﻿#pragma once
+// 독립 공간 벤치마크 빌드용 pch.h
+// 엔진 pch.h는 Windows / D3D11 / ImGui 헤더를 끌어오므로, 공간 분할 / 충돌 코드가 실제로 쓰는 표준 라이브러리와
+// 코어 헤더만 포함합니다. CMakeLists.txt가 이 디렉터리와 Stubs/를 include 경로 맨 앞에 두어
+// 엔진 소스의 #include "pch.h"와 액터 / 컴포넌트 헤더가 이쪽을 찾습니다.
+
+#include <vector>
+#include <map>
+#include <set>
+#include <unordered_set>
+#include <unordered_map>
+#include <queue>
+#include <stack>
+#include <list>
+#include <deque>
+#include <string>
+#include <array>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <cmath>
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <limits>
+#include <iostream>
+#include <fstream>
+#include <utility>
+#include <filesystem>
+#include <sstream>
+#include <iterator>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <immintrin.h>
+#include <condition_variable>
+#include <chrono>
+
+#include "PlatformShim.h"
+#include "VertexData.h"
+#include "UEContainer.h"
+#include "Vector.h"
+#include "Object.h"
+#include "WeakPtr.h"
+#include "Enums.h"
+#include "Color.h"
+#include "AABB.h"
+
+// 엔진 pch.h가 함께 끌어오는 매니저 (Stubs/의 대체 구현)
+#include "Renderer.h"
+#include "ResourceManager.h"
+
+// GlobalConsole.h의 UE_LOG와 같이 printf 형식 문자열을 받되 콘솔(stdout)에만 출력
+#define UE_LOG(fmt, ...) FBenchmarkLog::Log(fmt, ##__VA_ARGS__)
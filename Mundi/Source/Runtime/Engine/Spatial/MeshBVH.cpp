@@ -1,10 +1,237 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include "JobSystem.h"
+#include "PlatformTime.h"
+#include "WindowsBinReader.h"
+#include "WindowsBinWriter.h"
+#include <cfloat>
+#include <filesystem>
+#include <immintrin.h> // SSE / AVX 레이 탐색
 
-void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+namespace
 {
+	// Binned SAH 빌드 설정
+	constexpr uint32 SAHBinCount = 16;
+	constexpr uint32 SAHMaxLeafSize = 8;		// SAH상 분할이 손해여도 이보다 많으면 계속 분할
+	constexpr int32 SAHMaxDepth = 64;			// 퇴화한 입력에서 재귀 깊이 제한
+	constexpr uint32 ParallelSubtreeThreshold = 4096;	// 이 이상인 서브트리는 왼쪽 자식을 별도 작업으로 빌드
+	constexpr float SAHTraversalCost = 1.0f;
+	constexpr float SAHIntersectionCost = 1.0f;
+
+	FAABB MakeEmptyBounds()
+	{
+		return FAABB(FVector(FLT_MAX, FLT_MAX, FLT_MAX), FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+	}
+
+	void GrowBounds(FAABB& InOutBounds, const FAABB& InOther)
+	{
+		InOutBounds.Min = InOutBounds.Min.ComponentMin(InOther.Min);
+		InOutBounds.Max = InOutBounds.Max.ComponentMax(InOther.Max);
+	}
+
+	void GrowBounds(FAABB& InOutBounds, const FVector& InPoint)
+	{
+		InOutBounds.Min = InOutBounds.Min.ComponentMin(InPoint);
+		InOutBounds.Max = InOutBounds.Max.ComponentMax(InPoint);
+	}
+
+	// 비어 있는(Min > Max) 박스는 0
+	float GetSafeSurfaceArea(const FAABB& InBounds)
+	{
+		if (InBounds.Min.X > InBounds.Max.X)
+		{
+			return 0.0f;
+		}
+		return InBounds.GetSurfaceArea();
+	}
+
+	/**
+	 * @brief Binned SAH 빌더
+	 * 노드는 (왼쪽, 오른쪽) 쌍 단위로 원자적 카운터에서 할당하므로 서로 다른 서브트리를 동시에 빌드할 수 있고,
+	 * 각 서브트리는 TriIndices의 서로 겹치지 않는 구간만 재배치합니다.
+	 */
+	struct FMeshBVHSAHBuilder
+	{
+		TArray<FAABB> TriBounds;
+		TArray<FVector> TriCenters;
+		TArray<uint32>& TriIndices;
+		TArray<FMeshBVHNode> BuildNodes;
+		std::atomic<uint32> NodeCounter{ 1 };
+
+		explicit FMeshBVHSAHBuilder(TArray<uint32>& InTriIndices) : TriIndices(InTriIndices) {}
+
+		uint32 GetBin(uint32 TriangleID, int32 Axis, float AxisMin, float BinScale) const
+		{
+			const float Offset = (TriCenters[TriangleID][Axis] - AxisMin) * BinScale;
+			return std::min(SAHBinCount - 1, static_cast<uint32>(std::max(0.0f, Offset)));
+		}
+
+		void BuildNode(uint32 NodeIndex, uint32 Start, uint32 Count, int32 Depth)
+		{
+			FAABB Bounds = MakeEmptyBounds();
+			FAABB CenterBounds = MakeEmptyBounds();
+			for (uint32 i = Start; i < Start + Count; ++i)
+			{
+				const uint32 TriangleID = TriIndices[i];
+				GrowBounds(Bounds, TriBounds[TriangleID]);
+				GrowBounds(CenterBounds, TriCenters[TriangleID]);
+			}
+
+			FMeshBVHNode& Node = BuildNodes[NodeIndex];
+			Node.Bounds = Bounds;
+			Node.Start = Start;
+			Node.Count = Count;
+
+			if (Count <= 1 || Depth >= SAHMaxDepth)
+			{
+				return;
+			}
+
+			// 축마다 중심점을 SAHBinCount개 구간으로 나누고, 구간 경계 중 SAH 비용이 가장 낮은 평면을 찾음
+			int32 BestAxis = -1;
+			uint32 BestSplitBin = 0;
+			float BestCost = FLT_MAX;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float AxisMin = CenterBounds.Min[Axis];
+				const float AxisExtent = CenterBounds.Max[Axis] - AxisMin;
+				if (AxisExtent <= KINDA_SMALL_NUMBER)
+				{
+					continue;
+				}
+				const float BinScale = static_cast<float>(SAHBinCount) / AxisExtent;
+
+				uint32 BinCounts[SAHBinCount] = {};
+				FAABB BinBounds[SAHBinCount];
+				for (FAABB& BinBound : BinBounds)
+				{
+					BinBound = MakeEmptyBounds();
+				}
+				for (uint32 i = Start; i < Start + Count; ++i)
+				{
+					const uint32 TriangleID = TriIndices[i];
+					const uint32 Bin = GetBin(TriangleID, Axis, AxisMin, BinScale);
+					++BinCounts[Bin];
+					GrowBounds(BinBounds[Bin], TriBounds[TriangleID]);
+				}
+
+				// 오른쪽에서 왼쪽으로 누적해 평면 i (구간 i부터 오른쪽) 의 면적/개수를 구함
+				float RightAreas[SAHBinCount] = {};
+				uint32 RightCounts[SAHBinCount] = {};
+				FAABB Accumulated = MakeEmptyBounds();
+				uint32 AccumulatedCount = 0;
+				for (uint32 Bin = SAHBinCount - 1; Bin > 0; --Bin)
+				{
+					GrowBounds(Accumulated, BinBounds[Bin]);
+					AccumulatedCount += BinCounts[Bin];
+					RightAreas[Bin] = GetSafeSurfaceArea(Accumulated);
+					RightCounts[Bin] = AccumulatedCount;
+				}
+
+				Accumulated = MakeEmptyBounds();
+				AccumulatedCount = 0;
+				for (uint32 SplitBin = 1; SplitBin < SAHBinCount; ++SplitBin)
+				{
+					GrowBounds(Accumulated, BinBounds[SplitBin - 1]);
+					AccumulatedCount += BinCounts[SplitBin - 1];
+					if (AccumulatedCount == 0 || RightCounts[SplitBin] == 0)
+					{
+						continue;
+					}
+
+					const float Cost = GetSafeSurfaceArea(Accumulated) * AccumulatedCount + RightAreas[SplitBin] * RightCounts[SplitBin];
+					if (Cost < BestCost)
+					{
+						BestCost = Cost;
+						BestAxis = Axis;
+						BestSplitBin = SplitBin;
+					}
+				}
+			}
+
+			uint32 Mid = Start + Count / 2;
+			if (BestAxis >= 0)
+			{
+				const float ParentArea = GetSafeSurfaceArea(Bounds);
+				const float SplitCost = ParentArea > 0.0f
+					? SAHTraversalCost + SAHIntersectionCost * BestCost / ParentArea
+					: SAHTraversalCost + SAHIntersectionCost * Count;
+				const float LeafCost = SAHIntersectionCost * Count;
+				if (SplitCost >= LeafCost && Count <= SAHMaxLeafSize)
+				{
+					return;
+				}
+
+				const float AxisMin = CenterBounds.Min[BestAxis];
+				const float BinScale = static_cast<float>(SAHBinCount) / (CenterBounds.Max[BestAxis] - AxisMin);
+				auto SplitIt = std::partition(TriIndices.begin() + Start, TriIndices.begin() + Start + Count,
+					[&](uint32 TriangleID)
+					{
+						return GetBin(TriangleID, BestAxis, AxisMin, BinScale) < BestSplitBin;
+					});
+				Mid = static_cast<uint32>(SplitIt - TriIndices.begin());
+				if (Mid == Start || Mid == Start + Count)
+				{
+					Mid = Start + Count / 2;
+				}
+			}
+			else if (Count <= SAHMaxLeafSize)
+			{
+				// 모든 중심점이 한 점에 모여 있어 나눠도 이득이 없음
+				return;
+			}
+
+			const uint32 ChildIndex = NodeCounter.fetch_add(2, std::memory_order_relaxed);
+			Node.Left = static_cast<int>(ChildIndex);
+			Node.Right = static_cast<int>(ChildIndex + 1);
+			Node.Count = 0;
+
+			const uint32 LeftCount = Mid - Start;
+			const uint32 RightCount = Count - LeftCount;
+			if (Count >= ParallelSubtreeThreshold && FJobSystem::GetInstance().GetWorkerCount() > 0)
+			{
+				FJobRef LeftJob = FJobSystem::GetInstance().Launch([this, ChildIndex, Start, LeftCount, Depth]()
+				{
+					BuildNode(ChildIndex, Start, LeftCount, Depth + 1);
+				});
+				BuildNode(ChildIndex + 1, Mid, RightCount, Depth + 1);
+				FJobSystem::GetInstance().Wait(LeftJob);
+			}
+			else
+			{
+				BuildNode(ChildIndex, Start, LeftCount, Depth + 1);
+				BuildNode(ChildIndex + 1, Mid, RightCount, Depth + 1);
+			}
+		}
+	};
+
+	// 캐시 헤더. 빌더(분할 규칙, 리프 크기, 노드 레이아웃)가 바뀌면 Version을 올려 기존 캐시를 무효화한다
+	constexpr uint32 MeshBVHCacheMagic = 0x4856424D; // 'MBVH'
+	constexpr uint32 MeshBVHCacheVersion = 1;
+
+	struct FMeshBVHCacheHeader
+	{
+		uint32 Magic = MeshBVHCacheMagic;
+		uint32 Version = MeshBVHCacheVersion;
+		uint32 NodeSize = sizeof(FMeshBVHNode);
+		uint32 TriangleCount = 0;
+		FMeshBVHBuildStats Stats;
+	};
+
+	static_assert(std::is_trivially_copyable_v<FMeshBVHNode>, "FMeshBVHNode must be trivially copyable for bulk cache I/O");
+	static_assert(std::is_trivially_copyable_v<FMeshBVHCacheHeader>, "FMeshBVHCacheHeader must be trivially copyable for bulk cache I/O");
+}
+
+void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, EMeshBVHBuildMethod InMethod)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
 	TriIndices.Empty();
 	Nodes.Empty();
+	ChildBounds.Empty();
+	BuildStats = FMeshBVHBuildStats();
+	BuildStats.Method = InMethod;
+
 	uint32 TriCount = Indices.Num() / 3;
 	if (TriCount == 0) return;
 
@@ -12,15 +239,451 @@ void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>
 	for (uint32 t = 0; t < TriCount; ++t)
 		TriIndices.Add(t);
 
-	BuildRecursive(0, TriCount, Vertices, Indices);
+	if (InMethod == EMeshBVHBuildMethod::Median)
+	{
+		BuildRecursive(0, TriCount, Vertices, Indices);
+	}
+	else
+	{
+		FMeshBVHSAHBuilder Builder(TriIndices);
+		Builder.TriBounds.resize(TriCount);
+		Builder.TriCenters.resize(TriCount);
+		ParallelFor(static_cast<int32>(TriCount), [&](int32 TriangleID)
+		{
+			Builder.TriBounds[TriangleID] = ComputeTriBounds(TriangleID, Vertices, Indices);
+			Builder.TriCenters[TriangleID] = ComputeTriCenter(TriangleID, Vertices, Indices);
+		}, 4096);
+
+		// 이진 트리의 노드 수는 최대 2N-1
+		Builder.BuildNodes.resize(static_cast<size_t>(TriCount) * 2);
+		Builder.BuildNode(0, 0, TriCount, 0);
+		Builder.BuildNodes.resize(Builder.NodeCounter.load());
+
+		FlattenDepthFirst(Builder.BuildNodes);
+	}
+
+	ComputeBuildStats();
+	BuildChildBounds();
+	BuildStats.BuildMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+bool FMeshBVH::SaveCache(const FString& InFilePath) const
+{
+	if (Nodes.IsEmpty())
+		return false;
+
+	FMeshBVHCacheHeader Header;
+	Header.TriangleCount = static_cast<uint32>(TriIndices.Num());
+	Header.Stats = BuildStats;
+
+	FWindowsBinWriter Writer(InFilePath);
+	Writer.Serialize(&Header, sizeof(Header));
+	Serialization::WriteArray(Writer, Nodes);
+	Serialization::WriteArray(Writer, TriIndices);
+	Writer.Close();
+	return true;
+}
+
+bool FMeshBVH::LoadCache(const FString& InFilePath, uint32 InExpectedTriangleCount)
+{
+	namespace fs = std::filesystem;
+
+	TriIndices.Empty();
+	Nodes.Empty();
+	ChildBounds.Empty();
+	BuildStats = FMeshBVHBuildStats();
+
+	std::error_code Error;
+	const uintmax_t FileSize = fs::file_size(InFilePath, Error);
+	if (Error || FileSize < sizeof(FMeshBVHCacheHeader))
+		return false;
+
+	FWindowsBinReader Reader(InFilePath);
+	if (!Reader.IsOpen())
+		return false;
+
+	FMeshBVHCacheHeader Header;
+	Reader.Serialize(&Header, sizeof(Header));
+	if (Header.Magic != MeshBVHCacheMagic || Header.Version != MeshBVHCacheVersion
+		|| Header.NodeSize != sizeof(FMeshBVHNode) || Header.TriangleCount != InExpectedTriangleCount
+		|| Header.Stats.NodeCount <= 0)
+	{
+		return false;
+	}
+
+	// 잘린 파일을 읽어 쓰레기 인덱스로 탐색하지 않도록 전체 크기를 헤더 기준으로 먼저 확인
+	const uintmax_t ExpectedSize = sizeof(FMeshBVHCacheHeader)
+		+ sizeof(uint32) + static_cast<uintmax_t>(Header.Stats.NodeCount) * sizeof(FMeshBVHNode)
+		+ sizeof(uint32) + static_cast<uintmax_t>(Header.TriangleCount) * sizeof(uint32);
+	if (FileSize != ExpectedSize)
+		return false;
+
+	try
+	{
+		Serialization::ReadArray(Reader, Nodes);
+		Serialization::ReadArray(Reader, TriIndices);
+	}
+	catch (const std::exception&)
+	{
+		TriIndices.Empty();
+		Nodes.Empty();
+		return false;
+	}
+
+	if (Nodes.Num() != Header.Stats.NodeCount || TriIndices.Num() != static_cast<int32>(Header.TriangleCount)
+		|| !ValidateLoadedTree(Header.TriangleCount))
+	{
+		TriIndices.Empty();
+		Nodes.Empty();
+		return false;
+	}
+
+	BuildStats = Header.Stats;
+	BuildStats.BuildMS = 0.0;
+	BuildChildBounds();
+	return true;
 }
 
-// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
-// Möller–Trumbore로 교차 체크 ! 
+namespace
+{
+	// 탐색 스택의 고정 크기. SAH 빌드는 깊이 64로 제한되고 중앙값 빌드는 log2(삼각형 수) 수준이라 보통 넘지 않는다
+	constexpr int32 MaxTraversalStackSize = 128;
+	constexpr int32 RayPacketSize = 8;
+
+	/**
+	 * 깊이 우선 탐색용 스택. MaxTraversalStackSize까지는 지역 배열을 쓰고,
+	 * 그보다 깊은 트리(퇴화한 메시, 외부 캐시 등)는 넘치는 항목만 힙 TArray에 쌓아 범위 밖 쓰기를 막는다
+	 */
+	template<typename T>
+	struct TTraversalStack
+	{
+		T Inline[MaxTraversalStackSize];
+		int32 InlineNum = 0;
+		TArray<T> Overflow;
+
+		bool IsEmpty() const { return InlineNum == 0 && Overflow.IsEmpty(); }
+
+		void Push(const T& InItem)
+		{
+			if (InlineNum < MaxTraversalStackSize)
+			{
+				Inline[InlineNum++] = InItem;
+			}
+			else
+			{
+				Overflow.Add(InItem);
+			}
+		}
+
+		// 넘친 항목이 항상 가장 최근에 넣은 것이므로 먼저 꺼내면 LIFO 순서가 유지된다
+		T Pop()
+		{
+			if (!Overflow.IsEmpty())
+			{
+				const T Item = Overflow.back();
+				Overflow.pop_back();
+				return Item;
+			}
+			return Inline[--InlineNum];
+		}
+	};
+	constexpr int32 RayPacketsPerBatch = 8;
+
+	// 축과 평행한 방향 성분은 역수가 inf / NaN이 되지 않도록 부호를 유지한 작은 값으로 고정
+	inline float SafeInverse(float InValue)
+	{
+		const float Epsilon = 1e-6f;
+		if (std::abs(InValue) < Epsilon)
+		{
+			InValue = (InValue < 0.0f) ? -Epsilon : Epsilon;
+		}
+		return 1.0f / InValue;
+	}
+
+	/** SSE 단일 레이. 원점 / 방향 / 역방향을 4레인에 브로드캐스트 */
+	struct FRaySSE
+	{
+		__m128 OriginX, OriginY, OriginZ;
+		__m128 DirX, DirY, DirZ;
+		__m128 InvDirX, InvDirY, InvDirZ;
+
+		explicit FRaySSE(const FRay& InRay)
+		{
+			OriginX = _mm_set1_ps(InRay.Origin.X);
+			OriginY = _mm_set1_ps(InRay.Origin.Y);
+			OriginZ = _mm_set1_ps(InRay.Origin.Z);
+			DirX = _mm_set1_ps(InRay.Direction.X);
+			DirY = _mm_set1_ps(InRay.Direction.Y);
+			DirZ = _mm_set1_ps(InRay.Direction.Z);
+			InvDirX = _mm_set1_ps(SafeInverse(InRay.Direction.X));
+			InvDirY = _mm_set1_ps(SafeInverse(InRay.Direction.Y));
+			InvDirZ = _mm_set1_ps(SafeInverse(InRay.Direction.Z));
+		}
+	};
+
+	/** 리프 삼각형 최대 4개의 꼭짓점을 SoA로 모은 것. [축][레인] */
+	struct alignas(16) FTrianglePacket4
+	{
+		float A[3][4];
+		float B[3][4];
+		float C[3][4];
+	};
+
+	/**
+	 * 두 자식 AABB를 한 번에 슬랩 테스트한다. 반환값 bit0 = 왼쪽, bit1 = 오른쪽
+	 * OutEnter[0], OutEnter[1]에 각 자식의 진입 거리 (0 이상)
+	 */
+	inline int32 IntersectChildPairSSE(const FMeshBVHChildBounds& InChildren, const FRaySSE& InRay, float InMaxDistance, float OutEnter[4])
+	{
+		// 레인 { 왼쪽 Min, 오른쪽 Min, 왼쪽 Max, 오른쪽 Max } 평면까지의 거리
+		const __m128 TX = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(InChildren.X), InRay.OriginX), InRay.InvDirX);
+		const __m128 TY = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(InChildren.Y), InRay.OriginY), InRay.InvDirY);
+		const __m128 TZ = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(InChildren.Z), InRay.OriginZ), InRay.InvDirZ);
+
+		// 상위 두 레인(Max)을 하위로 내려 레인 0, 1에서 자식별 가까운 / 먼 평면을 구한다
+		const __m128 TXHigh = _mm_movehl_ps(TX, TX);
+		const __m128 TYHigh = _mm_movehl_ps(TY, TY);
+		const __m128 TZHigh = _mm_movehl_ps(TZ, TZ);
+
+		__m128 Enter = _mm_max_ps(_mm_min_ps(TX, TXHigh), _mm_min_ps(TY, TYHigh));
+		Enter = _mm_max_ps(Enter, _mm_max_ps(_mm_min_ps(TZ, TZHigh), _mm_setzero_ps()));
+
+		__m128 Exit = _mm_min_ps(_mm_max_ps(TX, TXHigh), _mm_max_ps(TY, TYHigh));
+		Exit = _mm_min_ps(Exit, _mm_min_ps(_mm_max_ps(TZ, TZHigh), _mm_set1_ps(InMaxDistance)));
+
+		_mm_storeu_ps(OutEnter, Enter);
+		return _mm_movemask_ps(_mm_cmple_ps(Enter, Exit)) & 0x3;
+	}
+
+	/**
+	 * 삼각형 최대 4개와 레이 하나의 Möller–Trumbore 검사 (IntersectRayTriangleMT와 같은 허용 오차)
+	 * InMaxDistance보다 가까운 교차가 있으면 가장 가까운 레인을 반환하고 OutDistance를 갱신, 없으면 -1
+	 */
+	inline int32 IntersectTriangles4SSE(const FTrianglePacket4& InTriangles, int32 InCount, const FRaySSE& InRay, float InMaxDistance, float& OutDistance)
+	{
+		const __m128 Epsilon = _mm_set1_ps(KINDA_SMALL_NUMBER);
+		const __m128 OnePlusEpsilon = _mm_set1_ps(1.0f + KINDA_SMALL_NUMBER);
+		const __m128 NegEpsilon = _mm_set1_ps(-KINDA_SMALL_NUMBER);
+		const __m128 SignMask = _mm_set1_ps(-0.0f);
+
+		const __m128 AX = _mm_load_ps(InTriangles.A[0]);
+		const __m128 AY = _mm_load_ps(InTriangles.A[1]);
+		const __m128 AZ = _mm_load_ps(InTriangles.A[2]);
+
+		const __m128 Edge1X = _mm_sub_ps(_mm_load_ps(InTriangles.B[0]), AX);
+		const __m128 Edge1Y = _mm_sub_ps(_mm_load_ps(InTriangles.B[1]), AY);
+		const __m128 Edge1Z = _mm_sub_ps(_mm_load_ps(InTriangles.B[2]), AZ);
+		const __m128 Edge2X = _mm_sub_ps(_mm_load_ps(InTriangles.C[0]), AX);
+		const __m128 Edge2Y = _mm_sub_ps(_mm_load_ps(InTriangles.C[1]), AY);
+		const __m128 Edge2Z = _mm_sub_ps(_mm_load_ps(InTriangles.C[2]), AZ);
+
+		// P = Dir x Edge2
+		const __m128 PX = _mm_sub_ps(_mm_mul_ps(InRay.DirY, Edge2Z), _mm_mul_ps(InRay.DirZ, Edge2Y));
+		const __m128 PY = _mm_sub_ps(_mm_mul_ps(InRay.DirZ, Edge2X), _mm_mul_ps(InRay.DirX, Edge2Z));
+		const __m128 PZ = _mm_sub_ps(_mm_mul_ps(InRay.DirX, Edge2Y), _mm_mul_ps(InRay.DirY, Edge2X));
+
+		const __m128 Determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Edge1X, PX), _mm_mul_ps(Edge1Y, PY)), _mm_mul_ps(Edge1Z, PZ));
+		__m128 Valid = _mm_cmpge_ps(_mm_andnot_ps(SignMask, Determinant), Epsilon);
+		const __m128 InvDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Determinant);
+
+		// S = Origin - A
+		const __m128 SX = _mm_sub_ps(InRay.OriginX, AX);
+		const __m128 SY = _mm_sub_ps(InRay.OriginY, AY);
+		const __m128 SZ = _mm_sub_ps(InRay.OriginZ, AZ);
+
+		const __m128 U = _mm_mul_ps(InvDeterminant, _mm_add_ps(_mm_add_ps(_mm_mul_ps(SX, PX), _mm_mul_ps(SY, PY)), _mm_mul_ps(SZ, PZ)));
+		Valid = _mm_and_ps(Valid, _mm_and_ps(_mm_cmpge_ps(U, NegEpsilon), _mm_cmple_ps(U, OnePlusEpsilon)));
+
+		// Q = S x Edge1
+		const __m128 QX = _mm_sub_ps(_mm_mul_ps(SY, Edge1Z), _mm_mul_ps(SZ, Edge1Y));
+		const __m128 QY = _mm_sub_ps(_mm_mul_ps(SZ, Edge1X), _mm_mul_ps(SX, Edge1Z));
+		const __m128 QZ = _mm_sub_ps(_mm_mul_ps(SX, Edge1Y), _mm_mul_ps(SY, Edge1X));
+
+		const __m128 V = _mm_mul_ps(InvDeterminant, _mm_add_ps(_mm_add_ps(_mm_mul_ps(InRay.DirX, QX), _mm_mul_ps(InRay.DirY, QY)), _mm_mul_ps(InRay.DirZ, QZ)));
+		Valid = _mm_and_ps(Valid, _mm_and_ps(_mm_cmpge_ps(V, NegEpsilon), _mm_cmple_ps(_mm_add_ps(U, V), OnePlusEpsilon)));
+
+		const __m128 T = _mm_mul_ps(InvDeterminant, _mm_add_ps(_mm_add_ps(_mm_mul_ps(Edge2X, QX), _mm_mul_ps(Edge2Y, QY)), _mm_mul_ps(Edge2Z, QZ)));
+		Valid = _mm_and_ps(Valid, _mm_and_ps(_mm_cmpgt_ps(T, Epsilon), _mm_cmplt_ps(T, _mm_set1_ps(InMaxDistance))));
+
+		int32 HitMask = _mm_movemask_ps(Valid) & ((1 << InCount) - 1);
+		if (HitMask == 0)
+		{
+			return -1;
+		}
+
+		alignas(16) float Distances[4];
+		_mm_store_ps(Distances, T);
+
+		int32 ClosestLane = -1;
+		for (int32 Lane = 0; Lane < InCount; ++Lane)
+		{
+			if ((HitMask & (1 << Lane)) && (ClosestLane < 0 || Distances[Lane] < Distances[ClosestLane]))
+			{
+				ClosestLane = Lane;
+			}
+		}
+		OutDistance = Distances[ClosestLane];
+		return ClosestLane;
+	}
+
+	/**
+	 * AVX 8-레이 패킷. 레인마다 레이 하나이며 MaxDistance는 레인별 현재 가장 가까운 교차 거리
+	 * 마지막 패킷의 빈 레인은 ActiveMask에서 빠지고 MaxDistance가 음수라 어떤 검사도 통과하지 않는다
+	 */
+	struct FRayPacket8
+	{
+		__m256 OriginX, OriginY, OriginZ;
+		__m256 DirX, DirY, DirZ;
+		__m256 InvDirX, InvDirY, InvDirZ;
+		__m256 MaxDistance;
+		__m256 TriangleID;	// 정수 비트를 float 레지스터에 담아 blend로 갱신
+		int32 ActiveMask = 0;
+	};
+
+	inline void LoadRayPacket8(const FRay* InRays, int32 InCount, FRayPacket8& OutPacket)
+	{
+		alignas(32) float Lanes[9][RayPacketSize];
+		alignas(32) float MaxDistances[RayPacketSize];
+		for (int32 Lane = 0; Lane < RayPacketSize; ++Lane)
+		{
+			const bool bActive = Lane < InCount;
+			const FVector Origin = bActive ? InRays[Lane].Origin : FVector(0.0f, 0.0f, 0.0f);
+			const FVector Direction = bActive ? InRays[Lane].Direction : FVector(0.0f, 0.0f, 0.0f);
+			Lanes[0][Lane] = Origin.X;
+			Lanes[1][Lane] = Origin.Y;
+			Lanes[2][Lane] = Origin.Z;
+			Lanes[3][Lane] = Direction.X;
+			Lanes[4][Lane] = Direction.Y;
+			Lanes[5][Lane] = Direction.Z;
+			Lanes[6][Lane] = SafeInverse(Direction.X);
+			Lanes[7][Lane] = SafeInverse(Direction.Y);
+			Lanes[8][Lane] = SafeInverse(Direction.Z);
+			MaxDistances[Lane] = bActive ? FLT_MAX : -1.0f;
+		}
+
+		OutPacket.OriginX = _mm256_load_ps(Lanes[0]);
+		OutPacket.OriginY = _mm256_load_ps(Lanes[1]);
+		OutPacket.OriginZ = _mm256_load_ps(Lanes[2]);
+		OutPacket.DirX = _mm256_load_ps(Lanes[3]);
+		OutPacket.DirY = _mm256_load_ps(Lanes[4]);
+		OutPacket.DirZ = _mm256_load_ps(Lanes[5]);
+		OutPacket.InvDirX = _mm256_load_ps(Lanes[6]);
+		OutPacket.InvDirY = _mm256_load_ps(Lanes[7]);
+		OutPacket.InvDirZ = _mm256_load_ps(Lanes[8]);
+		OutPacket.MaxDistance = _mm256_load_ps(MaxDistances);
+		OutPacket.TriangleID = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		OutPacket.ActiveMask = (1 << InCount) - 1;
+	}
+
+	/** 노드 AABB 하나와 8개 레이의 슬랩 테스트. 아직 이 노드 안에서 더 가까운 교차가 가능한 레인 마스크 */
+	inline int32 IntersectAABBPacket8(const FAABB& InBounds, const FRayPacket8& InPacket)
+	{
+		const __m256 TMinX = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(InBounds.Min.X), InPacket.OriginX), InPacket.InvDirX);
+		const __m256 TMaxX = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(InBounds.Max.X), InPacket.OriginX), InPacket.InvDirX);
+		const __m256 TMinY = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(InBounds.Min.Y), InPacket.OriginY), InPacket.InvDirY);
+		const __m256 TMaxY = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(InBounds.Max.Y), InPacket.OriginY), InPacket.InvDirY);
+		const __m256 TMinZ = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(InBounds.Min.Z), InPacket.OriginZ), InPacket.InvDirZ);
+		const __m256 TMaxZ = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(InBounds.Max.Z), InPacket.OriginZ), InPacket.InvDirZ);
+
+		__m256 Enter = _mm256_max_ps(_mm256_min_ps(TMinX, TMaxX), _mm256_min_ps(TMinY, TMaxY));
+		Enter = _mm256_max_ps(Enter, _mm256_max_ps(_mm256_min_ps(TMinZ, TMaxZ), _mm256_setzero_ps()));
+
+		__m256 Exit = _mm256_min_ps(_mm256_max_ps(TMinX, TMaxX), _mm256_max_ps(TMinY, TMaxY));
+		Exit = _mm256_min_ps(Exit, _mm256_min_ps(_mm256_max_ps(TMinZ, TMaxZ), InPacket.MaxDistance));
+
+		return _mm256_movemask_ps(_mm256_cmp_ps(Enter, Exit, _CMP_LE_OQ)) & InPacket.ActiveMask;
+	}
+
+	/** 삼각형 하나와 8개 레이의 Möller–Trumbore 검사. 더 가까운 교차를 찾은 레인의 거리 / 삼각형 ID를 갱신 */
+	inline void IntersectTrianglePacket8(const FVector& InA, const FVector& InB, const FVector& InC, uint32 InTriangleID, FRayPacket8& InOutPacket)
+	{
+		const __m256 Epsilon = _mm256_set1_ps(KINDA_SMALL_NUMBER);
+		const __m256 OnePlusEpsilon = _mm256_set1_ps(1.0f + KINDA_SMALL_NUMBER);
+		const __m256 NegEpsilon = _mm256_set1_ps(-KINDA_SMALL_NUMBER);
+		const __m256 SignMask = _mm256_set1_ps(-0.0f);
+
+		const FVector Edge1 = InB - InA;
+		const FVector Edge2 = InC - InA;
+		const __m256 Edge1X = _mm256_set1_ps(Edge1.X);
+		const __m256 Edge1Y = _mm256_set1_ps(Edge1.Y);
+		const __m256 Edge1Z = _mm256_set1_ps(Edge1.Z);
+		const __m256 Edge2X = _mm256_set1_ps(Edge2.X);
+		const __m256 Edge2Y = _mm256_set1_ps(Edge2.Y);
+		const __m256 Edge2Z = _mm256_set1_ps(Edge2.Z);
+
+		// P = Dir x Edge2
+		const __m256 PX = _mm256_sub_ps(_mm256_mul_ps(InOutPacket.DirY, Edge2Z), _mm256_mul_ps(InOutPacket.DirZ, Edge2Y));
+		const __m256 PY = _mm256_sub_ps(_mm256_mul_ps(InOutPacket.DirZ, Edge2X), _mm256_mul_ps(InOutPacket.DirX, Edge2Z));
+		const __m256 PZ = _mm256_sub_ps(_mm256_mul_ps(InOutPacket.DirX, Edge2Y), _mm256_mul_ps(InOutPacket.DirY, Edge2X));
+
+		const __m256 Determinant = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Edge1X, PX), _mm256_mul_ps(Edge1Y, PY)), _mm256_mul_ps(Edge1Z, PZ));
+		__m256 Valid = _mm256_cmp_ps(_mm256_andnot_ps(SignMask, Determinant), Epsilon, _CMP_GE_OQ);
+		const __m256 InvDeterminant = _mm256_div_ps(_mm256_set1_ps(1.0f), Determinant);
+
+		// S = Origin - A
+		const __m256 SX = _mm256_sub_ps(InOutPacket.OriginX, _mm256_set1_ps(InA.X));
+		const __m256 SY = _mm256_sub_ps(InOutPacket.OriginY, _mm256_set1_ps(InA.Y));
+		const __m256 SZ = _mm256_sub_ps(InOutPacket.OriginZ, _mm256_set1_ps(InA.Z));
+
+		const __m256 U = _mm256_mul_ps(InvDeterminant, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(SX, PX), _mm256_mul_ps(SY, PY)), _mm256_mul_ps(SZ, PZ)));
+		Valid = _mm256_and_ps(Valid, _mm256_and_ps(_mm256_cmp_ps(U, NegEpsilon, _CMP_GE_OQ), _mm256_cmp_ps(U, OnePlusEpsilon, _CMP_LE_OQ)));
+
+		// Q = S x Edge1
+		const __m256 QX = _mm256_sub_ps(_mm256_mul_ps(SY, Edge1Z), _mm256_mul_ps(SZ, Edge1Y));
+		const __m256 QY = _mm256_sub_ps(_mm256_mul_ps(SZ, Edge1X), _mm256_mul_ps(SX, Edge1Z));
+		const __m256 QZ = _mm256_sub_ps(_mm256_mul_ps(SX, Edge1Y), _mm256_mul_ps(SY, Edge1X));
+
+		const __m256 V = _mm256_mul_ps(InvDeterminant, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(InOutPacket.DirX, QX), _mm256_mul_ps(InOutPacket.DirY, QY)), _mm256_mul_ps(InOutPacket.DirZ, QZ)));
+		Valid = _mm256_and_ps(Valid, _mm256_and_ps(_mm256_cmp_ps(V, NegEpsilon, _CMP_GE_OQ), _mm256_cmp_ps(_mm256_add_ps(U, V), OnePlusEpsilon, _CMP_LE_OQ)));
+
+		const __m256 T = _mm256_mul_ps(InvDeterminant, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Edge2X, QX), _mm256_mul_ps(Edge2Y, QY)), _mm256_mul_ps(Edge2Z, QZ)));
+		Valid = _mm256_and_ps(Valid, _mm256_and_ps(_mm256_cmp_ps(T, Epsilon, _CMP_GT_OQ), _mm256_cmp_ps(T, InOutPacket.MaxDistance, _CMP_LT_OQ)));
+
+		if (_mm256_movemask_ps(Valid) == 0)
+		{
+			return;
+		}
+
+		InOutPacket.MaxDistance = _mm256_blendv_ps(InOutPacket.MaxDistance, T, Valid);
+		InOutPacket.TriangleID = _mm256_blendv_ps(InOutPacket.TriangleID, _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int32>(InTriangleID))), Valid);
+	}
+}
+
+void FMeshBVH::BuildChildBounds()
+{
+	ChildBounds.Empty();
+	ChildBounds.resize(Nodes.size());
+
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		const FMeshBVHNode& Node = Nodes[NodeIndex];
+		if (Node.IsLeaf())
+		{
+			continue;
+		}
+
+		// 없는 자식의 레인은 탐색 시 마스크로 걸러지므로 값은 상관없다
+		const FAABB LeftBounds = (Node.Left >= 0) ? Nodes[Node.Left].Bounds : Node.Bounds;
+		const FAABB RightBounds = (Node.Right >= 0) ? Nodes[Node.Right].Bounds : Node.Bounds;
+
+		FMeshBVHChildBounds& Children = ChildBounds[NodeIndex];
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			float* Lanes = (Axis == 0) ? Children.X : (Axis == 1) ? Children.Y : Children.Z;
+			Lanes[0] = LeftBounds.Min[Axis];
+			Lanes[1] = RightBounds.Min[Axis];
+			Lanes[2] = LeftBounds.Max[Axis];
+			Lanes[3] = RightBounds.Max[Axis];
+		}
+	}
+}
+
+// 가장 가까운 교차를 찾는다. 스택 깊이 우선 탐색으로 가까운 자식부터 내려가고,
+// 이미 찾은 교차보다 먼 노드는 진입 거리만 보고 건너뛴다
 bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
 	const TArray<FNormalVertex>& InVertices,
 	const TArray<uint32>& InIndices,
-	float& OutHitDistance)
+	float& OutHitDistance) const
 {
 	if (Nodes.Num() == 0)
 	{
@@ -33,69 +696,169 @@ bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
 		return false;
 	}
 
-	struct FHeapItem
-	{
-		int NodeIndex;
-		float EntryDistance;
-
-		bool operator>(const FHeapItem& Other) const
-		{
-			return EntryDistance > Other.EntryDistance; // 최소 힙
-		}
-	};
+	const FRaySSE Ray(InLocalRay);
+	float ClosestDistance = FLT_MAX;
+	bool bHasHit = false;
 
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
-	Heap.push({ 0, RootEntry });
+	TTraversalStack<FStackItem> Stack;
+	Stack.Push({ 0, RootEntry });
 
-	while (!Heap.empty())
+	while (!Stack.IsEmpty())
 	{
-		FHeapItem Current = Heap.top();
-		Heap.pop();
+		const FStackItem Current = Stack.Pop();
+		if (Current.EntryDistance > ClosestDistance)
+		{
+			continue;
+		}
 
 		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
 		if (Node.IsLeaf())
 		{
-			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
+			for (uint32 Base = 0; Base < Node.Count; Base += 4)
 			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
+				const int32 Count = static_cast<int32>(std::min<uint32>(4, Node.Count - Base));
 
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+				FTrianglePacket4 Triangles = {};
+				for (int32 Lane = 0; Lane < Count; ++Lane)
+				{
+					const uint32 TriangleID = TriIndices[Node.Start + Base + Lane];
+					const FVector& A = InVertices[InIndices[3 * TriangleID + 0]].pos;
+					const FVector& B = InVertices[InIndices[3 * TriangleID + 1]].pos;
+					const FVector& C = InVertices[InIndices[3 * TriangleID + 2]].pos;
+					for (int32 Axis = 0; Axis < 3; ++Axis)
+					{
+						Triangles.A[Axis][Lane] = A[Axis];
+						Triangles.B[Axis][Lane] = B[Axis];
+						Triangles.C[Axis][Lane] = C[Axis];
+					}
+				}
 
-				float HitT = 0.0f;
-				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
+				float HitDistance = 0.0f;
+				if (IntersectTriangles4SSE(Triangles, Count, Ray, ClosestDistance, HitDistance) >= 0)
 				{
-					OutHitDistance = HitT;
-					return true; // 🚀 첫 번째 히트 → 바로 종료
+					ClosestDistance = HitDistance;
+					bHasHit = true;
 				}
 			}
+			continue;
 		}
-		else
+
+		float ChildEnter[4];
+		const int32 ChildMask = ((Node.Left >= 0) ? 0x1 : 0) | ((Node.Right >= 0) ? 0x2 : 0);
+		const int32 HitMask = IntersectChildPairSSE(ChildBounds[Current.NodeIndex], Ray, ClosestDistance, ChildEnter) & ChildMask;
+		if (HitMask == 0x3)
 		{
-			if (Node.Left >= 0)
+			// 가까운 자식이 먼저 꺼내지도록 먼 자식을 먼저 넣는다
+			const bool bLeftFirst = ChildEnter[0] <= ChildEnter[1];
+			const int32 Near = bLeftFirst ? Node.Left : Node.Right;
+			const int32 Far = bLeftFirst ? Node.Right : Node.Left;
+			Stack.Push({ Far, bLeftFirst ? ChildEnter[1] : ChildEnter[0] });
+			Stack.Push({ Near, bLeftFirst ? ChildEnter[0] : ChildEnter[1] });
+		}
+		else if (HitMask == 0x1)
+		{
+			Stack.Push({ Node.Left, ChildEnter[0] });
+		}
+		else if (HitMask == 0x2)
+		{
+			Stack.Push({ Node.Right, ChildEnter[1] });
+		}
+	}
+
+	if (bHasHit)
+	{
+		OutHitDistance = ClosestDistance;
+	}
+	return bHasHit;
+}
+
+int32 FMeshBVH::IntersectRays(const TArray<FRay>& InLocalRays,
+	const TArray<FNormalVertex>& InVertices,
+	const TArray<uint32>& InIndices,
+	TArray<FMeshBVHRayHit>& OutHits) const
+{
+	OutHits.Empty();
+	OutHits.resize(InLocalRays.size());
+	if (Nodes.Num() == 0 || InLocalRays.IsEmpty())
+	{
+		return 0;
+	}
+
+	const int32 NumRays = InLocalRays.Num();
+	const int32 NumPackets = (NumRays + RayPacketSize - 1) / RayPacketSize;
+
+	ParallelFor(NumPackets, [&](int32 PacketIndex)
+	{
+		const int32 FirstRay = PacketIndex * RayPacketSize;
+		const int32 Count = std::min(RayPacketSize, NumRays - FirstRay);
+
+		FRayPacket8 Packet;
+		LoadRayPacket8(&InLocalRays[FirstRay], Count, Packet);
+
+		// 패킷 전체가 같은 순서로 내려가므로 자식 순서는 첫 레이 기준으로 정한다
+		const FRay& LeadRay = InLocalRays[FirstRay];
+
+		TTraversalStack<int32> Stack;
+		Stack.Push(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const FMeshBVHNode& Node = Nodes[Stack.Pop()];
+			if (IntersectAABBPacket8(Node.Bounds, Packet) == 0)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Left, ChildEntry });
-				}
+				continue;
 			}
-			if (Node.Right >= 0)
+
+			if (Node.IsLeaf())
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
+				for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
 				{
-					Heap.push({ Node.Right, ChildEntry });
+					const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
+					const FVector& A = InVertices[InIndices[3 * TriangleID + 0]].pos;
+					const FVector& B = InVertices[InIndices[3 * TriangleID + 1]].pos;
+					const FVector& C = InVertices[InIndices[3 * TriangleID + 2]].pos;
+					IntersectTrianglePacket8(A, B, C, TriangleID, Packet);
 				}
+				continue;
+			}
+
+			if (Node.Left >= 0 && Node.Right >= 0)
+			{
+				const float LeftDistance = FVector::Dot(Nodes[Node.Left].Bounds.GetCenter() - LeadRay.Origin, LeadRay.Direction);
+				const float RightDistance = FVector::Dot(Nodes[Node.Right].Bounds.GetCenter() - LeadRay.Origin, LeadRay.Direction);
+				const bool bLeftFirst = LeftDistance <= RightDistance;
+				Stack.Push(bLeftFirst ? Node.Right : Node.Left);
+				Stack.Push(bLeftFirst ? Node.Left : Node.Right);
+			}
+			else if (Node.Left >= 0)
+			{
+				Stack.Push(Node.Left);
+			}
+			else if (Node.Right >= 0)
+			{
+				Stack.Push(Node.Right);
 			}
 		}
-	}
 
-	return false;
+		alignas(32) float Distances[RayPacketSize];
+		alignas(32) int32 TriangleIDs[RayPacketSize];
+		_mm256_store_ps(Distances, Packet.MaxDistance);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(TriangleIDs), _mm256_castps_si256(Packet.TriangleID));
+
+		for (int32 Lane = 0; Lane < Count; ++Lane)
+		{
+			FMeshBVHRayHit& Hit = OutHits[FirstRay + Lane];
+			Hit.TriangleID = TriangleIDs[Lane];
+			Hit.Distance = Hit.IsHit() ? Distances[Lane] : 0.0f;
+		}
+	}, RayPacketsPerBatch);
+
+	int32 HitCount = 0;
+	for (const FMeshBVHRayHit& Hit : OutHits)
+	{
+		HitCount += Hit.IsHit() ? 1 : 0;
+	}
+	return HitCount;
 }
 //bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
 //{
@@ -331,3 +1094,137 @@ int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVer
 
 	return NodeIndex;
 }
+
+void FMeshBVH::FlattenDepthFirst(const TArray<FMeshBVHNode>& InBuildNodes)
+{
+	struct FFlattenItem
+	{
+		int BuildIndex;
+		int ParentIndex;
+		bool bIsRight;
+	};
+
+	Nodes.Empty();
+	Nodes.Reserve(InBuildNodes.Num());
+
+	TArray<FFlattenItem> Stack;
+	Stack.Add({ 0, -1, false });
+	while (!Stack.IsEmpty())
+	{
+		const FFlattenItem Item = Stack.back();
+		Stack.pop_back();
+
+		const FMeshBVHNode& Source = InBuildNodes[Item.BuildIndex];
+		const int FlatIndex = Nodes.Num();
+
+		FMeshBVHNode Node = Source;
+		Node.Left = -1;
+		Node.Right = -1;
+		Nodes.Add(Node);
+
+		if (Item.ParentIndex >= 0)
+		{
+			(Item.bIsRight ? Nodes[Item.ParentIndex].Right : Nodes[Item.ParentIndex].Left) = FlatIndex;
+		}
+
+		if (!Source.IsLeaf())
+		{
+			// 왼쪽을 나중에 넣어 먼저 꺼내므로 왼쪽 자식은 항상 부모 바로 다음 인덱스
+			Stack.Add({ Source.Right, FlatIndex, true });
+			Stack.Add({ Source.Left, FlatIndex, false });
+		}
+	}
+}
+
+bool FMeshBVH::ValidateLoadedTree(uint32 InTriangleCount) const
+{
+	// 삼각형 ID는 정점 인덱스 버퍼를 직접 참조하므로 범위 밖 값이 하나라도 있으면 캐시를 버린다
+	for (uint32 TriangleID : TriIndices)
+	{
+		if (TriangleID >= InTriangleCount)
+		{
+			return false;
+		}
+	}
+
+	// 루트에서 모든 노드에 정확히 한 번씩 도달해야 트리다 (두 번 도달 = 공유 / 사이클, 미도달 = 고아 노드)
+	const int32 NodeCount = Nodes.Num();
+	TArray<uint8> Visited(NodeCount, 0);
+	int32 VisitedCount = 0;
+
+	TArray<int32> Stack;
+	Stack.Add(0);
+	while (!Stack.IsEmpty())
+	{
+		const int32 NodeIndex = Stack.back();
+		Stack.pop_back();
+
+		if (Visited[NodeIndex])
+		{
+			return false;
+		}
+		Visited[NodeIndex] = 1;
+		++VisitedCount;
+
+		const FMeshBVHNode& Node = Nodes[NodeIndex];
+		if (Node.IsLeaf())
+		{
+			if (static_cast<uint64>(Node.Start) + Node.Count > static_cast<uint64>(TriIndices.Num()))
+			{
+				return false;
+			}
+			continue;
+		}
+
+		for (const int ChildIndex : { Node.Left, Node.Right })
+		{
+			if (ChildIndex < -1 || ChildIndex >= NodeCount)
+			{
+				return false;
+			}
+			if (ChildIndex >= 0)
+			{
+				Stack.Add(ChildIndex);
+			}
+		}
+	}
+
+	return VisitedCount == NodeCount;
+}
+
+void FMeshBVH::ComputeBuildStats()
+{
+	BuildStats.TriangleCount = static_cast<int32>(TriIndices.Num());
+	BuildStats.NodeCount = static_cast<int32>(Nodes.Num());
+	if (Nodes.IsEmpty())
+	{
+		return;
+	}
+
+	const float RootArea = Nodes[0].Bounds.GetSurfaceArea();
+	float CostSum = 0.0f;
+
+	TArray<TPair<int, int32>> Stack;
+	Stack.Add({ 0, 0 });
+	while (!Stack.IsEmpty())
+	{
+		const auto [NodeIndex, Depth] = Stack.back();
+		Stack.pop_back();
+
+		const FMeshBVHNode& Node = Nodes[NodeIndex];
+		BuildStats.MaxDepth = std::max(BuildStats.MaxDepth, Depth);
+		if (Node.IsLeaf())
+		{
+			++BuildStats.LeafCount;
+			BuildStats.MaxLeafTriangles = std::max(BuildStats.MaxLeafTriangles, static_cast<int32>(Node.Count));
+			CostSum += Node.Bounds.GetSurfaceArea() * Node.Count * SAHIntersectionCost;
+			continue;
+		}
+
+		CostSum += Node.Bounds.GetSurfaceArea() * SAHTraversalCost;
+		if (Node.Left >= 0) Stack.Add({ Node.Left, Depth + 1 });
+		if (Node.Right >= 0) Stack.Add({ Node.Right, Depth + 1 });
+	}
+
+	BuildStats.SAHCost = RootArea > 0.0f ? CostSum / RootArea : 0.0f;
+}
@@ -17,13 +17,73 @@ struct FStackItem
 	int32 NodeIndex;
 	float EntryDistance;
 };
+
+/**
+ * 내부 노드의 두 자식 AABB를 축별로 모아 둔 것. SSE 한 번의 로드로 두 자식의 슬랩을 동시에 검사한다
+ * 각 배열의 레인 = { 왼쪽 Min, 오른쪽 Min, 왼쪽 Max, 오른쪽 Max }
+ */
+struct alignas(16) FMeshBVHChildBounds
+{
+	float X[4];
+	float Y[4];
+	float Z[4];
+};
+
+/** 배치 레이 질의의 레이별 결과 (가장 가까운 교차) */
+struct FMeshBVHRayHit
+{
+	float Distance = 0.0f;
+	int32 TriangleID = -1;
+
+	bool IsHit() const { return TriangleID >= 0; }
+};
+
+/** 트리 분할 방식 */
+enum class EMeshBVHBuildMethod : uint8
+{
+	Median,		// 가장 긴 축의 중앙값으로 반씩 분할 (기존 방식, 비교용)
+	BinnedSAH,	// 축마다 중심점을 구간(bin)으로 나눠 SAH 비용이 가장 낮은 평면으로 분할, 큰 서브트리는 병렬 빌드
+};
+
+/** 마지막 Build의 품질 / 시간 통계 */
+struct FMeshBVHBuildStats
+{
+	EMeshBVHBuildMethod Method = EMeshBVHBuildMethod::BinnedSAH;
+	int32 TriangleCount = 0;
+	int32 NodeCount = 0;
+	int32 LeafCount = 0;
+	int32 MaxDepth = 0;
+	int32 MaxLeafTriangles = 0;
+	// 루트 표면적으로 정규화한 SAH 비용 (낮을수록 레이 탐색 시 방문 노드/삼각형이 적음)
+	float SAHCost = 0.0f;
+	double BuildMS = 0.0;
+};
+
 class FMeshBVH
 {
 public:
 
-	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, EMeshBVHBuildMethod InMethod = EMeshBVHBuildMethod::BinnedSAH);
+
+	const FMeshBVHBuildStats& GetBuildStats() const { return BuildStats; }
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	/**
+	 * 빌드 결과(노드 배열, 재배치된 삼각형 순서)를 DDC 사이드카 파일로 저장 / 로드한다.
+	 * 로드는 헤더 검증 후 노드와 인덱스를 각각 한 번의 벌크 읽기로 채우며,
+	 * 버전, 삼각형 수, 파일 크기 중 하나라도 맞지 않으면 false를 반환하고 상태를 비운다.
+	 */
+	bool SaveCache(const FString& InFilePath) const;
+	bool LoadCache(const FString& InFilePath, uint32 InExpectedTriangleCount);
+
+	/** 가장 가까운 교차 거리. 두 자식을 SSE로 동시에 슬랩 테스트하고, 리프 삼각형은 4개씩 묶어 Möller–Trumbore 검사 */
+	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance) const;
+
+	/**
+	 * N개 레이의 가장 가까운 교차 (영역 선택, CPU 가시성 프로브용)
+	 * 레이를 8개씩 AVX 패킷으로 묶어 트리를 한 번만 내려가며, 패킷들은 ParallelFor로 나눠 처리한다
+	 * OutHits는 InLocalRays와 같은 순서이고, 반환값은 교차한 레이 수
+	 */
+	int32 IntersectRays(const TArray<FRay>& InLocalRays, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, TArray<FMeshBVHRayHit>& OutHits) const;
 
 
 private:
@@ -36,6 +96,14 @@ private:
 
 	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
+	// 분할 순서대로 만들어진 BinnedSAH 결과를 왼쪽 자식이 부모 바로 뒤에 오는 깊이 우선 배열로 재배치
+	void FlattenDepthFirst(const TArray<FMeshBVHNode>& InBuildNodes);
+	void ComputeBuildStats();
+	// 캐시에서 읽은 노드 / 삼각형 인덱스가 탐색에 안전한지 검사 (자식 범위, 사이클, 리프 범위, 삼각형 ID)
+	bool ValidateLoadedTree(uint32 InTriangleCount) const;
+	// Build / LoadCache 이후 내부 노드마다 두 자식 AABB를 SIMD 레이아웃으로 복사
+	void BuildChildBounds();
+
 private:
 
 	TArray<FMeshBVHNode> Nodes;
@@ -43,5 +111,10 @@ private:
 	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
 	TArray<uint32> TriIndices;
 	const uint32 LeafSize = 4;
+
+	// Nodes와 같은 인덱스. 리프 노드의 항목은 사용하지 않음
+	TArray<FMeshBVHChildBounds> ChildBounds;
+
+	FMeshBVHBuildStats BuildStats;
 };
 
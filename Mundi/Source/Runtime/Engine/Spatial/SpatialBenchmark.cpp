@@ -0,0 +1,706 @@
+﻿#include "pch.h"
+#include "SpatialBenchmark.h"
+#include "BVHierarchy.h"
+#include "Octree.h"
+#include "MeshBVH.h"
+#include "CollisionBVH.h"
+#include "WorldPhysics.h"
+#include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
+#include "BoxComponent.h"
+#include "SphereComponent.h"
+#include "OBB.h"
+#include "BoundingSphere.h"
+#include "Picking.h"
+#include "PlatformTime.h"
+#include "CommandLineOptions.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+
+namespace
+{
+	// 프리미티브 하나가 차지하는 평균 공간. 월드 크기를 개수에 비례해 키워 밀도를 일정하게 유지
+	constexpr float PrimitiveSpacing = 8.0f;
+	// Moving 분포에서 매 프레임 이동하는 프리미티브 비율
+	constexpr float MovingRatio = 0.1f;
+	constexpr int32 ClusterCount = 16;
+
+	/**
+	 * @brief 플랫폼/표준 라이브러리 구현과 무관하게 같은 시드에서 같은 수열을 내는 xorshift 난수기
+	 * std::uniform_real_distribution 은 구현마다 결과가 달라 커밋 간 비교에 쓸 수 없음
+	 */
+	struct FBenchmarkRandom
+	{
+		uint64 State;
+
+		explicit FBenchmarkRandom(uint64 InSeed) : State(InSeed ? InSeed : 0x9e3779b97f4a7c15ULL) {}
+
+		uint64 Next()
+		{
+			State ^= State << 13;
+			State ^= State >> 7;
+			State ^= State << 17;
+			return State;
+		}
+
+		// [0, 1)
+		float Unit() { return static_cast<float>(Next() >> 40) / static_cast<float>(1ULL << 24); }
+		float Range(float InMin, float InMax) { return InMin + (InMax - InMin) * Unit(); }
+		FVector InBox(float InHalfExtent)
+		{
+			return FVector(Range(-InHalfExtent, InHalfExtent), Range(-InHalfExtent, InHalfExtent), Range(-InHalfExtent, InHalfExtent));
+		}
+		FVector UnitDirection()
+		{
+			FVector Dir;
+			do
+			{
+				Dir = InBox(1.0f);
+			} while (Dir.SizeSquared() < KINDA_SMALL_NUMBER || Dir.SizeSquared() > 1.0f);
+			return Dir.GetSafeNormal();
+		}
+	};
+
+	const char* GetDistributionName(EBenchmarkDistribution InDistribution)
+	{
+		switch (InDistribution)
+		{
+		case EBenchmarkDistribution::Uniform:	return "Uniform";
+		case EBenchmarkDistribution::Clustered:	return "Clustered";
+		case EBenchmarkDistribution::Moving:	return "Moving";
+		default:								return "Unknown";
+		}
+	}
+
+	class FBenchmarkTimer
+	{
+	public:
+		FBenchmarkTimer() : StartCycles(FPlatformTime::Cycles64()) {}
+		double GetElapsedMS() const { return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles); }
+
+	private:
+		uint64 StartCycles;
+	};
+}
+
+/**
+ * @brief 시드로부터 결정적으로 생성되는 합성 씬.
+ * 프리미티브 배치, 프레임별 이동량, 쿼리 도형을 모두 미리 만들어 두어 측정 구간에는 순수 연산만 포함됩니다.
+ */
+struct FSpatialBenchmarkScene
+{
+	EBenchmarkDistribution Distribution = EBenchmarkDistribution::Uniform;
+	int32 Count = 0;
+	float HalfExtent = 0.0f;
+	FAABB Bounds;
+
+	TArray<FVector> Locations;
+	TArray<FVector> Scales;
+
+	// Moving 분포 전용: [Frame][MoverIndex] 의 목표 위치. 이동 대상은 앞쪽 MoverCount개
+	int32 MoverCount = 0;
+	TArray<TArray<FVector>> MovedLocations;
+
+	TArray<FRay> Rays;
+	TArray<FAABB> QueryBoxes;
+	TArray<FOBB> QueryOBBs;
+	TArray<FBoundingSphere> QuerySpheres;
+
+	static FSpatialBenchmarkScene Generate(EBenchmarkDistribution InDistribution, int32 InCount, const FSpatialBenchmarkConfig& InConfig)
+	{
+		FSpatialBenchmarkScene Scene;
+		Scene.Distribution = InDistribution;
+		Scene.Count = InCount;
+		Scene.HalfExtent = 0.5f * PrimitiveSpacing * std::cbrt(static_cast<float>(std::max(InCount, 1)));
+		Scene.Bounds = FAABB(FVector(-Scene.HalfExtent, -Scene.HalfExtent, -Scene.HalfExtent),
+			FVector(Scene.HalfExtent, Scene.HalfExtent, Scene.HalfExtent));
+
+		// 분포/개수마다 시드를 섞어 서로 다른 씬이 같은 수열을 공유하지 않도록 함
+		FBenchmarkRandom Random(InConfig.Seed * 0x100000001b3ULL + static_cast<uint64>(InDistribution) * 7919ULL + static_cast<uint64>(InCount));
+
+		TArray<FVector> ClusterCenters;
+		const float ClusterRadius = Scene.HalfExtent * 0.08f;
+		if (InDistribution == EBenchmarkDistribution::Clustered)
+		{
+			for (int32 i = 0; i < ClusterCount; ++i)
+			{
+				ClusterCenters.Add(Random.InBox(Scene.HalfExtent - ClusterRadius));
+			}
+		}
+
+		Scene.Locations.Reserve(InCount);
+		Scene.Scales.Reserve(InCount);
+		for (int32 i = 0; i < InCount; ++i)
+		{
+			if (InDistribution == EBenchmarkDistribution::Clustered)
+			{
+				const FVector& Center = ClusterCenters[static_cast<int32>(Random.Next() % ClusterCount)];
+				// 균일 난수 3개의 평균으로 중심에 몰리는 분포를 근사
+				const FVector Offset = (Random.InBox(ClusterRadius) + Random.InBox(ClusterRadius) + Random.InBox(ClusterRadius)) / 3.0f;
+				Scene.Locations.Add(Center + Offset);
+			}
+			else
+			{
+				Scene.Locations.Add(Random.InBox(Scene.HalfExtent));
+			}
+
+			const float Scale = Random.Range(0.5f, 2.0f);
+			Scene.Scales.Add(FVector(Scale, Scale, Scale));
+		}
+
+		if (InDistribution == EBenchmarkDistribution::Moving)
+		{
+			Scene.MoverCount = std::max(1, static_cast<int32>(InCount * MovingRatio));
+			TArray<FVector> Current(Scene.Locations.begin(), Scene.Locations.begin() + Scene.MoverCount);
+			for (int32 Frame = 0; Frame < InConfig.MovingFrameCount; ++Frame)
+			{
+				for (FVector& Location : Current)
+				{
+					Location = Location + Random.UnitDirection() * (PrimitiveSpacing * 0.5f);
+				}
+				Scene.MovedLocations.Add(Current);
+			}
+		}
+
+		// 쿼리 도형 크기는 프리미티브 간격 기준이라 개수와 무관하게 비슷한 히트 수를 기대할 수 있음
+		const float QueryHalfSize = PrimitiveSpacing * 2.0f;
+		for (int32 i = 0; i < InConfig.QueryCount; ++i)
+		{
+			FRay Ray;
+			Ray.Origin = Random.UnitDirection() * (Scene.HalfExtent * 2.0f);
+			Ray.Direction = (Random.InBox(Scene.HalfExtent * 0.5f) - Ray.Origin).GetSafeNormal();
+			Scene.Rays.Add(Ray);
+
+			const FVector BoxCenter = Random.InBox(Scene.HalfExtent);
+			const FVector BoxHalf(QueryHalfSize, QueryHalfSize, QueryHalfSize);
+			Scene.QueryBoxes.Add(FAABB(BoxCenter - BoxHalf, BoxCenter + BoxHalf));
+
+			const FQuat Rotation = FQuat::FromAxisAngle(Random.UnitDirection(), Random.Range(0.0f, TWO_PI));
+			const FVector Axes[3] = { Rotation.RotateVector(FVector(1, 0, 0)), Rotation.RotateVector(FVector(0, 1, 0)), Rotation.RotateVector(FVector(0, 0, 1)) };
+			Scene.QueryOBBs.Add(FOBB(Random.InBox(Scene.HalfExtent), BoxHalf, Axes));
+
+			Scene.QuerySpheres.Add(FBoundingSphere(Random.InBox(Scene.HalfExtent), QueryHalfSize));
+		}
+
+		return Scene;
+	}
+};
+
+FSpatialBenchmark::FSpatialBenchmark(const FSpatialBenchmarkConfig& InConfig)
+	: Config(InConfig)
+{
+}
+
+FSpatialBenchmark::~FSpatialBenchmark()
+{
+	// 풀의 액터는 월드 없이 만든 것이라 개별 삭제하지 않고, 소유한 컴포넌트와 함께
+	// 엔진 종료 시 ObjectFactory::DeleteAll 에서 한 번에 정리
+	StaticMeshActorPool.Empty();
+	ShapePool.Empty();
+}
+
+bool FSpatialBenchmark::ParseCommandLine(const FString& InCmdLine, FSpatialBenchmarkConfig& OutConfig)
+{
+	if (!FCommandLine::HasFlag(InCmdLine, "SpatialBenchmark"))
+	{
+		return false;
+	}
+
+	FString Value;
+	if (FCommandLine::FindOption(InCmdLine, "BenchmarkCounts", Value))
+	{
+		OutConfig.PrimitiveCounts = FCommandLine::ParseIntList(Value);
+	}
+	if (FCommandLine::FindOption(InCmdLine, "BenchmarkTriangles", Value))
+	{
+		OutConfig.TriangleCounts = FCommandLine::ParseIntList(Value);
+	}
+	FCommandLine::ParseUIntOption(InCmdLine, "BenchmarkSeed", OutConfig.Seed);
+	FCommandLine::ParseIntOption(InCmdLine, "BenchmarkQueries", OutConfig.QueryCount);
+	FCommandLine::ParseIntOption(InCmdLine, "BenchmarkFrames", OutConfig.MovingFrameCount);
+	if (FCommandLine::FindOption(InCmdLine, "BenchmarkOutput", Value))
+	{
+		OutConfig.OutputDir = Value;
+	}
+	return true;
+}
+
+bool FSpatialBenchmark::Run()
+{
+	Results.Empty();
+
+	const EBenchmarkDistribution Distributions[] =
+	{
+		EBenchmarkDistribution::Uniform,
+		EBenchmarkDistribution::Clustered,
+		EBenchmarkDistribution::Moving,
+	};
+
+	for (EBenchmarkDistribution Distribution : Distributions)
+	{
+		for (int32 Count : Config.PrimitiveCounts)
+		{
+			if (Count <= 0)
+			{
+				continue;
+			}
+
+			UE_LOG("[SpatialBenchmark] %s x %d", GetDistributionName(Distribution), Count);
+			const FSpatialBenchmarkScene Scene = FSpatialBenchmarkScene::Generate(Distribution, Count, Config);
+
+			PlaceStaticMeshActors(Scene);
+			RunBVHierarchy(Scene);
+			RunOctree(Scene);
+
+			PlaceShapes(Scene);
+			RunCollisionBVH(Scene);
+			RunWorldPhysics(Scene);
+		}
+
+		// 삼각형은 프레임 간 이동 개념이 없으므로 정적 분포만 측정
+		if (Distribution == EBenchmarkDistribution::Moving)
+		{
+			continue;
+		}
+		for (int32 Count : Config.TriangleCounts)
+		{
+			if (Count <= 0)
+			{
+				continue;
+			}
+
+			UE_LOG("[SpatialBenchmark] MeshBVH %s x %d", GetDistributionName(Distribution), Count);
+			RunMeshBVH(FSpatialBenchmarkScene::Generate(Distribution, Count, Config));
+		}
+	}
+
+	std::error_code ErrorCode;
+	std::filesystem::create_directories(Config.OutputDir, ErrorCode);
+
+	const FString CSVPath = Config.OutputDir + "/SpatialBenchmark.csv";
+	const FString JSONPath = Config.OutputDir + "/SpatialBenchmark.json";
+	if (!WriteCSV(CSVPath) || !WriteJSON(JSONPath))
+	{
+		UE_LOG("[SpatialBenchmark] Failed to write results to %s", Config.OutputDir.c_str());
+		return false;
+	}
+	UE_LOG("[SpatialBenchmark] %d results written to %s", static_cast<int32>(Results.Num()), Config.OutputDir.c_str());
+	return true;
+}
+
+void FSpatialBenchmark::RunBVHierarchy(const FSpatialBenchmarkScene& InScene)
+{
+	TArray<UStaticMeshComponent*> Components;
+	Components.Reserve(InScene.Count);
+	for (int32 i = 0; i < InScene.Count; ++i)
+	{
+		Components.Add(StaticMeshActorPool[i]->GetStaticMeshComponent());
+	}
+
+	FBVHierarchy BVH(FAABB(), 0, 8, 1);
+	{
+		FBenchmarkTimer Timer;
+		BVH.BulkUpdate(Components);
+		AddResult("BVHierarchy", InScene, "Build", 1, Timer.GetElapsedMS(), BVH.TotalNodeCount());
+	}
+
+	if (InScene.Distribution == EBenchmarkDistribution::Moving)
+	{
+		double TotalMS = 0.0;
+		for (const TArray<FVector>& FrameLocations : InScene.MovedLocations)
+		{
+			for (int32 i = 0; i < InScene.MoverCount; ++i)
+			{
+				StaticMeshActorPool[i]->SetActorLocation(FrameLocations[i]);
+			}
+
+			FBenchmarkTimer Timer;
+			for (int32 i = 0; i < InScene.MoverCount; ++i)
+			{
+				BVH.Update(Components[i]);
+			}
+			BVH.FlushRebuild();
+			TotalMS += Timer.GetElapsedMS();
+		}
+		AddResult("BVHierarchy", InScene, "Refit", static_cast<int32>(InScene.MovedLocations.Num()), TotalMS, BVH.TotalNodeCount());
+	}
+
+	{
+		uint64 Hits = 0;
+		FBenchmarkTimer Timer;
+		for (const FRay& Ray : InScene.Rays)
+		{
+			AActor* HitActor = nullptr;
+			float HitT = 0.0f;
+			BVH.QueryRayClosest(Ray, HitActor, HitT);
+			Hits += HitActor ? 1 : 0;
+		}
+		AddResult("BVHierarchy", InScene, "RayClosest", static_cast<int32>(InScene.Rays.Num()), Timer.GetElapsedMS(), Hits);
+	}
+
+	{
+		uint64 Hits = 0;
+		FBenchmarkTimer Timer;
+		for (const FAABB& Box : InScene.QueryBoxes)
+		{
+			Hits += BVH.QueryIntersectedComponents(Box).Num();
+		}
+		AddResult("BVHierarchy", InScene, "QueryAABB", static_cast<int32>(InScene.QueryBoxes.Num()), Timer.GetElapsedMS(), Hits);
+	}
+
+	{
+		uint64 Hits = 0;
+		FBenchmarkTimer Timer;
+		for (const FOBB& Box : InScene.QueryOBBs)
+		{
+			Hits += BVH.QueryIntersectedComponents(Box).Num();
+		}
+		AddResult("BVHierarchy", InScene, "QueryOBB", static_cast<int32>(InScene.QueryOBBs.Num()), Timer.GetElapsedMS(), Hits);
+	}
+
+	{
+		uint64 Hits = 0;
+		FBenchmarkTimer Timer;
+		for (const FBoundingSphere& Sphere : InScene.QuerySpheres)
+		{
+			Hits += BVH.QueryIntersectedComponents(Sphere).Num();
+		}
+		AddResult("BVHierarchy", InScene, "QuerySphere", static_cast<int32>(InScene.QuerySpheres.Num()), Timer.GetElapsedMS(), Hits);
+	}
+}
+
+void FSpatialBenchmark::RunOctree(const FSpatialBenchmarkScene& InScene)
+{
+	TArray<std::pair<AActor*, FAABB>> ActorsAndBounds;
+	ActorsAndBounds.Reserve(InScene.Count);
+	for (int32 i = 0; i < InScene.Count; ++i)
+	{
+		AStaticMeshActor* Actor = StaticMeshActorPool[i];
+		ActorsAndBounds.Add({ Actor, Actor->GetBounds() });
+	}
+
+	// Moving 분포의 프리미티브가 범위 밖으로 나가도 루트에 남도록 WorldPartitionManager와 같은 설정에 여유 범위 부여
+	const FVector Margin(PrimitiveSpacing * InScene.MovedLocations.Num(), PrimitiveSpacing * InScene.MovedLocations.Num(), PrimitiveSpacing * InScene.MovedLocations.Num());
+	FOctree Octree(FAABB(InScene.Bounds.Min - Margin, InScene.Bounds.Max + Margin), 0, 8, 10);
+	{
+		FBenchmarkTimer Timer;
+		Octree.BulkInsert(ActorsAndBounds);
+		AddResult("Octree", InScene, "Build", 1, Timer.GetElapsedMS(), Octree.TotalNodeCount());
+	}
+
+	if (InScene.Distribution == EBenchmarkDistribution::Moving)
+	{
+		double TotalMS = 0.0;
+		for (const TArray<FVector>& FrameLocations : InScene.MovedLocations)
+		{
+			for (int32 i = 0; i < InScene.MoverCount; ++i)
+			{
+				StaticMeshActorPool[i]->SetActorLocation(FrameLocations[i]);
+			}
+
+			FBenchmarkTimer Timer;
+			for (int32 i = 0; i < InScene.MoverCount; ++i)
+			{
+				Octree.Update(StaticMeshActorPool[i]);
+			}
+			TotalMS += Timer.GetElapsedMS();
+		}
+		AddResult("Octree", InScene, "Refit", static_cast<int32>(InScene.MovedLocations.Num()), TotalMS, Octree.TotalActorCount());
+	}
+
+	{
+		uint64 Hits = 0;
+		FBenchmarkTimer Timer;
+		for (const FRay& Ray : InScene.Rays)
+		{
+			AActor* HitActor = nullptr;
+			float HitT = 0.0f;
+			Octree.QueryRayClosest(Ray, HitActor, HitT);
+			Hits += HitActor ? 1 : 0;
+		}
+		AddResult("Octree", InScene, "RayClosest", static_cast<int32>(InScene.Rays.Num()), Timer.GetElapsedMS(), Hits);
+	}
+}
+
+void FSpatialBenchmark::RunCollisionBVH(const FSpatialBenchmarkScene& InScene)
+{
+	TArray<UShapeComponent*> Shapes(ShapePool.begin(), ShapePool.begin() + InScene.Count);
+
+	FCollisionBVH BVH;
+	{
+		FBenchmarkTimer Timer;
+		BVH.BulkUpdate(Shapes);
+		AddResult("CollisionBVH", InScene, "Build", 1, Timer.GetElapsedMS(), BVH.TotalNodeCount());
+	}
+
+	if (InScene.Distribution == EBenchmarkDistribution::Moving)
+	{
+		double TotalMS = 0.0;
+		for (const TArray<FVector>& FrameLocations : InScene.MovedLocations)
+		{
+			for (int32 i = 0; i < InScene.MoverCount; ++i)
+			{
+				Shapes[i]->SetWorldLocation(FrameLocations[i]);
+			}
+
+			FBenchmarkTimer Timer;
+			for (int32 i = 0; i < InScene.MoverCount; ++i)
+			{
+				BVH.Update(Shapes[i]);
+			}
+			BVH.FlushRebuild();
+			TotalMS += Timer.GetElapsedMS();
+		}
+		AddResult("CollisionBVH", InScene, "Refit", static_cast<int32>(InScene.MovedLocations.Num()), TotalMS, BVH.TotalNodeCount());
+	}
+
+	{
+		uint64 Hits = 0;
+		FBenchmarkTimer Timer;
+		for (const FAABB& Box : InScene.QueryBoxes)
+		{
+			Hits += BVH.Query(Box).Num();
+		}
+		AddResult("CollisionBVH", InScene, "QueryAABB", static_cast<int32>(InScene.QueryBoxes.Num()), Timer.GetElapsedMS(), Hits);
+	}
+
+	{
+		uint64 Hits = 0;
+		FBenchmarkTimer Timer;
+		for (UShapeComponent* Shape : Shapes)
+		{
+			Hits += BVH.Query(Shape).Num();
+		}
+		AddResult("CollisionBVH", InScene, "OverlapPass", 1, Timer.GetElapsedMS(), Hits);
+	}
+}
+
+void FSpatialBenchmark::RunWorldPhysics(const FSpatialBenchmarkScene& InScene)
+{
+	TArray<UShapeComponent*> Shapes(ShapePool.begin(), ShapePool.begin() + InScene.Count);
+
+	// UWorld와 동일하게 GUObjectArray 밖에서 생성해 벤치마크 동안만 소유
+	std::unique_ptr<UWorldPhysics> Physics(new UWorldPhysics());
+	{
+		FBenchmarkTimer Timer;
+		Physics->BulkRegisterCollision(Shapes);
+		AddResult("WorldPhysics", InScene, "Build", 1, Timer.GetElapsedMS(), Physics->GetCollisionNodeCount());
+	}
+
+	{
+		FBenchmarkTimer Timer;
+		Physics->Update(0.0f);
+		uint64 Pairs = 0;
+		for (UShapeComponent* Shape : Shapes)
+		{
+			Pairs += Physics->CollisionQuery(Shape).Num();
+		}
+		AddResult("WorldPhysics", InScene, "OverlapPass", 1, Timer.GetElapsedMS(), Pairs);
+	}
+
+	if (InScene.Distribution == EBenchmarkDistribution::Moving)
+	{
+		double TotalMS = 0.0;
+		for (const TArray<FVector>& FrameLocations : InScene.MovedLocations)
+		{
+			for (int32 i = 0; i < InScene.MoverCount; ++i)
+			{
+				Shapes[i]->SetWorldLocation(FrameLocations[i]);
+			}
+
+			FBenchmarkTimer Timer;
+			for (int32 i = 0; i < InScene.MoverCount; ++i)
+			{
+				Physics->MarkCollisionDirty(Shapes[i]);
+			}
+			Physics->Update(1.0f / 60.0f);
+			TotalMS += Timer.GetElapsedMS();
+		}
+		AddResult("WorldPhysics", InScene, "Update", static_cast<int32>(InScene.MovedLocations.Num()), TotalMS, Physics->GetCollisionShapeCount());
+	}
+}
+
+void FSpatialBenchmark::RunMeshBVH(const FSpatialBenchmarkScene& InScene)
+{
+	// 분포 위치를 중심으로 하는 작은 삼각형 수프. 정점 공유 없이 삼각형마다 정점 3개
+	TArray<FNormalVertex> Vertices;
+	TArray<uint32> Indices;
+	Vertices.resize(static_cast<size_t>(InScene.Count) * 3);
+	Indices.resize(static_cast<size_t>(InScene.Count) * 3);
+
+	FBenchmarkRandom Random(Config.Seed);
+	for (int32 Tri = 0; Tri < InScene.Count; ++Tri)
+	{
+		const FVector& Center = InScene.Locations[Tri];
+		const float Size = InScene.Scales[Tri].X * PrimitiveSpacing * 0.5f;
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const uint32 VertexIndex = static_cast<uint32>(Tri * 3 + Corner);
+			Vertices[VertexIndex].pos = Center + Random.UnitDirection() * Size;
+			Indices[VertexIndex] = VertexIndex;
+		}
+	}
+
+	// 기존 중앙값 분할과 Binned SAH 를 같은 입력으로 비교. Build 행의 ResultCount 는 노드 수
+	const TPair<EMeshBVHBuildMethod, const char*> Methods[] =
+	{
+		{ EMeshBVHBuildMethod::Median, "MeshBVHMedian" },
+		{ EMeshBVHBuildMethod::BinnedSAH, "MeshBVH" },
+	};
+
+	for (const auto& [Method, Subsystem] : Methods)
+	{
+		FMeshBVH BVH;
+		{
+			FBenchmarkTimer Timer;
+			BVH.Build(Vertices, Indices, Method);
+			AddResult(Subsystem, InScene, "Build", 1, Timer.GetElapsedMS(), BVH.GetBuildStats().NodeCount);
+		}
+
+		const FMeshBVHBuildStats& Stats = BVH.GetBuildStats();
+		UE_LOG("[SpatialBenchmark] %-12s SAHCost=%.3f Leaves=%d MaxDepth=%d MaxLeafTris=%d",
+			Subsystem, Stats.SAHCost, Stats.LeafCount, Stats.MaxDepth, Stats.MaxLeafTriangles);
+
+		{
+			uint64 Hits = 0;
+			FBenchmarkTimer Timer;
+			for (const FRay& Ray : InScene.Rays)
+			{
+				float HitDistance = 0.0f;
+				Hits += BVH.IntersectRay(Ray, Vertices, Indices, HitDistance) ? 1 : 0;
+			}
+			AddResult(Subsystem, InScene, "RayClosest", static_cast<int32>(InScene.Rays.Num()), Timer.GetElapsedMS(), Hits);
+		}
+
+		{
+			// 같은 레이를 8개씩 AVX 패킷으로 질의. 히트 수는 RayClosest 행과 같아야 한다
+			TArray<FMeshBVHRayHit> RayHits;
+			FBenchmarkTimer Timer;
+			const int32 Hits = BVH.IntersectRays(InScene.Rays, Vertices, Indices, RayHits);
+			AddResult(Subsystem, InScene, "RayPacket", static_cast<int32>(InScene.Rays.Num()), Timer.GetElapsedMS(), Hits);
+		}
+	}
+}
+
+void FSpatialBenchmark::PlaceStaticMeshActors(const FSpatialBenchmarkScene& InScene)
+{
+	while (StaticMeshActorPool.Num() < InScene.Count)
+	{
+		StaticMeshActorPool.Add(NewObject<AStaticMeshActor>());
+	}
+
+	for (int32 i = 0; i < InScene.Count; ++i)
+	{
+		AStaticMeshActor* Actor = StaticMeshActorPool[i];
+		Actor->SetActorLocation(InScene.Locations[i]);
+		Actor->SetActorScale(InScene.Scales[i]);
+	}
+}
+
+void FSpatialBenchmark::PlaceShapes(const FSpatialBenchmarkScene& InScene)
+{
+	// 짝수 슬롯은 Box, 홀수 슬롯은 Sphere로 고정해 풀 재사용 시에도 타입 비율이 유지되도록 함
+	while (ShapePool.Num() < InScene.Count)
+	{
+		if (ShapePool.Num() % 2 == 0)
+		{
+			ShapePool.Add(NewObject<UBoxComponent>());
+		}
+		else
+		{
+			ShapePool.Add(NewObject<USphereComponent>());
+		}
+	}
+
+	for (int32 i = 0; i < InScene.Count; ++i)
+	{
+		UShapeComponent* Shape = ShapePool[i];
+		const float Size = InScene.Scales[i].X;
+		if (UBoxComponent* Box = Cast<UBoxComponent>(Shape))
+		{
+			Box->SetExtent(FVector(Size, Size, Size));
+		}
+		else if (USphereComponent* Sphere = Cast<USphereComponent>(Shape))
+		{
+			Sphere->SetRadius(Size);
+		}
+		Shape->SetWorldLocation(InScene.Locations[i]);
+	}
+}
+
+void FSpatialBenchmark::AddResult(const FString& InSubsystem, const FSpatialBenchmarkScene& InScene, const FString& InOperation,
+	int32 InIterations, double InTotalMS, uint64 InResultCount)
+{
+	FSpatialBenchmarkResult Result;
+	Result.Subsystem = InSubsystem;
+	Result.Distribution = GetDistributionName(InScene.Distribution);
+	Result.Operation = InOperation;
+	Result.PrimitiveCount = InScene.Count;
+	Result.Iterations = InIterations;
+	Result.TotalMS = InTotalMS;
+	Result.ResultCount = InResultCount;
+	Results.Add(Result);
+
+	UE_LOG("[SpatialBenchmark] %-12s %-9s %-11s N=%-7d avg=%.4fms result=%llu",
+		Result.Subsystem.c_str(), Result.Distribution.c_str(), Result.Operation.c_str(),
+		Result.PrimitiveCount, Result.GetAverageMS(), static_cast<unsigned long long>(Result.ResultCount));
+}
+
+bool FSpatialBenchmark::WriteCSV(const FString& InFilePath) const
+{
+	std::ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	File << "Subsystem,Distribution,Operation,PrimitiveCount,Iterations,TotalMS,AverageMS,ResultCount\n";
+	File << std::fixed << std::setprecision(6);
+	for (const FSpatialBenchmarkResult& Result : Results)
+	{
+		File << Result.Subsystem << ','
+			<< Result.Distribution << ','
+			<< Result.Operation << ','
+			<< Result.PrimitiveCount << ','
+			<< Result.Iterations << ','
+			<< Result.TotalMS << ','
+			<< Result.GetAverageMS() << ','
+			<< Result.ResultCount << '\n';
+	}
+	return true;
+}
+
+bool FSpatialBenchmark::WriteJSON(const FString& InFilePath) const
+{
+	std::ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	File << std::fixed << std::setprecision(6);
+	File << "{\n";
+	File << "  \"Seed\": " << Config.Seed << ",\n";
+	File << "  \"QueryCount\": " << Config.QueryCount << ",\n";
+	File << "  \"MovingFrameCount\": " << Config.MovingFrameCount << ",\n";
+	File << "  \"Results\": [\n";
+	for (int32 i = 0; i < Results.Num(); ++i)
+	{
+		const FSpatialBenchmarkResult& Result = Results[i];
+		File << "    { "
+			<< "\"Subsystem\": \"" << Result.Subsystem << "\", "
+			<< "\"Distribution\": \"" << Result.Distribution << "\", "
+			<< "\"Operation\": \"" << Result.Operation << "\", "
+			<< "\"PrimitiveCount\": " << Result.PrimitiveCount << ", "
+			<< "\"Iterations\": " << Result.Iterations << ", "
+			<< "\"TotalMS\": " << Result.TotalMS << ", "
+			<< "\"AverageMS\": " << Result.GetAverageMS() << ", "
+			<< "\"ResultCount\": " << Result.ResultCount
+			<< (i + 1 < Results.Num() ? " },\n" : " }\n");
+	}
+	File << "  ]\n";
+	File << "}\n";
+	return true;
+}
@@ -0,0 +1,99 @@
+﻿#pragma once
+
+struct FSpatialBenchmarkScene;
+class AStaticMeshActor;
+class UShapeComponent;
+
+/**
+ * @brief 벤치마크용 합성 씬의 프리미티브 분포
+ */
+enum class EBenchmarkDistribution : uint8
+{
+	Uniform,	// 월드 전체에 균일 분포
+	Clustered,	// 소수의 클러스터 주변에 밀집
+	Moving,		// 균일 분포 + 일부 프리미티브가 매 프레임 이동
+};
+
+/**
+ * @brief 벤치마크 실행 설정. 커맨드라인(-SpatialBenchmark ...)에서 채워집니다.
+ */
+struct FSpatialBenchmarkConfig
+{
+	// FBVHierarchy / FOctree / FCollisionBVH / UWorldPhysics 에 사용할 프리미티브 수
+	// 1M 단계는 액터/셰이프 UObject를 100만 개씩 만들므로 수 GB 메모리가 필요 (-BenchmarkCounts로 줄일 수 있음)
+	TArray<int32> PrimitiveCounts = { 1000, 10000, 100000, 1000000 };
+	// FMeshBVH 에 사용할 삼각형 수 (UObject 생성이 없으므로 더 큰 규모까지 측정)
+	TArray<int32> TriangleCounts = { 1000, 10000, 100000, 1000000 };
+
+	uint32 Seed = 1337;
+	int32 QueryCount = 1000;		// 레이 / AABB / OBB / Sphere 쿼리 각각의 개수
+	int32 MovingFrameCount = 8;		// Refit / Physics Update 를 반복할 프레임 수
+
+	FString OutputDir = "Saved/Benchmark";
+};
+
+/**
+ * @brief 측정 결과 한 줄 (CSV 한 행 / JSON 배열 원소 하나)
+ */
+struct FSpatialBenchmarkResult
+{
+	FString Subsystem;
+	FString Distribution;
+	FString Operation;
+	int32 PrimitiveCount = 0;
+	int32 Iterations = 0;
+	double TotalMS = 0.0;
+	// 쿼리 히트 수 / 노드 수 등. 동일 시드에서는 커밋 간 값이 같아야 하므로 정합성 확인용으로 사용
+	uint64 ResultCount = 0;
+
+	double GetAverageMS() const { return Iterations > 0 ? TotalMS / Iterations : 0.0; }
+};
+
+/**
+ * @brief 공간 분할 / 충돌 서브시스템 벤치마크
+ * 에디터 메인 루프를 돌리지 않고 결정적인 합성 씬을 만들어
+ * Build, Refit, RayClosest(메시 BVH는 RayPacket 포함), AABB/OBB/Sphere 쿼리, 전체 Overlap 패스를 측정하고
+ * 결과를 CSV / JSON 으로 저장합니다.
+ * 에디터(-SpatialBenchmark) 외에 D3D11 없이 도는 Linux 콘솔 타깃(Benchmark/CMakeLists.txt)으로도 빌드됩니다.
+ */
+class FSpatialBenchmark
+{
+public:
+	explicit FSpatialBenchmark(const FSpatialBenchmarkConfig& InConfig);
+	~FSpatialBenchmark();
+
+	/**
+	 * @brief 커맨드라인에 -SpatialBenchmark 가 있으면 설정을 채우고 true를 반환합니다.
+	 * 옵션: -BenchmarkCounts=1000,10000 -BenchmarkTriangles=... -BenchmarkSeed=N
+	 *       -BenchmarkQueries=N -BenchmarkFrames=N -BenchmarkOutput=Dir
+	 */
+	static bool ParseCommandLine(const FString& InCmdLine, FSpatialBenchmarkConfig& OutConfig);
+
+	/** @return 측정을 마치고 CSV를 썼으면 true */
+	bool Run();
+
+	bool WriteCSV(const FString& InFilePath) const;
+	bool WriteJSON(const FString& InFilePath) const;
+
+	const TArray<FSpatialBenchmarkResult>& GetResults() const { return Results; }
+
+private:
+	void RunBVHierarchy(const FSpatialBenchmarkScene& InScene);
+	void RunOctree(const FSpatialBenchmarkScene& InScene);
+	void RunCollisionBVH(const FSpatialBenchmarkScene& InScene);
+	void RunWorldPhysics(const FSpatialBenchmarkScene& InScene);
+	void RunMeshBVH(const FSpatialBenchmarkScene& InScene);
+
+	// 프리미티브 수가 바뀔 때마다 UObject를 새로 만들지 않도록 풀을 키워가며 재사용
+	void PlaceStaticMeshActors(const FSpatialBenchmarkScene& InScene);
+	void PlaceShapes(const FSpatialBenchmarkScene& InScene);
+
+	void AddResult(const FString& InSubsystem, const FSpatialBenchmarkScene& InScene, const FString& InOperation,
+		int32 InIterations, double InTotalMS, uint64 InResultCount);
+
+	FSpatialBenchmarkConfig Config;
+	TArray<FSpatialBenchmarkResult> Results;
+
+	TArray<AStaticMeshActor*> StaticMeshActorPool;
+	TArray<UShapeComponent*> ShapePool;
+};
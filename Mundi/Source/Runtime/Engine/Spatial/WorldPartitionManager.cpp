@@ -44,6 +44,10 @@ void UWorldPartitionManager::Clear()
 
 	ComponentDirtyQueue.Empty();
 	ComponentDirtySet.Empty();
+
+	LastMovedFrame.Empty();
+	PendingShadowInvalidations.Empty();
+	bShadowInvalidateAll = true;
 }
 
 // 새로 만들어진 StaticMeshComponent를 등록하는 상황에서 맥락을 분명히 드러내기 위한 API입니다.
@@ -64,10 +68,10 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 	if (Actors.empty()) return;
 	TArray<UStaticMeshComponent*> StaticMeshComponents;
 	StaticMeshComponents.Reserve(Actors.size());
-	
+
+	const TArray<AActor*>& EditorActors = GWorld->GetEditorActors();
 	for (AActor* Actor : Actors)
 	{
-		TArray<AActor*> EditorActors = GWorld->GetEditorActors();
 		auto it = std::find(EditorActors.begin(), EditorActors.end(), Actor);
 		if (it != EditorActors.end())
 			continue; // 에디터 액터는 포함하지 않는다.
@@ -84,6 +88,10 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 	}
 	
 	if (BVH) BVH->BulkUpdate(StaticMeshComponents);
+
+	// 대량 등록은 개별 영역 대신 섀도우 캐시 전체를 무효화
+	PendingShadowInvalidations.Empty();
+	bShadowInvalidateAll = true;
 }
 
 void UWorldPartitionManager::Unregister(AActor* Actor)
@@ -101,9 +109,16 @@ void UWorldPartitionManager::Unregister(USceneComponent* Component)
 {
 	if (UStaticMeshComponent* Smc = Cast<UStaticMeshComponent>(Component))
 	{
+		// 사라진 캐스터가 드리우던 그림자 영역 무효화
+		if (const FAABB* OldBound = BVH ? BVH->FindBounds(Smc) : nullptr)
+		{
+			AddShadowInvalidation(*OldBound, !LastMovedFrame.Contains(Smc));
+		}
+
 		if (BVH) BVH->Remove(Smc);
 
 		ComponentDirtySet.erase(Smc);
+		LastMovedFrame.Remove(Smc);
 	}
 }
 
@@ -139,6 +154,15 @@ void UWorldPartitionManager::MarkDirty(UStaticMeshComponent* Smc)
 	if (Cast<AGizmoActor>(Owner))
 		return;
 	
+	// 섀도우 캐시 무효화: BVH에 남아 있는 이전 바운드와 현재 바운드 양쪽 (이동할 때마다 호출되므로 거쳐 간 위치가 모두 기록됨)
+	const bool bStaticCaster = !LastMovedFrame.Contains(Smc);
+	if (const FAABB* OldBound = BVH ? BVH->FindBounds(Smc) : nullptr)
+	{
+		AddShadowInvalidation(*OldBound, bStaticCaster);
+	}
+	AddShadowInvalidation(Smc->GetWorldAABB(), bStaticCaster);
+	LastMovedFrame.Add(Smc, UpdateFrame);
+
 	// second: 새로운 요소가 성공적으로 삽입되었으면 true, 이미 요소가 존재하여 삽입에 실패했으면 false
 	// DirtyQueue 중복 삽입 방지 로직
 	if (ComponentDirtySet.insert(Smc).second)
@@ -149,6 +173,20 @@ void UWorldPartitionManager::MarkDirty(UStaticMeshComponent* Smc)
 
 void UWorldPartitionManager::Update(float DeltaTime, const uint32 BudgetCount)
 {
+	// 한동안 움직이지 않은 컴포넌트는 다시 정적 캐스터로 취급
+	++UpdateFrame;
+	for (auto It = LastMovedFrame.begin(); It != LastMovedFrame.end();)
+	{
+		if (UpdateFrame - It->second > RecentlyMovedFrameWindow)
+		{
+			It = LastMovedFrame.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
+
 	// 프레임 히칭 방지를 위해 컴포넌트 카운트 제한
 	uint32 processed = 0;
 	while (processed < BudgetCount)
@@ -206,6 +244,53 @@ void UWorldPartitionManager::FrustumQuery(FFrustum InFrustum)
 	}
 }
 
+void UWorldPartitionManager::FrustumQuery(const FFrustum& InFrustum, OUT TArray<UStaticMeshComponent*>& OutComponents) const
+{
+	if (BVH)
+	{
+		BVH->QueryFrustum(InFrustum, OutComponents);
+	}
+}
+
+bool UWorldPartitionManager::IsUpToDate(UStaticMeshComponent* Smc) const
+{
+	return BVH && BVH->Contains(Smc) && !ComponentDirtySet.Contains(Smc);
+}
+
+void UWorldPartitionManager::ConsumeShadowInvalidations(OUT TArray<FShadowCasterInvalidation>& OutInvalidations, OUT bool& bOutInvalidateAll)
+{
+	OutInvalidations = std::move(PendingShadowInvalidations);
+	PendingShadowInvalidations.Empty();
+	bOutInvalidateAll = bShadowInvalidateAll;
+	bShadowInvalidateAll = false;
+}
+
+bool UWorldPartitionManager::IsRecentlyMoved(UStaticMeshComponent* Smc) const
+{
+	return LastMovedFrame.Contains(Smc);
+}
+
+void UWorldPartitionManager::AddShadowInvalidation(const FAABB& InBound, bool bStaticCaster)
+{
+	if (bShadowInvalidateAll)
+	{
+		return;
+	}
+
+	// 섀도우를 그리지 않는 뷰 모드 등으로 오래 소비되지 않으면 전체 무효화로 합쳐 메모리 증가를 막음
+	if (PendingShadowInvalidations.Num() >= MaxPendingShadowInvalidations)
+	{
+		PendingShadowInvalidations.Empty();
+		bShadowInvalidateAll = true;
+		return;
+	}
+
+	FShadowCasterInvalidation Invalidation;
+	Invalidation.Bound = InBound;
+	Invalidation.bStaticCaster = bStaticCaster;
+	PendingShadowInvalidations.Add(Invalidation);
+}
+
 void UWorldPartitionManager::ClearSceneOctree()
 {
 	if (SceneOctree)
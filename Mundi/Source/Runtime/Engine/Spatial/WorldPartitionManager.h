@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Object.h"
 #include "Vector.h"
+#include "AABB.h"
 
 class UPrimitiveComponent;
 class AStaticMeshActor;
@@ -13,6 +14,13 @@ struct FRay;
 struct FAABB;
 struct FFrustum;
 
+/** 섀도우 캐시 무효화 영역: 스태틱 메시 바운드가 바뀐 자리 (이동 전/후 바운드를 각각 기록) */
+struct FShadowCasterInvalidation
+{
+	FAABB Bound;
+	bool bStaticCaster = true;	// 한동안 움직이지 않던 캐스터가 움직였는지 (정적 캐시 레이어까지 무효화해야 함)
+};
+
 class UWorldPartitionManager : public UObject
 {
 public:
@@ -40,6 +48,19 @@ public:
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
 	void FrustumQuery(FFrustum InFrustum);
+	void FrustumQuery(const FFrustum& InFrustum, OUT TArray<UStaticMeshComponent*>& OutComponents) const;
+
+	/** BVH에 최신 바운드로 반영되어 있어 쿼리 결과를 신뢰할 수 있는지 (등록됨 + 더티 큐에 없음) */
+	bool IsUpToDate(UStaticMeshComponent* Smc) const;
+
+	/**
+	 * 마지막 호출 이후 쌓인 섀도우 캐시 무효화 영역을 꺼내 갑니다.
+	 * bOutInvalidateAll이면 레벨 로드처럼 영역을 특정할 수 없는 변경이 있었으므로 전부 무효
+	 */
+	void ConsumeShadowInvalidations(OUT TArray<FShadowCasterInvalidation>& OutInvalidations, OUT bool& bOutInvalidateAll);
+
+	/** 최근 RecentlyMovedFrameWindow 프레임 안에 바운드가 바뀐 컴포넌트인지 (섀도우 캐시의 동적 레이어 분류용) */
+	bool IsRecentlyMoved(UStaticMeshComponent* Smc) const;
 
 	/** 옥트리 게터 */
 	FOctree* GetSceneOctree() const { return SceneOctree; }
@@ -58,6 +79,17 @@ private:
 	
 	TQueue<UStaticMeshComponent*> ComponentDirtyQueue; // 추가 혹은 갱신이 필요한 요소의 대기 큐
 	TSet<UStaticMeshComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
+
+	// --- 섀도우 캐시 무효화 ---
+	void AddShadowInvalidation(const FAABB& InBound, bool bStaticCaster);
+
+	static constexpr uint64 RecentlyMovedFrameWindow = 30;	// 이 프레임 수 동안 움직임이 없으면 다시 정적 캐스터로 취급
+	static constexpr int32 MaxPendingShadowInvalidations = 4096;	// 소비되지 않고 넘치면 전체 무효화로 합침
+
+	TArray<FShadowCasterInvalidation> PendingShadowInvalidations;
+	bool bShadowInvalidateAll = false;
+	TMap<UStaticMeshComponent*, uint64> LastMovedFrame;	// 컴포넌트 -> 마지막으로 더티가 된 Update 프레임
+	uint64 UpdateFrame = 0;
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
 };
@@ -28,6 +28,13 @@ struct ModelBufferType // b0
     FMatrix ModelInverseTranspose;  // For correct normal transformation with non-uniform scale
 };
 
+// b0 in VS (UberLit USE_INSTANCING 변형): ModelBuffer 대신 인스턴스 버퍼 시작 위치
+struct FInstanceBufferType
+{
+    uint32 FirstInstance;
+    uint32 Padding[3];
+};
+
 struct ViewProjBufferType // b1 고유번호 고정
 {
     FMatrix View;
@@ -242,6 +249,7 @@ constexpr bool TYPE##IsPS = PS;
 //매크로를 인자로 받고 그 매크로 함수에 버퍼 전달
 #define CONSTANT_BUFFER_LIST(MACRO) \
 MACRO(ModelBufferType)              \
+MACRO(FInstanceBufferType)          \
 MACRO(DecalBufferType)              \
 MACRO(PostProcessBufferType)        \
 MACRO(FogBufferType)                \
@@ -267,6 +275,7 @@ CONSTANT_BUFFER_LIST(STATIC_ASSERT_CBUFFER_ALIGNMENT)
 //VS, PS 세팅은 함수 파라미터로 결정하게 하는게 훨씬 나을듯 나중에 수정 필요
 //그리고 UV Scroll 상수버퍼도 처리해줘야함
 CONSTANT_BUFFER_INFO(ModelBufferType, 0, true, false)
+CONSTANT_BUFFER_INFO(FInstanceBufferType, 0, true, false) // 인스턴싱 변형에서 ModelBuffer와 b0 공유
 CONSTANT_BUFFER_INFO(PostProcessBufferType, 0, false, true)
 CONSTANT_BUFFER_INFO(ViewProjBufferType, 1, true, true) // b1 카메라 행렬 고정
 CONSTANT_BUFFER_INFO(FogBufferType, 2, false, true)
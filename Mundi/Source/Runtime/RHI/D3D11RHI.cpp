@@ -6,6 +6,26 @@ void D3D11RHI::Initialize(HWND hWindow)
 {
     // 이곳에서 Device, DeviceContext, viewport, swapchain를 초기화한다
     CreateDeviceAndSwapChain(hWindow);
+    CreateDeviceResources();
+
+    // Initialize Direct2D overlay after device/swapchain ready
+    UStatsOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
+}
+
+bool D3D11RHI::InitializeNull(UINT Width, UINT Height, bool bInUseD3DNullDriver)
+{
+    // 스왑체인이 없으므로 D2D 오버레이는 초기화하지 않는다
+    bNullRHI = true;
+    if (!CreateNullDevice(Width, Height, bInUseD3DNullDriver))
+    {
+        return false;
+    }
+    CreateDeviceResources();
+    return true;
+}
+
+void D3D11RHI::CreateDeviceResources()
+{
     CreateFrameBuffer();
     CreateIdBuffer();
     CreateRasterizerState();
@@ -16,9 +36,6 @@ void D3D11RHI::Initialize(HWND hWindow)
 	CreateDepthStencilState();
 	CreateSamplerState();
     UResourceManager::GetInstance().Initialize(Device,DeviceContext);
-
-    // Initialize Direct2D overlay after device/swapchain ready
-    UStatsOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
 }
 
 void D3D11RHI::Release()
@@ -291,6 +308,7 @@ HRESULT D3D11RHI::CreateIndexBuffer(ID3D11Device* device, const FStaticMesh* mes
 
 void D3D11RHI::ConstantBufferSet(ID3D11Buffer* ConstantBuffer, uint32 Slot, bool bIsVS, bool bIsPS)
 {
+    ++CommandStats.ConstantBufferBinds;
     if (bIsVS)
     {
         DeviceContext->VSSetConstantBuffers(Slot, 1, &ConstantBuffer);
@@ -309,6 +327,7 @@ void D3D11RHI::IASetPrimitiveTopology()
 
 void D3D11RHI::RSSetState(ERasterizerMode ViewModeIndex)
 {
+    ++CommandStats.RasterizerStateChanges;
 	switch (ViewModeIndex)
 	{
 	case ERasterizerMode::Solid:
@@ -380,6 +399,7 @@ ID3D11ShaderResourceView* D3D11RHI::GetSRV(RHI_SRV_Index SRVIndex) const
 
 void D3D11RHI::OMSetRenderTargets(ERTVMode RTVMode)
 {
+    ++CommandStats.RenderTargetChanges;
     switch (RTVMode)
     {
     case ERTVMode::BackBufferWithDepth:
@@ -430,6 +450,7 @@ void D3D11RHI::OMSetRenderTargets(ERTVMode RTVMode)
 
 void D3D11RHI::OMSetBlendState(bool bIsBlendMode)
 {
+    ++CommandStats.BlendStateChanges;
     if (bIsBlendMode == true)
     {
         float blendFactor[4] = { 0, 0, 0, 0 };
@@ -450,13 +471,20 @@ void D3D11RHI::DrawFullScreenQuad()
     DeviceContext->IASetIndexBuffer(nullptr, DXGI_FORMAT_UNKNOWN, 0);
     DeviceContext->IASetInputLayout(nullptr); // Input Layout도 필요 없습니다.
     DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    ++CommandStats.InputAssemblerChanges;
 
     // 2. 정점 셰이더를 6번 실행하여 큰 삼각형 2개를 그리도록 명령합니다.
     DeviceContext->Draw(6, 0);
+    ++CommandStats.DrawCalls;
+    CommandStats.Primitives += 2;
 }
 
 void D3D11RHI::Present()
 {
+    // Null RHI는 화면 출력이 없다
+    if (!SwapChain)
+        return;
+
 #ifndef _RELEASE_STANDALONE
     // Draw any Direct2D overlays before present (에디터 모드에서만)
     UStatsOverlayD2D::Get().Draw();
@@ -491,6 +519,7 @@ void D3D11RHI::CreateDeviceAndSwapChain(HWND hWindow)
         createDeviceFlags,
         featurelevels, ARRAYSIZE(featurelevels), D3D11_SDK_VERSION,
         &swapchaindesc, &SwapChain, &Device, nullptr, &DeviceContext);
+    DriverType = D3D_DRIVER_TYPE_HARDWARE;
     // 생성된 스왑 체인의 정보 가져오기
     SwapChain->GetDesc(&swapchaindesc);
 
@@ -498,13 +527,88 @@ void D3D11RHI::CreateDeviceAndSwapChain(HWND hWindow)
     ViewportInfo = { 0.0f, 0.0f, (float)swapchaindesc.BufferDesc.Width, (float)swapchaindesc.BufferDesc.Height, 0.0f, 1.0f };
 }
 
+bool D3D11RHI::CreateNullDevice(UINT Width, UINT Height, bool bUseD3DNullDriver)
+{
+    if (!bUseD3DNullDriver)
+    {
+        // 카운터 전용 디바이스: D3D 런타임/드라이버를 전혀 호출하지 않으므로 그래픽 도구나 WARP 없이 만들어진다
+        bCounterOnlyRHI = true;
+        DriverType = D3D_DRIVER_TYPE_UNKNOWN;
+        const HRESULT hr = CreateNullRHIDevice(&NullRHICallStats, &Device, &DeviceContext);
+        if (FAILED(hr))
+        {
+            UE_LOG("D3D11RHI: Failed to create counter-only device (0x%08X)\n", (uint32)hr);
+            bCounterOnlyRHI = false;
+            return false;
+        }
+
+        UE_LOG("D3D11RHI: Created %s device without swap chain\n", GetDriverTypeName());
+        ViewportInfo = { 0.0f, 0.0f, (float)Width, (float)Height, 0.0f, 1.0f };
+        return true;
+    }
+
+    D3D_FEATURE_LEVEL featurelevels[] = { D3D_FEATURE_LEVEL_11_0 };
+
+    // NULL 드라이버는 API 호출 검증만 하고 실제 래스터라이즈/셰이딩을 하지 않으므로
+    // 렌더 스레드의 CPU 비용(수집, 정렬, 상태 캐싱, 버퍼 갱신)만 측정할 수 있다
+    UINT createDeviceFlags = D3D11_CREATE_DEVICE_BGRA_SUPPORT;
+
+    DriverType = D3D_DRIVER_TYPE_NULL;
+    HRESULT hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_NULL, nullptr,
+        createDeviceFlags,
+        featurelevels, ARRAYSIZE(featurelevels), D3D11_SDK_VERSION,
+        &Device, nullptr, &DeviceContext);
+    if (FAILED(hr))
+    {
+        // NULL 드라이버는 그래픽 도구(SDK 레이어)가 설치된 환경에서만 제공되므로 WARP로 대체.
+        // WARP는 CPU에서 실제로 래스터라이즈하므로 호출부가 GetDriverType으로 확인할 수 있게 기록해 둔다
+        UE_LOG("D3D11RHI: NULL driver unavailable (0x%08X), falling back to WARP\n", (uint32)hr);
+        DriverType = D3D_DRIVER_TYPE_WARP;
+        hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_WARP, nullptr,
+            createDeviceFlags,
+            featurelevels, ARRAYSIZE(featurelevels), D3D11_SDK_VERSION,
+            &Device, nullptr, &DeviceContext);
+    }
+    if (FAILED(hr) || !Device || !DeviceContext)
+    {
+        UE_LOG("D3D11RHI: Failed to create null device (0x%08X)\n", (uint32)hr);
+        DriverType = D3D_DRIVER_TYPE_UNKNOWN;
+        return false;
+    }
+
+    UE_LOG("D3D11RHI: Created %s device without swap chain\n", GetDriverTypeName());
+    ViewportInfo = { 0.0f, 0.0f, (float)Width, (float)Height, 0.0f, 1.0f };
+    return true;
+}
+
 void D3D11RHI::CreateFrameBuffer()
 {
-    DXGI_SWAP_CHAIN_DESC swapDesc;
-    SwapChain->GetDesc(&swapDesc);
+    DXGI_SWAP_CHAIN_DESC swapDesc = {};
+    if (SwapChain)
+    {
+        SwapChain->GetDesc(&swapDesc);
 
-    // 백 버퍼 가져오기
-    SwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&FrameBuffer);
+        // 백 버퍼 가져오기
+        SwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&FrameBuffer);
+    }
+    else
+    {
+        // Null RHI: 스왑체인 백 버퍼 대신 같은 포맷의 오프스크린 텍스처를 사용
+        swapDesc.BufferDesc.Width = (UINT)ViewportInfo.Width;
+        swapDesc.BufferDesc.Height = (UINT)ViewportInfo.Height;
+
+        D3D11_TEXTURE2D_DESC FrameBufferDesc = {};
+        FrameBufferDesc.Width = swapDesc.BufferDesc.Width;
+        FrameBufferDesc.Height = swapDesc.BufferDesc.Height;
+        FrameBufferDesc.MipLevels = 1;
+        FrameBufferDesc.ArraySize = 1;
+        FrameBufferDesc.Format = DXGI_FORMAT_B8G8R8A8_TYPELESS; // UNORM_SRGB RTV를 만들 수 있도록 Typeless
+        FrameBufferDesc.SampleDesc.Count = 1;
+        FrameBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+        FrameBufferDesc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+        Device->CreateTexture2D(&FrameBufferDesc, nullptr, &FrameBuffer);
+    }
 
     // 렌더 타겟 뷰 생성
     D3D11_RENDER_TARGET_VIEW_DESC framebufferRTVdesc = {};
@@ -573,8 +677,16 @@ void D3D11RHI::CreateFrameBuffer()
 void D3D11RHI::CreateIdBuffer()
 {
 
-    DXGI_SWAP_CHAIN_DESC SwapDesc;
-    SwapChain->GetDesc(&SwapDesc);
+    DXGI_SWAP_CHAIN_DESC SwapDesc = {};
+    if (SwapChain)
+    {
+        SwapChain->GetDesc(&SwapDesc);
+    }
+    else
+    {
+        SwapDesc.BufferDesc.Width = (UINT)ViewportInfo.Width;
+        SwapDesc.BufferDesc.Height = (UINT)ViewportInfo.Height;
+    }
 
     D3D11_TEXTURE2D_DESC TextureDesc{};
     TextureDesc.Format = DXGI_FORMAT_R32_UINT;
@@ -854,6 +966,7 @@ void D3D11RHI::ReleaseDeviceAndSwapChain()
 
 void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
 {
+    ++CommandStats.DepthStencilStateChanges;
     switch (Func)
     {
     case EComparisonFunc::Always:
@@ -873,12 +986,14 @@ void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
 
 void D3D11RHI::OMSetDepthStencilState_OverlayWriteStencil()
 {
+    ++CommandStats.DepthStencilStateChanges;
     // Stencil ref = 1 (overlay marks)
     DeviceContext->OMSetDepthStencilState(DepthStencilStateOverlayWriteStencil, 1);
 }
 
 void D3D11RHI::OMSetDepthStencilState_StencilRejectOverlay()
 {
+    ++CommandStats.DepthStencilStateChanges;
     // Stencil ref = 0 (draw only where overlay not marked)
     DeviceContext->OMSetDepthStencilState(DepthStencilStateStencilRejectOverlay, 0);
 }
@@ -1067,6 +1182,7 @@ ID3D11SamplerState* D3D11RHI::GetSamplerState(RHI_Sampler_Index SamplerIndex) co
 
 void D3D11RHI::PrepareShader(FShader& InShader)
 {
+    ++CommandStats.ShaderChanges;
     GetDeviceContext()->VSSetShader(InShader.SimpleVertexShader, nullptr, 0);
     GetDeviceContext()->PSSetShader(InShader.SimplePixelShader, nullptr, 0);
     GetDeviceContext()->IASetInputLayout(InShader.SimpleInputLayout);
@@ -1074,6 +1190,7 @@ void D3D11RHI::PrepareShader(FShader& InShader)
 
 void D3D11RHI::PrepareShader(UShader* InShader)
 {
+    ++CommandStats.ShaderChanges;
     GetDeviceContext()->VSSetShader(InShader->GetVertexShader(), nullptr, 0);
     GetDeviceContext()->PSSetShader(InShader->GetPixelShader(), nullptr, 0);
     GetDeviceContext()->IASetInputLayout(InShader->GetInputLayout());
@@ -1081,6 +1198,7 @@ void D3D11RHI::PrepareShader(UShader* InShader)
 
 void D3D11RHI::PrepareShader(UShader* InVertexShader, UShader* InPixelShader)
 {
+    ++CommandStats.ShaderChanges;
     GetDeviceContext()->IASetInputLayout(InVertexShader->GetInputLayout());
     GetDeviceContext()->VSSetShader(InVertexShader->GetVertexShader(), nullptr, 0);
 
@@ -1135,6 +1253,7 @@ void D3D11RHI::UpdateStructuredBuffer(ID3D11Buffer* InBuffer, const void* InData
     if (!InBuffer || !InData)
         return;
 
+    ++CommandStats.StructuredBufferUpdates;
     D3D11_MAPPED_SUBRESOURCE mappedResource;
     HRESULT hr = DeviceContext->Map(InBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
     if (SUCCEEDED(hr))
@@ -3,6 +3,7 @@
 #include "ResourceManager.h"
 #include "VertexData.h"
 #include "ConstantBufferType.h"
+#include "NullRHI.h"
 
 
 #define DECLARE_CONSTANT_BUFFER(TYPE)\
@@ -42,6 +43,35 @@ enum class EComparisonFunc
 	// 필요시 추가 후 OMSetDepthStencilState 함수 수정
 };
 
+/**
+ * @brief 한 프레임 동안 RHI로 제출된 명령과 상태 변경 횟수입니다.
+ * URenderer::BeginFrame에서 초기화되며, 헤드리스 렌더 벤치마크가 프레임마다 읽어 갑니다.
+ */
+struct FRHICommandStats
+{
+	uint32 DrawCalls = 0;				// Draw / DrawIndexed 호출 수
+	uint32 Primitives = 0;				// 그린 삼각형(선) 수 (IndexCount / 3 근사)
+	uint32 ShaderChanges = 0;			// VS/PS/InputLayout 교체
+	uint32 InputAssemblerChanges = 0;	// VB/IB/Topology 교체
+	uint32 ShaderResourceBinds = 0;		// PSSetShaderResources 호출 수
+	uint32 SamplerBinds = 0;			// PSSetSamplers 호출 수
+	uint32 ConstantBufferUpdates = 0;	// 상수 버퍼 Map/Unmap
+	uint32 ConstantBufferBinds = 0;		// 상수 버퍼 슬롯 바인딩
+	uint32 StructuredBufferUpdates = 0;	// 구조화 버퍼 갱신 (라이트 버퍼 등)
+	uint32 RenderTargetChanges = 0;		// OMSetRenderTargets
+	uint32 BlendStateChanges = 0;
+	uint32 DepthStencilStateChanges = 0;
+	uint32 RasterizerStateChanges = 0;
+
+	/** @return 드로우를 제외한 모든 상태 변경 횟수의 합 */
+	uint32 GetStateChangeCount() const
+	{
+		return ShaderChanges + InputAssemblerChanges + ShaderResourceBinds + SamplerBinds
+			+ ConstantBufferBinds + RenderTargetChanges + BlendStateChanges
+			+ DepthStencilStateChanges + RasterizerStateChanges;
+	}
+};
+
 class D3D11RHI
 {
 public:
@@ -55,6 +85,39 @@ public:
 public:
 	void Initialize(HWND hWindow);
 
+	/**
+	 * @brief 스왑체인 없이 화면 출력 없는 디바이스를 만듭니다.
+	 * 기본은 드라이버를 거치지 않는 카운터 전용 디바이스(NullRHI.h)로, 어떤 Windows 환경에서도 만들어집니다.
+	 * bInUseD3DNullDriver면 D3D NULL 드라이버(그래픽 도구 필요, 없으면 WARP)를 써서 런타임의 API 검증을 거칩니다.
+	 * 백 버퍼는 오프스크린 텍스처로 대체되고 Present는 아무 일도 하지 않습니다.
+	 * GPU 없는 환경에서 렌더 스레드 CPU 비용만 측정하는 헤드리스 벤치마크용입니다.
+	 * @return 디바이스를 만들지 못하면 false
+	 */
+	bool InitializeNull(UINT Width, UINT Height, bool bInUseD3DNullDriver = false);
+
+	/** @return InitializeNull로 초기화되어 화면 출력이 없는 상태인지 여부 */
+	bool IsNullRHI() const { return bNullRHI; }
+
+	/** @return D3D 드라이버 없이 호출 수만 세는 카운터 전용 디바이스인지 여부 */
+	bool IsCounterOnlyRHI() const { return bCounterOnlyRHI; }
+
+	/** @return 실제로 만들어진 디바이스의 드라이버 종류 (NULL 요청이 WARP로 대체됐는지 확인용). 카운터 전용이면 UNKNOWN */
+	D3D_DRIVER_TYPE GetDriverType() const { return DriverType; }
+	const char* GetDriverTypeName() const
+	{
+		if (bCounterOnlyRHI)
+		{
+			return "NullCounter";
+		}
+		switch (DriverType)
+		{
+		case D3D_DRIVER_TYPE_HARDWARE: return "Hardware";
+		case D3D_DRIVER_TYPE_NULL: return "Null";
+		case D3D_DRIVER_TYPE_WARP: return "WARP";
+		default: return "Unknown";
+		}
+	}
+
 	void Release();
 
 
@@ -89,7 +152,9 @@ public:
 	{
 		D3D11_MAPPED_SUBRESOURCE MSR;
 
-		DeviceContext->Map(ConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR);
+		++CommandStats.ConstantBufferUpdates;
+		if (FAILED(DeviceContext->Map(ConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR)))
+			return;
 		memcpy(MSR.pData, &Data, sizeof(T));
 		DeviceContext->Unmap(ConstantBuffer, 0);
 	}
@@ -177,8 +242,22 @@ public:
     // RTV Getters
     ID3D11RenderTargetView* GetBackBufferRTV() const { return BackBufferRTV; }
 
+	// 명령/상태 변경 카운터 (DeviceContext를 직접 쓰는 호출부도 여기에 기록)
+	FRHICommandStats& GetCommandStats() { return CommandStats; }
+	const FRHICommandStats& GetCommandStats() const { return CommandStats; }
+	void ResetCommandStats()
+	{
+		CommandStats = FRHICommandStats();
+		NullRHICallStats = FNullRHICallStats();
+	}
+
+	// 카운터 전용 디바이스의 컨텍스트가 직접 센 호출 수 (IsCounterOnlyRHI일 때만 의미 있음)
+	const FNullRHICallStats& GetNullRHICallStats() const { return NullRHICallStats; }
+
 private:
 	void CreateDeviceAndSwapChain(HWND hWindow); // 여기서 디바이스, 디바이스 컨택스트, 스왑체인, 뷰포트를 초기화한다
+	bool CreateNullDevice(UINT Width, UINT Height, bool bUseD3DNullDriver); // 스왑체인 없이 디바이스, 디바이스 컨택스트, 뷰포트를 초기화한다
+	void CreateDeviceResources(); // 디바이스 생성 이후 공통 리소스(프레임 버퍼, 상태 객체, 상수 버퍼) 생성
 	void CreateFrameBuffer();
 	void CreateIdBuffer();
 	void CreateRasterizerState();
@@ -257,6 +336,12 @@ private:
 
 	UShader* PreShader = nullptr; // Shaders, Inputlayout
 
+	FRHICommandStats CommandStats;
+	FNullRHICallStats NullRHICallStats;
+
+	bool bNullRHI = false;
+	bool bCounterOnlyRHI = false;
+	D3D_DRIVER_TYPE DriverType = D3D_DRIVER_TYPE_UNKNOWN;
 	bool bReleased = false; // Prevent double Release() calls
 };
 
@@ -0,0 +1,799 @@
+﻿#include "pch.h"
+#include "NullRHI.h"
+
+namespace
+{
+	/** IUnknown 참조 카운트 공통 구현 */
+	template<typename TInterface>
+	class TNullUnknown : public TInterface
+	{
+	public:
+		virtual ~TNullUnknown() = default;
+
+		ULONG STDMETHODCALLTYPE AddRef() override
+		{
+			return ++RefCount;
+		}
+
+		ULONG STDMETHODCALLTYPE Release() override
+		{
+			const ULONG NewCount = --RefCount;
+			if (NewCount == 0)
+			{
+				delete this;
+			}
+			return NewCount;
+		}
+
+	protected:
+		/** IUnknown / 구현한 인터페이스 / 그 부모 인터페이스면 this를 돌려준다 */
+		HRESULT QueryThis(REFIID Riid, void** OutObject, std::initializer_list<IID> InSupported)
+		{
+			if (!OutObject)
+			{
+				return E_POINTER;
+			}
+			for (const IID& Supported : InSupported)
+			{
+				if (Riid == Supported)
+				{
+					*OutObject = static_cast<TInterface*>(this);
+					AddRef();
+					return S_OK;
+				}
+			}
+			*OutObject = nullptr;
+			return E_NOINTERFACE;
+		}
+
+	private:
+		std::atomic<ULONG> RefCount{ 1 };
+	};
+
+	/**
+	 * ID3D11DeviceChild 공통 구현. 실제 D3D와 같이 자식 객체가 디바이스 참조를 잡는다.
+	 * 디버그 이름(SetPrivateData)은 보관하지 않는다.
+	 */
+	template<typename TInterface>
+	class TNullDeviceChild : public TNullUnknown<TInterface>
+	{
+	public:
+		explicit TNullDeviceChild(ID3D11Device* InDevice)
+			: Device(InDevice)
+		{
+			Device->AddRef();
+		}
+		~TNullDeviceChild() override
+		{
+			Device->Release();
+		}
+
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID Riid, void** OutObject) override
+		{
+			return this->QueryThis(Riid, OutObject, { __uuidof(IUnknown), __uuidof(ID3D11DeviceChild), __uuidof(TInterface), GetParentInterface() });
+		}
+
+		void STDMETHODCALLTYPE GetDevice(ID3D11Device** OutDevice) override
+		{
+			Device->AddRef();
+			*OutDevice = Device;
+		}
+		HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID Guid, UINT* DataSize, void* Data) override
+		{
+			if (DataSize)
+			{
+				*DataSize = 0;
+			}
+			return DXGI_ERROR_NOT_FOUND;
+		}
+		HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID Guid, UINT DataSize, const void* Data) override { return S_OK; }
+		HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID Guid, const IUnknown* Data) override { return S_OK; }
+
+	protected:
+		/** ID3D11Resource / ID3D11View처럼 DeviceChild와 최종 인터페이스 사이의 부모. 없으면 DeviceChild */
+		virtual IID GetParentInterface() const { return __uuidof(ID3D11DeviceChild); }
+
+	private:
+		ID3D11Device* Device;
+	};
+
+	/** 셰이더 / 입력 레이아웃처럼 추가 메서드가 없는 객체 */
+	template<typename TInterface>
+	class TNullObject final : public TNullDeviceChild<TInterface>
+	{
+	public:
+		using TNullDeviceChild<TInterface>::TNullDeviceChild;
+	};
+
+	/** 블렌드 / 깊이 스텐실 / 래스터라이저 / 샘플러 상태. 생성 설명자를 그대로 돌려준다 */
+	template<typename TInterface, typename TDesc>
+	class TNullState final : public TNullDeviceChild<TInterface>
+	{
+	public:
+		TNullState(ID3D11Device* InDevice, const TDesc& InDesc)
+			: TNullDeviceChild<TInterface>(InDevice)
+			, Desc(InDesc)
+		{
+		}
+
+		void STDMETHODCALLTYPE GetDesc(TDesc* OutDesc) override { *OutDesc = Desc; }
+
+	private:
+		TDesc Desc;
+	};
+
+	/**
+	 * Map이 돌려줄 CPU 메모리. 처음 Map할 때 할당한다.
+	 * 포맷별 크기를 계산하지 않고 텍셀당 16바이트(가장 큰 포맷)로 잡아, 호출부가 RowPitch를 따르는 한 넘치지 않는다.
+	 */
+	class FNullResourceMemory
+	{
+	public:
+		virtual ~FNullResourceMemory() = default;
+
+		bool Map(D3D11_MAPPED_SUBRESOURCE* OutMapped)
+		{
+			if (!bMappable || !OutMapped)
+			{
+				return false;
+			}
+			if (Memory.empty())
+			{
+				Memory.resize(MemorySize);
+			}
+			OutMapped->pData = Memory.data();
+			OutMapped->RowPitch = RowPitch;
+			OutMapped->DepthPitch = DepthPitch;
+			return true;
+		}
+
+	protected:
+		void SetLayout(bool bInMappable, UINT InRowPitch, UINT InDepthPitch, SIZE_T InMemorySize)
+		{
+			bMappable = bInMappable;
+			RowPitch = InRowPitch;
+			DepthPitch = InDepthPitch;
+			MemorySize = InMemorySize;
+		}
+
+		static bool IsMappable(D3D11_USAGE Usage, UINT CPUAccessFlags)
+		{
+			return Usage == D3D11_USAGE_DYNAMIC || Usage == D3D11_USAGE_STAGING || CPUAccessFlags != 0;
+		}
+
+		static constexpr UINT MaxBytesPerTexel = 16;
+
+	private:
+		std::vector<uint8> Memory;
+		SIZE_T MemorySize = 0;
+		UINT RowPitch = 0;
+		UINT DepthPitch = 0;
+		bool bMappable = false;
+	};
+
+	/** 버퍼 / 텍스처. 초기 데이터는 버리고 설명자와 Map용 메모리 크기만 보관한다 */
+	template<typename TInterface, typename TDesc, D3D11_RESOURCE_DIMENSION Dimension>
+	class TNullResource final : public TNullDeviceChild<TInterface>, public FNullResourceMemory
+	{
+	public:
+		TNullResource(ID3D11Device* InDevice, const TDesc& InDesc)
+			: TNullDeviceChild<TInterface>(InDevice)
+			, Desc(InDesc)
+		{
+			const bool bMappable = IsMappable(Desc.Usage, Desc.CPUAccessFlags);
+			if constexpr (Dimension == D3D11_RESOURCE_DIMENSION_BUFFER)
+			{
+				SetLayout(bMappable, Desc.ByteWidth, Desc.ByteWidth, Desc.ByteWidth);
+			}
+			else if constexpr (Dimension == D3D11_RESOURCE_DIMENSION_TEXTURE1D)
+			{
+				const UINT Pitch = Desc.Width * MaxBytesPerTexel;
+				SetLayout(bMappable, Pitch, Pitch, Pitch);
+			}
+			else if constexpr (Dimension == D3D11_RESOURCE_DIMENSION_TEXTURE2D)
+			{
+				const UINT Pitch = Desc.Width * MaxBytesPerTexel;
+				SetLayout(bMappable, Pitch, Pitch * Desc.Height, static_cast<SIZE_T>(Pitch) * Desc.Height);
+			}
+			else
+			{
+				const UINT Pitch = Desc.Width * MaxBytesPerTexel;
+				SetLayout(bMappable, Pitch, Pitch * Desc.Height, static_cast<SIZE_T>(Pitch) * Desc.Height * Desc.Depth);
+			}
+		}
+
+		void STDMETHODCALLTYPE GetType(D3D11_RESOURCE_DIMENSION* OutDimension) override { *OutDimension = Dimension; }
+		void STDMETHODCALLTYPE SetEvictionPriority(UINT InEvictionPriority) override { EvictionPriority = InEvictionPriority; }
+		UINT STDMETHODCALLTYPE GetEvictionPriority() override { return EvictionPriority; }
+		void STDMETHODCALLTYPE GetDesc(TDesc* OutDesc) override { *OutDesc = Desc; }
+
+	protected:
+		IID GetParentInterface() const override { return __uuidof(ID3D11Resource); }
+
+	private:
+		TDesc Desc;
+		UINT EvictionPriority = 0;
+	};
+
+	using FNullBuffer = TNullResource<ID3D11Buffer, D3D11_BUFFER_DESC, D3D11_RESOURCE_DIMENSION_BUFFER>;
+	using FNullTexture1D = TNullResource<ID3D11Texture1D, D3D11_TEXTURE1D_DESC, D3D11_RESOURCE_DIMENSION_TEXTURE1D>;
+	using FNullTexture2D = TNullResource<ID3D11Texture2D, D3D11_TEXTURE2D_DESC, D3D11_RESOURCE_DIMENSION_TEXTURE2D>;
+	using FNullTexture3D = TNullResource<ID3D11Texture3D, D3D11_TEXTURE3D_DESC, D3D11_RESOURCE_DIMENSION_TEXTURE3D>;
+
+	/** SRV / RTV / DSV / UAV. 원본 리소스 참조를 잡는다. 설명자가 없으면 0으로 채운 설명자를 돌려준다 */
+	template<typename TInterface, typename TDesc>
+	class TNullView final : public TNullDeviceChild<TInterface>
+	{
+	public:
+		TNullView(ID3D11Device* InDevice, ID3D11Resource* InResource, const TDesc* InDesc)
+			: TNullDeviceChild<TInterface>(InDevice)
+			, Resource(InResource)
+			, Desc(InDesc ? *InDesc : TDesc{})
+		{
+			Resource->AddRef();
+		}
+		~TNullView() override
+		{
+			Resource->Release();
+		}
+
+		void STDMETHODCALLTYPE GetResource(ID3D11Resource** OutResource) override
+		{
+			Resource->AddRef();
+			*OutResource = Resource;
+		}
+		void STDMETHODCALLTYPE GetDesc(TDesc* OutDesc) override { *OutDesc = Desc; }
+
+	protected:
+		IID GetParentInterface() const override { return __uuidof(ID3D11View); }
+
+	private:
+		ID3D11Resource* Resource;
+		TDesc Desc;
+	};
+
+	/**
+	 * 카운터 전용 즉시 컨텍스트. 파이프라인에 아무것도 바인딩하지 않고 호출 수만 센다.
+	 * 읽어 가는 호출부가 있는 뷰포트 / 시저 / 토폴로지만 보관하고, 나머지 Get*은 빈 값(nullptr)을 돌려준다.
+	 */
+	class FNullDeviceContext final : public TNullUnknown<ID3D11DeviceContext>
+	{
+	public:
+		FNullDeviceContext(ID3D11Device* InDevice, FNullRHICallStats* InStats)
+			: Device(InDevice)
+			, Stats(InStats)
+		{
+		}
+
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID Riid, void** OutObject) override
+		{
+			return QueryThis(Riid, OutObject, { __uuidof(IUnknown), __uuidof(ID3D11DeviceChild), __uuidof(ID3D11DeviceContext) });
+		}
+
+		// 디바이스가 즉시 컨텍스트를 소유하므로 컨텍스트는 디바이스 참조를 잡지 않는다 (순환 참조 방지)
+		void STDMETHODCALLTYPE GetDevice(ID3D11Device** OutDevice) override
+		{
+			Device->AddRef();
+			*OutDevice = Device;
+		}
+		HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID Guid, UINT* DataSize, void* Data) override
+		{
+			if (DataSize)
+			{
+				*DataSize = 0;
+			}
+			return DXGI_ERROR_NOT_FOUND;
+		}
+		HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID Guid, UINT DataSize, const void* Data) override { return S_OK; }
+		HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID Guid, const IUnknown* Data) override { return S_OK; }
+
+		// ───── 드로우 / 디스패치 ─────
+
+		void STDMETHODCALLTYPE Draw(UINT VertexCount, UINT StartVertexLocation) override
+		{
+			CountDraw(VertexCount, 1);
+		}
+		void STDMETHODCALLTYPE DrawIndexed(UINT IndexCount, UINT StartIndexLocation, INT BaseVertexLocation) override
+		{
+			CountDraw(IndexCount, 1);
+		}
+		void STDMETHODCALLTYPE DrawInstanced(UINT VertexCountPerInstance, UINT InstanceCount, UINT StartVertexLocation, UINT StartInstanceLocation) override
+		{
+			CountDraw(VertexCountPerInstance, InstanceCount);
+		}
+		void STDMETHODCALLTYPE DrawIndexedInstanced(UINT IndexCountPerInstance, UINT InstanceCount, UINT StartIndexLocation, INT BaseVertexLocation, UINT StartInstanceLocation) override
+		{
+			CountDraw(IndexCountPerInstance, InstanceCount);
+		}
+		void STDMETHODCALLTYPE DrawAuto() override { ++Stats->DrawCalls; }
+		void STDMETHODCALLTYPE DrawIndexedInstancedIndirect(ID3D11Buffer* BufferForArgs, UINT AlignedByteOffsetForArgs) override { ++Stats->DrawCalls; }
+		void STDMETHODCALLTYPE DrawInstancedIndirect(ID3D11Buffer* BufferForArgs, UINT AlignedByteOffsetForArgs) override { ++Stats->DrawCalls; }
+		void STDMETHODCALLTYPE Dispatch(UINT ThreadGroupCountX, UINT ThreadGroupCountY, UINT ThreadGroupCountZ) override { ++Stats->Dispatches; }
+		void STDMETHODCALLTYPE DispatchIndirect(ID3D11Buffer* BufferForArgs, UINT AlignedByteOffsetForArgs) override { ++Stats->Dispatches; }
+
+		// ───── 리소스 갱신 ─────
+
+		HRESULT STDMETHODCALLTYPE Map(ID3D11Resource* Resource, UINT Subresource, D3D11_MAP MapType, UINT MapFlags, D3D11_MAPPED_SUBRESOURCE* MappedResource) override
+		{
+			++Stats->ResourceUpdates;
+			FNullResourceMemory* Memory = dynamic_cast<FNullResourceMemory*>(Resource);
+			return (Memory && Memory->Map(MappedResource)) ? S_OK : E_INVALIDARG;
+		}
+		void STDMETHODCALLTYPE Unmap(ID3D11Resource* Resource, UINT Subresource) override {}
+		void STDMETHODCALLTYPE CopySubresourceRegion(ID3D11Resource* DstResource, UINT DstSubresource, UINT DstX, UINT DstY, UINT DstZ, ID3D11Resource* SrcResource, UINT SrcSubresource, const D3D11_BOX* SrcBox) override { ++Stats->ResourceUpdates; }
+		void STDMETHODCALLTYPE CopyResource(ID3D11Resource* DstResource, ID3D11Resource* SrcResource) override { ++Stats->ResourceUpdates; }
+		void STDMETHODCALLTYPE UpdateSubresource(ID3D11Resource* DstResource, UINT DstSubresource, const D3D11_BOX* DstBox, const void* SrcData, UINT SrcRowPitch, UINT SrcDepthPitch) override { ++Stats->ResourceUpdates; }
+		void STDMETHODCALLTYPE CopyStructureCount(ID3D11Buffer* DstBuffer, UINT DstAlignedByteOffset, ID3D11UnorderedAccessView* SrcView) override { ++Stats->ResourceUpdates; }
+		void STDMETHODCALLTYPE GenerateMips(ID3D11ShaderResourceView* ShaderResourceView) override { ++Stats->ResourceUpdates; }
+		void STDMETHODCALLTYPE ResolveSubresource(ID3D11Resource* DstResource, UINT DstSubresource, ID3D11Resource* SrcResource, UINT SrcSubresource, DXGI_FORMAT Format) override { ++Stats->ResourceUpdates; }
+		void STDMETHODCALLTYPE SetResourceMinLOD(ID3D11Resource* Resource, FLOAT MinLOD) override {}
+		FLOAT STDMETHODCALLTYPE GetResourceMinLOD(ID3D11Resource* Resource) override { return 0.0f; }
+
+		// ───── 클리어 ─────
+
+		void STDMETHODCALLTYPE ClearRenderTargetView(ID3D11RenderTargetView* RenderTargetView, const FLOAT ColorRGBA[4]) override { ++Stats->Clears; }
+		void STDMETHODCALLTYPE ClearUnorderedAccessViewUint(ID3D11UnorderedAccessView* UnorderedAccessView, const UINT Values[4]) override { ++Stats->Clears; }
+		void STDMETHODCALLTYPE ClearUnorderedAccessViewFloat(ID3D11UnorderedAccessView* UnorderedAccessView, const FLOAT Values[4]) override { ++Stats->Clears; }
+		void STDMETHODCALLTYPE ClearDepthStencilView(ID3D11DepthStencilView* DepthStencilView, UINT ClearFlags, FLOAT Depth, UINT8 Stencil) override { ++Stats->Clears; }
+
+		// ───── 입력 어셈블러 ─────
+
+		void STDMETHODCALLTYPE IASetInputLayout(ID3D11InputLayout* InputLayout) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE IASetVertexBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer* const* VertexBuffers, const UINT* Strides, const UINT* Offsets) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE IASetIndexBuffer(ID3D11Buffer* IndexBuffer, DXGI_FORMAT Format, UINT Offset) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) override
+		{
+			++Stats->StateCalls;
+			Topology = InTopology;
+		}
+
+		// ───── 셰이더 스테이지 ─────
+
+		void STDMETHODCALLTYPE VSSetShader(ID3D11VertexShader* Shader, ID3D11ClassInstance* const* ClassInstances, UINT NumClassInstances) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE VSSetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer* const* ConstantBuffers) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE VSSetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* ShaderResourceViews) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE VSSetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* Samplers) override { ++Stats->StateCalls; }
+
+		void STDMETHODCALLTYPE PSSetShader(ID3D11PixelShader* Shader, ID3D11ClassInstance* const* ClassInstances, UINT NumClassInstances) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE PSSetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer* const* ConstantBuffers) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE PSSetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* ShaderResourceViews) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE PSSetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* Samplers) override { ++Stats->StateCalls; }
+
+		void STDMETHODCALLTYPE GSSetShader(ID3D11GeometryShader* Shader, ID3D11ClassInstance* const* ClassInstances, UINT NumClassInstances) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE GSSetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer* const* ConstantBuffers) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE GSSetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* ShaderResourceViews) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE GSSetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* Samplers) override { ++Stats->StateCalls; }
+
+		void STDMETHODCALLTYPE HSSetShader(ID3D11HullShader* Shader, ID3D11ClassInstance* const* ClassInstances, UINT NumClassInstances) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE HSSetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer* const* ConstantBuffers) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE HSSetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* ShaderResourceViews) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE HSSetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* Samplers) override { ++Stats->StateCalls; }
+
+		void STDMETHODCALLTYPE DSSetShader(ID3D11DomainShader* Shader, ID3D11ClassInstance* const* ClassInstances, UINT NumClassInstances) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE DSSetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer* const* ConstantBuffers) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE DSSetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* ShaderResourceViews) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE DSSetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* Samplers) override { ++Stats->StateCalls; }
+
+		void STDMETHODCALLTYPE CSSetShader(ID3D11ComputeShader* Shader, ID3D11ClassInstance* const* ClassInstances, UINT NumClassInstances) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE CSSetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer* const* ConstantBuffers) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE CSSetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* ShaderResourceViews) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE CSSetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* Samplers) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE CSSetUnorderedAccessViews(UINT StartSlot, UINT NumUAVs, ID3D11UnorderedAccessView* const* UnorderedAccessViews, const UINT* UAVInitialCounts) override { ++Stats->StateCalls; }
+
+		// ───── 래스터라이저 / 출력 병합 / 스트림 출력 ─────
+
+		void STDMETHODCALLTYPE RSSetState(ID3D11RasterizerState* RasterizerState) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE RSSetViewports(UINT NumViewports, const D3D11_VIEWPORT* Viewports) override
+		{
+			++Stats->StateCalls;
+			ViewportCount = std::min<UINT>(NumViewports, D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE);
+			std::copy_n(Viewports, ViewportCount, ViewportState);
+		}
+		void STDMETHODCALLTYPE RSSetScissorRects(UINT NumRects, const D3D11_RECT* Rects) override
+		{
+			++Stats->StateCalls;
+			ScissorRectCount = std::min<UINT>(NumRects, D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE);
+			std::copy_n(Rects, ScissorRectCount, ScissorRectState);
+		}
+
+		void STDMETHODCALLTYPE OMSetRenderTargets(UINT NumViews, ID3D11RenderTargetView* const* RenderTargetViews, ID3D11DepthStencilView* DepthStencilView) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE OMSetRenderTargetsAndUnorderedAccessViews(UINT NumRTVs, ID3D11RenderTargetView* const* RenderTargetViews, ID3D11DepthStencilView* DepthStencilView, UINT UAVStartSlot, UINT NumUAVs, ID3D11UnorderedAccessView* const* UnorderedAccessViews, const UINT* UAVInitialCounts) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE OMSetBlendState(ID3D11BlendState* BlendState, const FLOAT BlendFactor[4], UINT SampleMask) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE OMSetDepthStencilState(ID3D11DepthStencilState* DepthStencilState, UINT StencilRef) override { ++Stats->StateCalls; }
+		void STDMETHODCALLTYPE SOSetTargets(UINT NumBuffers, ID3D11Buffer* const* SOTargets, const UINT* Offsets) override { ++Stats->StateCalls; }
+
+		// ───── 쿼리 / 프레디케이션 (CreateQuery를 지원하지 않으므로 호출될 일이 없다) ─────
+
+		void STDMETHODCALLTYPE Begin(ID3D11Asynchronous* Async) override {}
+		void STDMETHODCALLTYPE End(ID3D11Asynchronous* Async) override {}
+		HRESULT STDMETHODCALLTYPE GetData(ID3D11Asynchronous* Async, void* Data, UINT DataSize, UINT GetDataFlags) override { return DXGI_ERROR_INVALID_CALL; }
+		void STDMETHODCALLTYPE SetPredication(ID3D11Predicate* Predicate, BOOL PredicateValue) override {}
+		void STDMETHODCALLTYPE GetPredication(ID3D11Predicate** Predicate, BOOL* PredicateValue) override
+		{
+			ClearOut(Predicate, 1);
+			if (PredicateValue)
+			{
+				*PredicateValue = FALSE;
+			}
+		}
+
+		// ───── 상태 조회. 뷰포트 / 시저 / 토폴로지 외에는 바인딩을 보관하지 않으므로 비어 있음 ─────
+
+		void STDMETHODCALLTYPE RSGetViewports(UINT* NumViewports, D3D11_VIEWPORT* Viewports) override
+		{
+			if (!Viewports)
+			{
+				*NumViewports = ViewportCount;
+				return;
+			}
+			for (UINT Index = 0; Index < *NumViewports; ++Index)
+			{
+				Viewports[Index] = Index < ViewportCount ? ViewportState[Index] : D3D11_VIEWPORT{};
+			}
+		}
+		void STDMETHODCALLTYPE RSGetScissorRects(UINT* NumRects, D3D11_RECT* Rects) override
+		{
+			if (!Rects)
+			{
+				*NumRects = ScissorRectCount;
+				return;
+			}
+			for (UINT Index = 0; Index < *NumRects; ++Index)
+			{
+				Rects[Index] = Index < ScissorRectCount ? ScissorRectState[Index] : D3D11_RECT{};
+			}
+		}
+		void STDMETHODCALLTYPE IAGetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY* OutTopology) override { *OutTopology = Topology; }
+
+		void STDMETHODCALLTYPE IAGetInputLayout(ID3D11InputLayout** InputLayout) override { ClearOut(InputLayout, 1); }
+		void STDMETHODCALLTYPE IAGetVertexBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer** VertexBuffers, UINT* Strides, UINT* Offsets) override
+		{
+			ClearOut(VertexBuffers, NumBuffers);
+			ClearOut(Strides, NumBuffers);
+			ClearOut(Offsets, NumBuffers);
+		}
+		void STDMETHODCALLTYPE IAGetIndexBuffer(ID3D11Buffer** IndexBuffer, DXGI_FORMAT* Format, UINT* Offset) override
+		{
+			ClearOut(IndexBuffer, 1);
+			if (Format)
+			{
+				*Format = DXGI_FORMAT_UNKNOWN;
+			}
+			ClearOut(Offset, 1);
+		}
+
+		void STDMETHODCALLTYPE VSGetShader(ID3D11VertexShader** Shader, ID3D11ClassInstance** ClassInstances, UINT* NumClassInstances) override { ClearShaderOut(Shader, NumClassInstances); }
+		void STDMETHODCALLTYPE VSGetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer** ConstantBuffers) override { ClearOut(ConstantBuffers, NumBuffers); }
+		void STDMETHODCALLTYPE VSGetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView** ShaderResourceViews) override { ClearOut(ShaderResourceViews, NumViews); }
+		void STDMETHODCALLTYPE VSGetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState** Samplers) override { ClearOut(Samplers, NumSamplers); }
+
+		void STDMETHODCALLTYPE PSGetShader(ID3D11PixelShader** Shader, ID3D11ClassInstance** ClassInstances, UINT* NumClassInstances) override { ClearShaderOut(Shader, NumClassInstances); }
+		void STDMETHODCALLTYPE PSGetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer** ConstantBuffers) override { ClearOut(ConstantBuffers, NumBuffers); }
+		void STDMETHODCALLTYPE PSGetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView** ShaderResourceViews) override { ClearOut(ShaderResourceViews, NumViews); }
+		void STDMETHODCALLTYPE PSGetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState** Samplers) override { ClearOut(Samplers, NumSamplers); }
+
+		void STDMETHODCALLTYPE GSGetShader(ID3D11GeometryShader** Shader, ID3D11ClassInstance** ClassInstances, UINT* NumClassInstances) override { ClearShaderOut(Shader, NumClassInstances); }
+		void STDMETHODCALLTYPE GSGetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer** ConstantBuffers) override { ClearOut(ConstantBuffers, NumBuffers); }
+		void STDMETHODCALLTYPE GSGetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView** ShaderResourceViews) override { ClearOut(ShaderResourceViews, NumViews); }
+		void STDMETHODCALLTYPE GSGetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState** Samplers) override { ClearOut(Samplers, NumSamplers); }
+
+		void STDMETHODCALLTYPE HSGetShader(ID3D11HullShader** Shader, ID3D11ClassInstance** ClassInstances, UINT* NumClassInstances) override { ClearShaderOut(Shader, NumClassInstances); }
+		void STDMETHODCALLTYPE HSGetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer** ConstantBuffers) override { ClearOut(ConstantBuffers, NumBuffers); }
+		void STDMETHODCALLTYPE HSGetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView** ShaderResourceViews) override { ClearOut(ShaderResourceViews, NumViews); }
+		void STDMETHODCALLTYPE HSGetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState** Samplers) override { ClearOut(Samplers, NumSamplers); }
+
+		void STDMETHODCALLTYPE DSGetShader(ID3D11DomainShader** Shader, ID3D11ClassInstance** ClassInstances, UINT* NumClassInstances) override { ClearShaderOut(Shader, NumClassInstances); }
+		void STDMETHODCALLTYPE DSGetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer** ConstantBuffers) override { ClearOut(ConstantBuffers, NumBuffers); }
+		void STDMETHODCALLTYPE DSGetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView** ShaderResourceViews) override { ClearOut(ShaderResourceViews, NumViews); }
+		void STDMETHODCALLTYPE DSGetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState** Samplers) override { ClearOut(Samplers, NumSamplers); }
+
+		void STDMETHODCALLTYPE CSGetShader(ID3D11ComputeShader** Shader, ID3D11ClassInstance** ClassInstances, UINT* NumClassInstances) override { ClearShaderOut(Shader, NumClassInstances); }
+		void STDMETHODCALLTYPE CSGetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer** ConstantBuffers) override { ClearOut(ConstantBuffers, NumBuffers); }
+		void STDMETHODCALLTYPE CSGetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView** ShaderResourceViews) override { ClearOut(ShaderResourceViews, NumViews); }
+		void STDMETHODCALLTYPE CSGetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState** Samplers) override { ClearOut(Samplers, NumSamplers); }
+		void STDMETHODCALLTYPE CSGetUnorderedAccessViews(UINT StartSlot, UINT NumUAVs, ID3D11UnorderedAccessView** UnorderedAccessViews) override { ClearOut(UnorderedAccessViews, NumUAVs); }
+
+		void STDMETHODCALLTYPE OMGetRenderTargets(UINT NumViews, ID3D11RenderTargetView** RenderTargetViews, ID3D11DepthStencilView** DepthStencilView) override
+		{
+			ClearOut(RenderTargetViews, NumViews);
+			ClearOut(DepthStencilView, 1);
+		}
+		void STDMETHODCALLTYPE OMGetRenderTargetsAndUnorderedAccessViews(UINT NumRTVs, ID3D11RenderTargetView** RenderTargetViews, ID3D11DepthStencilView** DepthStencilView, UINT UAVStartSlot, UINT NumUAVs, ID3D11UnorderedAccessView** UnorderedAccessViews) override
+		{
+			ClearOut(RenderTargetViews, NumRTVs);
+			ClearOut(DepthStencilView, 1);
+			ClearOut(UnorderedAccessViews, NumUAVs);
+		}
+		void STDMETHODCALLTYPE OMGetBlendState(ID3D11BlendState** BlendState, FLOAT BlendFactor[4], UINT* SampleMask) override
+		{
+			ClearOut(BlendState, 1);
+			ClearOut(BlendFactor, 4);
+			if (SampleMask)
+			{
+				*SampleMask = 0xFFFFFFFF;
+			}
+		}
+		void STDMETHODCALLTYPE OMGetDepthStencilState(ID3D11DepthStencilState** DepthStencilState, UINT* StencilRef) override
+		{
+			ClearOut(DepthStencilState, 1);
+			ClearOut(StencilRef, 1);
+		}
+		void STDMETHODCALLTYPE SOGetTargets(UINT NumBuffers, ID3D11Buffer** SOTargets) override { ClearOut(SOTargets, NumBuffers); }
+		void STDMETHODCALLTYPE RSGetState(ID3D11RasterizerState** RasterizerState) override { ClearOut(RasterizerState, 1); }
+
+		// ───── 컨텍스트 ─────
+
+		void STDMETHODCALLTYPE ClearState() override
+		{
+			ViewportCount = 0;
+			ScissorRectCount = 0;
+			Topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+		}
+		void STDMETHODCALLTYPE Flush() override {}
+		void STDMETHODCALLTYPE ExecuteCommandList(ID3D11CommandList* CommandList, BOOL RestoreContextState) override {}
+		HRESULT STDMETHODCALLTYPE FinishCommandList(BOOL RestoreDeferredContextState, ID3D11CommandList** CommandList) override
+		{
+			ClearOut(CommandList, 1);
+			return DXGI_ERROR_INVALID_CALL;
+		}
+		D3D11_DEVICE_CONTEXT_TYPE STDMETHODCALLTYPE GetType() override { return D3D11_DEVICE_CONTEXT_IMMEDIATE; }
+		UINT STDMETHODCALLTYPE GetContextFlags() override { return 0; }
+
+	private:
+		void CountDraw(UINT ElementCount, UINT InstanceCount)
+		{
+			++Stats->DrawCalls;
+			Stats->Primitives += (ElementCount / 3) * InstanceCount;
+		}
+
+		template<typename T>
+		static void ClearOut(T* Out, UINT Count)
+		{
+			if (Out)
+			{
+				std::fill_n(Out, Count, T{});
+			}
+		}
+
+		template<typename TShader>
+		static void ClearShaderOut(TShader** Shader, UINT* NumClassInstances)
+		{
+			ClearOut(Shader, 1);
+			ClearOut(NumClassInstances, 1);
+		}
+
+		ID3D11Device* Device;
+		FNullRHICallStats* Stats;
+
+		D3D11_VIEWPORT ViewportState[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE] = {};
+		D3D11_RECT ScissorRectState[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE] = {};
+		UINT ViewportCount = 0;
+		UINT ScissorRectCount = 0;
+		D3D11_PRIMITIVE_TOPOLOGY Topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	};
+
+	/**
+	 * 카운터 전용 디바이스. 생성 함수는 설명자만 보관하는 객체를 만들고, 기능 조회는 모두 지원한다고 답한다.
+	 * 쿼리 / 카운터 / 클래스 링키지 / 지연 컨텍스트 / 공유 리소스는 렌더러가 쓰지 않으므로 E_NOTIMPL.
+	 */
+	class FNullDevice final : public TNullUnknown<ID3D11Device>
+	{
+	public:
+		explicit FNullDevice(FNullRHICallStats* InStats)
+		{
+			ImmediateContext = new FNullDeviceContext(this, InStats);
+		}
+		~FNullDevice() override
+		{
+			ImmediateContext->Release();
+		}
+
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID Riid, void** OutObject) override
+		{
+			// ID3D11Debug / IDXGIDevice는 없음. 호출부(D3D11RHI 디버그 리포트, ImGui)는 실패를 처리한다
+			return QueryThis(Riid, OutObject, { __uuidof(IUnknown), __uuidof(ID3D11Device) });
+		}
+
+		// ───── 리소스 ─────
+
+		HRESULT STDMETHODCALLTYPE CreateBuffer(const D3D11_BUFFER_DESC* Desc, const D3D11_SUBRESOURCE_DATA* InitialData, ID3D11Buffer** OutBuffer) override
+		{
+			return Create<FNullBuffer>(OutBuffer, *Desc);
+		}
+		HRESULT STDMETHODCALLTYPE CreateTexture1D(const D3D11_TEXTURE1D_DESC* Desc, const D3D11_SUBRESOURCE_DATA* InitialData, ID3D11Texture1D** OutTexture) override
+		{
+			return Create<FNullTexture1D>(OutTexture, *Desc);
+		}
+		HRESULT STDMETHODCALLTYPE CreateTexture2D(const D3D11_TEXTURE2D_DESC* Desc, const D3D11_SUBRESOURCE_DATA* InitialData, ID3D11Texture2D** OutTexture) override
+		{
+			return Create<FNullTexture2D>(OutTexture, *Desc);
+		}
+		HRESULT STDMETHODCALLTYPE CreateTexture3D(const D3D11_TEXTURE3D_DESC* Desc, const D3D11_SUBRESOURCE_DATA* InitialData, ID3D11Texture3D** OutTexture) override
+		{
+			return Create<FNullTexture3D>(OutTexture, *Desc);
+		}
+
+		// ───── 뷰 ─────
+
+		HRESULT STDMETHODCALLTYPE CreateShaderResourceView(ID3D11Resource* Resource, const D3D11_SHADER_RESOURCE_VIEW_DESC* Desc, ID3D11ShaderResourceView** OutView) override
+		{
+			return CreateView<TNullView<ID3D11ShaderResourceView, D3D11_SHADER_RESOURCE_VIEW_DESC>>(OutView, Resource, Desc);
+		}
+		HRESULT STDMETHODCALLTYPE CreateUnorderedAccessView(ID3D11Resource* Resource, const D3D11_UNORDERED_ACCESS_VIEW_DESC* Desc, ID3D11UnorderedAccessView** OutView) override
+		{
+			return CreateView<TNullView<ID3D11UnorderedAccessView, D3D11_UNORDERED_ACCESS_VIEW_DESC>>(OutView, Resource, Desc);
+		}
+		HRESULT STDMETHODCALLTYPE CreateRenderTargetView(ID3D11Resource* Resource, const D3D11_RENDER_TARGET_VIEW_DESC* Desc, ID3D11RenderTargetView** OutView) override
+		{
+			return CreateView<TNullView<ID3D11RenderTargetView, D3D11_RENDER_TARGET_VIEW_DESC>>(OutView, Resource, Desc);
+		}
+		HRESULT STDMETHODCALLTYPE CreateDepthStencilView(ID3D11Resource* Resource, const D3D11_DEPTH_STENCIL_VIEW_DESC* Desc, ID3D11DepthStencilView** OutView) override
+		{
+			return CreateView<TNullView<ID3D11DepthStencilView, D3D11_DEPTH_STENCIL_VIEW_DESC>>(OutView, Resource, Desc);
+		}
+
+		// ───── 셰이더 / 입력 레이아웃 (바이트코드는 D3DCompile이 만든 그대로 받고 보관하지 않음) ─────
+
+		HRESULT STDMETHODCALLTYPE CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* InputElementDescs, UINT NumElements, const void* ShaderBytecodeWithInputSignature, SIZE_T BytecodeLength, ID3D11InputLayout** OutInputLayout) override
+		{
+			return Create<TNullObject<ID3D11InputLayout>>(OutInputLayout);
+		}
+		HRESULT STDMETHODCALLTYPE CreateVertexShader(const void* ShaderBytecode, SIZE_T BytecodeLength, ID3D11ClassLinkage* ClassLinkage, ID3D11VertexShader** OutShader) override
+		{
+			return Create<TNullObject<ID3D11VertexShader>>(OutShader);
+		}
+		HRESULT STDMETHODCALLTYPE CreateGeometryShader(const void* ShaderBytecode, SIZE_T BytecodeLength, ID3D11ClassLinkage* ClassLinkage, ID3D11GeometryShader** OutShader) override
+		{
+			return Create<TNullObject<ID3D11GeometryShader>>(OutShader);
+		}
+		HRESULT STDMETHODCALLTYPE CreateGeometryShaderWithStreamOutput(const void* ShaderBytecode, SIZE_T BytecodeLength, const D3D11_SO_DECLARATION_ENTRY* SODeclaration, UINT NumEntries, const UINT* BufferStrides, UINT NumStrides, UINT RasterizedStream, ID3D11ClassLinkage* ClassLinkage, ID3D11GeometryShader** OutShader) override
+		{
+			return Create<TNullObject<ID3D11GeometryShader>>(OutShader);
+		}
+		HRESULT STDMETHODCALLTYPE CreatePixelShader(const void* ShaderBytecode, SIZE_T BytecodeLength, ID3D11ClassLinkage* ClassLinkage, ID3D11PixelShader** OutShader) override
+		{
+			return Create<TNullObject<ID3D11PixelShader>>(OutShader);
+		}
+		HRESULT STDMETHODCALLTYPE CreateHullShader(const void* ShaderBytecode, SIZE_T BytecodeLength, ID3D11ClassLinkage* ClassLinkage, ID3D11HullShader** OutShader) override
+		{
+			return Create<TNullObject<ID3D11HullShader>>(OutShader);
+		}
+		HRESULT STDMETHODCALLTYPE CreateDomainShader(const void* ShaderBytecode, SIZE_T BytecodeLength, ID3D11ClassLinkage* ClassLinkage, ID3D11DomainShader** OutShader) override
+		{
+			return Create<TNullObject<ID3D11DomainShader>>(OutShader);
+		}
+		HRESULT STDMETHODCALLTYPE CreateComputeShader(const void* ShaderBytecode, SIZE_T BytecodeLength, ID3D11ClassLinkage* ClassLinkage, ID3D11ComputeShader** OutShader) override
+		{
+			return Create<TNullObject<ID3D11ComputeShader>>(OutShader);
+		}
+
+		// ───── 상태 객체 ─────
+
+		HRESULT STDMETHODCALLTYPE CreateBlendState(const D3D11_BLEND_DESC* Desc, ID3D11BlendState** OutState) override
+		{
+			return Create<TNullState<ID3D11BlendState, D3D11_BLEND_DESC>>(OutState, *Desc);
+		}
+		HRESULT STDMETHODCALLTYPE CreateDepthStencilState(const D3D11_DEPTH_STENCIL_DESC* Desc, ID3D11DepthStencilState** OutState) override
+		{
+			return Create<TNullState<ID3D11DepthStencilState, D3D11_DEPTH_STENCIL_DESC>>(OutState, *Desc);
+		}
+		HRESULT STDMETHODCALLTYPE CreateRasterizerState(const D3D11_RASTERIZER_DESC* Desc, ID3D11RasterizerState** OutState) override
+		{
+			return Create<TNullState<ID3D11RasterizerState, D3D11_RASTERIZER_DESC>>(OutState, *Desc);
+		}
+		HRESULT STDMETHODCALLTYPE CreateSamplerState(const D3D11_SAMPLER_DESC* Desc, ID3D11SamplerState** OutState) override
+		{
+			return Create<TNullState<ID3D11SamplerState, D3D11_SAMPLER_DESC>>(OutState, *Desc);
+		}
+
+		// ───── 지원하지 않는 객체 ─────
+
+		HRESULT STDMETHODCALLTYPE CreateClassLinkage(ID3D11ClassLinkage** OutLinkage) override { return Unsupported(OutLinkage); }
+		HRESULT STDMETHODCALLTYPE CreateQuery(const D3D11_QUERY_DESC* QueryDesc, ID3D11Query** OutQuery) override { return Unsupported(OutQuery); }
+		HRESULT STDMETHODCALLTYPE CreatePredicate(const D3D11_QUERY_DESC* PredicateDesc, ID3D11Predicate** OutPredicate) override { return Unsupported(OutPredicate); }
+		HRESULT STDMETHODCALLTYPE CreateCounter(const D3D11_COUNTER_DESC* CounterDesc, ID3D11Counter** OutCounter) override { return Unsupported(OutCounter); }
+		HRESULT STDMETHODCALLTYPE CreateDeferredContext(UINT ContextFlags, ID3D11DeviceContext** OutDeferredContext) override { return Unsupported(OutDeferredContext); }
+		HRESULT STDMETHODCALLTYPE OpenSharedResource(HANDLE Resource, REFIID ReturnedInterface, void** OutResource) override { return Unsupported(OutResource); }
+
+		// ───── 기능 조회 ─────
+
+		HRESULT STDMETHODCALLTYPE CheckFormatSupport(DXGI_FORMAT Format, UINT* FormatSupport) override
+		{
+			*FormatSupport = 0xFFFFFFFF;
+			return S_OK;
+		}
+		HRESULT STDMETHODCALLTYPE CheckMultisampleQualityLevels(DXGI_FORMAT Format, UINT SampleCount, UINT* NumQualityLevels) override
+		{
+			*NumQualityLevels = 1;
+			return S_OK;
+		}
+		void STDMETHODCALLTYPE CheckCounterInfo(D3D11_COUNTER_INFO* CounterInfo) override
+		{
+			*CounterInfo = D3D11_COUNTER_INFO{};
+		}
+		HRESULT STDMETHODCALLTYPE CheckCounter(const D3D11_COUNTER_DESC* Desc, D3D11_COUNTER_TYPE* Type, UINT* ActiveCounters, LPSTR Name, UINT* NameLength, LPSTR Units, UINT* UnitsLength, LPSTR Description, UINT* DescriptionLength) override
+		{
+			return E_NOTIMPL;
+		}
+		HRESULT STDMETHODCALLTYPE CheckFeatureSupport(D3D11_FEATURE Feature, void* FeatureSupportData, UINT FeatureSupportDataSize) override
+		{
+			// 옵션 기능은 모두 미지원(0)으로 답한다
+			if (!FeatureSupportData)
+			{
+				return E_INVALIDARG;
+			}
+			std::memset(FeatureSupportData, 0, FeatureSupportDataSize);
+			return S_OK;
+		}
+
+		HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID Guid, UINT* DataSize, void* Data) override
+		{
+			if (DataSize)
+			{
+				*DataSize = 0;
+			}
+			return DXGI_ERROR_NOT_FOUND;
+		}
+		HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID Guid, UINT DataSize, const void* Data) override { return S_OK; }
+		HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID Guid, const IUnknown* Data) override { return S_OK; }
+
+		D3D_FEATURE_LEVEL STDMETHODCALLTYPE GetFeatureLevel() override { return D3D_FEATURE_LEVEL_11_0; }
+		UINT STDMETHODCALLTYPE GetCreationFlags() override { return 0; }
+		HRESULT STDMETHODCALLTYPE GetDeviceRemovedReason() override { return S_OK; }
+		void STDMETHODCALLTYPE GetImmediateContext(ID3D11DeviceContext** OutImmediateContext) override
+		{
+			ImmediateContext->AddRef();
+			*OutImmediateContext = ImmediateContext;
+		}
+		HRESULT STDMETHODCALLTYPE SetExceptionMode(UINT RaiseFlags) override { return S_OK; }
+		UINT STDMETHODCALLTYPE GetExceptionMode() override { return 0; }
+
+	private:
+		template<typename TObject, typename TInterface, typename... TArgs>
+		HRESULT Create(TInterface** OutObject, TArgs&&... Args)
+		{
+			// ppObject가 nullptr이면 D3D와 같이 인자 검증만 하고 S_FALSE
+			if (!OutObject)
+			{
+				return S_FALSE;
+			}
+			*OutObject = new TObject(this, std::forward<TArgs>(Args)...);
+			return S_OK;
+		}
+
+		template<typename TView, typename TInterface, typename TDesc>
+		HRESULT CreateView(TInterface** OutView, ID3D11Resource* Resource, const TDesc* Desc)
+		{
+			if (!Resource)
+			{
+				return E_INVALIDARG;
+			}
+			return Create<TView>(OutView, Resource, Desc);
+		}
+
+		template<typename TInterface>
+		static HRESULT Unsupported(TInterface** OutObject)
+		{
+			if (OutObject)
+			{
+				*OutObject = nullptr;
+			}
+			return E_NOTIMPL;
+		}
+
+		FNullDeviceContext* ImmediateContext = nullptr;
+	};
+}
+
+HRESULT CreateNullRHIDevice(FNullRHICallStats* InStats, ID3D11Device** OutDevice, ID3D11DeviceContext** OutContext)
+{
+	if (!InStats || !OutDevice || !OutContext)
+	{
+		return E_INVALIDARG;
+	}
+
+	FNullDevice* Device = new FNullDevice(InStats);
+	Device->GetImmediateContext(OutContext);
+	*OutDevice = Device;
+	return S_OK;
+}
@@ -0,0 +1,26 @@
+﻿#pragma once
+#include <d3d11.h>
+
+/**
+ * @brief 카운터 전용 Null 디바이스 컨텍스트가 받은 D3D11 호출 수입니다.
+ * 호출부가 FRHICommandStats에 기록하는 값과 달리 컨텍스트에 실제로 도착한 API 호출을 그대로 셉니다.
+ * D3D11RHI::ResetCommandStats에서 함께 초기화됩니다.
+ */
+struct FNullRHICallStats
+{
+	uint32 DrawCalls = 0;		// Draw* / DrawIndexed* / Draw*Indirect
+	uint32 Primitives = 0;		// 그린 삼각형 수 (정점/인덱스 수 / 3 근사, 인스턴스 수 반영)
+	uint32 Dispatches = 0;		// Dispatch / DispatchIndirect
+	uint32 StateCalls = 0;		// IA/VS/PS/GS/HS/DS/CS/RS/OM/SO 상태 설정 호출
+	uint32 Clears = 0;			// Clear*View
+	uint32 ResourceUpdates = 0;	// Map / UpdateSubresource / Copy* / GenerateMips / ResolveSubresource
+};
+
+/**
+ * @brief 드라이버를 거치지 않는 카운터 전용 ID3D11Device / ID3D11DeviceContext를 만듭니다.
+ * 리소스 / 뷰 / 상태 / 셰이더 생성은 설명자만 보관하는 객체를 돌려주고, 컨텍스트 호출은 OutStats에 횟수만 기록합니다.
+ * Map은 CPU 메모리를 돌려주며, 뷰포트와 토폴로지는 RSGetViewports 등으로 다시 읽을 수 있도록 보관합니다.
+ * D3D NULL 드라이버(그래픽 도구 필요)나 WARP 없이 어떤 Windows 환경에서도 만들어집니다.
+ * @param InStats 컨텍스트가 호출 수를 기록할 곳. 컨텍스트보다 오래 살아 있어야 합니다.
+ */
+HRESULT CreateNullRHIDevice(FNullRHICallStats* InStats, ID3D11Device** OutDevice, ID3D11DeviceContext** OutContext);
@@ -94,6 +94,9 @@ public:
     void UpdateDepthConstant(D3D11RHI* RHIDevice, int DSVIndex);
     void UpdateUberConstant(D3D11RHI* RHIDevice);
 
+    // 캐스케이드 하나의 Light View * Ortho (섀도우 캐스터 컬링 볼륨 계산용)
+    FMatrix GetCascadeViewProjection(int Index) const { return Frustum[Index].LightView * Frustum[Index].LightProj; }
+
     /* Debug */
     void CreateDebugCSMSliceTextures(D3D11RHI* InDevice, int NumCascades);
     void UpdateDebugCopies(D3D11RHI* InDevice, int NumCascades);
@@ -0,0 +1,105 @@
+﻿#pragma once
+
+#include <cstdint>
+
+/**
+ * @class FCullingStatManager
+ * @brief 프러스텀 컬링 결과(가시/컬링된 프리미티브 수, 배치 수)를 수집하고 제공하는 싱글톤 클래스입니다.
+ * 뷰포트가 여러 개면 한 프레임 동안 모든 뷰의 결과가 누적됩니다.
+ */
+class FCullingStatManager
+{
+public:
+	/**
+	 * @brief FCullingStatManager의 싱글톤 인스턴스를 반환합니다.
+	 */
+	static FCullingStatManager& GetInstance()
+	{
+		static FCullingStatManager Instance;
+		return Instance;
+	}
+
+	/**
+	 * @brief 매 프레임 렌더링 시작 시 호출하여 프레임 단위 통계 데이터를 초기화합니다.
+	 */
+	void ResetFrameStats()
+	{
+		TotalPrimitiveCount = 0;
+		VisiblePrimitiveCount = 0;
+		CulledPrimitiveCount = 0;
+		OpaqueBatchCount = 0;
+		InstanceCount = 0;
+		MergedBatchCount = 0;
+		CullingTimeMS = 0.0;
+	}
+
+	// --- Getters ---
+
+	/** @return 컬링 대상이 된 프리미티브 수 (메시 + 데칼) */
+	uint32_t GetTotalPrimitiveCount() const { return TotalPrimitiveCount; }
+
+	/** @return 프러스텀 컬링을 통과한 프리미티브 수 */
+	uint32_t GetVisiblePrimitiveCount() const { return VisiblePrimitiveCount; }
+
+	/** @return 프러스텀 컬링으로 제거된 프리미티브 수 */
+	uint32_t GetCulledPrimitiveCount() const { return CulledPrimitiveCount; }
+
+	/** @return 불투명 패스에서 실제로 수집된 메시 배치 수 */
+	uint32_t GetOpaqueBatchCount() const { return OpaqueBatchCount; }
+
+	/** @return 인스턴스 드로우로 그려진 인스턴스 수 */
+	uint32_t GetInstanceCount() const { return InstanceCount; }
+
+	/** @return 인스턴싱으로 합쳐져 사라진 드로우 콜 수 */
+	uint32_t GetMergedBatchCount() const { return MergedBatchCount; }
+
+	/** @return BVH 프러스텀 쿼리 + 수집 단계 소요 시간 (ms) */
+	double GetCullingTimeMS() const { return CullingTimeMS; }
+
+	// --- Setters / Incrementers ---
+
+	/** @brief 컬링 판정 결과를 하나 기록합니다. */
+	void AddPrimitive(bool bVisible)
+	{
+		++TotalPrimitiveCount;
+		if (bVisible)
+		{
+			++VisiblePrimitiveCount;
+		}
+		else
+		{
+			++CulledPrimitiveCount;
+		}
+	}
+
+	/** @brief 불투명 패스에서 수집된 배치 수를 더합니다. */
+	void AddOpaqueBatchCount(uint32_t InCount) { OpaqueBatchCount += InCount; }
+
+	/** @brief 인스턴싱 결과를 더합니다. */
+	void AddInstancingResult(uint32_t InInstanceCount, uint32_t InMergedCount)
+	{
+		InstanceCount += InInstanceCount;
+		MergedBatchCount += InMergedCount;
+	}
+
+	/** @brief 컬링 소요 시간을 직접 기록할 수 있도록 변수의 참조를 반환합니다. */
+	double& GetCullingTimeSlot() { return CullingTimeMS; }
+
+private:
+	FCullingStatManager() = default;
+	~FCullingStatManager() = default;
+
+	// 싱글톤 패턴을 위해 복사 및 대입을 금지합니다.
+	FCullingStatManager(const FCullingStatManager&) = delete;
+	FCullingStatManager& operator=(const FCullingStatManager&) = delete;
+
+private:
+	// 매 프레임 초기화되는 데이터
+	uint32_t TotalPrimitiveCount = 0;
+	uint32_t VisiblePrimitiveCount = 0;
+	uint32_t CulledPrimitiveCount = 0;
+	uint32_t OpaqueBatchCount = 0;
+	uint32_t InstanceCount = 0;
+	uint32_t MergedBatchCount = 0;
+	double CullingTimeMS = 0.0;
+};
@@ -13,6 +13,10 @@ struct FMeshBatchElement
 {
 	// --- 1. 정렬 키 (Sorting Keys) ---
 	// 렌더러가 상태 변경을 최소화하기 위해 정렬하는 기준입니다.
+
+	// 패스 | 깊이 | 셰이더 | 머티리얼 | 메시를 압축한 키 (FMeshBatchSorter::BuildSortKeys에서 채움)
+	uint64 SortKey = 0;
+
 	ID3D11VertexShader* VertexShader = nullptr;
 	ID3D11PixelShader* PixelShader = nullptr;
 	ID3D11InputLayout* InputLayout = nullptr;
@@ -62,33 +66,23 @@ struct FMeshBatchElement
 	// (기본값으로 흰색(1,1,1,1)을 설정하는 것이 일반적입니다.)
 	FLinearColor InstanceColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);
 
+	// FMeshBatchInstancer가 합친 배치의 인스턴스 수입니다. (1이면 WorldMatrix/ObjectID로 일반 DrawIndexed)
+	uint32 InstanceCount = 1;
+
+	// 인스턴스 버퍼에서 이 배치의 첫 인스턴스 위치입니다. (InstanceCount > 1일 때만 유효)
+	uint32 FirstInstance = 0;
+
 	// --- 기본 생성자 ---
 	FMeshBatchElement() = default;
 
 
 	/**
 	 * @brief FMeshBatchElement 정렬을 위한 'less than' 연산자입니다.
-	 * TArray::Sort()가 A < B 를 비교하기 위해 이 함수를 호출합니다.
-	 * GPU 상태 변경을 최소화하는 순서로 정렬 키를 비교합니다.
+	 * 렌더 패스는 원소를 옮기지 않고 FMeshBatchSorter로 인덱스를 기수 정렬하며,
+	 * 이 연산자는 TArray::Sort()로 원소를 직접 정렬해야 할 때 같은 순서를 제공합니다.
 	 */
 	bool operator<(const FMeshBatchElement& B) const
 	{
-		const FMeshBatchElement& A = *this; // A는 'this' (자신), B는 비교 대상
-
-		// 1순위: 셰이더 프로그램 (VS, PS)
-		if (A.VertexShader != B.VertexShader) return A.VertexShader < B.VertexShader;
-		if (A.PixelShader != B.PixelShader) return A.PixelShader < B.PixelShader;
-
-		// 2순위: 셰이더 파라미터 (Material)
-		if (A.Material != B.Material) return A.Material < B.Material;
-
-		// 3순위: IA(Input Assembler) 상태 (버퍼, 스트라이드, 토폴로지)
-		if (A.VertexBuffer != B.VertexBuffer) return A.VertexBuffer < B.VertexBuffer;
-		if (A.IndexBuffer != B.IndexBuffer) return A.IndexBuffer < B.IndexBuffer;
-		if (A.VertexStride != B.VertexStride) return A.VertexStride < B.VertexStride;
-		if (A.PrimitiveTopology != B.PrimitiveTopology) return A.PrimitiveTopology < B.PrimitiveTopology;
-
-		// 모든 키가 동일하면 순서가 중요하지 않으므로 false 반환 (Stable Sort 보장)
-		return false;
+		return SortKey < B.SortKey;
 	}
 };
\ No newline at end of file
@@ -0,0 +1,205 @@
+﻿#include "pch.h"
+#include "MeshBatchInstancing.h"
+#include "MeshBatchElement.h"
+#include "Shader.h"
+#include "HashUtils.h"
+
+namespace
+{
+	// 버퍼를 다시 만들 때 최소 용량 (원소 수)
+	constexpr uint32 MinInstanceCapacity = 256;
+}
+
+FMeshBatchInstancer::~FMeshBatchInstancer()
+{
+	Release();
+}
+
+void FMeshBatchInstancer::Initialize(D3D11RHI* InRHI)
+{
+	RHI = InRHI;
+}
+
+void FMeshBatchInstancer::Release()
+{
+	if (InstanceBufferSRV)
+	{
+		InstanceBufferSRV->Release();
+		InstanceBufferSRV = nullptr;
+	}
+	if (InstanceBuffer)
+	{
+		InstanceBuffer->Release();
+		InstanceBuffer = nullptr;
+	}
+	InstanceCapacity = 0;
+}
+
+bool FMeshBatchInstancer::CanInstanceTogether(const FMeshBatchElement& A, const FMeshBatchElement& B)
+{
+	return A.VertexShader == B.VertexShader
+		&& A.PixelShader == B.PixelShader
+		&& A.InputLayout == B.InputLayout
+		&& A.Material == B.Material
+		&& A.VertexBuffer == B.VertexBuffer
+		&& A.IndexBuffer == B.IndexBuffer
+		&& A.PrimitiveTopology == B.PrimitiveTopology
+		&& A.IndexCount == B.IndexCount
+		&& A.StartIndex == B.StartIndex
+		&& A.BaseVertexIndex == B.BaseVertexIndex
+		&& A.VertexStride == B.VertexStride
+		&& A.InstanceShaderResourceView == B.InstanceShaderResourceView
+		&& A.InstanceColor == B.InstanceColor;
+}
+
+uint64 FMeshBatchInstancer::HashInstancingState(const FMeshBatchElement& InBatch)
+{
+	// 색상과 셰이더는 해시에서 빼고 CanInstanceTogether에서만 비교 (대부분 같음)
+	uint64 Hash = PointerHash(InBatch.VertexBuffer);
+	Hash = HashCombine(Hash, PointerHash(InBatch.IndexBuffer));
+	Hash = HashCombine(Hash, PointerHash(InBatch.Material));
+	Hash = HashCombine(Hash, (static_cast<uint64>(InBatch.StartIndex) << 32) | InBatch.IndexCount);
+	return Hash;
+}
+
+uint32 FMeshBatchInstancer::MergeInstancedBatches(TArray<FMeshBatchElement>& InOutBatches, const FShaderVariant* InInstancedVariant, uint32 InMinInstanceCount)
+{
+	InstanceData.Empty();
+
+	const int32 NumBatches = InOutBatches.Num();
+	if (!InInstancedVariant || NumBatches < 2)
+	{
+		return 0;
+	}
+	InMinInstanceCount = std::max(InMinInstanceCount, 2u);
+
+	// --- 1. 그룹 분류 (해시 + 실제 상태 비교) ---
+	Groups.Empty();
+	FirstGroupByHash.Empty();
+	GroupOfBatch.SetNum(NumBatches);
+
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+	{
+		const FMeshBatchElement& Batch = InOutBatches[BatchIndex];
+		const uint64 Hash = HashInstancingState(Batch);
+
+		int32* FirstGroup = FirstGroupByHash.Find(Hash);
+		int32 GroupIndex = FirstGroup ? *FirstGroup : -1;
+		while (GroupIndex != -1 && !CanInstanceTogether(InOutBatches[Groups[GroupIndex].HeadBatch], Batch))
+		{
+			GroupIndex = Groups[GroupIndex].NextSameHash;
+		}
+
+		if (GroupIndex == -1)
+		{
+			FInstanceGroup NewGroup;
+			NewGroup.HeadBatch = BatchIndex;
+			NewGroup.NextSameHash = FirstGroup ? *FirstGroup : -1;
+			GroupIndex = Groups.Num();
+			Groups.Add(NewGroup);
+			FirstGroupByHash[Hash] = GroupIndex;
+		}
+
+		++Groups[GroupIndex].Count;
+		GroupOfBatch[BatchIndex] = GroupIndex;
+	}
+
+	// --- 2. 인스턴스 버퍼 구간 배정 ---
+	uint32 TotalInstances = 0;
+	for (FInstanceGroup& Group : Groups)
+	{
+		if (Group.Count >= InMinInstanceCount)
+		{
+			Group.FirstInstance = TotalInstances;
+			TotalInstances += Group.Count;
+		}
+	}
+	if (TotalInstances == 0)
+	{
+		return 0;
+	}
+	InstanceData.SetNum(TotalInstances);
+
+	// --- 3. 인스턴스 데이터 채우기 + 배열 압축 (원래 상대 순서 유지) ---
+	int32 WriteIndex = 0;
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+	{
+		FInstanceGroup& Group = Groups[GroupOfBatch[BatchIndex]];
+		if (Group.Count < InMinInstanceCount)
+		{
+			if (WriteIndex != BatchIndex)
+			{
+				InOutBatches[WriteIndex] = std::move(InOutBatches[BatchIndex]);
+			}
+			++WriteIndex;
+			continue;
+		}
+
+		const FMeshBatchElement& Batch = InOutBatches[BatchIndex];
+		FMeshInstanceData& Instance = InstanceData[Group.FirstInstance + Group.Written++];
+		Instance.WorldMatrix = Batch.WorldMatrix;
+		Instance.WorldInverseTranspose = Batch.WorldMatrix.InverseAffine().Transpose();
+		Instance.ObjectID = Batch.ObjectID;
+
+		if (BatchIndex != Group.HeadBatch)
+		{
+			continue;
+		}
+
+		FMeshBatchElement& Head = InOutBatches[WriteIndex];
+		if (WriteIndex != BatchIndex)
+		{
+			Head = std::move(InOutBatches[BatchIndex]);
+		}
+		Head.VertexShader = InInstancedVariant->VertexShader;
+		Head.PixelShader = InInstancedVariant->PixelShader;
+		Head.InputLayout = InInstancedVariant->InputLayout;
+		Head.InstanceCount = Group.Count;
+		Head.FirstInstance = Group.FirstInstance;
+		++WriteIndex;
+	}
+
+	InOutBatches.SetNum(WriteIndex);
+	return static_cast<uint32>(NumBatches - WriteIndex);
+}
+
+void FMeshBatchInstancer::CreateOrResizeInstanceBuffer(uint32 InRequiredCount)
+{
+	if (InstanceBuffer && InRequiredCount <= InstanceCapacity)
+	{
+		return;
+	}
+
+	Release();
+
+	uint32 NewCapacity = MinInstanceCapacity;
+	while (NewCapacity < InRequiredCount)
+	{
+		NewCapacity *= 2;
+	}
+
+	if (FAILED(RHI->CreateStructuredBuffer(sizeof(FMeshInstanceData), NewCapacity, nullptr, &InstanceBuffer)) ||
+		FAILED(RHI->CreateStructuredBufferSRV(InstanceBuffer, &InstanceBufferSRV)))
+	{
+		UE_LOG("FMeshBatchInstancer: Failed to create instance buffer (%u instances)", NewCapacity);
+		Release();
+		return;
+	}
+	InstanceCapacity = NewCapacity;
+}
+
+void FMeshBatchInstancer::UploadInstanceData()
+{
+	if (!RHI || InstanceData.IsEmpty())
+	{
+		return;
+	}
+
+	CreateOrResizeInstanceBuffer(static_cast<uint32>(InstanceData.Num()));
+	if (!InstanceBuffer)
+	{
+		return;
+	}
+
+	RHI->UpdateStructuredBuffer(InstanceBuffer, InstanceData.data(), static_cast<UINT>(InstanceData.Num() * sizeof(FMeshInstanceData)));
+}
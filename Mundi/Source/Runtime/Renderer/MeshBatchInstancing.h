@@ -0,0 +1,79 @@
+﻿#pragma once
+#include "D3D11RHI.h"
+
+struct FMeshBatchElement;
+struct FShaderVariant;
+
+/**
+ * @brief 인스턴스 버퍼 원소. UberLit.hlsl(USE_INSTANCING)의 FInstanceData와 정확히 일치해야 합니다.
+ */
+struct FMeshInstanceData
+{
+	FMatrix WorldMatrix;
+	FMatrix WorldInverseTranspose;	// 비균등 스케일 노멀 변환용
+	uint32 ObjectID;				// 피킹용 UUID (SV_Target1)
+	uint32 Padding[3];
+};
+
+/**
+ * @class FMeshBatchInstancer
+ * @brief 같은 정점/인덱스 버퍼, 섹션, 머티리얼, 셰이더를 쓰는 배치를 하나의 DrawIndexedInstanced로 합칩니다.
+ *
+ * 인스턴스별 월드 행렬과 오브젝트 ID는 프레임마다 하나의 구조화 버퍼에 모아 올리고,
+ * 합쳐진 배치는 버퍼 안의 시작 위치(FirstInstance)와 개수(InstanceCount)만 가집니다.
+ * URenderer가 소유하며 버퍼는 필요할 때만 커집니다.
+ */
+class FMeshBatchInstancer
+{
+public:
+	FMeshBatchInstancer() = default;
+	~FMeshBatchInstancer();
+
+	void Initialize(D3D11RHI* InRHI);
+	void Release();
+
+	/**
+	 * @brief InOutBatches 전체에서 인스턴싱 가능한 배치를 묶습니다.
+	 * 묶음의 첫 배치만 남아 InInstancedVariant 셰이더로 바뀌고 나머지는 배열에서 제거됩니다. (상대 순서 유지)
+	 * 이전 호출에서 모은 인스턴스 데이터는 버려지므로, 그리기 전에 UploadInstanceData를 호출해야 합니다.
+	 * @return 인스턴싱으로 줄어든 드로우 콜 수
+	 */
+	uint32 MergeInstancedBatches(TArray<FMeshBatchElement>& InOutBatches, const FShaderVariant* InInstancedVariant, uint32 InMinInstanceCount = 2);
+
+	/** @brief 모은 인스턴스 데이터를 GPU 버퍼에 올립니다. (WRITE_DISCARD) */
+	void UploadInstanceData();
+
+	/** @return VS t9에 바인딩할 인스턴스 버퍼 SRV */
+	ID3D11ShaderResourceView* GetInstanceBufferSRV() const { return InstanceBufferSRV; }
+
+	/** @return 마지막 MergeInstancedBatches에서 인스턴스 버퍼에 들어간 인스턴스 수 */
+	uint32 GetInstanceCount() const { return static_cast<uint32>(InstanceData.Num()); }
+
+private:
+	// 두 배치를 한 번의 인스턴스 드로우로 그려도 결과가 같은지
+	static bool CanInstanceTogether(const FMeshBatchElement& A, const FMeshBatchElement& B);
+	static uint64 HashInstancingState(const FMeshBatchElement& InBatch);
+
+	void CreateOrResizeInstanceBuffer(uint32 InRequiredCount);
+
+	struct FInstanceGroup
+	{
+		int32 HeadBatch = -1;		// 묶음 대표 배치 (원래 배열 인덱스)
+		int32 NextSameHash = -1;	// 해시가 같은 다음 그룹 (충돌 체인)
+		uint32 Count = 0;
+		uint32 FirstInstance = 0;
+		uint32 Written = 0;
+	};
+
+	D3D11RHI* RHI = nullptr;
+
+	ID3D11Buffer* InstanceBuffer = nullptr;
+	ID3D11ShaderResourceView* InstanceBufferSRV = nullptr;
+	uint32 InstanceCapacity = 0;
+
+	// 프레임 간 재사용 버퍼
+	TArray<FMeshInstanceData> InstanceData;
+	TArray<FInstanceGroup> Groups;
+	TArray<int32> GroupOfBatch;
+	TMap<uint64, int32> FirstGroupByHash;
+};
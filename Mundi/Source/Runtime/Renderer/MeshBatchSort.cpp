@@ -0,0 +1,181 @@
+﻿#include "pch.h"
+#include "MeshBatchSort.h"
+#include "MeshBatchElement.h"
+#include "SceneView.h"
+#include "HashUtils.h"
+
+namespace
+{
+	// 키 필드 폭 (합계 64비트)
+	constexpr uint32 PassBits = 4;
+	constexpr uint32 DepthMajorBits = 12;
+	constexpr uint32 ShaderBits = 12;
+	constexpr uint32 MaterialBits = 14;
+	constexpr uint32 MeshBits = 14;
+	constexpr uint32 DepthMinorBits = 8;
+	static_assert(PassBits + DepthMajorBits + ShaderBits + MaterialBits + MeshBits + DepthMinorBits == 64, "정렬 키는 64비트");
+
+	constexpr uint32 DepthMinorShift = 0;
+	constexpr uint32 MeshShift = DepthMinorShift + DepthMinorBits;
+	constexpr uint32 MaterialShift = MeshShift + MeshBits;
+	constexpr uint32 ShaderShift = MaterialShift + MaterialBits;
+	constexpr uint32 DepthMajorShift = ShaderShift + ShaderBits;
+	constexpr uint32 PassShift = DepthMajorShift + DepthMajorBits;
+
+	constexpr uint64 FieldMask(uint32 InBits) { return (uint64(1) << InBits) - 1; }
+
+	uint64 QuantizeDepth(float InDepth01, uint32 InBits)
+	{
+		const float Clamped = std::clamp(InDepth01, 0.0f, 1.0f);
+		return static_cast<uint64>(Clamped * static_cast<float>(FieldMask(InBits)) + 0.5f);
+	}
+
+	// 두 포인터를 하나의 해시 키로 합친다 (충돌해도 그룹만 합쳐질 뿐 그리기 결과는 같음)
+	uint64 CombineHandles(const void* InA, const void* InB)
+	{
+		return HashCombine(PointerHash(InA), PointerHash(InB));
+	}
+}
+
+uint32 FMeshBatchSorter::FindOrAddId(TMap<uint64, uint32>& InOutIds, uint64 InHandle)
+{
+	if (const uint32* Found = InOutIds.Find(InHandle))
+	{
+		return *Found;
+	}
+	const uint32 NewId = static_cast<uint32>(InOutIds.Num());
+	InOutIds.Add(InHandle, NewId);
+	return NewId;
+}
+
+uint64 FMeshBatchSorter::MakeSortKey(EMeshBatchPass InPass, EMeshSortMode InMode,
+	uint32 InShaderId, uint32 InMaterialId, uint32 InMeshId, float InDepth01)
+{
+	uint64 DepthMajor = 0;
+	uint64 DepthMinor = 0;
+	switch (InMode)
+	{
+	case EMeshSortMode::FRONT_TO_BACK:
+		DepthMajor = QuantizeDepth(InDepth01, DepthMajorBits);
+		break;
+	case EMeshSortMode::BACK_TO_FRONT:
+		DepthMajor = FieldMask(DepthMajorBits) - QuantizeDepth(InDepth01, DepthMajorBits);
+		break;
+	case EMeshSortMode::STATE:
+	default:
+		// 같은 상태 묶음 안에서만 앞→뒤
+		DepthMinor = QuantizeDepth(InDepth01, DepthMinorBits);
+		break;
+	}
+
+	return ((static_cast<uint64>(InPass) & FieldMask(PassBits)) << PassShift)
+		| (DepthMajor << DepthMajorShift)
+		| ((static_cast<uint64>(InShaderId) & FieldMask(ShaderBits)) << ShaderShift)
+		| ((static_cast<uint64>(InMaterialId) & FieldMask(MaterialBits)) << MaterialShift)
+		| ((static_cast<uint64>(InMeshId) & FieldMask(MeshBits)) << MeshShift)
+		| (DepthMinor << DepthMinorShift);
+}
+
+float FMeshBatchSorter::ComputeViewDepth01(const FSceneView* InView, const FVector& InWorldPosition)
+{
+	if (!InView || InView->ZFar <= 0.0f)
+	{
+		return 0.0f;
+	}
+	const float Depth = FVector::Dot(InWorldPosition - InView->ViewLocation, InView->ViewDirection);
+	return Depth / InView->ZFar;
+}
+
+void FMeshBatchSorter::BuildSortKeys(TArray<FMeshBatchElement>& InOutBatches, int32 InStart, int32 InEnd,
+	EMeshBatchPass InPass, EMeshSortMode InMode, const FSceneView* InView)
+{
+	InEnd = std::min(InEnd, static_cast<int32>(InOutBatches.Num()));
+	for (int32 i = InStart; i < InEnd; ++i)
+	{
+		FMeshBatchElement& Batch = InOutBatches[i];
+
+		const uint32 ShaderId = FindOrAddId(ShaderIds, CombineHandles(Batch.VertexShader, Batch.PixelShader));
+		const uint32 MaterialId = FindOrAddId(MaterialIds, PointerHash(Batch.Material));
+		const uint32 MeshId = FindOrAddId(MeshIds, CombineHandles(Batch.VertexBuffer, Batch.IndexBuffer));
+
+		const FVector WorldPosition(Batch.WorldMatrix.M[3][0], Batch.WorldMatrix.M[3][1], Batch.WorldMatrix.M[3][2]);
+		Batch.SortKey = MakeSortKey(InPass, InMode, ShaderId, MaterialId, MeshId, ComputeViewDepth01(InView, WorldPosition));
+	}
+}
+
+void FMeshBatchSorter::SortMeshBatches(const TArray<FMeshBatchElement>& InBatches, TArray<int32>& OutOrder)
+{
+	ScratchKeys.SetNum(InBatches.Num());
+	for (int32 i = 0; i < InBatches.Num(); ++i)
+	{
+		ScratchKeys[i] = InBatches[i].SortKey;
+	}
+	RadixSortIndices(ScratchKeys, OutOrder);
+
+	ShaderIds.Empty();
+	MaterialIds.Empty();
+	MeshIds.Empty();
+}
+
+void FMeshBatchSorter::RadixSortIndices(const TArray<uint64>& InKeys, TArray<int32>& OutOrder)
+{
+	const int32 Count = InKeys.Num();
+	OutOrder.SetNum(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutOrder[i] = i;
+	}
+	if (Count < 2)
+	{
+		return;
+	}
+
+	// 8개 자리의 히스토그램을 한 번에 센다
+	constexpr int32 NumDigits = 8;
+	constexpr int32 Radix = 256;
+	uint32 Histograms[NumDigits][Radix] = {};
+	for (uint64 Key : InKeys)
+	{
+		for (int32 Digit = 0; Digit < NumDigits; ++Digit)
+		{
+			++Histograms[Digit][(Key >> (Digit * 8)) & 0xFF];
+		}
+	}
+
+	thread_local TArray<int32> TempOrder;
+	TempOrder.SetNum(Count);
+
+	int32* Src = OutOrder.data();
+	int32* Dst = TempOrder.data();
+	for (int32 Digit = 0; Digit < NumDigits; ++Digit)
+	{
+		uint32* Histogram = Histograms[Digit];
+		const uint32 Shift = Digit * 8;
+
+		// 모든 키가 이 자리에서 같은 값이면 순서가 바뀌지 않으므로 건너뛴다
+		if (Histogram[(InKeys[Src[0]] >> Shift) & 0xFF] == static_cast<uint32>(Count))
+		{
+			continue;
+		}
+
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < Radix; ++Bucket)
+		{
+			const uint32 BucketCount = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += BucketCount;
+		}
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const int32 Index = Src[i];
+			Dst[Histogram[(InKeys[Index] >> Shift) & 0xFF]++] = Index;
+		}
+		std::swap(Src, Dst);
+	}
+
+	if (Src != OutOrder.data())
+	{
+		std::copy(Src, Src + Count, OutOrder.data());
+	}
+}
@@ -0,0 +1,83 @@
+﻿#pragma once
+#include "RenderSettings.h"
+
+struct FMeshBatchElement;
+class FSceneView;
+
+/**
+ * @brief 정렬 키 최상위 비트에 들어가는 패스 구분. 같은 리스트 안에서 패스 순서대로 그려집니다.
+ */
+enum class EMeshBatchPass : uint8
+{
+	Opaque = 0,
+	Masked = 1,			// 빌보드 등 알파 테스트 스프라이트 (불투명 메시 이후)
+	Translucent = 2,	// 블렌딩 (데칼)
+	Overlay = 3,
+};
+
+/**
+ * @class FMeshBatchSorter
+ * @brief FMeshBatchElement마다 64비트 정렬 키를 만들고, 원소 대신 인덱스 배열을 기수 정렬합니다.
+ *
+ * 키 레이아웃 (상위 → 하위):
+ *   Pass(4) | DepthMajor(12) | ShaderId(12) | MaterialId(14) | MeshId(14) | DepthMinor(8)
+ * STATE 모드는 DepthMajor가 0이라 상태 순으로 묶이고, 깊이 정렬 모드는 DepthMajor가 상태보다 앞섭니다.
+ *
+ * 셰이더/머티리얼/메시 ID는 정렬 리스트 하나 안에서 포인터를 처음 본 순서대로 부여하는 작은 정수라서
+ * 포인터 주소 비교와 달리 실행마다 같은 순서가 나오고, 해제된 리소스가 남아 ID가 계속 커지지도 않습니다. ID가 필드 폭을 넘으면 하위 비트만 쓰므로
+ * 서로 다른 상태가 같은 그룹으로 묶일 수 있지만, DrawMeshBatches가 실제 포인터로 상태 변경을 판단하므로 결과는 같습니다.
+ */
+class FMeshBatchSorter
+{
+public:
+	static FMeshBatchSorter& GetInstance()
+	{
+		static FMeshBatchSorter Instance;
+		return Instance;
+	}
+
+	/**
+	 * @brief [InStart, InEnd) 범위 배치의 SortKey를 채웁니다.
+	 * 한 리스트에 패스별로 여러 번 호출하면 같은 ID 공간을 공유하고, 다음 SortMeshBatches에서 ID가 초기화됩니다.
+	 */
+	void BuildSortKeys(TArray<FMeshBatchElement>& InOutBatches, int32 InStart, int32 InEnd,
+		EMeshBatchPass InPass, EMeshSortMode InMode, const FSceneView* InView);
+
+	/**
+	 * @brief 배치의 SortKey 오름차순으로 그릴 인덱스 순서를 만듭니다. (안정 정렬)
+	 * 키를 모두 소비했으므로 다음 리스트를 위해 상태 ID 표를 비웁니다.
+	 */
+	void SortMeshBatches(const TArray<FMeshBatchElement>& InBatches, TArray<int32>& OutOrder);
+
+	/**
+	 * @brief 패스, 정렬 모드, 상태 ID, 정규화된 뷰 깊이(0 = 카메라, 1 = Far)로 정렬 키를 만듭니다.
+	 */
+	static uint64 MakeSortKey(EMeshBatchPass InPass, EMeshSortMode InMode,
+		uint32 InShaderId, uint32 InMaterialId, uint32 InMeshId, float InDepth01);
+
+	/** @return 뷰 방향으로 잰 WorldPosition의 깊이를 Far 평면 기준 [0, 1]로 정규화한 값 */
+	static float ComputeViewDepth01(const FSceneView* InView, const FVector& InWorldPosition);
+
+	/**
+	 * @brief 키 배열을 8비트씩 LSD 기수 정렬해 인덱스 순서를 반환합니다. (안정 정렬)
+	 * 모든 키에서 같은 바이트는 건너뛰므로 상위 비트가 비어 있는 키는 패스 수가 줄어듭니다.
+	 */
+	static void RadixSortIndices(const TArray<uint64>& InKeys, TArray<int32>& OutOrder);
+
+private:
+	FMeshBatchSorter() = default;
+	~FMeshBatchSorter() = default;
+	FMeshBatchSorter(const FMeshBatchSorter&) = delete;
+	FMeshBatchSorter& operator=(const FMeshBatchSorter&) = delete;
+
+	// 포인터(또는 포인터 쌍) → 처음 본 순서대로 부여한 ID
+	static uint32 FindOrAddId(TMap<uint64, uint32>& InOutIds, uint64 InHandle);
+
+	// 정렬 리스트 하나 동안만 유효. SortMeshBatches가 끝나면 비워진다 (버킷은 재사용)
+	TMap<uint64, uint32> ShaderIds;		// (VS, PS)
+	TMap<uint64, uint32> MaterialIds;	// UMaterialInterface*
+	TMap<uint64, uint32> MeshIds;		// (VB, IB)
+
+	// SortMeshBatches 재사용 버퍼
+	TArray<uint64> ScratchKeys;
+};
@@ -0,0 +1,303 @@
+﻿#include "pch.h"
+#include "RenderBenchmark.h"
+#include "CommandLineOptions.h"
+#include "PlatformTime.h"
+#include "Renderer.h"
+#include "FViewport.h"
+#include "FViewportClient.h"
+#include "World.h"
+#include "Level.h"
+#include "CameraActor.h"
+#include "CameraComponent.h"
+#include "RenderPassStatManager.h"
+#include "CullingStatManager.h"
+
+#include <filesystem>
+#include <iomanip>
+
+namespace
+{
+	// 측정 프레임마다 값을 누적해 평균/최소/최대를 구한다
+	struct FSampleAccumulator
+	{
+		double Sum = 0.0;
+		double Min = (std::numeric_limits<double>::max)();
+		double Max = 0.0;
+		int32 Count = 0;
+
+		void Add(double InValue)
+		{
+			Sum += InValue;
+			Min = std::min(Min, InValue);
+			Max = std::max(Max, InValue);
+			++Count;
+		}
+
+		FRenderBenchmarkResult ToResult(const char* InCategory, const char* InName) const
+		{
+			FRenderBenchmarkResult Result;
+			Result.Category = InCategory;
+			Result.Name = InName;
+			if (Count > 0)
+			{
+				Result.Average = Sum / Count;
+				Result.Min = Min;
+				Result.Max = Max;
+			}
+			return Result;
+		}
+	};
+
+	// FRHICommandStats 필드 순서와 이름
+	constexpr int32 NumCommandCounters = 14;
+	const char* CommandCounterNames[NumCommandCounters] =
+	{
+		"DrawCalls", "Primitives", "StateChanges", "ShaderChanges", "InputAssemblerChanges",
+		"ShaderResourceBinds", "SamplerBinds", "ConstantBufferUpdates", "ConstantBufferBinds",
+		"StructuredBufferUpdates", "RenderTargetChanges", "BlendStateChanges",
+		"DepthStencilStateChanges", "RasterizerStateChanges"
+	};
+
+	void GetCommandCounters(const FRHICommandStats& InStats, double (&OutValues)[NumCommandCounters])
+	{
+		OutValues[0] = InStats.DrawCalls;
+		OutValues[1] = InStats.Primitives;
+		OutValues[2] = InStats.GetStateChangeCount();
+		OutValues[3] = InStats.ShaderChanges;
+		OutValues[4] = InStats.InputAssemblerChanges;
+		OutValues[5] = InStats.ShaderResourceBinds;
+		OutValues[6] = InStats.SamplerBinds;
+		OutValues[7] = InStats.ConstantBufferUpdates;
+		OutValues[8] = InStats.ConstantBufferBinds;
+		OutValues[9] = InStats.StructuredBufferUpdates;
+		OutValues[10] = InStats.RenderTargetChanges;
+		OutValues[11] = InStats.BlendStateChanges;
+		OutValues[12] = InStats.DepthStencilStateChanges;
+		OutValues[13] = InStats.RasterizerStateChanges;
+	}
+
+	// FNullRHICallStats 필드 순서와 이름 (카운터 전용 디바이스에서만 기록)
+	constexpr int32 NumNullRHICounters = 6;
+	const char* NullRHICounterNames[NumNullRHICounters] =
+	{
+		"DrawCalls", "Primitives", "Dispatches", "StateCalls", "Clears", "ResourceUpdates"
+	};
+
+	void GetNullRHICounters(const FNullRHICallStats& InStats, double (&OutValues)[NumNullRHICounters])
+	{
+		OutValues[0] = InStats.DrawCalls;
+		OutValues[1] = InStats.Primitives;
+		OutValues[2] = InStats.Dispatches;
+		OutValues[3] = InStats.StateCalls;
+		OutValues[4] = InStats.Clears;
+		OutValues[5] = InStats.ResourceUpdates;
+	}
+}
+
+FRenderBenchmark::FRenderBenchmark(const FRenderBenchmarkConfig& InConfig)
+	: Config(InConfig)
+{
+}
+
+bool FRenderBenchmark::ParseCommandLine(const FString& InCmdLine, FRenderBenchmarkConfig& OutConfig)
+{
+	if (!FCommandLine::HasFlag(InCmdLine, "RenderBenchmark"))
+	{
+		return false;
+	}
+
+	FCommandLine::ParseIntOption(InCmdLine, "RenderWarmup", OutConfig.WarmupFrames, 0);
+	FCommandLine::ParseIntOption(InCmdLine, "RenderFrames", OutConfig.FrameCount);
+	OutConfig.bNullRHI = !FCommandLine::HasFlag(InCmdLine, "RenderUseGPU");
+	OutConfig.bD3DNullDriver = FCommandLine::HasFlag(InCmdLine, "RenderD3DNullDriver");
+	OutConfig.bAllowWARP = FCommandLine::HasFlag(InCmdLine, "RenderAllowWARP");
+	OutConfig.bMeshInstancing = !FCommandLine::HasFlag(InCmdLine, "RenderNoInstancing");
+
+	FString Value;
+	if (FCommandLine::FindOption(InCmdLine, "RenderScene", Value))
+	{
+		OutConfig.ScenePath = Value;
+	}
+	if (FCommandLine::FindOption(InCmdLine, "BenchmarkOutput", Value))
+	{
+		OutConfig.OutputDir = Value;
+	}
+	return true;
+}
+
+bool FRenderBenchmark::Run()
+{
+	Results.Empty();
+
+	URenderer* Renderer = GEngine.GetRenderer();
+	UWorld* World = GEngine.GetDefaultWorld();
+	if (!Renderer || !World)
+	{
+		UE_LOG("[RenderBenchmark] Engine is not initialized");
+		return false;
+	}
+	D3D11RHI* RHIDevice = Renderer->GetRHIDevice();
+	DriverName = RHIDevice->GetDriverTypeName();
+
+	if (RHIDevice->GetDriverType() == D3D_DRIVER_TYPE_WARP && !Config.bAllowWARP)
+	{
+		UE_LOG("[RenderBenchmark] NULL driver unavailable and the device fell back to WARP, which rasterizes on the CPU. Pass -RenderAllowWARP to measure anyway");
+		return false;
+	}
+
+	std::unique_ptr<ULevel> NewLevel = ULevelService::LoadLevel(Config.ScenePath);
+	if (!NewLevel)
+	{
+		UE_LOG("[RenderBenchmark] Failed to load scene %s", Config.ScenePath.c_str());
+		return false;
+	}
+	World->SetLevel(std::move(NewLevel));
+	World->GetRenderSettings().SetMeshInstancingEnabled(Config.bMeshInstancing);
+
+	// 에디터 뷰포트와 같은 경로(FViewport → FViewportClient → URenderer::RenderSceneForView)로 렌더
+	FViewport Viewport;
+	FViewportClient ViewportClient;
+	const UINT Width = RHIDevice->GetViewportWidth();
+	const UINT Height = RHIDevice->GetViewportHeight();
+	if (!Viewport.Initialize(0.0f, 0.0f, static_cast<float>(Width), static_cast<float>(Height), RHIDevice->GetDevice()))
+	{
+		UE_LOG("[RenderBenchmark] Failed to initialize viewport");
+		return false;
+	}
+	Viewport.SetViewportClient(&ViewportClient);
+	ViewportClient.SetWorld(World);
+
+	// 씬에 저장된 에디터 카메라 시점에서 측정
+	const ULevel* Level = World->GetLevel();
+	if (Level && Level->HasPerspectiveCamera())
+	{
+		const FPerspectiveCameraData& CamData = Level->GetPerspectiveCamera();
+		ACameraActor* Camera = ViewportClient.GetCamera();
+		Camera->SetActorLocation(CamData.Location);
+		Camera->SetRotationFromEulerAngles(CamData.Rotation);
+		Camera->GetCameraComponent()->SetFOV(CamData.FOV);
+		Camera->GetCameraComponent()->SetClipPlanes(CamData.NearClip, CamData.FarClip);
+	}
+
+	UE_LOG("[RenderBenchmark] %s driver, %ux%u, Scene=%s, Warmup=%d, Frames=%d",
+		DriverName.c_str(), Width, Height, Config.ScenePath.c_str(), Config.WarmupFrames, Config.FrameCount);
+
+	constexpr int32 NumPasses = static_cast<int32>(ERenderPassStat::Count);
+	FSampleAccumulator FrameSamples;
+	FSampleAccumulator RenderPassTotalSamples;
+	FSampleAccumulator PassSamples[NumPasses];
+	FSampleAccumulator CommandSamples[NumCommandCounters];
+	FSampleAccumulator NullRHISamples[NumNullRHICounters];
+	const bool bCounterOnlyRHI = RHIDevice->IsCounterOnlyRHI();
+	FSampleAccumulator VisiblePrimitiveSamples;
+	FSampleAccumulator OpaqueBatchSamples;
+	FSampleAccumulator MergedBatchSamples;
+
+	const FRenderPassStatManager& PassStats = FRenderPassStatManager::GetInstance();
+	const FCullingStatManager& CullingStats = FCullingStatManager::GetInstance();
+
+	const int32 TotalFrames = Config.WarmupFrames + Config.FrameCount;
+	for (int32 Frame = 0; Frame < TotalFrames; ++Frame)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Renderer->BeginFrame();
+		Viewport.Render();
+		Renderer->EndFrame();
+		const double FrameMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+		if (Frame < Config.WarmupFrames)
+		{
+			continue;
+		}
+
+		// 카운터는 다음 BeginFrame에서 초기화되므로 EndFrame 직후에 읽는다
+		FrameSamples.Add(FrameMS);
+		RenderPassTotalSamples.Add(PassStats.GetTotalMilliseconds());
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			PassSamples[Pass].Add(PassStats.GetPassMilliseconds(static_cast<ERenderPassStat>(Pass)));
+		}
+
+		double Counters[NumCommandCounters];
+		GetCommandCounters(RHIDevice->GetCommandStats(), Counters);
+		for (int32 i = 0; i < NumCommandCounters; ++i)
+		{
+			CommandSamples[i].Add(Counters[i]);
+		}
+
+		if (bCounterOnlyRHI)
+		{
+			double NullRHICounters[NumNullRHICounters];
+			GetNullRHICounters(RHIDevice->GetNullRHICallStats(), NullRHICounters);
+			for (int32 i = 0; i < NumNullRHICounters; ++i)
+			{
+				NullRHISamples[i].Add(NullRHICounters[i]);
+			}
+		}
+
+		VisiblePrimitiveSamples.Add(CullingStats.GetVisiblePrimitiveCount());
+		OpaqueBatchSamples.Add(CullingStats.GetOpaqueBatchCount());
+		MergedBatchSamples.Add(CullingStats.GetMergedBatchCount());
+	}
+
+	Results.Add(FrameSamples.ToResult("Frame", "FrameTotal"));
+	Results.Add(RenderPassTotalSamples.ToResult("Frame", "PassTotal"));
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		Results.Add(PassSamples[Pass].ToResult("Pass", FRenderPassStatManager::GetPassName(static_cast<ERenderPassStat>(Pass))));
+	}
+	for (int32 i = 0; i < NumCommandCounters; ++i)
+	{
+		Results.Add(CommandSamples[i].ToResult("Command", CommandCounterNames[i]));
+	}
+	if (bCounterOnlyRHI)
+	{
+		for (int32 i = 0; i < NumNullRHICounters; ++i)
+		{
+			Results.Add(NullRHISamples[i].ToResult("NullRHI", NullRHICounterNames[i]));
+		}
+	}
+	Results.Add(VisiblePrimitiveSamples.ToResult("Scene", "VisiblePrimitives"));
+	Results.Add(OpaqueBatchSamples.ToResult("Scene", "OpaqueBatches"));
+	Results.Add(MergedBatchSamples.ToResult("Scene", "InstancingMergedBatches"));
+
+	for (const FRenderBenchmarkResult& Result : Results)
+	{
+		UE_LOG("[RenderBenchmark] %-8s %-24s Avg=%.4f Min=%.4f Max=%.4f",
+			Result.Category.c_str(), Result.Name.c_str(), Result.Average, Result.Min, Result.Max);
+	}
+
+	std::error_code ErrorCode;
+	std::filesystem::create_directories(Config.OutputDir, ErrorCode);
+
+	const FString CSVPath = Config.OutputDir + "/RenderBenchmark.csv";
+	if (!WriteCSV(CSVPath))
+	{
+		UE_LOG("[RenderBenchmark] Failed to write results to %s", Config.OutputDir.c_str());
+		return false;
+	}
+	UE_LOG("[RenderBenchmark] %d results written to %s", static_cast<int32>(Results.Num()), Config.OutputDir.c_str());
+	return true;
+}
+
+bool FRenderBenchmark::WriteCSV(const FString& InFilePath) const
+{
+	std::ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	File << "Driver,Category,Name,Average,Min,Max\n";
+	File << std::fixed << std::setprecision(6);
+	for (const FRenderBenchmarkResult& Result : Results)
+	{
+		File << DriverName << ','
+			<< Result.Category << ','
+			<< Result.Name << ','
+			<< Result.Average << ','
+			<< Result.Min << ','
+			<< Result.Max << '\n';
+	}
+	return true;
+}
@@ -0,0 +1,61 @@
+﻿#pragma once
+
+/**
+ * @brief 렌더 벤치마크 설정. 커맨드라인(-RenderBenchmark ...)에서 채워집니다.
+ */
+struct FRenderBenchmarkConfig
+{
+	FString ScenePath = "Scene/Bus.Scene";	// 렌더할 씬 파일
+	int32 WarmupFrames = 30;				// 측정에서 제외할 프레임 (셰이더 컴파일, 섀도우 캐시 채우기)
+	int32 FrameCount = 300;					// 측정 프레임 수
+	bool bNullRHI = true;					// false(-RenderUseGPU)면 실제 하드웨어 디바이스로 같은 측정을 수행
+	bool bD3DNullDriver = false;			// true(-RenderD3DNullDriver)면 카운터 전용 디바이스 대신 D3D NULL 드라이버 사용 (그래픽 도구 필요)
+	bool bAllowWARP = false;				// true(-RenderAllowWARP)면 D3D NULL 드라이버가 없을 때 WARP(CPU 래스터라이저)로 대체돼도 측정
+	bool bMeshInstancing = true;			// false(-RenderNoInstancing)면 배치 인스턴싱 없이 측정
+
+	FString OutputDir = "Saved/Benchmark";
+};
+
+/**
+ * @brief 측정 결과 한 줄 (CSV 한 행). 패스 시간은 ms, 카운터는 프레임당 횟수입니다.
+ */
+struct FRenderBenchmarkResult
+{
+	FString Category;	// Frame / Pass / Command / NullRHI / Scene
+	FString Name;
+	double Average = 0.0;
+	double Min = 0.0;
+	double Max = 0.0;
+};
+
+/**
+ * @brief 씬을 로드해 에디터 루프 없이 FSceneRenderer 전체 경로를 반복 렌더링하고
+ * 패스별 CPU 시간과 RHI 명령/상태 변경 횟수를 기록합니다.
+ * 기본적으로 카운터 전용 Null RHI(NullRHI.h)에서 실행되므로 GPU나 그래픽 도구 없이 렌더 스레드 CPU 비용만 측정하고,
+ * 컨텍스트가 직접 센 호출 수를 NullRHI 항목으로 함께 기록합니다.
+ * -RenderD3DNullDriver로 D3D NULL 드라이버를 요청했는데 WARP가 만들어졌으면 래스터라이즈 비용이 섞이므로 -RenderAllowWARP 없이는 실패합니다.
+ */
+class FRenderBenchmark
+{
+public:
+	explicit FRenderBenchmark(const FRenderBenchmarkConfig& InConfig);
+
+	/**
+	 * @brief 커맨드라인에 -RenderBenchmark 가 있으면 설정을 채우고 true를 반환합니다.
+	 * 엔진 초기화(Null RHI 여부) 전에 호출할 수 있도록 문자열만 해석합니다.
+	 * 옵션: -RenderScene=Path -RenderFrames=N -RenderWarmup=N -RenderUseGPU -RenderD3DNullDriver -RenderAllowWARP -RenderNoInstancing -BenchmarkOutput=Dir
+	 */
+	static bool ParseCommandLine(const FString& InCmdLine, FRenderBenchmarkConfig& OutConfig);
+
+	/** @return 측정을 마치고 CSV를 썼으면 true */
+	bool Run();
+
+	bool WriteCSV(const FString& InFilePath) const;
+
+	const TArray<FRenderBenchmarkResult>& GetResults() const { return Results; }
+
+private:
+	FRenderBenchmarkConfig Config;
+	TArray<FRenderBenchmarkResult> Results;
+	FString DriverName;		// 측정에 쓰인 디바이스 드라이버 (Null / WARP / Hardware). CSV 각 행에 기록
+};
@@ -0,0 +1,120 @@
+﻿#pragma once
+
+#include <cstdint>
+#include "PlatformTime.h"
+
+/**
+ * @brief CPU 시간을 측정하는 FSceneRenderer 렌더 패스 구분입니다.
+ */
+enum class ERenderPassStat : uint8_t
+{
+	PrepareView,		// 뷰 행렬/프러스텀 계산
+	GatherProxies,		// BVH 컬링 + 프록시 수집
+	LightSetup,			// 섀도우 인덱스 갱신 + 라이트 버퍼 패킹
+	TileLightCulling,
+	ShadowMap,			// 스팟/포인트/방향성 섀도우 맵
+	CSMShadowMap,
+	OpaqueCollect,		// 메시 배치 수집
+	OpaqueSort,			// 메시 배치 정렬
+	OpaqueDraw,			// 상태 캐싱 + 드로우 제출
+	Decal,
+	PostProcess,		// 안개/후처리 체인/타일 컬링 디버그
+	EditorPrimitives,	// 에디터 프리미티브, 디버그, 오버레이
+	ScreenEffects,		// FXAA, 페이드, 백 버퍼 합성
+
+	Count
+};
+
+/**
+ * @class FRenderPassStatManager
+ * @brief 렌더 패스별 CPU 시간(ms)을 수집하고 제공하는 싱글톤 클래스입니다.
+ * 뷰포트가 여러 개면 한 프레임 동안 모든 뷰의 결과가 누적됩니다.
+ */
+class FRenderPassStatManager
+{
+public:
+	/**
+	 * @brief FRenderPassStatManager의 싱글톤 인스턴스를 반환합니다.
+	 */
+	static FRenderPassStatManager& GetInstance()
+	{
+		static FRenderPassStatManager Instance;
+		return Instance;
+	}
+
+	/**
+	 * @brief 매 프레임 렌더링 시작 시 호출하여 프레임 단위 통계 데이터를 초기화합니다.
+	 */
+	void ResetFrameStats()
+	{
+		for (double& Ms : PassMilliseconds)
+		{
+			Ms = 0.0;
+		}
+	}
+
+	// --- Getters ---
+
+	/** @return 이번 프레임에 해당 패스가 사용한 CPU 시간 (ms) */
+	double GetPassMilliseconds(ERenderPassStat InPass) const { return PassMilliseconds[static_cast<uint32_t>(InPass)]; }
+
+	/** @return 모든 패스의 CPU 시간 합 (ms) */
+	double GetTotalMilliseconds() const
+	{
+		double Total = 0.0;
+		for (double Ms : PassMilliseconds)
+		{
+			Total += Ms;
+		}
+		return Total;
+	}
+
+	/** @return CSV/오버레이 출력용 패스 이름 */
+	static const char* GetPassName(ERenderPassStat InPass)
+	{
+		static const char* Names[] =
+		{
+			"PrepareView", "GatherProxies", "LightSetup", "TileLightCulling", "ShadowMap", "CSMShadowMap",
+			"OpaqueCollect", "OpaqueSort", "OpaqueDraw", "Decal", "PostProcess", "EditorPrimitives", "ScreenEffects"
+		};
+		static_assert(sizeof(Names) / sizeof(Names[0]) == static_cast<size_t>(ERenderPassStat::Count), "패스 이름 누락");
+		return Names[static_cast<uint32_t>(InPass)];
+	}
+
+	// --- Setters / Incrementers ---
+
+	void AddPassCycles(ERenderPassStat InPass, uint64 InCycles)
+	{
+		PassMilliseconds[static_cast<uint32_t>(InPass)] += FPlatformTime::ToMilliseconds(InCycles);
+	}
+
+private:
+	FRenderPassStatManager() = default;
+	~FRenderPassStatManager() = default;
+	FRenderPassStatManager(const FRenderPassStatManager&) = delete;
+	FRenderPassStatManager& operator=(const FRenderPassStatManager&) = delete;
+
+	double PassMilliseconds[static_cast<uint32_t>(ERenderPassStat::Count)] = {};
+};
+
+/**
+ * @brief 스코프가 끝날 때 경과 시간을 해당 렌더 패스에 누적합니다.
+ */
+class FScopedRenderPassTimer
+{
+public:
+	explicit FScopedRenderPassTimer(ERenderPassStat InPass)
+		: Pass(InPass)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FScopedRenderPassTimer()
+	{
+		FRenderPassStatManager::GetInstance().AddPassCycles(Pass, FPlatformTime::Cycles64() - StartCycles);
+	}
+
+private:
+	ERenderPassStat Pass;
+	uint64 StartCycles;
+};
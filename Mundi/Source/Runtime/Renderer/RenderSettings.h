@@ -15,6 +15,22 @@ enum class EDirectionalShadowMode : uint32
     CSM = 1
 };
 
+// Spot/Point 섀도우 맵 캐시 정책
+enum class EShadowCacheMode : uint32
+{
+    NONE = 0,       // 매 프레임 모든 섀도우 맵을 다시 그림
+    STATIC = 1,     // 라이트나 볼륨 안의 캐스터가 바뀐 섀도우 맵만 다시 그림
+    DYNAMIC = 2     // 정적 캐스터는 캐시 레이어에서 복사, 움직이는 캐스터만 매 프레임 덧그림
+};
+
+// 메시 배치 드로우 순서 (정렬 키에서 깊이를 얼마나 앞에 두는지)
+enum class EMeshSortMode : uint32
+{
+    STATE = 0,          // 셰이더 → 머티리얼 → 메시 순으로 묶어 상태 변경 최소화 (같은 상태 안에서는 앞→뒤)
+    FRONT_TO_BACK = 1,  // 깊이 버킷 우선, 가까운 것부터 (Early-Z 활용)
+    BACK_TO_FRONT = 2   // 깊이 버킷 우선, 먼 것부터 (블렌딩)
+};
+
 class URenderSettings {
 public:
     URenderSettings() = default;
@@ -53,6 +69,20 @@ public:
     void SetDirectionaliShadowMode(EDirectionalShadowMode In) { DirectionalShadowMode = In; }
     EShadowFilterMode GetShadowFilterMode() const { return ShadowFilterMode; }
     EDirectionalShadowMode GetDirectionaliShadowMode() const { return DirectionalShadowMode; }
+    void SetShadowCacheMode(EShadowCacheMode In) { ShadowCacheMode = In; }
+    EShadowCacheMode GetShadowCacheMode() const { return ShadowCacheMode; }
+
+    // Draw order
+    void SetOpaqueSortMode(EMeshSortMode In) { OpaqueSortMode = In; }
+    EMeshSortMode GetOpaqueSortMode() const { return OpaqueSortMode; }
+    void SetTranslucentSortMode(EMeshSortMode In) { TranslucentSortMode = In; }
+    EMeshSortMode GetTranslucentSortMode() const { return TranslucentSortMode; }
+
+    // Hardware instancing (불투명 패스)
+    void SetMeshInstancingEnabled(bool bEnabled) { bMeshInstancing = bEnabled; }
+    bool IsMeshInstancingEnabled() const { return bMeshInstancing; }
+    void SetMinInstanceCount(uint32 Value) { MinInstanceCount = Value; }
+    uint32 GetMinInstanceCount() const { return MinInstanceCount; }
 
     // Shadow resolution (Spot/Point)
     void SetSpotShadowResolution(uint32 Value) { SpotShadowResolution = Value; }
@@ -95,6 +125,15 @@ private:
     // Shadow filtering
     EShadowFilterMode ShadowFilterMode = EShadowFilterMode::NONE;
     EDirectionalShadowMode DirectionalShadowMode = EDirectionalShadowMode::CSM;
+    EShadowCacheMode ShadowCacheMode = EShadowCacheMode::STATIC;
+
+    // Draw order (Translucent는 블렌딩되는 데칼 패스에 적용)
+    EMeshSortMode OpaqueSortMode = EMeshSortMode::STATE;
+    EMeshSortMode TranslucentSortMode = EMeshSortMode::BACK_TO_FRONT;
+
+    // Hardware instancing
+    bool bMeshInstancing = true;
+    uint32 MinInstanceCount = 2;            // 같은 상태의 배치가 이 수 이상일 때만 인스턴스 드로우로 합침
 
     // Shadow resolution (used for Spot/Point atlas textures)
     uint32 SpotShadowResolution = 1024;
@@ -29,11 +29,15 @@
 #include "EditorEngine.h"
 #include "DecalComponent.h"
 #include "DecalStatManager.h"
+#include "CullingStatManager.h"
+#include "ShadowStatManager.h"
+#include "RenderPassStatManager.h"
 #include "SceneRenderer.h"
 #include "SceneView.h"
 #include "ShadowSystem.h"
 #include "CSM.h"
 #include "TileLightCuller.h"
+#include "MeshBatchInstancing.h"
 
 #include <Windows.h>
 
@@ -44,6 +48,9 @@ URenderer::URenderer(D3D11RHI* InDevice) : RHIDevice(InDevice)
 	CSMSystem = new FCSM(InDevice);
 	// 타일 라이트 컬러는 프레임 간 재사용 (컴파일/리소스 재생성 방지)
 	TileLightCuller = new FTileLightCuller();
+	// 인스턴스 버퍼도 프레임 간 재사용 (필요할 때만 커짐)
+	MeshBatchInstancer = new FMeshBatchInstancer();
+	MeshBatchInstancer->Initialize(InDevice);
 }
 
 URenderer::~URenderer()
@@ -65,6 +72,11 @@ URenderer::~URenderer()
 		delete TileLightCuller;
 		TileLightCuller = nullptr;
 	}
+	if (MeshBatchInstancer)
+	{
+		delete MeshBatchInstancer;
+		MeshBatchInstancer = nullptr;
+	}
 }
 
 void URenderer::BeginFrame()
@@ -75,6 +87,10 @@ void URenderer::BeginFrame()
 
 	// 프레임별 데칼 통계를 추적하기 위해 초기화
 	FDecalStatManager::GetInstance().ResetFrameStats();
+	FCullingStatManager::GetInstance().ResetFrameStats();
+	FShadowStatManager::GetInstance().ResetFrameStats();
+	FRenderPassStatManager::GetInstance().ResetFrameStats();
+	RHIDevice->ResetCommandStats();
 
 	RHIDevice->ClearAllBuffer();
 }
@@ -261,6 +277,8 @@ void URenderer::EndLineBatch(const FMatrix& ModelMatrix)
 		// Overlay 스텐실(=1) 영역은 그리지 않도록 스텐실 테스트 설정
 		
 		RHIDevice->GetDeviceContext()->DrawIndexed(DynamicLineMesh->GetCurrentIndexCount(), 0, 0);
+		++RHIDevice->GetCommandStats().DrawCalls;
+		RHIDevice->GetCommandStats().Primitives += DynamicLineMesh->GetCurrentIndexCount() / 2;
 		
 	}
 	RHIDevice->OMSetDepthStencilState_StencilRejectOverlay();
@@ -14,6 +14,7 @@ class UPrimitiveComponent;
 struct FMaterialSlot;
 class FShadowSystem;
 class FTileLightCuller;
+class FMeshBatchInstancer;
 
 class URenderer
 {
@@ -48,6 +49,7 @@ public:
     FShadowSystem* GetShadowSystem() const { return ShadowSystem; }
     FCSM* GetCSMSystem() const { return CSMSystem;	}
     FTileLightCuller* GetTileLightCuller() const { return TileLightCuller; }
+    FMeshBatchInstancer* GetMeshBatchInstancer() const { return MeshBatchInstancer; }
 
 private:
 	D3D11RHI* RHIDevice;    // NOTE: 개발 편의성을 위해서 DX11를 종속적으로 사용한다 (URHIDevice를 사용하지 않음)
@@ -77,5 +79,6 @@ private:
     FShadowSystem* ShadowSystem = nullptr;
     FCSM* CSMSystem = nullptr;
     FTileLightCuller* TileLightCuller = nullptr;
+    FMeshBatchInstancer* MeshBatchInstancer = nullptr;
 };
 
@@ -22,11 +22,19 @@
 #include "SelectionManager.h"
 #include "StaticMeshComponent.h"
 #include "DecalStatManager.h"
+#include "CullingStatManager.h"
+#include "ShadowStatManager.h"
+#include "RenderPassStatManager.h"
+#include "MeshBatchSort.h"
+#include "MeshBatchInstancing.h"
 #include "BillboardComponent.h"
 #include "TextRenderComponent.h"
 #include "OBB.h"
 #include "BoundingSphere.h"
+#include "Collision.h"
 #include "HeightFogComponent.h"
+#include "JobSystem.h"
+#include "HashUtils.h"
 #include "Gizmo/GizmoArrowComponent.h"
 #include "Gizmo/GizmoRotateComponent.h"
 #include "Gizmo/GizmoScaleComponent.h"
@@ -76,10 +84,16 @@ void FSceneRenderer::Render()
 	if (!IsValid()) return;
 
 	// 뷰(View) 준비: 행렬, 절두체 등 프레임에 필요한 기본 데이터 계산
-	PrepareView();
+	{
+		FScopedRenderPassTimer PassTimer(ERenderPassStat::PrepareView);
+		PrepareView();
+	}
 
 	// 렌더링할 대상 수집 (Cull + Gather)
-	GatherVisibleProxies();
+	{
+		FScopedRenderPassTimer PassTimer(ERenderPassStat::GatherProxies);
+		GatherVisibleProxies();
+	}
 
 	// ViewMode에 따라 렌더링 경로 결정
 	if (View->ViewMode == EViewModeIndex::VMI_Lit ||
@@ -91,24 +105,38 @@ void FSceneRenderer::Render()
 
 		// 섀도우가 그려질 라이트들에 대해서 ShadowList에서의 Index 업데이트.
 		FShadowSystem* ShadowSystem = OwnerRenderer->GetShadowSystem();
+		ShadowSystem->SetShadowCacheMode(World->GetRenderSettings().GetShadowCacheMode());
 
-        ShadowSystem->UpdateShadowIndex(LightManager->GetDirectionalLight(), LightManager->GetPointLightList(),
-            LightManager->GetSpotLightList(), RHIDevice, View);
+		{
+			FScopedRenderPassTimer PassTimer(ERenderPassStat::LightSetup);
+			ShadowSystem->UpdateShadowIndex(LightManager->GetDirectionalLight(), LightManager->GetPointLightList(),
+				LightManager->GetSpotLightList(), RHIDevice, View);
 
-        // 새도우 업데이트 후 라이트 업데이트해야함 (새도우에 대한 참조 인덱스를 라이트가 저장하기 때문)
-        LightManager->UpdateLightBuffer(RHIDevice);	//라이트 구조체 버퍼 업데이트, 바인딩
+			// 새도우 업데이트 후 라이트 업데이트해야함 (새도우에 대한 참조 인덱스를 라이트가 저장하기 때문)
+			LightManager->UpdateLightBuffer(RHIDevice);	//라이트 구조체 버퍼 업데이트, 바인딩
+		}
 
         // 라이트 버퍼 업데이트 이후에 타일 컬링 수행 (CS가 최신 SRV/Count 사용)
-        PerformTileLightCulling();	
+		{
+			FScopedRenderPassTimer PassTimer(ERenderPassStat::TileLightCulling);
+			PerformTileLightCulling();
+		}
 
 		// Per-light shadow sharpen is provided via light buffers (Spot/Point info).
 
 		if (World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Shadows))
 		{
+			FScopedRenderPassTimer PassTimer(ERenderPassStat::ShadowMap);
 			RenderShadowMap(ShadowSystem);	// 섀도우 맵 렌더링
 		}
 		else
 		{
+			// 캐시 모드에서는 UpdateShadowIndex가 지우지 않으므로 직접 지우고, 다시 켤 때 전부 새로 그리도록 캐시를 비움
+			if (ShadowSystem->GetShadowCacheMode() != EShadowCacheMode::NONE)
+			{
+				ShadowSystem->ClearLocalLightShadowMaps(RHIDevice, true);
+				ShadowSystem->InvalidateAllShadowCache();
+			}
 			ShadowSystem->CaptureSelectedLightShadowMap(RHIDevice); // 쉐도우맵이 클리어된 상태(FShadowSystem::UpdateShadowIndex에서 해줌)에서 캡처
 		}
 
@@ -119,6 +147,7 @@ void FSceneRenderer::Render()
 				FCSM* CSMSystem = OwnerRenderer->GetCSMSystem();
 				if(World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Shadows))
 				{
+					FScopedRenderPassTimer PassTimer(ERenderPassStat::CSMShadowMap);
 					RenderDirectionalCSMShadowMap(CSMSystem); // 섀도우 맵 렌더링	
 				}
 				else
@@ -131,6 +160,8 @@ void FSceneRenderer::Render()
 		}
         
 		RenderLitPath();
+
+		FScopedRenderPassTimer PassTimer(ERenderPassStat::PostProcess);
 		RenderPostProcessingPasses();	// 후처리 체인 실행
 		RenderPostProcessChainPass(); //  Letter Box, Gamma Correction, Vignetting을 위한 후처리 체인 실행
 		RenderTileCullingDebug();	// 타일 컬링 디버그 시각화 draw
@@ -154,11 +185,16 @@ void FSceneRenderer::Render()
 	}
 
 	//그리드와 디버그용 Primitive는 Post Processing 적용하지 않음.
-	RenderEditorPrimitivesPass();	// 빌보드, 기타 화살표 출력 (상호작용, 피킹 O)
-	RenderDebugPass();	//  그리드, 선택한 물체의 경계 출력 (상호작용, 피킹 X)
+	{
+		FScopedRenderPassTimer PassTimer(ERenderPassStat::EditorPrimitives);
+		RenderEditorPrimitivesPass();	// 빌보드, 기타 화살표 출력 (상호작용, 피킹 O)
+		RenderDebugPass();	//  그리드, 선택한 물체의 경계 출력 (상호작용, 피킹 X)
 
-	// 오버레이(Overlay) Primitive 렌더링
-	RenderOverayEditorPrimitivesPass();	// 기즈모 출력
+		// 오버레이(Overlay) Primitive 렌더링
+		RenderOverayEditorPrimitivesPass();	// 기즈모 출력
+	}
+
+	FScopedRenderPassTimer PassTimer(ERenderPassStat::ScreenEffects);
 
 	// FXAA 등 화면에서 최종 이미지 품질을 위해 적용되는 효과를 적용
 	ApplyScreenEffectsPass();
@@ -178,6 +214,8 @@ void FSceneRenderer::RenderLitPath()
 
 	// Base Pass
 	RenderOpaquePass(View->ViewMode);
+
+	FScopedRenderPassTimer PassTimer(ERenderPassStat::Decal);
 	RenderDecalPass();
 }
 
@@ -307,9 +345,10 @@ void FSceneRenderer::PrepareView()
 
 void FSceneRenderer::GatherVisibleProxies()
 {
-	// NOTE: 일단 컴포넌트 단위와 데칼 관련 이슈 해결까지 컬링 무시
-	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
-	//PerformFrustumCulling();
+	auto CpuTimeStart = std::chrono::high_resolution_clock::now();
+
+	// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleComponents에 저장됨
+	PerformFrustumCulling();
 
 	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
 	const bool bDrawDecals = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Decals);
@@ -374,7 +413,15 @@ void FSceneRenderer::GatherVisibleProxies()
 
 						if (bShouldAdd)
 						{
-							Proxies.Meshes.Add(MeshComponent);
+							// 화면 밖에 있어도 그림자는 드리울 수 있으므로 섀도우 캐스터 목록은 컬링하지 않음
+							Proxies.ShadowCasterMeshes.Add(MeshComponent);
+
+							const bool bVisible = IsPrimitiveVisible(MeshComponent);
+							FCullingStatManager::GetInstance().AddPrimitive(bVisible);
+							if (bVisible)
+							{
+								Proxies.Meshes.Add(MeshComponent);
+							}
 						}
 					}
 					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
@@ -383,7 +430,13 @@ void FSceneRenderer::GatherVisibleProxies()
 					}
 					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent); DecalComponent && bDrawDecals)
 					{
-						Proxies.Decals.Add(DecalComponent);
+						// 데칼은 투영 볼륨이 보일 때만 그림 (투영 대상 메시는 RenderDecalPass에서 BVH로 따로 조회)
+						const bool bVisible = IsPrimitiveVisible(DecalComponent);
+						FCullingStatManager::GetInstance().AddPrimitive(bVisible);
+						if (bVisible)
+						{
+							Proxies.Decals.Add(DecalComponent);
+						}
 					}
 				}
 				else
@@ -407,6 +460,304 @@ void FSceneRenderer::GatherVisibleProxies()
 	{
 		CollectComponentsFromActor(Actor, false);
 	}
+
+	auto CpuTimeEnd = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double, std::milli> CpuTimeMs = CpuTimeEnd - CpuTimeStart;
+	FCullingStatManager::GetInstance().GetCullingTimeSlot() += CpuTimeMs.count();
+}
+
+namespace
+{
+	/**
+	 * 직교 섀도우 행렬(Light View * Ortho)이 덮는 월드 공간 박스를 OBB로 만든다.
+	 * 클립 공간 x,y ∈ [-1, 1], z ∈ [0, 1] 슬랩을 행렬 열벡터 방향으로 되돌림 (역행렬 없이 스케일이 큰 직교 투영도 안정적)
+	 * 원근 성분이 있으면(PSM 등) false
+	 */
+	bool TryMakeOrthoShadowVolume(const FMatrix& InViewProj, FOBB& OutVolume)
+	{
+		constexpr float Tolerance = 1.0e-4f;
+		if (std::fabs(InViewProj.M[0][3]) > Tolerance || std::fabs(InViewProj.M[1][3]) > Tolerance ||
+			std::fabs(InViewProj.M[2][3]) > Tolerance || std::fabs(InViewProj.M[3][3] - 1.0f) > Tolerance)
+		{
+			return false;
+		}
+
+		const float ClipMin[3] = { -1.0f, -1.0f, 0.0f };
+		const float ClipMax[3] = { 1.0f, 1.0f, 1.0f };
+
+		FVector Axes[3];
+		float HalfExtent[3];
+		FVector Center(0.0f, 0.0f, 0.0f);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const FVector Column(InViewProj.M[0][Axis], InViewProj.M[1][Axis], InViewProj.M[2][Axis]);
+			const float Scale = Column.Size();
+			if (!(Scale > 0.0f))
+			{
+				return false;
+			}
+
+			const float InvScale = 1.0f / Scale;
+			const float SlabMin = (ClipMin[Axis] - InViewProj.M[3][Axis]) * InvScale;
+			const float SlabMax = (ClipMax[Axis] - InViewProj.M[3][Axis]) * InvScale;
+
+			Axes[Axis] = Column * InvScale;
+			HalfExtent[Axis] = (SlabMax - SlabMin) * 0.5f;
+			Center += Axes[Axis] * ((SlabMin + SlabMax) * 0.5f);
+		}
+
+		OutVolume = FOBB(Center, FVector(HalfExtent[0], HalfExtent[1], HalfExtent[2]), Axes);
+		return true;
+	}
+
+	/** 스포트라이트 원뿔(꼭짓점 InOrigin, 반각 InHalfAngle, 길이 InRange의 구면 부채꼴)과 AABB의 겹침 판정. AABB는 외접구로 근사 */
+	bool IntersectsSpotCone(const FAABB& InBound, const FVector& InOrigin, const FVector& InDirection, float InHalfAngle, float InRange)
+	{
+		const float Radius = InBound.GetHalfExtent().Size();
+		const FVector ToCenter = InBound.GetCenter() - InOrigin;
+		const float Distance = ToCenter.Size();
+
+		if (Distance > InRange + Radius)
+		{
+			return false;
+		}
+		if (Distance <= Radius)
+		{
+			return true;
+		}
+
+		const float CosToCenter = std::clamp(FVector::Dot(ToCenter, InDirection) / Distance, -1.0f, 1.0f);
+		return std::acos(CosToCenter) <= InHalfAngle + std::asin(Radius / Distance);
+	}
+
+	/**
+	 * 큐브맵 면(0:+X, 1:-X, 2:+Y, 3:-Y, 4:+Z, 5:-Z)의 90도 절두체와 AABB의 겹침 판정.
+	 * 면 영역은 해당 축 좌표가 나머지 두 축 좌표의 절댓값 이상인 점들이므로 축마다 독립적으로 극값을 고르면 됨
+	 */
+	bool IntersectsCubeFace(const FAABB& InBound, const FVector& InLightPosition, int32 InFaceIndex)
+	{
+		const FVector LocalMin = InBound.Min - InLightPosition;
+		const FVector LocalMax = InBound.Max - InLightPosition;
+		const float Lo[3] = { LocalMin.X, LocalMin.Y, LocalMin.Z };
+		const float Hi[3] = { LocalMax.X, LocalMax.Y, LocalMax.Z };
+
+		const int32 FaceAxis = InFaceIndex / 2;
+		const float Reach = (InFaceIndex % 2 == 0) ? Hi[FaceAxis] : -Lo[FaceAxis];
+		if (Reach < 0.0f)
+		{
+			return false;
+		}
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (Axis == FaceAxis)
+			{
+				continue;
+			}
+			const float Nearest = (Lo[Axis] > 0.0f) ? Lo[Axis] : ((Hi[Axis] < 0.0f) ? -Hi[Axis] : 0.0f);
+			if (Nearest > Reach)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** 섀도우 캐시 키: 값을 섞은 뒤 매번 믹스해 비트가 고르게 퍼지도록 함 */
+	uint64 HashShadowCacheValue(uint64 Seed, uint64 Value)
+	{
+		return HashMix64(HashCombine(Seed, Value));
+	}
+
+	uint64 HashShadowCacheFloat(uint64 Seed, float Value)
+	{
+		return HashMix64(HashCombineFloat(Seed, Value));
+	}
+}
+
+void FSceneRenderer::PrepareShadowCasters()
+{
+	if (bShadowCastersPrepared)
+	{
+		return;
+	}
+	bShadowCastersPrepared = true;
+
+	const TArray<UMeshComponent*>& Casters = Proxies.ShadowCasterMeshes;
+	const int32 CasterCount = Casters.Num();
+
+	// 배치 수집은 뷰당 한 번: 라이트/캐스케이드/큐브 면마다 다시 만들지 않고 인덱스로 골라 그림
+	MeshBatchElements.Empty();
+	ShadowCasterBatchStarts.Empty();
+	CollectMeshBatches(Casters, &ShadowCasterBatchStarts);
+	ShadowCasterBatchStarts.Add(MeshBatchElements.Num());
+
+	// 정렬 결과를 배열로 만들어 두고, 수집 순서 -> 정렬 위치 역참조를 기록
+	// 섀도우 패스는 라이트마다 시점이 달라 깊이 없이 상태 순으로만 정렬
+	const int32 BatchCount = MeshBatchElements.Num();
+	TArray<int32> SortedToCollected;
+	FMeshBatchSorter& Sorter = FMeshBatchSorter::GetInstance();
+	Sorter.BuildSortKeys(MeshBatchElements, 0, BatchCount, EMeshBatchPass::Opaque, EMeshSortMode::STATE, nullptr);
+	Sorter.SortMeshBatches(MeshBatchElements, SortedToCollected);
+
+	ShadowBatchElements.Empty();
+	ShadowBatchElements.Reserve(BatchCount);
+	ShadowBatchOrder.SetNum(BatchCount);
+	for (int32 SortedIndex = 0; SortedIndex < BatchCount; ++SortedIndex)
+	{
+		ShadowBatchElements.Add(MeshBatchElements[SortedToCollected[SortedIndex]]);
+		ShadowBatchOrder[SortedToCollected[SortedIndex]] = SortedIndex;
+	}
+	MeshBatchElements.Empty();
+
+	// 캐스터 분류: BVH에 최신 상태로 들어있는 것만 BVH 쿼리 결과를 믿고, 나머지는 직접 판정하거나 항상 포함
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	const bool bHasBVH = Partition && Partition->GetBVH();
+
+	ShadowCasterBounds.SetNum(CasterCount);
+	ShadowCasterIndexMap.Empty();
+	UnindexedShadowCasters.Empty();
+	UnboundedShadowCasters.Empty();
+	for (int32 CasterIndex = 0; CasterIndex < CasterCount; ++CasterIndex)
+	{
+		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Casters[CasterIndex]))
+		{
+			ShadowCasterBounds[CasterIndex] = StaticMeshComponent->GetWorldAABB();
+			if (bHasBVH && Partition->IsUpToDate(StaticMeshComponent))
+			{
+				ShadowCasterIndexMap.Add(StaticMeshComponent, CasterIndex);
+			}
+			else
+			{
+				UnindexedShadowCasters.Add(CasterIndex);
+			}
+		}
+		else
+		{
+			ShadowCasterBounds[CasterIndex] = FAABB(FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX), FVector(FLT_MAX, FLT_MAX, FLT_MAX));
+			UnboundedShadowCasters.Add(CasterIndex);
+		}
+	}
+
+	FShadowStatManager::GetInstance().AddCandidates(CasterCount, BatchCount);
+}
+
+void FSceneRenderer::GatherShadowCasters(const TArray<UStaticMeshComponent*>& InBVHCandidates,
+	const std::function<bool(const FAABB&)>& InOverlaps, TArray<int32>& OutCasterIndices) const
+{
+	OutCasterIndices.Empty();
+
+	for (UStaticMeshComponent* Candidate : InBVHCandidates)
+	{
+		// 이번 뷰의 캐스터 목록에 없는 컴포넌트(숨김, ShowFlag 등)는 BVH에 있어도 제외
+		if (const int32* CasterIndex = ShadowCasterIndexMap.Find(Candidate))
+		{
+			if (InOverlaps(ShadowCasterBounds[*CasterIndex]))
+			{
+				OutCasterIndices.Add(*CasterIndex);
+			}
+		}
+	}
+
+	for (int32 CasterIndex : UnindexedShadowCasters)
+	{
+		if (InOverlaps(ShadowCasterBounds[CasterIndex]))
+		{
+			OutCasterIndices.Add(CasterIndex);
+		}
+	}
+
+	OutCasterIndices.Append(UnboundedShadowCasters);
+}
+
+void FSceneRenderer::GatherShadowBatches(const TArray<int32>& InCasterIndices, TArray<int32>& OutBatchIndices) const
+{
+	OutBatchIndices.Empty();
+	for (int32 CasterIndex : InCasterIndices)
+	{
+		for (int32 Collected = ShadowCasterBatchStarts[CasterIndex]; Collected < ShadowCasterBatchStarts[CasterIndex + 1]; ++Collected)
+		{
+			OutBatchIndices.Add(ShadowBatchOrder[Collected]);
+		}
+	}
+
+	// 정렬된 배치 배열의 순서대로 그려 IA 상태 변경을 최소화
+	std::sort(OutBatchIndices.begin(), OutBatchIndices.end());
+}
+
+void FSceneRenderer::DrawShadowBatches(const TArray<int32>& InBatchIndices)
+{
+	FRHICommandStats& CommandStats = RHIDevice->GetCommandStats();
+
+	// --- 렌더링: depth map에 쓰기 ---
+	ID3D11Buffer* CurrentVertexBuffer = nullptr;
+	ID3D11Buffer* CurrentIndexBuffer = nullptr;
+	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+
+	// 메시 배치 요소 순회
+	for (int32 BatchIndex : InBatchIndices)
+	{
+		const FMeshBatchElement& Batch = ShadowBatchElements[BatchIndex];
+		if (Batch.VertexBuffer != CurrentVertexBuffer ||
+			Batch.IndexBuffer != CurrentIndexBuffer ||
+			Batch.PrimitiveTopology != CurrentTopology)
+		{
+			UINT Stride = Batch.VertexStride;
+			UINT Offset = 0;
+
+			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
+			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+
+			RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
+
+			// 현재 IA 상태 캐싱
+			CurrentVertexBuffer = Batch.VertexBuffer;
+			CurrentIndexBuffer = Batch.IndexBuffer;
+			CurrentTopology = Batch.PrimitiveTopology;
+			++CommandStats.InputAssemblerChanges;
+		}
+
+		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, FMatrix::Identity()));
+
+		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		++CommandStats.DrawCalls;
+		CommandStats.Primitives += Batch.IndexCount / 3;
+	}
+}
+
+uint64 FSceneRenderer::SplitShadowCachedCasters(const TArray<int32>& InCasterIndices, bool bSplitDynamic,
+	TArray<int32>& OutStaticCasters, TArray<int32>& OutDynamicCasters, bool& bOutCacheable) const
+{
+	OutStaticCasters.Empty();
+	OutDynamicCasters.Empty();
+	bOutCacheable = true;
+
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	uint64 CasterSum = 0;
+	for (int32 CasterIndex : InCasterIndices)
+	{
+		UMeshComponent* Caster = Proxies.ShadowCasterMeshes[CasterIndex];
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Caster);
+
+		// 파티션이 MarkDirty로 이동을 추적하는 스태틱 메시만 무효화 영역이 기록됨
+		const bool bTracked = StaticMeshComponent && Partition;
+		const bool bMoving = !bTracked || Partition->IsRecentlyMoved(StaticMeshComponent);
+		if (bSplitDynamic && bMoving)
+		{
+			OutDynamicCasters.Add(CasterIndex);
+			continue;
+		}
+
+		if (!bTracked)
+		{
+			bOutCacheable = false;
+		}
+		OutStaticCasters.Add(CasterIndex);
+		// 더하기로 합쳐 BVH 쿼리 순서와 무관하게 같은 집합이면 같은 값
+		CasterSum += HashMix64(PointerHash(Caster));
+	}
+
+	return HashShadowCacheValue(CasterSum, static_cast<uint64>(OutStaticCasters.Num()));
 }
 
 void FSceneRenderer::RenderDirectionalCSMShadowMap(FCSM* CSMSystem)
@@ -443,23 +794,17 @@ void FSceneRenderer::RenderDirectionalCSMShadowMap(FCSM* CSMSystem)
 	}
 	RHIDevice->PrepareShader(DepthOnlyShader);
 
-	// --- Mesh 수집 및 정렬 ---
-	MeshBatchElements.Empty();
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
-	{
-		MeshComponent->CollectMeshBatches(MeshBatchElements, View);
-	}
-	MeshBatchElements.Sort();
+	// --- 캐스터 배치 준비 (RenderShadowMap과 공유) ---
+	PrepareShadowCasters();
 
-	// --- 렌더링: depth map에 쓰기 ---
-	ID3D11Buffer* CurrentVertexBuffer = nullptr;
-	ID3D11Buffer* CurrentIndexBuffer = nullptr;
-	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
-	
 	const TArray<ID3D11DepthStencilView*>& DSVViews = CSMSystem->GetCSMDSV();
 	uint32 NumLights = CSMSystem->GetDSVNum();
 
 	CSMSystem->UpdateMatrices(GWorld->GetLightManager()->GetDirectionalLight()->GetLightInfo().Direction, View);
+
+	const FBVHierarchy* BVH = World->GetPartitionManager() ? World->GetPartitionManager()->GetBVH() : nullptr;
+	TArray<int32> CasterIndices;
+	TArray<int32> BatchIndices;
 	for(int idx = 0; idx < NumLights; idx++)
 	{
 		//// ShadowViewports의 index는 FShadowBufferType.ShadowInfoList의 index와 매칭됨.
@@ -471,32 +816,27 @@ void FSceneRenderer::RenderDirectionalCSMShadowMap(FCSM* CSMSystem)
 		RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
 		// Provide light type for DepthOnly encoding
 		RHIDevice->SetAndUpdateConstantBuffer(FShadowBufferIndexType(idx, (int)ELightType::DirectionalLight));
-		// 메시 배치 요소 순회
-		for (const FMeshBatchElement& Batch : MeshBatchElements)
-		{
-			if (Batch.VertexBuffer != CurrentVertexBuffer ||
-				Batch.IndexBuffer != CurrentIndexBuffer ||
-				Batch.PrimitiveTopology != CurrentTopology)
-			{
-				UINT Stride = Batch.VertexStride;
-				UINT Offset = 0;
-
-				RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-				RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
 
-				RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
-
-				// 현재 IA 상태 캐싱
-				CurrentVertexBuffer = Batch.VertexBuffer;
-				CurrentIndexBuffer = Batch.IndexBuffer;
-				CurrentTopology = Batch.PrimitiveTopology;
-			}
-
-			RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, FMatrix::Identity()));
-			RHIDevice->SetAndUpdateConstantBuffer(FShadowBufferIndexType(idx));
-
-			RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		// 캐스케이드의 라이트 공간 박스(OBB)와 겹치는 캐스터만 그림
+		FOBB CascadeVolume;
+		if (TryMakeOrthoShadowVolume(CSMSystem->GetCascadeViewProjection(idx), CascadeVolume))
+		{
+			const TArray<UStaticMeshComponent*> Candidates = BVH ? BVH->QueryIntersectedComponents(CascadeVolume) : TArray<UStaticMeshComponent*>();
+			GatherShadowCasters(Candidates, [&CascadeVolume](const FAABB& Bound) { return Collision::Intersects(Bound, CascadeVolume); }, CasterIndices);
 		}
+		else
+		{
+			GatherShadowCasters(TArray<UStaticMeshComponent*>(), [](const FAABB&) { return true; }, CasterIndices);
+		}
+		GatherShadowBatches(CasterIndices, BatchIndices);
+		DrawShadowBatches(BatchIndices);
+
+		FShadowCasterStat Stat;
+		Stat.LightType = ELightType::DirectionalLight;
+		Stat.SubIndex = idx;
+		Stat.CasterCount = CasterIndices.Num();
+		Stat.DrawCount = BatchIndices.Num();
+		FShadowStatManager::GetInstance().AddCasterStat(Stat, 1, ShadowBatchElements.Num());
 	}
 	
 	/* Uber Constant에 Matrix 업데이트 */
@@ -563,19 +903,13 @@ void FSceneRenderer::RenderShadowMap(FShadowSystem* InShadowSystem)
 		RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
 	}
 
-	// --- Mesh 수집 및 정렬 ---
-	MeshBatchElements.Empty();
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
-	{
-		MeshComponent->CollectMeshBatches(MeshBatchElements, View);
-	}
-	MeshBatchElements.Sort();
-	// --- 렌더링: depth map에 쓰기 ---
-	ID3D11Buffer* CurrentVertexBuffer = nullptr;
-	ID3D11Buffer* CurrentIndexBuffer = nullptr;
-	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	// --- 캐스터 배치 준비 (CSM 패스와 공유) ---
+	PrepareShadowCasters();
+
+	const FBVHierarchy* BVH = World->GetPartitionManager() ? World->GetPartitionManager()->GetBVH() : nullptr;
+	TArray<int32> CasterIndices;
+	TArray<int32> BatchIndices;
 
-	/////////////////////////////// 똑같은 매시를 렌더링하는 똑같은 코드를 중복해서 작성하고 있음. 별개 함수로 분리하고 반복문 안에서 호출만 해줘야 함/////////////////////////
 	UDirectionalLightComponent* DirectionalLight = LightManager->GetDirectionalLight();
 	if (DirectionalLight)
 	{
@@ -584,40 +918,89 @@ void FSceneRenderer::RenderShadowMap(FShadowSystem* InShadowSystem)
 		// Depth-only pass: Pixel Shader 없음
 		RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
         RHIDevice->SetAndUpdateConstantBuffer(FShadowBufferIndexType(DirectionalLight->GetShadowIndex(), (int)ELightType::DirectionalLight));
-		// 메시 배치 요소 순회
-		for (const FMeshBatchElement& Batch : MeshBatchElements)
-		{
-			if (Batch.VertexBuffer != CurrentVertexBuffer ||
-				Batch.IndexBuffer != CurrentIndexBuffer ||
-				Batch.PrimitiveTopology != CurrentTopology)
-			{
-				UINT Stride = Batch.VertexStride;
-				UINT Offset = 0;
-
-				RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-				RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
 
-				RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
+		const FShadowInfo ShadowInfo = InShadowSystem->GetShadowBufferData().ShadowInfoList[DirectionalLight->GetShadowIndex()];
+		// NOTE: 마지막 행렬을 제외한 나머지 행렬은 카메라 관련 행렬로 유지를 해야 함: 다른 패스에서 카메라 관련 행렬들을 쓰기 위함
+		RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(ViewProjBuffer.View,
+			ViewProjBuffer.Proj,
+			ViewProjBuffer.InvView,
+			ViewProjBuffer.InvProj,
+			ShadowInfo.ViewProjectionMatrix));
+
+		// 직교 섀도우는 라이트 공간 박스(OBB)로 컬링, PSM처럼 원근이 섞인 행렬은 모든 캐스터를 그림
+		FOBB ShadowVolume;
+		if (TryMakeOrthoShadowVolume(ShadowInfo.ViewProjectionMatrix, ShadowVolume))
+		{
+			const TArray<UStaticMeshComponent*> Candidates = BVH ? BVH->QueryIntersectedComponents(ShadowVolume) : TArray<UStaticMeshComponent*>();
+			GatherShadowCasters(Candidates, [&ShadowVolume](const FAABB& Bound) { return Collision::Intersects(Bound, ShadowVolume); }, CasterIndices);
+		}
+		else
+		{
+			GatherShadowCasters(TArray<UStaticMeshComponent*>(), [](const FAABB&) { return true; }, CasterIndices);
+		}
+		GatherShadowBatches(CasterIndices, BatchIndices);
+		DrawShadowBatches(BatchIndices);
+
+		FShadowCasterStat Stat;
+		Stat.LightType = ELightType::DirectionalLight;
+		Stat.CasterCount = CasterIndices.Num();
+		Stat.DrawCount = BatchIndices.Num();
+		FShadowStatManager::GetInstance().AddCasterStat(Stat, 1, ShadowBatchElements.Num());
+	}
 
-				// 현재 IA 상태 캐싱
-				CurrentVertexBuffer = Batch.VertexBuffer;
-				CurrentIndexBuffer = Batch.IndexBuffer;
-				CurrentTopology = Batch.PrimitiveTopology;
-			}
+	// --- Spot/Point 섀도우 맵 캐시: 라이트 상태와 캐스터 집합이 그대로이고 무효화 영역과 겹치지 않은 슬롯은 다시 그리지 않음 ---
+	const EShadowCacheMode CacheMode = InShadowSystem->GetShadowCacheMode();
+	const bool bCacheEnabled = (CacheMode != EShadowCacheMode::NONE);
+	const bool bDynamicCache = (CacheMode == EShadowCacheMode::DYNAMIC);
+	if (bCacheEnabled)
+	{
+		UWorldPartitionManager* Partition = World->GetPartitionManager();
+		TArray<FShadowCasterInvalidation> Invalidations;
+		bool bInvalidateAll = true;	// 파티션이 없으면 변경을 추적할 수 없으므로 매번 전부 무효
+		if (Partition)
+		{
+			Partition->ConsumeShadowInvalidations(Invalidations, bInvalidateAll);
+		}
 
-			RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, FMatrix::Identity()));
+		if (bInvalidateAll)
+		{
+			InShadowSystem->InvalidateAllShadowCache();
+		}
+		else
+		{
+			// DYNAMIC 모드에서 움직이는 캐스터는 매 프레임 덧그리므로 그 영역으로 정적 레이어를 버리지 않음
+			InShadowSystem->InvalidateShadowCache(Invalidations, bDynamicCache);
+		}
+	}
 
-			const FShadowInfo ShadowInfo = InShadowSystem->GetShadowBufferData().ShadowInfoList[DirectionalLight->GetShadowIndex()];
-			// NOTE: 마지막 행렬을 제외한 나머지 행렬은 카메라 관련 행렬로 유지를 해야 함: 다른 패스에서 카메라 관련 행렬들을 쓰기 위함
-			RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(ViewProjBuffer.View,
-				ViewProjBuffer.Proj,
-				ViewProjBuffer.InvView,
-				ViewProjBuffer.InvProj,
-				ShadowInfo.ViewProjectionMatrix));
+	TArray<int32> StaticCasterIndices;
+	TArray<int32> DynamicCasterIndices;
+	// 슬롯을 다시 그려야 하면 true. 캐시를 쓰지 않으면 모든 캐스터를 정적 목록으로 보냄
+	auto ResolveShadowCache = [&](FShadowCacheEntry& Entry, const void* Light, uint64 StateHash, const FBoundingSphere& LightBounds) -> bool
+	{
+		if (!bCacheEnabled)
+		{
+			StaticCasterIndices = CasterIndices;
+			DynamicCasterIndices.Empty();
+			return true;
+		}
 
-			RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		bool bCacheable = true;
+		const uint64 CasterHash = SplitShadowCachedCasters(CasterIndices, bDynamicCache, StaticCasterIndices, DynamicCasterIndices, bCacheable);
+		if (Entry.bValid && Entry.Light == Light && Entry.StateHash == StateHash && Entry.CasterHash == CasterHash)
+		{
+			return false;
 		}
-	}
+
+		Entry.Light = Light;
+		Entry.StateHash = StateHash;
+		Entry.CasterHash = CasterHash;
+		Entry.Bounds = LightBounds;
+		Entry.bValid = bCacheable;
+		Entry.bCacheLayerValid = false;
+		Entry.bHasOverlay = false;
+		return true;
+	};
 
     ShadowVp.Width = InShadowSystem->GetSpotShadowTextureResolution();
     ShadowVp.Height = InShadowSystem->GetSpotShadowTextureResolution();
@@ -631,63 +1014,108 @@ void FSceneRenderer::RenderShadowMap(FShadowSystem* InShadowSystem)
 	{
 		//// ShadowViewports의 index는 FShadowBufferType.ShadowInfoList의 index와 매칭됨.
 		//const FViewportInfo& ViewportInfo = ShadowViewports[ShadowBufferIndex];
-		RHIDevice->GetDeviceContext()->OMSetRenderTargets(0, nullptr, DSVViews[Index]);
 		// Depth-only pass: Pixel Shader 없음
 		RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
 		// +1 -> DirectionalLight
         RHIDevice->SetAndUpdateConstantBuffer(FShadowBufferIndexType(SpotLights[Index]->GetShadowIndex(), (int)ELightType::SpotLight));
-		if (bUseVSM)
+
+		const FShadowInfo ShadowInfo = InShadowSystem->GetShadowBufferData().ShadowInfoList[SpotLights[Index]->GetShadowIndex()];
+
+		// NOTE: 마지막 행렬을 제외한 나머지 행렬은 카메라 관련 행렬로 유지를 해야 함: 다른 패스에서 카메라 관련 행렬들을 쓰기 위함
+		RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(ViewProjBuffer.View,
+			ViewProjBuffer.Proj,
+			ViewProjBuffer.InvView,
+			ViewProjBuffer.InvProj,
+			ShadowInfo.ViewProjectionMatrix));
+
+		// 원뿔 밖의 캐스터는 원뿔 안의 수신자를 가릴 수 없으므로 원뿔과 겹치는 캐스터만 그림
+		// BVH는 원뿔의 외접구로 조회 (반각 60도 이상이면 라이트 위치 중심 구가 더 작음)
+		const FSpotLightInfo SpotInfo = SpotLights[Index]->GetLightInfo();
+		const FVector SpotDirection = SpotInfo.Direction.GetNormalized();
+		const float HalfAngle = DegreesToRadians(SpotInfo.OuterConeAngle);
+		const float Range = SpotInfo.AttenuationRadius;
+		const float CosHalfAngle = std::cos(HalfAngle);
+		const FBoundingSphere ConeSphere = (CosHalfAngle > 0.5f)
+			? FBoundingSphere(SpotInfo.Position + SpotDirection * (Range / (2.0f * CosHalfAngle)), Range / (2.0f * CosHalfAngle))
+			: FBoundingSphere(SpotInfo.Position, Range);
+
+		const TArray<UStaticMeshComponent*> Candidates = BVH ? BVH->QueryIntersectedComponents(ConeSphere) : TArray<UStaticMeshComponent*>();
+		GatherShadowCasters(Candidates, [&](const FAABB& Bound)
 		{
-			ID3D11RenderTargetView* RTV = RTVViews[Index];
-			RHIDevice->GetDeviceContext()->OMSetRenderTargets(1, &RTV, DSVViews[Index]);
-			const float clear[4] = { 1.0f, 1.0f, 0.0f, 1.0f };
-			RHIDevice->GetDeviceContext()->ClearRenderTargetView(RTV, clear);
-			// Clear moments to m1=1, m2=1 so empty texels are lit
-			RHIDevice->OMSetBlendState(false);
-			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+			return IntersectsSpotCone(Bound, SpotInfo.Position, SpotDirection, HalfAngle, Range);
+		}, CasterIndices);
+
+		// 뎁스 맵 내용을 결정하는 상태: 라이트 행렬, near/far, 해상도, 필터 모드
+		uint64 StateHash = HashShadowCacheValue(InShadowSystem->GetSpotShadowTextureResolution(), bUseVSM ? 1 : 0);
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 4; ++Column)
+			{
+				StateHash = HashShadowCacheFloat(StateHash, ShadowInfo.ViewProjectionMatrix.M[Row][Column]);
+			}
 		}
-		else
+		StateHash = HashShadowCacheFloat(HashShadowCacheFloat(StateHash, ShadowInfo.Near), ShadowInfo.Far);
+
+		FShadowCacheEntry& CacheEntry = InShadowSystem->GetSpotShadowCacheEntry(Index);
+		bool bRenderStatic = ResolveShadowCache(CacheEntry, SpotLights[Index], StateHash, ConeSphere);
+		// 지난번에 덧그린 동적 캐스터를 지우기 위해 정적 레이어로 되돌림
+		if (!bRenderStatic && CacheEntry.bHasOverlay && !InShadowSystem->RestoreSpotShadowCacheLayer(RHIDevice, Index, bUseVSM))
 		{
-			RHIDevice->GetDeviceContext()->OMSetRenderTargets(0, nullptr, DSVViews[Index]);
-			// Depth-only pass: Pixel Shader 없음
-			RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
-			RHIDevice->OMSetBlendState(false);
-			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+			bRenderStatic = true;
 		}
-		// 메시 배치 요소 순회
-		for (const FMeshBatchElement& Batch : MeshBatchElements)
+
+		auto DrawSpotCasters = [&](const TArray<int32>& InCasters, bool bClear)
 		{
-			if (Batch.VertexBuffer != CurrentVertexBuffer ||
-				Batch.IndexBuffer != CurrentIndexBuffer ||
-				Batch.PrimitiveTopology != CurrentTopology)
+			if (bUseVSM)
 			{
-				UINT Stride = Batch.VertexStride;
-				UINT Offset = 0;
-
-				RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-				RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-
-				RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
-
-				// 현재 IA 상태 캐싱
-				CurrentVertexBuffer = Batch.VertexBuffer;
-				CurrentIndexBuffer = Batch.IndexBuffer;
-				CurrentTopology = Batch.PrimitiveTopology;
+				ID3D11RenderTargetView* RTV = RTVViews[Index];
+				RHIDevice->GetDeviceContext()->OMSetRenderTargets(1, &RTV, DSVViews[Index]);
+				if (bClear)
+				{
+					// Clear moments to m1=1, m2=1 so empty texels are lit
+					const float clear[4] = { 1.0f, 1.0f, 0.0f, 1.0f };
+					RHIDevice->GetDeviceContext()->ClearRenderTargetView(RTV, clear);
+				}
 			}
+			else
+			{
+				RHIDevice->GetDeviceContext()->OMSetRenderTargets(0, nullptr, DSVViews[Index]);
+				// Depth-only pass: Pixel Shader 없음
+				RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
+			}
+			// 캐시를 쓰지 않으면 UpdateShadowIndex에서 이미 지움
+			if (bClear && bCacheEnabled)
+			{
+				RHIDevice->GetDeviceContext()->ClearDepthStencilView(DSVViews[Index], D3D11_CLEAR_DEPTH, 1.0f, 0);
+			}
+			RHIDevice->OMSetBlendState(false);
+			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
-			RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, FMatrix::Identity()));
-		
-			const FShadowInfo ShadowInfo = InShadowSystem->GetShadowBufferData().ShadowInfoList[SpotLights[Index]->GetShadowIndex()];
-
-			// NOTE: 마지막 행렬을 제외한 나머지 행렬은 카메라 관련 행렬로 유지를 해야 함: 다른 패스에서 카메라 관련 행렬들을 쓰기 위함
-			RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(ViewProjBuffer.View,
-				ViewProjBuffer.Proj,
-				ViewProjBuffer.InvView,
-				ViewProjBuffer.InvProj,
-				ShadowInfo.ViewProjectionMatrix));
+			GatherShadowBatches(InCasters, BatchIndices);
+			DrawShadowBatches(BatchIndices);
+			return BatchIndices.Num();
+		};
 
-			RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		FShadowCasterStat Stat;
+		Stat.LightType = ELightType::SpotLight;
+		Stat.CasterCount = CasterIndices.Num();
+		Stat.bCached = !bRenderStatic;
+		if (bRenderStatic)
+		{
+			Stat.DrawCount += DrawSpotCasters(StaticCasterIndices, true);
+			if (bDynamicCache && CacheEntry.bValid)
+			{
+				// 복사 원본이 출력으로 바인딩되어 있지 않도록 해제 후 저장
+				RHIDevice->GetDeviceContext()->OMSetRenderTargets(0, nullptr, nullptr);
+				InShadowSystem->StoreSpotShadowCacheLayer(RHIDevice, Index, bUseVSM);
+			}
 		}
+		if (!DynamicCasterIndices.IsEmpty())
+		{
+			Stat.DrawCount += DrawSpotCasters(DynamicCasterIndices, false);
+		}
+		CacheEntry.bHasOverlay = !DynamicCasterIndices.IsEmpty();
+		FShadowStatManager::GetInstance().AddCasterStat(Stat, 1, ShadowBatchElements.Num());
 	}
 
     // Point Shadow Map 렌더링
@@ -697,63 +1125,104 @@ void FSceneRenderer::RenderShadowMap(FShadowSystem* InShadowSystem)
 	const TArray<TArray<ID3D11DepthStencilView*>>& PointDSVViews = InShadowSystem->GetPointShadowCubeMapDSVs();
 	const TArray<TArray<ID3D11RenderTargetView*>>& PointRTVViews = InShadowSystem->GetPointShadowVSMCubeMapRTVs();
 	const TArray<UPointLightComponent*>& PointLights = InShadowSystem->GetPointLightCandidates();
+	TArray<int32> FaceCasterIndices;
 	for (int PointShadowIndex = 0; PointShadowIndex < PointLights.Num(); PointShadowIndex++)
 	{
 		// 아래의 상수 버퍼는 똑같은 것을 쓰니까 반복문 밖으로 뺌
         RHIDevice->SetAndUpdateConstantBuffer(FShadowBufferIndexType(PointLights[PointShadowIndex]->GetShadowIndex(), (int)ELightType::PointLight));
-		for (int FaceIndex = 0; FaceIndex < 6; FaceIndex++)
-		{
-			if (bUseVSM)
-			{
-				ID3D11RenderTargetView* RTV = PointRTVViews[PointShadowIndex][FaceIndex];
-				RHIDevice->GetDeviceContext()->OMSetRenderTargets(1, &RTV, PointDSVViews[PointShadowIndex][FaceIndex]);
-				const float clear[4] = { 1.0f, 1.0f, 0.0f, 1.0f };
-				RHIDevice->GetDeviceContext()->ClearRenderTargetView(RTV, clear);
-			}
-			else
-			{
-				RHIDevice->GetDeviceContext()->OMSetRenderTargets(0, nullptr, PointDSVViews[PointShadowIndex][FaceIndex]);
-			}
-			RHIDevice->OMSetBlendState(false);
-			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
-			const FShadowInfo ShadowInfo = InShadowSystem->GetShadowBufferData().ShadowInfoList[PointLights[PointShadowIndex]->GetShadowIndex()];
+		const FShadowInfo ShadowInfo = InShadowSystem->GetShadowBufferData().ShadowInfoList[PointLights[PointShadowIndex]->GetShadowIndex()];
+		assert(ShadowInfo.Far > ShadowInfo.Near && "Point Shadow Info has invalid Near/Far planes");
 
-			assert(ShadowInfo.Far > ShadowInfo.Near && "Point Shadow Info has invalid Near/Far planes");
-			const FMatrix ViewProjMatrix = InShadowSystem->GetPointShadowViewProjectionMatrix(FaceIndex, ShadowInfo.LightPosition,
-				ShadowInfo.Near, ShadowInfo.Far);
-			// NOTE: 마지막 행렬을 제외한 나머지 행렬은 카메라 관련 행렬로 유지를 해야 함: 다른 패스에서 카메라 관련 행렬들을 쓰기 위함
-			RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(ViewProjBuffer.View,
-				ViewProjBuffer.Proj,
-				ViewProjBuffer.InvView,
-				ViewProjBuffer.InvProj,
-				ViewProjMatrix));
+		// 라이트 구와 겹치는 캐스터를 한 번 모으고, 면마다 그 면의 90도 절두체에 걸치는 캐스터만 다시 고름
+		const FBoundingSphere LightSphere(ShadowInfo.LightPosition, ShadowInfo.Far);
+		const TArray<UStaticMeshComponent*> Candidates = BVH ? BVH->QueryIntersectedComponents(LightSphere) : TArray<UStaticMeshComponent*>();
+		GatherShadowCasters(Candidates, [&LightSphere](const FAABB& Bound) { return Collision::Intersects(Bound, LightSphere); }, CasterIndices);
 
-			for (const FMeshBatchElement& Batch : MeshBatchElements)
-			{
-				if (Batch.VertexBuffer != CurrentVertexBuffer ||
-					Batch.IndexBuffer != CurrentIndexBuffer ||
-					Batch.PrimitiveTopology != CurrentTopology)
-				{
-					UINT Stride = Batch.VertexStride;
-					UINT Offset = 0;
-
-					RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-					RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+		// 큐브 면 행렬은 라이트 위치와 near/far로 정해짐
+		uint64 StateHash = HashShadowCacheValue(InShadowSystem->GetPointShadowTextureResolution(), bUseVSM ? 1 : 0);
+		StateHash = HashShadowCacheFloat(StateHash, ShadowInfo.LightPosition.X);
+		StateHash = HashShadowCacheFloat(StateHash, ShadowInfo.LightPosition.Y);
+		StateHash = HashShadowCacheFloat(StateHash, ShadowInfo.LightPosition.Z);
+		StateHash = HashShadowCacheFloat(HashShadowCacheFloat(StateHash, ShadowInfo.Near), ShadowInfo.Far);
 
-					RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
+		FShadowCacheEntry& CacheEntry = InShadowSystem->GetPointShadowCacheEntry(PointShadowIndex);
+		bool bRenderStatic = ResolveShadowCache(CacheEntry, PointLights[PointShadowIndex], StateHash, LightSphere);
+		if (!bRenderStatic && CacheEntry.bHasOverlay && !InShadowSystem->RestorePointShadowCacheLayer(RHIDevice, PointShadowIndex, bUseVSM))
+		{
+			bRenderStatic = true;
+		}
 
-					// 현재 IA 상태 캐싱
-					CurrentVertexBuffer = Batch.VertexBuffer;
-					CurrentIndexBuffer = Batch.IndexBuffer;
-					CurrentTopology = Batch.PrimitiveTopology;
+		auto DrawPointCasters = [&](const TArray<int32>& InCasters, bool bClear)
+		{
+			uint32 DrawCount = 0;
+			for (int FaceIndex = 0; FaceIndex < 6; FaceIndex++)
+			{
+				if (bUseVSM)
+				{
+					ID3D11RenderTargetView* RTV = PointRTVViews[PointShadowIndex][FaceIndex];
+					RHIDevice->GetDeviceContext()->OMSetRenderTargets(1, &RTV, PointDSVViews[PointShadowIndex][FaceIndex]);
+					if (bClear)
+					{
+						const float clear[4] = { 1.0f, 1.0f, 0.0f, 1.0f };
+						RHIDevice->GetDeviceContext()->ClearRenderTargetView(RTV, clear);
+					}
 				}
+				else
+				{
+					RHIDevice->GetDeviceContext()->OMSetRenderTargets(0, nullptr, PointDSVViews[PointShadowIndex][FaceIndex]);
+				}
+				if (bClear && bCacheEnabled)
+				{
+					RHIDevice->GetDeviceContext()->ClearDepthStencilView(PointDSVViews[PointShadowIndex][FaceIndex], D3D11_CLEAR_DEPTH, 1.0f, 0);
+				}
+				RHIDevice->OMSetBlendState(false);
+				RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+
+				const FMatrix ViewProjMatrix = InShadowSystem->GetPointShadowViewProjectionMatrix(FaceIndex, ShadowInfo.LightPosition,
+					ShadowInfo.Near, ShadowInfo.Far);
+				// NOTE: 마지막 행렬을 제외한 나머지 행렬은 카메라 관련 행렬로 유지를 해야 함: 다른 패스에서 카메라 관련 행렬들을 쓰기 위함
+				RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(ViewProjBuffer.View,
+					ViewProjBuffer.Proj,
+					ViewProjBuffer.InvView,
+					ViewProjBuffer.InvProj,
+					ViewProjMatrix));
+
+				// 바운드가 없는 캐스터는 무한 AABB로 기록되어 있어 모든 면을 통과
+				FaceCasterIndices.Empty();
+				for (int32 CasterIndex : InCasters)
+				{
+					if (IntersectsCubeFace(ShadowCasterBounds[CasterIndex], ShadowInfo.LightPosition, FaceIndex))
+					{
+						FaceCasterIndices.Add(CasterIndex);
+					}
+				}
+				GatherShadowBatches(FaceCasterIndices, BatchIndices);
+				DrawShadowBatches(BatchIndices);
+				DrawCount += BatchIndices.Num();
+			}
+			return DrawCount;
+		};
 
-				RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, FMatrix::Identity()));
-
-				RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		FShadowCasterStat Stat;
+		Stat.LightType = ELightType::PointLight;
+		Stat.CasterCount = CasterIndices.Num();
+		Stat.bCached = !bRenderStatic;
+		if (bRenderStatic)
+		{
+			Stat.DrawCount += DrawPointCasters(StaticCasterIndices, true);
+			if (bDynamicCache && CacheEntry.bValid)
+			{
+				RHIDevice->GetDeviceContext()->OMSetRenderTargets(0, nullptr, nullptr);
+				InShadowSystem->StorePointShadowCacheLayer(RHIDevice, PointShadowIndex, bUseVSM);
 			}
 		}
+		if (!DynamicCasterIndices.IsEmpty())
+		{
+			Stat.DrawCount += DrawPointCasters(DynamicCasterIndices, false);
+		}
+		CacheEntry.bHasOverlay = !DynamicCasterIndices.IsEmpty();
+		FShadowStatManager::GetInstance().AddCasterStat(Stat, 6, ShadowBatchElements.Num());
 	}
 
 	// Shadow Map DSV 해제: 다른 패스에서 SRV로 사용하기 위해
@@ -766,41 +1235,6 @@ void FSceneRenderer::RenderShadowMap(FShadowSystem* InShadowSystem)
 	RHIDevice->GetDeviceContext()->RSSetViewports(OriginNumViewports, &OriginViewport);
 }
 
-// 기존 메인 브랜치와 병합하기가 너무 복잡해져서 일단 보류, 꼭 리팩토링 해야함
-//void FSceneRenderer::RenderShadowMeshes(int Index)
-//{
-//	// --- 렌더링: depth map에 쓰기 ---
-//	ID3D11Buffer* CurrentVertexBuffer = nullptr;
-//	ID3D11Buffer* CurrentIndexBuffer = nullptr;
-//	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
-//	// 메시 배치 요소 순회
-//	for (const FMeshBatchElement& Batch : MeshBatchElements)
-//	{
-//		if (Batch.VertexBuffer != CurrentVertexBuffer ||
-//			Batch.IndexBuffer != CurrentIndexBuffer ||
-//			Batch.PrimitiveTopology != CurrentTopology)
-//		{
-//			UINT Stride = Batch.VertexStride;
-//			UINT Offset = 0;
-//
-//			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-//			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-//
-//			RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
-//
-//			// 현재 IA 상태 캐싱
-//			CurrentVertexBuffer = Batch.VertexBuffer;
-//			CurrentIndexBuffer = Batch.IndexBuffer;
-//			CurrentTopology = Batch.PrimitiveTopology;
-//		}
-//
-//		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, FMatrix::Identity()));
-//		RHIDevice->SetAndUpdateConstantBuffer(FShadowBufferIndexType(Index));
-//
-//		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
-//	}
-//}
-
 void FSceneRenderer::PerformTileLightCulling()
 {
     // ShowFlag 확인
@@ -862,22 +1296,55 @@ void FSceneRenderer::PerformTileLightCulling()
 
 void FSceneRenderer::PerformFrustumCulling()
 {
-	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
+	PotentiallyVisibleComponents.Empty();
+	PotentiallyVisibleSet.Empty();
+	bFrustumCullingValid = false;
+
+	// FSceneView::ViewFrustum은 원근 투영 기준으로만 만들어지므로 직교 뷰는 컬링하지 않음
+	if (View->ProjectionMode != ECameraProjectionMode::Perspective)
+		return;
 
-	// Todo: 프로스텀 컬링 수행, 추후 프로스텀 컬링이 컴포넌트 단위로 변경되면 적용
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	if (!Partition || !Partition->GetBVH())
+		return;
 
-	//World->GetPartitionManager()->FrustumQuery(ViewFrustum)
+	TArray<UStaticMeshComponent*> VisibleStaticMeshes;
+	Partition->FrustumQuery(View->ViewFrustum, VisibleStaticMeshes);
 
-	//for (AActor* Actor : World->GetActors())
-	//{
-	//	if (!Actor || Actor->GetActorHiddenInEditor()) continue;
+	PotentiallyVisibleComponents.Reserve(VisibleStaticMeshes.Num());
+	PotentiallyVisibleSet.reserve(VisibleStaticMeshes.Num());
+	for (UStaticMeshComponent* StaticMeshComponent : VisibleStaticMeshes)
+	{
+		PotentiallyVisibleComponents.Add(StaticMeshComponent);
+		PotentiallyVisibleSet.insert(StaticMeshComponent);
+	}
 
-	//	// 절두체 컬링을 통과한 액터만 목록에 추가
-	//	if (ViewFrustum.Intersects(Actor->GetBounds()))
-	//	{
-	//		PotentiallyVisibleActors.Add(Actor);
-	//	}
-	//}
+	bFrustumCullingValid = true;
+}
+
+bool FSceneRenderer::IsPrimitiveVisible(UPrimitiveComponent* InPrimitive) const
+{
+	if (!bFrustumCullingValid || !InPrimitive)
+		return true;
+
+	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(InPrimitive))
+	{
+		// BVH에 최신 상태로 들어있으면 쿼리 결과를 그대로 사용
+		if (World->GetPartitionManager()->IsUpToDate(StaticMeshComponent))
+		{
+			return PotentiallyVisibleSet.Contains(StaticMeshComponent);
+		}
+		// 등록 대기 중이거나 이번 프레임 budget을 넘겨 갱신이 밀린 컴포넌트는 직접 판정
+		return IsAABBVisible(View->ViewFrustum, StaticMeshComponent->GetWorldAABB());
+	}
+
+	if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(InPrimitive))
+	{
+		return IsAABBVisible(View->ViewFrustum, DecalComponent->GetWorldAABB());
+	}
+
+	// 바운드를 제공하지 않는 프리미티브는 보수적으로 보이는 것으로 처리
+	return true;
 }
 
 void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
@@ -942,11 +1409,10 @@ void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
 	}
 
 	// --- 1. 수집 (Collect) ---
+	const uint64 CollectStartCycles = FPlatformTime::Cycles64();
 	MeshBatchElements.Empty();
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
-	{
-		MeshComponent->CollectMeshBatches(MeshBatchElements, View);
-	}
+	CollectMeshBatches(Proxies.Meshes);
+	const int32 CollectedMeshBatchCount = MeshBatchElements.Num();
 
 	// --- UMeshComponent 셰이더 오버라이드 ---
 	if (bNeedsShaderOverride && ShaderVariant)
@@ -960,6 +1426,24 @@ void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
 		}
 	}
 
+	// --- 인스턴싱 (Instancing) ---
+	// 같은 VB/IB/섹션/머티리얼 배치를 하나의 DrawIndexedInstanced로 합침 (빌보드 수집 전이라 메시 배치만 대상)
+	if (bNeedsShaderOverride && ShaderVariant && World->GetRenderSettings().IsMeshInstancingEnabled())
+	{
+		TArray<FShaderMacro> InstancedMacros = ShaderMacros;
+		InstancedMacros.push_back(FShaderMacro{ "USE_INSTANCING", "1" });
+		FShaderVariant* InstancedVariant = ViewModeShader->GetOrCompileShaderVariant(RHIDevice->GetDevice(), InstancedMacros);
+
+		FMeshBatchInstancer* Instancer = OwnerRenderer->GetMeshBatchInstancer();
+		if (Instancer && InstancedVariant)
+		{
+			const uint32 MergedCount = Instancer->MergeInstancedBatches(MeshBatchElements, InstancedVariant, World->GetRenderSettings().GetMinInstanceCount());
+			Instancer->UploadInstanceData();
+			FCullingStatManager::GetInstance().AddInstancingResult(Instancer->GetInstanceCount(), MergedCount);
+		}
+	}
+	const int32 MeshBatchCount = MeshBatchElements.Num();
+
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
 	{
 		BillboardComponent->CollectMeshBatches(MeshBatchElements, View);
@@ -971,11 +1455,26 @@ void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
 		//TextRenderComponent->CollectMeshBatches(MeshBatchElements, View);
 	}
 
+	// 인스턴싱 전 기준 (합쳐진 배치도 포함)
+	FCullingStatManager::GetInstance().AddOpaqueBatchCount(CollectedMeshBatchCount + (MeshBatchElements.Num() - MeshBatchCount));
+
 	// --- 2. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
+	// 원소(100바이트 이상)를 옮기지 않고 64비트 키로 인덱스만 기수 정렬
+	const uint64 SortStartCycles = FPlatformTime::Cycles64();
+	FMeshBatchSorter& Sorter = FMeshBatchSorter::GetInstance();
+	const EMeshSortMode OpaqueSortMode = World->GetRenderSettings().GetOpaqueSortMode();
+	Sorter.BuildSortKeys(MeshBatchElements, 0, MeshBatchCount, EMeshBatchPass::Opaque, OpaqueSortMode, View);
+	Sorter.BuildSortKeys(MeshBatchElements, MeshBatchCount, MeshBatchElements.Num(), EMeshBatchPass::Masked, OpaqueSortMode, View);
+	Sorter.SortMeshBatches(MeshBatchElements, MeshBatchDrawOrder);
 
 	// --- 3. 그리기 (Draw) ---
-	DrawMeshBatches(MeshBatchElements, true);
+	const uint64 DrawStartCycles = FPlatformTime::Cycles64();
+	DrawMeshBatches(MeshBatchElements, true, &MeshBatchDrawOrder);
+
+	FRenderPassStatManager& PassStats = FRenderPassStatManager::GetInstance();
+	PassStats.AddPassCycles(ERenderPassStat::OpaqueCollect, SortStartCycles - CollectStartCycles);
+	PassStats.AddPassCycles(ERenderPassStat::OpaqueSort, DrawStartCycles - SortStartCycles);
+	PassStats.AddPassCycles(ERenderPassStat::OpaqueDraw, FPlatformTime::Cycles64() - DrawStartCycles);
 }
 
 void FSceneRenderer::RenderDecalPass()
@@ -1041,8 +1540,35 @@ void FSceneRenderer::RenderDecalPass()
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly); // 깊이 쓰기 OFF
 	RHIDevice->OMSetBlendState(true);
 
-	for (UDecalComponent* Decal : Proxies.Decals)
+	// 블렌딩되는 데칼끼리는 그리는 순서가 결과를 바꾸므로 Translucent 정렬 모드를 데칼 단위로 적용
+	FMeshBatchSorter& Sorter = FMeshBatchSorter::GetInstance();
+	const EMeshSortMode TranslucentSortMode = World->GetRenderSettings().GetTranslucentSortMode();
+	TArray<int32> DecalOrder;
+	if (TranslucentSortMode == EMeshSortMode::STATE)
+	{
+		// 상태로 묶을 것이 없으므로 수집 순서 유지
+		DecalOrder.SetNum(Proxies.Decals.Num());
+		for (int32 Index = 0; Index < Proxies.Decals.Num(); ++Index)
+		{
+			DecalOrder[Index] = Index;
+		}
+	}
+	else
+	{
+		TArray<uint64> DecalKeys;
+		DecalKeys.SetNum(Proxies.Decals.Num());
+		for (int32 Index = 0; Index < Proxies.Decals.Num(); ++Index)
+		{
+			UDecalComponent* Decal = Proxies.Decals[Index];
+			const float Depth01 = Decal ? FMeshBatchSorter::ComputeViewDepth01(View, Decal->GetWorldLocation()) : 0.0f;
+			DecalKeys[Index] = FMeshBatchSorter::MakeSortKey(EMeshBatchPass::Translucent, TranslucentSortMode, 0, 0, 0, Depth01);
+		}
+		FMeshBatchSorter::RadixSortIndices(DecalKeys, DecalOrder);
+	}
+
+	for (int32 DecalIndex : DecalOrder)
 	{
+		UDecalComponent* Decal = Proxies.Decals[DecalIndex];
 		if (!Decal || !Decal->GetDecalTexture())
 		{
 			continue;
@@ -1094,7 +1620,10 @@ void FSceneRenderer::RenderDecalPass()
 			BatchElement.PixelShader = ShaderVariant->PixelShader;
 			BatchElement.VertexStride = sizeof(FVertexDynamic);
 		}
-		DrawMeshBatches(MeshBatchElements, true);
+		// 한 데칼 안에서는 셰이더/머티리얼이 같으므로 메시 단위로 묶임
+		Sorter.BuildSortKeys(MeshBatchElements, 0, MeshBatchElements.Num(), EMeshBatchPass::Translucent, EMeshSortMode::STATE, View);
+		Sorter.SortMeshBatches(MeshBatchElements, MeshBatchDrawOrder);
+		DrawMeshBatches(MeshBatchElements, true, &MeshBatchDrawOrder);
 
 		// --- 데칼 렌더 시간 측정 종료 및 결과 저장 ---
 		auto CpuTimeEnd = std::chrono::high_resolution_clock::now();
@@ -1463,10 +1992,76 @@ void FSceneRenderer::RenderOverayEditorPrimitivesPass()
 }
 
 // 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+void FSceneRenderer::CollectMeshBatches(const TArray<UMeshComponent*>& InMeshComponents, TArray<int32>* OutComponentBatchStarts)
+{
+	// 컴포넌트 묶음 하나를 한 작업 단위로 처리. 너무 잘게 나누면 배열 병합 비용이 커짐
+	constexpr int32 ComponentsPerChunk = 64;
+
+	const int32 ComponentCount = static_cast<int32>(InMeshComponents.Num());
+	if (OutComponentBatchStarts)
+	{
+		OutComponentBatchStarts->SetNum(ComponentCount);
+	}
+
+	if (ComponentCount <= ComponentsPerChunk || FJobSystem::GetInstance().GetWorkerCount() == 0)
+	{
+		for (int32 i = 0; i < ComponentCount; ++i)
+		{
+			if (OutComponentBatchStarts)
+			{
+				(*OutComponentBatchStarts)[i] = MeshBatchElements.Num();
+			}
+			InMeshComponents[i]->CollectMeshBatches(MeshBatchElements, View);
+		}
+		return;
+	}
+
+	// 월드 행렬 캐시는 지연 계산(mutable)이라 부모를 공유하는 컴포넌트가 워커에서 동시에 채우지 않도록 미리 확정
+	for (UMeshComponent* MeshComponent : InMeshComponents)
+	{
+		MeshComponent->GetWorldMatrix();
+	}
+
+	const int32 ChunkCount = (ComponentCount + ComponentsPerChunk - 1) / ComponentsPerChunk;
+	TArray<TArray<FMeshBatchElement>> ChunkBatches(ChunkCount);
+	ParallelFor(ChunkCount, [&](int32 ChunkIndex)
+	{
+		const int32 Begin = ChunkIndex * ComponentsPerChunk;
+		const int32 End = std::min(ComponentCount, Begin + ComponentsPerChunk);
+		for (int32 i = Begin; i < End; ++i)
+		{
+			// 청크 내부 오프셋을 먼저 기록하고 병합할 때 청크 시작 위치만큼 밀어줌 (청크마다 쓰는 칸이 달라 경합 없음)
+			if (OutComponentBatchStarts)
+			{
+				(*OutComponentBatchStarts)[i] = ChunkBatches[ChunkIndex].Num();
+			}
+			InMeshComponents[i]->CollectMeshBatches(ChunkBatches[ChunkIndex], View);
+		}
+	}, 1);
+
+	// 정렬 전이라도 수집 순서는 직렬 수집과 같게 유지 (정렬 키가 같은 배치의 그리기 순서 보존)
+	for (int32 ChunkIndex = 0; ChunkIndex < ChunkCount; ++ChunkIndex)
+	{
+		if (OutComponentBatchStarts)
+		{
+			const int32 ChunkBase = MeshBatchElements.Num();
+			const int32 Begin = ChunkIndex * ComponentsPerChunk;
+			const int32 End = std::min(ComponentCount, Begin + ComponentsPerChunk);
+			for (int32 i = Begin; i < End; ++i)
+			{
+				(*OutComponentBatchStarts)[i] += ChunkBase;
+			}
+		}
+		MeshBatchElements.Append(ChunkBatches[ChunkIndex]);
+	}
+}
+
+void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, const TArray<int32>* InDrawOrder)
 {
 	if (InMeshBatches.IsEmpty()) return;
 
+	FRHICommandStats& CommandStats = RHIDevice->GetCommandStats();
+
 	// --- 초기 상태 ---
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
@@ -1522,8 +2117,18 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 
 	ID3D11SamplerState* GlobalShadowSampler = OwnerRenderer->GetShadowSystem()->GetShadowSampler();
 
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	// 인스턴스 버퍼 (VS t9): 인스턴싱 배치를 처음 만날 때 한 번만 바인딩
+	ID3D11ShaderResourceView* InstanceBufferSRV = nullptr;
+	if (FMeshBatchInstancer* Instancer = OwnerRenderer->GetMeshBatchInstancer())
 	{
+		InstanceBufferSRV = Instancer->GetInstanceBufferSRV();
+	}
+	bool bInstanceBufferBound = false;
+
+	const int32 DrawCount = InDrawOrder ? InDrawOrder->Num() : InMeshBatches.Num();
+	for (int32 DrawIndex = 0; DrawIndex < DrawCount; ++DrawIndex)
+	{
+		const FMeshBatchElement& Batch = InMeshBatches[InDrawOrder ? (*InDrawOrder)[DrawIndex] : DrawIndex];
 		if (!Batch.VertexShader || !Batch.PixelShader || !Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0)
 		{
 			UE_LOG("DrawMeshBatches: Missing shader or buffer in Batch.");
@@ -1538,6 +2143,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			RHIDevice->GetDeviceContext()->PSSetShader(Batch.PixelShader, nullptr, 0);
 			CurrentVS = Batch.VertexShader;
 			CurrentPS = Batch.PixelShader;
+			++CommandStats.ShaderChanges;
 		}
 
 		// ---  픽셀 스테이지 리소스 ---
@@ -1584,6 +2190,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		if (DiffuseSRV && DiffuseSRV != CurrentDiffuseSRV)
 		{
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &DiffuseSRV);
+			++CommandStats.ShaderResourceBinds;
 			CurrentDiffuseSRV = DiffuseSRV;
 		}
 		else if (!DiffuseSRV && CurrentDiffuseSRV)
@@ -1591,30 +2198,35 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			// 명시적으로 비워야 하는 경우
 			ID3D11ShaderResourceView* nullSRV = nullptr;
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &nullSRV);
+			++CommandStats.ShaderResourceBinds;
 			CurrentDiffuseSRV = nullptr;
 		}
 
 		if (NormalSRV && NormalSRV != CurrentNormalSRV)
 		{
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(1, 1, &NormalSRV);
+			++CommandStats.ShaderResourceBinds;
 			CurrentNormalSRV = NormalSRV;
 		}
 		else if (!NormalSRV && CurrentNormalSRV)
 		{
 			ID3D11ShaderResourceView* nullSRV = nullptr;
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(1, 1, &nullSRV);
+			++CommandStats.ShaderResourceBinds;
 			CurrentNormalSRV = nullptr;
 		}
 
 		if (GlobalShadowSRV && GlobalShadowSRV != CurrentShadowSRV)
 		{
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(2, 1, &GlobalShadowSRV);
+			++CommandStats.ShaderResourceBinds;
 			CurrentShadowSRV = GlobalShadowSRV;
 		}
 
 		if(GlobalPointShadowSRV && GlobalPointShadowSRV != CurrentPointShadowSRV)
 		{
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(6, 1, &GlobalPointShadowSRV);
+			++CommandStats.ShaderResourceBinds;
 			CurrentPointShadowSRV = GlobalPointShadowSRV;
 		}
 
@@ -1626,6 +2238,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			if (CSMSRV)
 			{
 				RHIDevice->GetDeviceContext()->PSSetShaderResources(5, 1, &CSMSRV);	
+				++CommandStats.ShaderResourceBinds;
 			}	
 		}
 		else 
@@ -1634,6 +2247,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			if (GlobalDirectionalShadowMapSRV && GlobalDirectionalShadowMapSRV != CurrentDirectionalShadowMapSRV)
 			{
 				RHIDevice->GetDeviceContext()->PSSetShaderResources(7, 1, &GlobalDirectionalShadowMapSRV);
+				++CommandStats.ShaderResourceBinds;
 				CurrentDirectionalShadowMapSRV = GlobalDirectionalShadowMapSRV;
 			}
 		}
@@ -1643,26 +2257,31 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		if (DefaultSampler && DefaultSampler != CurrentSampler0)
 		{
 			RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, &DefaultSampler);
+			++CommandStats.SamplerBinds;
 			CurrentSampler0 = DefaultSampler;
 		}
 		if (DefaultSampler && DefaultSampler != CurrentSampler1)
 		{
 			RHIDevice->GetDeviceContext()->PSSetSamplers(1, 1, &DefaultSampler);
+			++CommandStats.SamplerBinds;
 			CurrentSampler1 = DefaultSampler;
 		}
 		// s3: VSM moments sampler
 		if (World->GetRenderSettings().GetShadowFilterMode() == EShadowFilterMode::VSM)
 		{
 			RHIDevice->GetDeviceContext()->PSSetSamplers(3, 1, &LinearClampSampler);
+			++CommandStats.SamplerBinds;
 		}
 		if (DefaultSampler && DefaultSampler != CurrentSampler1)
 		{
 			RHIDevice->GetDeviceContext()->PSSetSamplers(1, 1, &DefaultSampler);
+			++CommandStats.SamplerBinds;
 			CurrentSampler1 = DefaultSampler;
 		}
 		if (GlobalShadowSampler && GlobalShadowSampler != CurrentShadowSampler)
 		{
 			RHIDevice->GetDeviceContext()->PSSetSamplers(2, 1, &GlobalShadowSampler);
+			++CommandStats.SamplerBinds;
 			CurrentShadowSampler = GlobalShadowSampler;
 		}
 
@@ -1690,6 +2309,30 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			CurrentIB = Batch.IndexBuffer;
 			CurrentStride = Batch.VertexStride;
 			CurrentTopology = Batch.PrimitiveTopology;
+			++CommandStats.InputAssemblerChanges;
+		}
+
+		// --- 4️⃣ 인스턴싱 배치: 월드 행렬/UUID는 인스턴스 버퍼, b0에는 시작 위치만 ---
+		if (Batch.InstanceCount > 1)
+		{
+			if (!InstanceBufferSRV)
+			{
+				UE_LOG("DrawMeshBatches: Instanced batch without instance buffer.");
+				continue;
+			}
+			if (!bInstanceBufferBound)
+			{
+				RHIDevice->GetDeviceContext()->VSSetShaderResources(9, 1, &InstanceBufferSRV);
+				++CommandStats.ShaderResourceBinds;
+				bInstanceBufferBound = true;
+			}
+			RHIDevice->SetAndUpdateConstantBuffer(FInstanceBufferType{ Batch.FirstInstance });
+			RHIDevice->SetAndUpdateConstantBuffer(FColorBufferType(Batch.InstanceColor, Batch.ObjectID));
+
+			RHIDevice->GetDeviceContext()->DrawIndexedInstanced(Batch.IndexCount, Batch.InstanceCount, Batch.StartIndex, Batch.BaseVertexIndex, 0);
+			++CommandStats.DrawCalls;
+			CommandStats.Primitives += (Batch.IndexCount / 3) * Batch.InstanceCount;
+			continue;
 		}
 
 		// --- 4️⃣ 오브젝트별 CBuffer ---
@@ -1698,6 +2341,14 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 
 		// --- 5️⃣ Draw Call ---
 		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		++CommandStats.DrawCalls;
+		CommandStats.Primitives += Batch.IndexCount / 3;
+	}
+
+	if (bInstanceBufferBound)
+	{
+		ID3D11ShaderResourceView* NullInstanceSRV = nullptr;
+		RHIDevice->GetDeviceContext()->VSSetShaderResources(9, 1, &NullInstanceSRV);
 	}
 
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 3, nullSRVs);
@@ -23,6 +23,7 @@ class FSceneView;
 class FTileLightCuller;
 class ULineComponent;
 class FShadowSystem;
+class UStaticMeshComponent;
 
 struct FCandidateDrawable;
 
@@ -49,6 +50,9 @@ struct FVisibleRenderProxySet
 	TArray<UDecalComponent*> Decals;
 	TArray<UTextRenderComponent*> Texts;
 
+	// 섀도우 패스용: 뷰 프러스텀 컬링 이전의 메시 목록 (화면 밖 캐스터 포함)
+	TArray<UMeshComponent*> ShadowCasterMeshes;
+
 	// --- Type 2: In-Scene Editor (PP X, Depth-Test O) ---
 	TArray<ULineComponent*> EditorLines;	// 그리드
 	TArray<UPrimitiveComponent*> EditorPrimitives; // 빛 기즈모, *에디터 아이콘 빌보드*
@@ -90,9 +94,12 @@ private:
 	/** @brief 렌더링에 필요한 뷰 행렬, 절두체 등 프레임 데이터를 준비합니다. */
 	void PrepareView();
 
-	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
+	/** @brief 파티션 BVH를 이용해 컴포넌트 단위 절두체 컬링을 수행합니다. */
 	void PerformFrustumCulling();
 
+	/** @brief 컬링 결과를 기준으로 프리미티브가 보이는지 판정합니다. (BVH 미반영 컴포넌트는 직접 판정) */
+	bool IsPrimitiveVisible(UPrimitiveComponent* InPrimitive) const;
+
 
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
 	void GatherVisibleProxies();
@@ -100,7 +107,30 @@ private:
 	void RenderDirectionalCSMShadowMap(FCSM* CSMSystem);
 	void RenderShadowMap(FShadowSystem* InShadowSystem);
 
-	void RenderShadowMeshes(int Index);
+	/** @brief 섀도우 캐스터의 배치를 뷰당 한 번 수집/정렬하고 캐스터별 바운드와 배치 범위를 만듭니다. */
+	void PrepareShadowCasters();
+
+	/**
+	 * @brief 라이트 볼륨과 겹치는 캐스터 인덱스를 모읍니다.
+	 * @param InBVHCandidates 라이트 볼륨으로 BVH를 조회한 결과 (BVH가 최신인 스태틱 메시만 사용)
+	 * @param InOverlaps 캐스터 AABB가 라이트 볼륨과 겹치는지 정밀 판정 (BVH 결과와 BVH 미반영 캐스터 모두에 적용)
+	 */
+	void GatherShadowCasters(const TArray<UStaticMeshComponent*>& InBVHCandidates,
+		const std::function<bool(const FAABB&)>& InOverlaps, TArray<int32>& OutCasterIndices) const;
+
+	/** @brief 캐스터 인덱스 목록을 정렬된 ShadowBatchElements의 인덱스 목록(그리기 순서)으로 바꿉니다. */
+	void GatherShadowBatches(const TArray<int32>& InCasterIndices, TArray<int32>& OutBatchIndices) const;
+
+	/** @brief 현재 바인딩된 섀도우 타깃에 지정한 배치만 그립니다. (패스 공통 상수는 호출 전에 설정) */
+	void DrawShadowBatches(const TArray<int32>& InBatchIndices);
+
+	/**
+	 * @brief 섀도우 캐시용으로 캐스터를 정적/동적으로 나누고, 정적 캐스터 집합의 해시(순서 무관)를 반환합니다.
+	 * @param bSplitDynamic false면 모두 정적 목록으로 들어감 (STATIC 모드)
+	 * @param bOutCacheable 파티션이 이동을 추적하지 않는 캐스터가 정적 목록에 있으면 false (무효화 영역을 알 수 없음)
+	 */
+	uint64 SplitShadowCachedCasters(const TArray<int32>& InCasterIndices, bool bSplitDynamic,
+		TArray<int32>& OutStaticCasters, TArray<int32>& OutDynamicCasters, bool& bOutCacheable) const;
 
 	/** @brief 타일 기반 라이트 컬링을 수행하고 Structured Buffer를 업데이트합니다. */
 	void PerformTileLightCulling();
@@ -108,7 +138,17 @@ private:
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewModeIndex InRenderViewMode);
 
-	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	/**
+	 * @brief 배치를 상태 캐싱하며 그립니다.
+	 * @param InDrawOrder 지정하면 이 인덱스 순서대로 그림 (FMeshBatchSorter 결과), 없으면 배열 순서
+	 */
+	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, const TArray<int32>* InDrawOrder = nullptr);
+
+	/**
+	 * @brief 메시 컴포넌트들의 배치를 잡 시스템으로 나눠 수집해 MeshBatchElements 뒤에 컴포넌트 순서대로 붙입니다.
+	 * @param OutComponentBatchStarts 지정하면 컴포넌트별 첫 배치의 MeshBatchElements 인덱스를 컴포넌트 순서대로 채움
+	 */
+	void CollectMeshBatches(const TArray<UMeshComponent*>& InMeshComponents, TArray<int32>* OutComponentBatchStarts = nullptr);
 
 	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. */
 	void RenderDecalPass();
@@ -148,11 +188,26 @@ private:
 	// 씬 전역 설정
 	FSceneGlobals SceneGlobals;
 
-	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
+	// 컬링을 거친 가시성 목록 (컴포넌트 단위), 조회용 Set을 함께 유지
 	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
+	TSet<UPrimitiveComponent*> PotentiallyVisibleSet;
+
+	// 이번 뷰에서 BVH 컬링 결과가 유효한지 (직교 투영, 파티션 없음 등은 컬링 생략)
+	bool bFrustumCullingValid = false;
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
+	TArray<int32> MeshBatchDrawOrder;	// MeshBatchElements를 SortKey로 기수 정렬한 인덱스
+
+	// --- 섀도우 캐스터 (뷰당 한 번 준비해서 모든 섀도우 패스가 공유) ---
+	bool bShadowCastersPrepared = false;
+	TArray<FMeshBatchElement> ShadowBatchElements;	// 정렬 완료된 캐스터 배치
+	TArray<int32> ShadowBatchOrder;					// 수집 순서 인덱스 -> ShadowBatchElements 인덱스
+	TArray<int32> ShadowCasterBatchStarts;			// 캐스터 i의 배치는 수집 순서로 [Starts[i], Starts[i + 1])
+	TArray<FAABB> ShadowCasterBounds;				// 캐스터 월드 AABB (ShadowCasterMeshes와 같은 순서, 바운드 없는 메시는 무한 AABB)
+	TMap<UStaticMeshComponent*, int32> ShadowCasterIndexMap;	// BVH에 최신 상태로 들어있는 캐스터 -> 캐스터 인덱스
+	TArray<int32> UnindexedShadowCasters;			// BVH 갱신이 밀린 스태틱 메시: 바운드로 직접 판정
+	TArray<int32> UnboundedShadowCasters;			// 바운드를 제공하지 않는 메시: 모든 패스에 포함
 
     // 타일 기반 라이트 컬링 시스템: URenderer가 소유하고 프레임 간 재사용
 
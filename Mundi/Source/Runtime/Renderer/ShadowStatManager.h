@@ -0,0 +1,99 @@
+﻿#pragma once
+
+#include <cstdint>
+#include "LightManager.h"
+
+/**
+ * @brief 섀도우 패스 하나(라이트, CSM 캐스케이드)의 캐스터 컬링 결과입니다.
+ */
+struct FShadowCasterStat
+{
+	ELightType LightType = ELightType::DirectionalLight;
+	int32 SubIndex = -1;			// CSM 캐스케이드 인덱스 (그 외 -1)
+	uint32_t CasterCount = 0;		// 라이트 볼륨과 겹친 캐스터 수
+	uint32_t DrawCount = 0;			// 실제로 그린 배치 수 (포인트 라이트는 6면 합계)
+	bool bCached = false;			// 섀도우 캐시를 재사용해 정적 캐스터를 다시 그리지 않음 (DrawCount는 동적 캐스터만)
+};
+
+/**
+ * @class FShadowStatManager
+ * @brief 라이트별 섀도우 캐스터 컬링 결과를 수집하고 제공하는 싱글톤 클래스입니다.
+ * 뷰포트가 여러 개면 한 프레임 동안 모든 뷰의 결과가 누적됩니다.
+ */
+class FShadowStatManager
+{
+public:
+	/**
+	 * @brief FShadowStatManager의 싱글톤 인스턴스를 반환합니다.
+	 */
+	static FShadowStatManager& GetInstance()
+	{
+		static FShadowStatManager Instance;
+		return Instance;
+	}
+
+	/**
+	 * @brief 매 프레임 렌더링 시작 시 호출하여 프레임 단위 통계 데이터를 초기화합니다.
+	 */
+	void ResetFrameStats()
+	{
+		CasterStats.Empty();
+		CandidateCasterCount = 0;
+		CandidateBatchCount = 0;
+		TotalDrawCount = 0;
+		UnculledDrawCount = 0;
+	}
+
+	// --- Getters ---
+
+	/** @return 섀도우 패스별 캐스터 통계 */
+	const TArray<FShadowCasterStat>& GetCasterStats() const { return CasterStats; }
+
+	/** @return 컬링 전 섀도우 캐스터 후보 수 (뷰 프러스텀 컬링 이전 메시) */
+	uint32_t GetCandidateCasterCount() const { return CandidateCasterCount; }
+
+	/** @return 후보 캐스터에서 한 번 수집한 메시 배치 수 */
+	uint32_t GetCandidateBatchCount() const { return CandidateBatchCount; }
+
+	/** @return 모든 섀도우 패스에서 실제로 그린 배치 수 */
+	uint32_t GetTotalDrawCount() const { return TotalDrawCount; }
+
+	/** @return 캐스터 컬링 없이 모든 패스가 모든 배치를 그렸을 때의 배치 수 */
+	uint32_t GetUnculledDrawCount() const { return UnculledDrawCount; }
+
+	// --- Setters / Incrementers ---
+
+	/** @brief 이번 뷰의 섀도우 캐스터 후보를 기록합니다. */
+	void AddCandidates(uint32_t InCasterCount, uint32_t InBatchCount)
+	{
+		CandidateCasterCount += InCasterCount;
+		CandidateBatchCount += InBatchCount;
+	}
+
+	/**
+	 * @brief 섀도우 패스 하나의 결과를 기록합니다.
+	 * @param InPassCount 이 라이트가 그린 패스 수 (포인트 라이트는 6, 그 외 1)
+	 */
+	void AddCasterStat(const FShadowCasterStat& InStat, uint32_t InPassCount, uint32_t InViewBatchCount)
+	{
+		CasterStats.Add(InStat);
+		TotalDrawCount += InStat.DrawCount;
+		UnculledDrawCount += InViewBatchCount * InPassCount;
+	}
+
+private:
+	FShadowStatManager() = default;
+	~FShadowStatManager() = default;
+
+	// 싱글톤 패턴을 위해 복사 및 대입을 금지합니다.
+	FShadowStatManager(const FShadowStatManager&) = delete;
+	FShadowStatManager& operator=(const FShadowStatManager&) = delete;
+
+private:
+	// 매 프레임 초기화되는 데이터
+	TArray<FShadowCasterStat> CasterStats;
+	uint32_t CandidateCasterCount = 0;
+	uint32_t CandidateBatchCount = 0;
+	uint32_t TotalDrawCount = 0;
+	uint32_t UnculledDrawCount = 0;
+};
@@ -10,6 +10,8 @@
 #include "Frustum.h"
 #include "StaticMeshComponent.h"
 #include "SelectionManager.h"
+#include "WorldPartitionManager.h"
+#include "Collision.h"
 
 #define MIN(a,b) a > b ? b : a
 #define MAX(a,b) a > b ? a : b
@@ -84,6 +86,8 @@ FShadowSystem::~FShadowSystem()
         if (Entry.PointShadowDebugSnapshotTexture) { Entry.PointShadowDebugSnapshotTexture->Release(); Entry.PointShadowDebugSnapshotTexture = nullptr; }
     }
 
+    ReleaseShadowCacheLayers();
+
     // Directional resources
     if (DirectionalShadowMap) { DirectionalShadowMap->Release(); DirectionalShadowMap = nullptr; }
     if (DirectionalShadowMapSRV) { DirectionalShadowMapSRV->Release(); DirectionalShadowMapSRV = nullptr; }
@@ -121,16 +125,10 @@ void FShadowSystem::UpdateShadowIndex(UDirectionalLightComponent* DirectionalLig
 	{
 		RHIDevice->GetDeviceContext()->ClearDepthStencilView(DirectionalShadowMapDSV, D3D11_CLEAR_DEPTH, 1.0f, 0);
 	}
-    for (int Index = 0; Index < SpotShadowMapDSVs.Num(); Index++)
-    {
-        RHIDevice->GetDeviceContext()->ClearDepthStencilView(SpotShadowMapDSVs[Index], D3D11_CLEAR_DEPTH, 1.0f, 0);
-    }
-	for (int Index = 0; Index < PointShadowCubeMapDSVs.Num(); Index++)
+	// 캐시 모드에서는 이전 프레임 결과를 재사용하므로 지우지 않음 (RenderShadowMap이 다시 그리는 슬롯만 지움)
+	if (ShadowCacheMode == EShadowCacheMode::NONE)
 	{
-		for(int FaceIndex = 0; FaceIndex < PointShadowCubeMapDSVs[Index].Num(); FaceIndex++)
-		{
-			RHIDevice->GetDeviceContext()->ClearDepthStencilView(PointShadowCubeMapDSVs[Index][FaceIndex], D3D11_CLEAR_DEPTH, 1.0f, 0);
-		}
+		ClearLocalLightShadowMaps(RHIDevice, false);
 	}
     SelectLightCandidates(PointLightList, SpotLightList, View);
 
@@ -1483,3 +1481,242 @@ void FShadowSystem::SetPointShadowTextureResolution(D3D11RHI* InDevice, uint32 N
     PointShadowTextureResolution = NewResolution;
     AdoptPointResources(It->second);
 }
+
+void FShadowSystem::ClearLocalLightShadowMaps(D3D11RHI* RHIDevice, bool bClearMoments)
+{
+	ID3D11DeviceContext* Context = RHIDevice->GetDeviceContext();
+	for (int Index = 0; Index < SpotShadowMapDSVs.Num(); Index++)
+	{
+		Context->ClearDepthStencilView(SpotShadowMapDSVs[Index], D3D11_CLEAR_DEPTH, 1.0f, 0);
+	}
+	for (int Index = 0; Index < PointShadowCubeMapDSVs.Num(); Index++)
+	{
+		for (int FaceIndex = 0; FaceIndex < PointShadowCubeMapDSVs[Index].Num(); FaceIndex++)
+		{
+			Context->ClearDepthStencilView(PointShadowCubeMapDSVs[Index][FaceIndex], D3D11_CLEAR_DEPTH, 1.0f, 0);
+		}
+	}
+
+	if (!bClearMoments)
+	{
+		return;
+	}
+
+	// 빈 텍셀이 밝게 보이도록 m1=1, m2=1 (RenderShadowMap의 VSM 클리어 값과 같음)
+	const float ClearMoments[4] = { 1.0f, 1.0f, 0.0f, 1.0f };
+	for (int Index = 0; Index < SpotShadowVSMRTVs.Num(); Index++)
+	{
+		Context->ClearRenderTargetView(SpotShadowVSMRTVs[Index], ClearMoments);
+	}
+	for (int Index = 0; Index < PointShadowVSMCubeMapRTVs.Num(); Index++)
+	{
+		for (int FaceIndex = 0; FaceIndex < PointShadowVSMCubeMapRTVs[Index].Num(); FaceIndex++)
+		{
+			Context->ClearRenderTargetView(PointShadowVSMCubeMapRTVs[Index][FaceIndex], ClearMoments);
+		}
+	}
+}
+
+void FShadowSystem::SetShadowCacheMode(EShadowCacheMode InMode)
+{
+	if (ShadowCacheMode == InMode)
+		return;
+
+	ShadowCacheMode = InMode;
+	InvalidateAllShadowCache();
+
+	// 캐시 레이어는 DYNAMIC 모드에서만 사용
+	if (ShadowCacheMode != EShadowCacheMode::DYNAMIC)
+	{
+		ReleaseShadowCacheLayers();
+	}
+}
+
+void FShadowSystem::InvalidateAllShadowCache()
+{
+	for (FShadowCacheEntry& Entry : SpotShadowCache)
+	{
+		Entry = FShadowCacheEntry();
+	}
+	for (FShadowCacheEntry& Entry : PointShadowCache)
+	{
+		Entry = FShadowCacheEntry();
+	}
+}
+
+void FShadowSystem::InvalidateShadowCache(const TArray<FShadowCasterInvalidation>& InInvalidations, bool bIgnoreMovingCasters)
+{
+	if (InInvalidations.IsEmpty())
+		return;
+
+	auto InvalidateOverlapping = [&](FShadowCacheEntry& Entry)
+	{
+		if (!Entry.bValid)
+			return;
+
+		for (const FShadowCasterInvalidation& Invalidation : InInvalidations)
+		{
+			if (bIgnoreMovingCasters && !Invalidation.bStaticCaster)
+				continue;
+
+			if (Collision::Intersects(Invalidation.Bound, Entry.Bounds))
+			{
+				Entry.bValid = false;
+				Entry.bCacheLayerValid = false;
+				return;
+			}
+		}
+	};
+
+	for (FShadowCacheEntry& Entry : SpotShadowCache)
+	{
+		InvalidateOverlapping(Entry);
+	}
+	for (FShadowCacheEntry& Entry : PointShadowCache)
+	{
+		InvalidateOverlapping(Entry);
+	}
+}
+
+bool FShadowSystem::IsSameTextureSize(ID3D11Texture2D* A, ID3D11Texture2D* B)
+{
+	D3D11_TEXTURE2D_DESC DescA{};
+	D3D11_TEXTURE2D_DESC DescB{};
+	A->GetDesc(&DescA);
+	B->GetDesc(&DescB);
+	return DescA.Width == DescB.Width && DescA.Height == DescB.Height && DescA.ArraySize == DescB.ArraySize && DescA.Format == DescB.Format;
+}
+
+bool FShadowSystem::EnsureShadowCacheLayer(D3D11RHI* RHIDevice, ID3D11Texture2D* InLiveTexture, ID3D11Texture2D*& InOutCacheTexture)
+{
+	if (InOutCacheTexture)
+	{
+		if (IsSameTextureSize(InLiveTexture, InOutCacheTexture))
+		{
+			return false;
+		}
+		InOutCacheTexture->Release();
+		InOutCacheTexture = nullptr;
+	}
+
+	// 복사 전용이라 바인딩 없이 같은 typeless 포맷으로 생성 (뎁스 리소스는 서브리소스 전체 복사만 허용)
+	D3D11_TEXTURE2D_DESC Desc{};
+	InLiveTexture->GetDesc(&Desc);
+	Desc.BindFlags = 0;
+	Desc.MiscFlags = 0;
+	RHIDevice->GetDevice()->CreateTexture2D(&Desc, nullptr, &InOutCacheTexture);
+	return true;
+}
+
+void FShadowSystem::ReleaseShadowCacheLayers()
+{
+	if (SpotShadowCacheLayer) { SpotShadowCacheLayer->Release(); SpotShadowCacheLayer = nullptr; }
+	if (SpotShadowVSMCacheLayer) { SpotShadowVSMCacheLayer->Release(); SpotShadowVSMCacheLayer = nullptr; }
+	if (PointShadowCacheLayer) { PointShadowCacheLayer->Release(); PointShadowCacheLayer = nullptr; }
+	if (PointShadowVSMCacheLayer) { PointShadowVSMCacheLayer->Release(); PointShadowVSMCacheLayer = nullptr; }
+
+	for (FShadowCacheEntry& Entry : SpotShadowCache)
+	{
+		Entry.bCacheLayerValid = false;
+	}
+	for (FShadowCacheEntry& Entry : PointShadowCache)
+	{
+		Entry.bCacheLayerValid = false;
+	}
+}
+
+void FShadowSystem::StoreSpotShadowCacheLayer(D3D11RHI* RHIDevice, uint32 Slot, bool bUseVSM)
+{
+	bool bRecreated = EnsureShadowCacheLayer(RHIDevice, SpotShadowMapTextureArray, SpotShadowCacheLayer);
+	if (bUseVSM)
+	{
+		bRecreated |= EnsureShadowCacheLayer(RHIDevice, SpotShadowVSMTextureArray, SpotShadowVSMCacheLayer);
+	}
+	if (bRecreated)
+	{
+		for (FShadowCacheEntry& Entry : SpotShadowCache)
+		{
+			Entry.bCacheLayerValid = false;
+		}
+	}
+	if (!SpotShadowCacheLayer || (bUseVSM && !SpotShadowVSMCacheLayer))
+		return;
+
+	ID3D11DeviceContext* Context = RHIDevice->GetDeviceContext();
+	const UINT Subresource = D3D11CalcSubresource(0, Slot, 1);
+	Context->CopySubresourceRegion(SpotShadowCacheLayer, Subresource, 0, 0, 0, SpotShadowMapTextureArray, Subresource, nullptr);
+	if (bUseVSM)
+	{
+		Context->CopySubresourceRegion(SpotShadowVSMCacheLayer, Subresource, 0, 0, 0, SpotShadowVSMTextureArray, Subresource, nullptr);
+	}
+	SpotShadowCache[Slot].bCacheLayerValid = true;
+}
+
+bool FShadowSystem::RestoreSpotShadowCacheLayer(D3D11RHI* RHIDevice, uint32 Slot, bool bUseVSM)
+{
+	if (!SpotShadowCache[Slot].bCacheLayerValid || !SpotShadowCacheLayer || (bUseVSM && !SpotShadowVSMCacheLayer))
+		return false;
+	// 해상도가 바뀐 뒤의 레이어는 크기가 달라 복사할 수 없음
+	if (!IsSameTextureSize(SpotShadowMapTextureArray, SpotShadowCacheLayer))
+		return false;
+
+	ID3D11DeviceContext* Context = RHIDevice->GetDeviceContext();
+	const UINT Subresource = D3D11CalcSubresource(0, Slot, 1);
+	Context->CopySubresourceRegion(SpotShadowMapTextureArray, Subresource, 0, 0, 0, SpotShadowCacheLayer, Subresource, nullptr);
+	if (bUseVSM)
+	{
+		Context->CopySubresourceRegion(SpotShadowVSMTextureArray, Subresource, 0, 0, 0, SpotShadowVSMCacheLayer, Subresource, nullptr);
+	}
+	return true;
+}
+
+void FShadowSystem::StorePointShadowCacheLayer(D3D11RHI* RHIDevice, uint32 Slot, bool bUseVSM)
+{
+	bool bRecreated = EnsureShadowCacheLayer(RHIDevice, PointShadowCubeMapTextureArray, PointShadowCacheLayer);
+	if (bUseVSM)
+	{
+		bRecreated |= EnsureShadowCacheLayer(RHIDevice, PointShadowVSMCubeMapTextureArray, PointShadowVSMCacheLayer);
+	}
+	if (bRecreated)
+	{
+		for (FShadowCacheEntry& Entry : PointShadowCache)
+		{
+			Entry.bCacheLayerValid = false;
+		}
+	}
+	if (!PointShadowCacheLayer || (bUseVSM && !PointShadowVSMCacheLayer))
+		return;
+
+	ID3D11DeviceContext* Context = RHIDevice->GetDeviceContext();
+	for (uint32 Face = 0; Face < 6; ++Face)
+	{
+		const UINT Subresource = D3D11CalcSubresource(0, Slot * 6 + Face, 1);
+		Context->CopySubresourceRegion(PointShadowCacheLayer, Subresource, 0, 0, 0, PointShadowCubeMapTextureArray, Subresource, nullptr);
+		if (bUseVSM)
+		{
+			Context->CopySubresourceRegion(PointShadowVSMCacheLayer, Subresource, 0, 0, 0, PointShadowVSMCubeMapTextureArray, Subresource, nullptr);
+		}
+	}
+	PointShadowCache[Slot].bCacheLayerValid = true;
+}
+
+bool FShadowSystem::RestorePointShadowCacheLayer(D3D11RHI* RHIDevice, uint32 Slot, bool bUseVSM)
+{
+	if (!PointShadowCache[Slot].bCacheLayerValid || !PointShadowCacheLayer || (bUseVSM && !PointShadowVSMCacheLayer))
+		return false;
+	// 해상도가 바뀐 뒤의 레이어는 크기가 달라 복사할 수 없음
+	if (!IsSameTextureSize(PointShadowCubeMapTextureArray, PointShadowCacheLayer))
+		return false;
+
+	ID3D11DeviceContext* Context = RHIDevice->GetDeviceContext();
+	for (uint32 Face = 0; Face < 6; ++Face)
+	{
+		const UINT Subresource = D3D11CalcSubresource(0, Slot * 6 + Face, 1);
+		Context->CopySubresourceRegion(PointShadowCubeMapTextureArray, Subresource, 0, 0, 0, PointShadowCacheLayer, Subresource, nullptr);
+		if (bUseVSM)
+		{
+			Context->CopySubresourceRegion(PointShadowVSMCubeMapTextureArray, Subresource, 0, 0, 0, PointShadowVSMCacheLayer, Subresource, nullptr);
+		}
+	}
+	return true;
+}
@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "LightManager.h"
 #include "ConstantBufferType.h"
+#include "RenderSettings.h"
+#include "BoundingSphere.h"
 #define MAX_SPOT_LIGHT_SHADOWED 5
 #define MAX_POINT_LIGHT_SHADOWED 5
 #define SHADOW_TEXTURE_RESOLUTION 1024
@@ -14,8 +16,21 @@ struct FViewportInfo
 	uint32 SizeY;
 };
 
+/** Spot/Point 섀도우 맵 슬롯 하나의 캐시 상태 (슬롯 인덱스 = 섀도우 맵 배열 인덱스) */
+struct FShadowCacheEntry
+{
+	const void* Light = nullptr;	// 이 슬롯을 마지막으로 그린 라이트
+	uint64 StateHash = 0;			// 라이트 행렬, near/far, 해상도, 필터 모드
+	uint64 CasterHash = 0;			// 캐시된 맵에 그려진 캐스터 집합 (DYNAMIC 모드는 정적 캐스터만)
+	FBoundingSphere Bounds;			// 라이트 영향 범위: 무효화 영역과 겹치면 다시 그림
+	bool bValid = false;
+	bool bCacheLayerValid = false;	// DYNAMIC 모드: 정적 캐스터만 그린 결과가 캐시 레이어에 복사되어 있음
+	bool bHasOverlay = false;		// DYNAMIC 모드: 라이브 맵에 동적 캐스터가 덧그려져 있어 다음에 캐시 레이어 복원이 필요
+};
+
 class FSceneView;
 struct FViewportRect;
+struct FShadowCasterInvalidation;
 class D3D11RHI;
 //struct FShadowBufferType;
 class FShadowSystem
@@ -100,6 +115,25 @@ public:
     void SetPointShadowTextureResolution(D3D11RHI* InDevice, uint32 NewResolution);
     void SetDirectionalShadowTextureResolution(D3D11RHI* InDevice, uint32 NewResolution);
 
+	// --- Spot/Point 섀도우 맵 캐시 ---
+	// 모드가 바뀌면 캐시 전체를 무효화. NONE이 아니면 UpdateShadowIndex가 Spot/Point 맵을 지우지 않음
+	void SetShadowCacheMode(EShadowCacheMode InMode);
+	EShadowCacheMode GetShadowCacheMode() const { return ShadowCacheMode; }
+	FShadowCacheEntry& GetSpotShadowCacheEntry(uint32 Slot) { return SpotShadowCache[Slot]; }
+	FShadowCacheEntry& GetPointShadowCacheEntry(uint32 Slot) { return PointShadowCache[Slot]; }
+	void InvalidateAllShadowCache();
+	// 무효화 영역과 라이트 범위가 겹치는 슬롯을 무효화 (bIgnoreMovingCasters: 동적 레이어로 그리는 캐스터의 영역은 건너뜀)
+	void InvalidateShadowCache(const TArray<FShadowCasterInvalidation>& InInvalidations, bool bIgnoreMovingCasters);
+	// Spot/Point 섀도우 맵을 모두 지움 (bClearMoments: VSM 모멘트 텍스처까지)
+	void ClearLocalLightShadowMaps(D3D11RHI* RHIDevice, bool bClearMoments);
+
+	// DYNAMIC 모드 캐시 레이어: 라이브 맵 <-> 정적 캐스터만 그린 복사본
+	// Restore는 슬롯의 캐시 레이어가 유효하지 않으면 false (호출자가 다시 그려야 함)
+	void StoreSpotShadowCacheLayer(D3D11RHI* RHIDevice, uint32 Slot, bool bUseVSM);
+	bool RestoreSpotShadowCacheLayer(D3D11RHI* RHIDevice, uint32 Slot, bool bUseVSM);
+	void StorePointShadowCacheLayer(D3D11RHI* RHIDevice, uint32 Slot, bool bUseVSM);
+	bool RestorePointShadowCacheLayer(D3D11RHI* RHIDevice, uint32 Slot, bool bUseVSM);
+
 	////////////////////////아틀라스 전용/////////////////////
 	//Viewport 정보 받아서 Offset 채워줌
 	void CalculateAtlasOffset(FViewportInfo& ViewportInfo);
@@ -181,6 +215,22 @@ private:
 	uint32 NumSpotShadow = 0;
 	uint32 NumPointShadow = 0;
 
+	// --- 섀도우 맵 캐시 ---
+	// 라이브 텍스처와 같은 포맷/해상도의 복사 대상 (바인딩 없음). 처음 필요할 때 만들고 해상도가 바뀌면 다시 만듦
+	// 새로 만들었으면 true: 이전 레이어에 복사해 둔 슬롯들은 더 이상 복원할 수 없음
+	bool EnsureShadowCacheLayer(D3D11RHI* RHIDevice, ID3D11Texture2D* InLiveTexture, ID3D11Texture2D*& InOutCacheTexture);
+	static bool IsSameTextureSize(ID3D11Texture2D* A, ID3D11Texture2D* B);
+	void ReleaseShadowCacheLayers();
+
+	EShadowCacheMode ShadowCacheMode = EShadowCacheMode::STATIC;
+	FShadowCacheEntry SpotShadowCache[MAX_SPOT_LIGHT_SHADOWED];
+	FShadowCacheEntry PointShadowCache[MAX_POINT_LIGHT_SHADOWED];
+
+	ID3D11Texture2D* SpotShadowCacheLayer = nullptr;
+	ID3D11Texture2D* SpotShadowVSMCacheLayer = nullptr;
+	ID3D11Texture2D* PointShadowCacheLayer = nullptr;
+	ID3D11Texture2D* PointShadowVSMCacheLayer = nullptr;
+
 	FShadowBufferType ShadowBufferData; // 상수버퍼로 할당한 데이터 용+ cpu에서도 ShadowIndex에 해당하는 ShadowInfo를 얻는 용도
 
 	////////////////////////아틀라스 전용/////////////////////
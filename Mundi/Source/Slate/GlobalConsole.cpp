@@ -43,6 +43,10 @@ void UGlobalConsole::Log(const char* fmt, ...)
 
 void UGlobalConsole::LogV(const char* fmt, va_list args)
 {
+    // 잡 시스템 워커에서도 로그를 남기므로 콘솔 버퍼 접근을 직렬화
+    static std::mutex LogMutex;
+    std::lock_guard<std::mutex> Lock(LogMutex);
+
     if (ConsoleWidget)
     {
         ConsoleWidget->VAddLog(fmt, args);
@@ -14,6 +14,8 @@
 #include "Picking.h"
 #include "PlatformTime.h"
 #include "DecalStatManager.h"
+#include "CullingStatManager.h"
+#include "ShadowStatManager.h"
 #include "TileCullingStats.h"
 #include "World.h"
 #include "WorldPhysics.h"
@@ -152,7 +154,7 @@ static float CalcPanelHeightForText(IDWriteFactory* Dwrite, const wchar_t* InTex
 void UStatsOverlayD2D::Draw()
 {
 	if (!bInitialized
-		|| (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowShadowInfo && !bShowPhysics)
+		|| (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowShadowInfo && !bShowPhysics && !bShowCulling)
 		|| !SwapChain)
 		return;
 
@@ -278,18 +280,54 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(CMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		constexpr double ToMb = 1.0 / (1024.0 * 1024.0);
+		const FMemoryStats Stats = CMemoryManager::GetStats();
+
+		wchar_t Buf[1024];
+		int Len = swprintf_s(Buf,
+			L"Memory: %.2f MB (Peak %.2f)\n"
+			L"Objects: %u (Peak %u)\n"
+			L"Slabs: %u, %.2f / %.2f MB\n"
+			L"Large: %.2f MB",
+			Stats.LiveBytes * ToMb, Stats.PeakBytes * ToMb,
+			Stats.LiveCount, Stats.PeakCount,
+			Stats.SlabCount, Stats.SlabUsedBytes * ToMb, Stats.SlabReservedBytes * ToMb,
+			Stats.LargeLiveBytes * ToMb);
+
+		// 살아있는 바이트가 많은 클래스 상위 N개 (live / peak 개수)
+		constexpr int32 MaxClassRows = 5;
+		TArray<UClass*> Classes = UClass::GetAllClasses();
+		Classes.Add(UObject::StaticClass());
+		std::sort(Classes.begin(), Classes.end(), [](const UClass* A, const UClass* B)
+		{
+			return A->MemoryStats.LiveBytes.load(std::memory_order_relaxed) > B->MemoryStats.LiveBytes.load(std::memory_order_relaxed);
+		});
 
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, CMemoryManager::TotalAllocationCount);
+		int32 ClassRows = 0;
+		for (const UClass* Class : Classes)
+		{
+			if (ClassRows >= MaxClassRows || Len < 0)
+				break;
+
+			const int32 LiveCount = Class->MemoryStats.LiveCount.load(std::memory_order_relaxed);
+			if (LiveCount <= 0)
+				break;
+
+			Len += swprintf_s(Buf + Len, _countof(Buf) - Len, L"\n%hs: %d / %d, %.2f MB",
+				Class->Name, LiveCount, Class->MemoryStats.PeakCount.load(std::memory_order_relaxed),
+				Class->MemoryStats.LiveBytes.load(std::memory_order_relaxed) * ToMb);
+			++ClassRows;
+		}
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		const float MemoryPanelHeight = 24.0f * (4 + ClassRows) + 8.0f;
+		const float MemoryPanelWidth = PanelWidth + 80.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + MemoryPanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(
 			D2dCtx, Dwrite, Buf, Rc, 16.0f,
 			D2D1::ColorF(0, 0, 0, 0.6f),
 			D2D1::ColorF(D2D1::ColorF::LightGreen));
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowPhysics)
@@ -318,6 +356,44 @@ void UStatsOverlayD2D::Draw()
 		NextY += PhysicsPanelHeight + Space;
 	}
 
+	if (bShowCulling)
+	{
+		const FCullingStatManager& CullingStats = FCullingStatManager::GetInstance();
+		const uint32 Total = CullingStats.GetTotalPrimitiveCount();
+		const uint32 Visible = CullingStats.GetVisiblePrimitiveCount();
+		const uint32 Culled = CullingStats.GetCulledPrimitiveCount();
+		const double CulledRatio = (Total > 0) ? (100.0 * Culled / Total) : 0.0;
+
+		// 이번 프레임에 RHI로 제출된 드로우/상태 변경 (BeginFrame에서 초기화)
+		FRHICommandStats CommandStats;
+		if (URenderer* Renderer = URenderManager::GetInstance().GetRenderer())
+		{
+			CommandStats = Renderer->GetRHIDevice()->GetCommandStats();
+		}
+
+		wchar_t Buf[384];
+		swprintf_s(Buf, L"[Frustum Culling]\nTotal: %u\nVisible: %u\nCulled: %u (%.1f%%)\nOpaque Batches: %u\nInstances: %u (-%u draws)\nCull+Gather: %.3f ms\nDraw Calls: %u\nState Changes: %u",
+			Total,
+			Visible,
+			Culled,
+			CulledRatio,
+			CullingStats.GetOpaqueBatchCount(),
+			CullingStats.GetInstanceCount(),
+			CullingStats.GetMergedBatchCount(),
+			CullingStats.GetCullingTimeMS(),
+			CommandStats.DrawCalls,
+			CommandStats.GetStateChangeCount());
+
+		const float CullingPanelHeight = 200.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + CullingPanelHeight);
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, Rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Plum));
+
+		NextY += CullingPanelHeight + Space;
+	}
+
 	if (bShowDecal)
 	{
 		// 1. FDecalStatManager로부터 통계 데이터를 가져옵니다.
@@ -443,42 +519,85 @@ void UStatsOverlayD2D::Draw()
         NextY += panelHeight + Space;
     }
 
-  //  if (bShowShadowInfo)
-  //  {
-		//// TODO: Shadow 관련 사용된 메모리량, 라이트 종류 별 개수 등 출력
-
-		//
-		//wchar_t Buf[256];
-
-		//// PointLight, SpotLight, DirectionalLight 개수
-		//FLightManager* LightManager = GWorld->GetLightManager();
-
-		//const uint32 PointLightCount = LightManager->GetPointLightCount();
-		//const uint32 SpotLightCount = LightManager->GetSpotLightCount();
+	if (bShowShadowInfo)
+	{
+		const FShadowStatManager& ShadowStats = FShadowStatManager::GetInstance();
+		const TArray<FShadowCasterStat>& CasterStats = ShadowStats.GetCasterStats();
+		const uint32 TotalDraws = ShadowStats.GetTotalDrawCount();
+		const uint32 UnculledDraws = ShadowStats.GetUnculledDrawCount();
+		const double SavedRatio = (UnculledDraws > 0) ? (100.0 * (UnculledDraws - TotalDraws) / UnculledDraws) : 0.0;
+
+		// 섀도우 캐시: Spot/Point 라이트 중 이전 결과를 재사용한 수
+		uint32 LocalLightCount = 0;
+		uint32 CachedLightCount = 0;
+		for (const FShadowCasterStat& Stat : CasterStats)
+		{
+			if (Stat.LightType == ELightType::SpotLight || Stat.LightType == ELightType::PointLight)
+			{
+				++LocalLightCount;
+				CachedLightCount += Stat.bCached ? 1 : 0;
+			}
+		}
 
-		//swprintf_s(Buf, L"[Shadow Info]\nPoint Lights: %u\nSpot Lights: %u\nDirectional Lights: %u\n\nPoint Lights Tex Count: %u\nSpot Lights Tex Count: %u\nDirectional Lights Tex Count: %u",
-		//	PointLightCount,
-		//	SpotLightCount,
-		//	1,
-		//	PointLightCount * 6,
-		//	SpotLightCount,
-		//	1
-		//);
+		wchar_t Line[192];
+		swprintf_s(Line, L"[Shadow Casters]\nCandidates: %u (Batches: %u)\nShadow Draws: %u / %u (-%.1f%%)\nPasses: %u\nCached Lights: %u / %u",
+			ShadowStats.GetCandidateCasterCount(),
+			ShadowStats.GetCandidateBatchCount(),
+			TotalDraws,
+			UnculledDraws,
+			SavedRatio,
+			static_cast<uint32>(CasterStats.Num()),
+			CachedLightCount,
+			LocalLightCount);
+		std::wstring Text = Line;
+
+		// 라이트가 많으면 패널이 화면을 덮으므로 앞쪽 일부만 표시
+		constexpr int32 MaxListedPasses = 12;
+		for (int32 Index = 0; Index < CasterStats.Num() && Index < MaxListedPasses; ++Index)
+		{
+			const FShadowCasterStat& Stat = CasterStats[Index];
+			switch (Stat.LightType)
+			{
+			case ELightType::DirectionalLight:
+				if (Stat.SubIndex >= 0)
+				{
+					swprintf_s(Line, L"\n  CSM %d: %u casters, %u draws", Stat.SubIndex, Stat.CasterCount, Stat.DrawCount);
+				}
+				else
+				{
+					swprintf_s(Line, L"\n  Directional: %u casters, %u draws", Stat.CasterCount, Stat.DrawCount);
+				}
+				break;
+			case ELightType::SpotLight:
+				swprintf_s(Line, L"\n  Spot: %u casters, %u draws%s", Stat.CasterCount, Stat.DrawCount, Stat.bCached ? L" [cached]" : L"");
+				break;
+			case ELightType::PointLight:
+				swprintf_s(Line, L"\n  Point: %u casters, %u draws (6 faces)%s", Stat.CasterCount, Stat.DrawCount, Stat.bCached ? L" [cached]" : L"");
+				break;
+			default:
+				swprintf_s(Line, L"\n  Light: %u casters, %u draws", Stat.CasterCount, Stat.DrawCount);
+				break;
+			}
+			Text += Line;
+		}
+		if (CasterStats.Num() > MaxListedPasses)
+		{
+			swprintf_s(Line, L"\n  ... +%d more", static_cast<int32>(CasterStats.Num()) - MaxListedPasses);
+			Text += Line;
+		}
 
-		//// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
-  //      const float fontSize = 16.0f;
-  //      const float minHeight = 140.0f;
-  //      const float ShadowPanelHeight = CalcPanelHeightForText(Dwrite, Buf, fontSize, PanelWidth, minHeight);
-  //      D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + ShadowPanelHeight);
+		const float fontSize = 16.0f;
+		const float minHeight = 96.0f;
+		const float ShadowPanelHeight = CalcPanelHeightForText(Dwrite, Text.c_str(), fontSize, PanelWidth, minHeight);
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + ShadowPanelHeight);
 
-		//// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 주황색(Orange)으로 설정합니다.
-		//DrawTextBlock(
-  //          D2dCtx, Dwrite, Buf, rc, fontSize,
-  //          D2D1::ColorF(0, 0, 0, 0.6f),
-  //          D2D1::ColorF(D2D1::ColorF::Orange));
+		DrawTextBlock(
+			D2dCtx, Dwrite, Text.c_str(), rc, fontSize,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Khaki));
 
-  //      NextY += ShadowPanelHeight + Space;
-  //  }
+		NextY += ShadowPanelHeight + Space;
+	}
 
 	D2dCtx->EndDraw();
 	D2dCtx->SetTarget(nullptr);
@@ -547,6 +666,11 @@ void UStatsOverlayD2D::SetShowPhysics(bool b)
 	bShowPhysics = b;
 }
 
+void UStatsOverlayD2D::SetShowCulling(bool b)
+{
+	bShowCulling = b;
+}
+
 void UStatsOverlayD2D::ToggleTileCulling()
 {
 	bShowTileCulling = !bShowTileCulling;
@@ -562,4 +686,7 @@ void UStatsOverlayD2D::TogglePhysics()
 	bShowPhysics = !bShowPhysics;
 }
 
-
+void UStatsOverlayD2D::ToggleCulling()
+{
+	bShowCulling = !bShowCulling;
+}
\ No newline at end of file
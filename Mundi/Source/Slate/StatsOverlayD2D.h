@@ -19,6 +19,7 @@ public:
     void SetShowTileCulling(bool b);
 	void SetShowShadowInfo(bool b);
     void SetShowPhysics(bool b);
+    void SetShowCulling(bool b);
 	void ToggleFPS();
     void ToggleMemory();
     void TogglePicking();
@@ -26,6 +27,7 @@ public:
     void ToggleTileCulling();
 	void ToggleShadowInfo();
     void TogglePhysics();
+    void ToggleCulling();
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -33,6 +35,7 @@ public:
     bool IsTileCullingVisible() const { return bShowTileCulling; }
 	bool IsShadowInfoVisible() const { return bShowShadowInfo; }
     bool IsPhysicsVisible() const { return bShowPhysics; }
+    bool IsCullingVisible() const { return bShowCulling; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -52,6 +55,7 @@ private:
     bool bShowTileCulling = false;
 	bool bShowShadowInfo = true;
     bool bShowPhysics = false;
+    bool bShowCulling = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
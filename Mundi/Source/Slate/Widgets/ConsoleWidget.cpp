@@ -52,9 +52,18 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT PHYSICS");
+	HelpCommandList.Add("STAT CULLING");
     HelpCommandList.Add("SHADOW_FILTER NONE");
     HelpCommandList.Add("SHADOW_FILTER PCF");
     HelpCommandList.Add("SHADOW_FILTER VSM");
+    HelpCommandList.Add("SHADOW_CACHE NONE");
+    HelpCommandList.Add("SHADOW_CACHE STATIC");
+    HelpCommandList.Add("SHADOW_CACHE DYNAMIC");
+    HelpCommandList.Add("SORT_OPAQUE STATE");
+    HelpCommandList.Add("SORT_OPAQUE FRONT_TO_BACK");
+    HelpCommandList.Add("SORT_TRANSLUCENT BACK_TO_FRONT");
+    HelpCommandList.Add("INSTANCING ON");
+    HelpCommandList.Add("INSTANCING OFF");
 	HelpCommandList.Add("STAT SHADOW");
 
 	// Add welcome messages
@@ -281,6 +290,7 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT PICKING");
 		AddLog("- STAT DECAL");
 		AddLog("- STAT PHYSICS");
+		AddLog("- STAT CULLING");
 		AddLog("- STAT ALL");
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT NONE");
@@ -310,6 +320,11 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().TogglePhysics();
 		AddLog("STAT PHYSICS TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT CULLING") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleCulling();
+		AddLog("STAT CULLING TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT LIGHT") == 0)
 	{
 		UStatsOverlayD2D::Get().ToggleTileCulling();
@@ -329,6 +344,7 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowPhysics(true);
 		UStatsOverlayD2D::Get().SetShowTileCulling(true);
 		UStatsOverlayD2D::Get().SetShowShadowInfo(true);
+		UStatsOverlayD2D::Get().SetShowCulling(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
@@ -340,6 +356,7 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowPhysics(false);
 		UStatsOverlayD2D::Get().SetShowTileCulling(false);
 		UStatsOverlayD2D::Get().SetShowShadowInfo(false);
+		UStatsOverlayD2D::Get().SetShowCulling(false);
 		AddLog("STAT: OFF");
 	}
 	else
@@ -383,6 +400,99 @@ void UConsoleWidget::ExecCommand(const char* command_line)
                     AddLog("Unknown SHADOW_FILTER argument. Use NONE, PCF or VSM.");
                 }
             }
+        }
+        // Shadow cache command: SHADOW_CACHE <NONE|STATIC|DYNAMIC>
+        else if (Strnicmp(command_line, "SHADOW_CACHE", 12) == 0)
+        {
+            const char* arg = command_line + 12;
+            while (*arg == ' ') ++arg;
+            if (*arg == 0)
+            {
+                AddLog("Usage: SHADOW_CACHE NONE|STATIC|DYNAMIC");
+            }
+            else
+            {
+                bool bHandled = false;
+                UWorld* World = GWorld;
+                if (World)
+                {
+                    if (Stricmp(arg, "NONE") == 0)
+                    {
+                        World->GetRenderSettings().SetShadowCacheMode(EShadowCacheMode::NONE);
+                        AddLog("Shadow cache set to NONE");
+                        bHandled = true;
+                    }
+                    else if (Stricmp(arg, "STATIC") == 0)
+                    {
+                        World->GetRenderSettings().SetShadowCacheMode(EShadowCacheMode::STATIC);
+                        AddLog("Shadow cache set to STATIC");
+                        bHandled = true;
+                    }
+                    else if (Stricmp(arg, "DYNAMIC") == 0)
+                    {
+                        World->GetRenderSettings().SetShadowCacheMode(EShadowCacheMode::DYNAMIC);
+                        AddLog("Shadow cache set to DYNAMIC");
+                        bHandled = true;
+                    }
+                }
+                if (!bHandled)
+                {
+                    AddLog("Unknown SHADOW_CACHE argument. Use NONE, STATIC or DYNAMIC.");
+                }
+            }
+        }
+        // Draw order commands: SORT_OPAQUE|SORT_TRANSLUCENT <STATE|FRONT_TO_BACK|BACK_TO_FRONT>
+        else if (Strnicmp(command_line, "SORT_OPAQUE", 11) == 0 || Strnicmp(command_line, "SORT_TRANSLUCENT", 16) == 0)
+        {
+            const bool bOpaque = Strnicmp(command_line, "SORT_OPAQUE", 11) == 0;
+            const char* arg = command_line + (bOpaque ? 11 : 16);
+            while (*arg == ' ') ++arg;
+
+            bool bHandled = false;
+            EMeshSortMode Mode = EMeshSortMode::STATE;
+            if (Stricmp(arg, "STATE") == 0) { Mode = EMeshSortMode::STATE; bHandled = true; }
+            else if (Stricmp(arg, "FRONT_TO_BACK") == 0) { Mode = EMeshSortMode::FRONT_TO_BACK; bHandled = true; }
+            else if (Stricmp(arg, "BACK_TO_FRONT") == 0) { Mode = EMeshSortMode::BACK_TO_FRONT; bHandled = true; }
+
+            UWorld* World = GWorld;
+            if (!bHandled || !World)
+            {
+                AddLog("Usage: %s STATE|FRONT_TO_BACK|BACK_TO_FRONT", bOpaque ? "SORT_OPAQUE" : "SORT_TRANSLUCENT");
+            }
+            else
+            {
+                if (bOpaque)
+                {
+                    World->GetRenderSettings().SetOpaqueSortMode(Mode);
+                }
+                else
+                {
+                    World->GetRenderSettings().SetTranslucentSortMode(Mode);
+                }
+                AddLog("%s set to %s", bOpaque ? "Opaque sort" : "Translucent sort", arg);
+            }
+        }
+        // Hardware instancing command: INSTANCING <ON|OFF>
+        else if (Strnicmp(command_line, "INSTANCING", 10) == 0)
+        {
+            const char* arg = command_line + 10;
+            while (*arg == ' ') ++arg;
+
+            UWorld* World = GWorld;
+            if (World && Stricmp(arg, "ON") == 0)
+            {
+                World->GetRenderSettings().SetMeshInstancingEnabled(true);
+                AddLog("Mesh instancing enabled");
+            }
+            else if (World && Stricmp(arg, "OFF") == 0)
+            {
+                World->GetRenderSettings().SetMeshInstancingEnabled(false);
+                AddLog("Mesh instancing disabled");
+            }
+            else
+            {
+                AddLog("Usage: INSTANCING ON|OFF");
+            }
         }
 		else
 		{
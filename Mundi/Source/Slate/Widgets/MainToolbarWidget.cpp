@@ -577,13 +577,8 @@ void UMainToolbarWidget::OnLoadScene()
         UUIManager::GetInstance().ClearTransformWidgetSelection();
         GWorld->GetSelectionManager()->ClearSelection();
 
-        std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-        JSON LevelJsonData;
-        if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, InFilePath))
-        {
-            NewLevel->Serialize(true, LevelJsonData);
-        }
-        else
+        std::unique_ptr<ULevel> NewLevel = ULevelService::LoadLevel(InFilePath);
+        if (!NewLevel)
         {
             UE_LOG("MainToolbar: Failed To Load Level From: %s", InFilePath.c_str());
             return;
@@ -110,6 +110,8 @@ bool UPropertyRenderer::RenderProperty(const FProperty& Property, void* ObjectIn
 	// SceneComponent는 Transform 프로퍼티가 변경되면 Setter를 통해 동기화
 	if (bChanged && ObjectInstance)
 	{
+		GWorld->MarkLevelEdited();
+
 		UObject* Obj = static_cast<UObject*>(ObjectInstance);
 		if (USceneComponent* SceneComponent = Cast<USceneComponent>(Obj))
 		{
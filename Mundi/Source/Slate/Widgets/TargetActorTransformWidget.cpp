@@ -3,6 +3,7 @@
 #include "TargetActorTransformWidget.h"
 #include "UIManager.h"
 #include "ImGui/imgui.h"
+#include "ImGui/imgui_internal.h"
 #include "Vector.h"
 #include "World.h"
 #include "ResourceManager.h"
@@ -473,6 +474,12 @@ void UTargetActorTransformWidget::RenderWidget()
 	{
 		RenderSelectedComponentDetails(GWorld->GetSelectionManager()->GetSelectedActorComponent());
 	}
+
+	// 디테일 패널의 개별 위젯(Shape 크기, 스크립트 경로 등)으로 값이 바뀐 프레임이면 PIE 스냅샷 무효화
+	if (ImGui::GetCurrentContext()->ActiveIdHasBeenEditedThisFrame)
+	{
+		GWorld->MarkLevelEdited();
+	}
 }
 
 void UTargetActorTransformWidget::RenderHeader(AActor* SelectedActor, UActorComponent* SelectedComponent)
@@ -1927,6 +1927,33 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
             ImGui::SetTooltip("그림자 필터 모드 선택");
         }
 
+        // 그림자 캐시 (Spot/Point 섀도우 맵 재사용)
+        if (ImGui::BeginMenu("그림자 캐시"))
+        {
+            ImGui::TextColored(ImVec4(0.6f, 0.6f, 0.6f, 1.0f), "그림자 캐시 모드");
+            ImGui::Separator();
+
+        	EShadowCacheMode cacheMode = RenderSettings.GetShadowCacheMode();
+        	bool bCacheNone    = (cacheMode == EShadowCacheMode::NONE);
+        	bool bCacheStatic  = (cacheMode == EShadowCacheMode::STATIC);
+        	bool bCacheDynamic = (cacheMode == EShadowCacheMode::DYNAMIC);
+
+        	if (ImGui::Checkbox(" NONE##ShadowCache", &bCacheNone)) { if (bCacheNone) RenderSettings.SetShadowCacheMode(EShadowCacheMode::NONE); }
+        	if (ImGui::IsItemHovered())  ImGui::SetTooltip("매 프레임 모든 섀도우 맵을 다시 그림");
+
+        	if (ImGui::Checkbox(" STATIC##ShadowCache", &bCacheStatic)) { if (bCacheStatic) RenderSettings.SetShadowCacheMode(EShadowCacheMode::STATIC); }
+        	if (ImGui::IsItemHovered())  ImGui::SetTooltip("라이트나 범위 안의 캐스터가 바뀐 섀도우 맵만 다시 그림");
+
+        	if (ImGui::Checkbox(" DYNAMIC##ShadowCache", &bCacheDynamic)) { if (bCacheDynamic) RenderSettings.SetShadowCacheMode(EShadowCacheMode::DYNAMIC); }
+        	if (ImGui::IsItemHovered())  ImGui::SetTooltip("정적 캐스터는 캐시에서 복사하고 움직이는 캐스터만 매 프레임 덧그림");
+
+            ImGui::EndMenu();
+        }
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("그림자 캐시 모드 선택");
+        }
+
         // Directional Shadow Resolution (moved below filter)
         if (ImGui::BeginMenu("다이렉셔널 해상도"))
         {
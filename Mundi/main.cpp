@@ -1,5 +1,13 @@
 ﻿#include "pch.h"
 #include "EditorEngine.h"
+#include "SpatialBenchmark.h"
+#include "QueueBenchmark.h"
+#include "ObjectIteratorBenchmark.h"
+#include "SceneDeserializeBenchmark.h"
+#include "DelegateBenchmark.h"
+#include "ObjImportBenchmark.h"
+#include "RenderBenchmark.h"
+#include "CommandLineOptions.h"
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 #   define _CRTDBG_MAP_ALLOC
@@ -7,6 +15,44 @@
 #   include <crtdbg.h>
 #endif
 
+namespace
+{
+    // 설정을 커맨드라인에서 채운 뒤 벤치마크 하나를 실행. 결과가 유효하고 저장까지 끝났으면 true
+    template<typename TBenchmark, typename TConfig>
+    bool RunBenchmark(const FString& InCmdLine)
+    {
+        TConfig Config;
+        TBenchmark::ParseCommandLine(InCmdLine, Config);
+        TBenchmark Benchmark(Config);
+        return Benchmark.Run();
+    }
+
+    struct FBenchmarkMode
+    {
+        const char* Flag;
+        bool (*Run)(const FString& InCmdLine);
+    };
+
+    // 커맨드라인에 플래그가 있으면 에디터 루프 없이 해당 벤치마크만 돌리고 종료. 먼저 나온 항목이 우선
+    const FBenchmarkMode BenchmarkModes[] =
+    {
+        // Bus.Scene을 반복 렌더링해 패스별 CPU 시간과 드로우/상태 변경 횟수를 기록
+        { "RenderBenchmark", &RunBenchmark<FRenderBenchmark, FRenderBenchmarkConfig> },
+        // 공간 분할 / 충돌 벤치마크
+        { "SpatialBenchmark", &RunBenchmark<FSpatialBenchmark, FSpatialBenchmarkConfig> },
+        // TQueue 모드별 락프리 구현과 mutex 큐의 처리량 비교
+        { "QueueBenchmark", &RunBenchmark<FQueueBenchmark, FQueueBenchmarkConfig> },
+        // 클래스별 인스턴스 목록 기반 TObjectIterator와 전체 스캔 비교
+        { "ObjectIteratorBenchmark", &RunBenchmark<FObjectIteratorBenchmark, FObjectIteratorBenchmarkConfig> },
+        // 씬 로드 시 클래스 검색 / 프로퍼티 테이블 조회를 선형 검색과 레지스트리로 비교
+        { "SceneDeserializeBenchmark", &RunBenchmark<FSceneDeserializeBenchmark, FSceneDeserializeBenchmarkConfig> },
+        // 힙 바인딩 방식과 인라인 저장 TMultiCastDelegate의 Broadcast / 제거 비용 비교
+        { "DelegateBenchmark", &RunBenchmark<FDelegateBenchmark, FDelegateBenchmarkConfig> },
+        // 기존 istringstream OBJ 파서와 메모리 매핑 / 청크 병렬 파서의 파싱 시간 비교
+        { "ObjImportBenchmark", &RunBenchmark<FObjImportBenchmark, FObjImportBenchmarkConfig> },
+    };
+}
+
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nShowCmd)
 {
 #if defined(_MSC_VER) && defined(_DEBUG)
@@ -17,9 +63,27 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     _CrtSetBreakAlloc(0);
 #endif
 
+    // -RenderBenchmark는 기본적으로 창 없이 Null RHI에서 실행되므로 엔진 초기화 전에 해석한다
+    // -NullRHI: 다른 벤치마크 모드도 GPU/화면 없이 실행
+    const FString CmdLine = lpCmdLine ? lpCmdLine : "";
+    FRenderBenchmarkConfig RenderBenchmarkConfig;
+    const bool bRenderBenchmark = FRenderBenchmark::ParseCommandLine(CmdLine, RenderBenchmarkConfig);
+    GEngine.SetNullRHI(bRenderBenchmark ? RenderBenchmarkConfig.bNullRHI : FCommandLine::HasFlag(CmdLine, "NullRHI"),
+        RenderBenchmarkConfig.bD3DNullDriver);
+
     if (!GEngine.Startup(hInstance))
         return -1;
 
+    for (const FBenchmarkMode& Mode : BenchmarkModes)
+    {
+        if (FCommandLine::HasFlag(CmdLine, Mode.Flag))
+        {
+            const bool bSucceeded = Mode.Run(CmdLine);
+            GEngine.Shutdown();
+            return bSucceeded ? 0 : 1;
+        }
+    }
+
     GEngine.MainLoop();
     GEngine.Shutdown();
 
@@ -36,6 +36,10 @@
 #include <filesystem>
 #include <sstream>
 #include <iterator>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 // Windows & DirectX
 #include <windows.h>